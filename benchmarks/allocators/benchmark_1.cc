@@ -66,6 +66,7 @@ struct string {
 	typedef std::basic_string<char, std::char_traits<char>, alloc_adaptors<char>::multipool> multipool;
 	typedef std::basic_string<char, std::char_traits<char>, alloc_adaptors<char>::newdel> newdel;
 	typedef std::basic_string<char, std::char_traits<char>, alloc_adaptors<char>::polymorphic> polymorphic;
+	typedef std::basic_string<char, std::char_traits<char>, alloc_adaptors<char>::static_monotonic> static_monotonic;
 };
 
 struct containers {
@@ -115,18 +116,22 @@ struct combined_containers {
 	typedef alloc_containers::DS1<alloc_adaptors<int>::monotonic> DS1_mono;
 	typedef alloc_containers::DS1<alloc_adaptors<int>::multipool> DS1_multi;
 	typedef alloc_containers::DS1<alloc_adaptors<int>::polymorphic> DS1_poly;
+	typedef alloc_containers::DS1<alloc_adaptors<int>::static_monotonic> DS1_static;
 
 	typedef alloc_containers::DS2<string::monotonic, alloc_adaptors<string::monotonic>::monotonic> DS2_mono;
 	typedef alloc_containers::DS2<string::multipool, alloc_adaptors<string::multipool>::multipool> DS2_multi;
 	typedef alloc_containers::DS2<string::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic> DS2_poly;
+	typedef alloc_containers::DS2<string::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic> DS2_static;
 
 	typedef alloc_containers::DS3<alloc_adaptors<int>::monotonic> DS3_mono;
 	typedef alloc_containers::DS3<alloc_adaptors<int>::multipool> DS3_multi;
 	typedef alloc_containers::DS3<alloc_adaptors<int>::polymorphic> DS3_poly;
+	typedef alloc_containers::DS3<alloc_adaptors<int>::static_monotonic> DS3_static;
 	
 	typedef alloc_containers::DS4<string::monotonic, alloc_adaptors<string::monotonic>::monotonic> DS4_mono;
 	typedef alloc_containers::DS4<string::multipool, alloc_adaptors<string::multipool>::multipool> DS4_multi;
 	typedef alloc_containers::DS4<string::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic> DS4_poly;
+	typedef alloc_containers::DS4<string::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic> DS4_static;
 
 };
 
@@ -317,7 +322,7 @@ struct process_DS12 {
 };
 
 
-template<typename GLOBAL_CONT, typename MONO_CONT, typename MULTI_CONT, typename POLY_CONT, template<typename CONT> class PROCESSER>
+template<typename GLOBAL_CONT, typename MONO_CONT, typename MULTI_CONT, typename POLY_CONT, typename STATIC_CONT, template<typename CONT> class PROCESSER>
 static void run_base_allocations(unsigned long long iterations, size_t elements) {
 	// TODO: 
 	// 6) For DS9-12, inner containers must be constructed and then passed in (thus incuring the copy/move cost) because contents of a set can't be modified
@@ -676,6 +681,31 @@ static void run_base_allocations(unsigned long long iterations, size_t elements)
 		}
 	}
 
+#ifdef DEBUG_V1
+	std::cout << std::endl << "AS15" << std::endl;
+#endif
+
+	// AS15 - Monotonic with bslma::StaticAllocator
+	{
+		int pid = fork();
+		if (pid == 0) {
+			PROCESSER<STATIC_CONT> processer;
+			c_start = std::clock();
+			for (unsigned long long i = 0; i < iterations; i++) {
+				final_monotonic alloc(pool, sizeof(pool));
+				STATIC_CONT container(&alloc);
+				container.reserve(elements);
+				processer(&container, elements);
+			}
+			c_end = std::clock();
+			std::cout << (c_end - c_start) * 1.0 / CLOCKS_PER_SEC << " ";
+			exit(0);
+		}
+		else {
+			wait(NULL);
+		}
+	}
+
 	std::cout << std::endl;
 }
 
@@ -726,61 +756,73 @@ int main(int argc, char *argv[]) {
 		typename combined_containers::DS1_mono,
 		typename combined_containers::DS1_multi,
 		typename combined_containers::DS1_poly,
+		typename combined_containers::DS1_static,
 		process_DS1>, "**DS1**");
 	run_base_loop(&run_base_allocations<typename containers::DS2,
 		typename combined_containers::DS2_mono,
 		typename combined_containers::DS2_multi,
 		typename combined_containers::DS2_poly,
+		typename combined_containers::DS2_static,
 		process_DS2>, "**DS2**");
 	run_base_loop(&run_base_allocations<typename containers::DS3,
 		typename combined_containers::DS3_mono,
 		typename combined_containers::DS3_multi,
 		typename combined_containers::DS3_poly,
+		typename combined_containers::DS3_static,
 		process_DS3>, "**DS3**");
 	run_base_loop(&run_base_allocations<typename containers::DS4,
 		typename combined_containers::DS4_mono,
 		typename combined_containers::DS4_multi,
 		typename combined_containers::DS4_poly,
+		typename combined_containers::DS4_static,
 		process_DS4>, "**DS4**");
 	run_nested_loop(&run_base_allocations<typename containers::DS5,
 		typename alloc_containers::DS5<alloc_adaptors<combined_containers::DS1_mono>::monotonic, alloc_adaptors<int>::monotonic>,
 		typename alloc_containers::DS5<alloc_adaptors<combined_containers::DS1_multi>::multipool, alloc_adaptors<int>::multipool>,
 		typename alloc_containers::DS5<alloc_adaptors<combined_containers::DS1_poly>::polymorphic, alloc_adaptors<int>::polymorphic>,
+		typename alloc_containers::DS5<alloc_adaptors<combined_containers::DS1_static>::static_monotonic, alloc_adaptors<int>::static_monotonic>,
 		process_DS5>, "**DS5**");
 	run_nested_loop(&run_base_allocations<typename containers::DS6,
 		typename alloc_containers::DS6<string::monotonic, alloc_adaptors<combined_containers::DS2_mono>::monotonic, alloc_adaptors<string::monotonic>::monotonic>,
 		typename alloc_containers::DS6<string::multipool, alloc_adaptors<combined_containers::DS2_multi>::multipool, alloc_adaptors<string::multipool>::multipool>,
 		typename alloc_containers::DS6<string::polymorphic, alloc_adaptors<combined_containers::DS2_poly>::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic>,
+		typename alloc_containers::DS6<string::static_monotonic, alloc_adaptors<combined_containers::DS2_static>::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic>,
 		process_DS6>, "**DS6**");
 	run_nested_loop(&run_base_allocations<typename containers::DS7,
 		typename alloc_containers::DS7<alloc_adaptors<combined_containers::DS3_mono>::monotonic, alloc_adaptors<int>::monotonic>,
 		typename alloc_containers::DS7<alloc_adaptors<combined_containers::DS3_multi>::multipool, alloc_adaptors<int>::multipool>,
 		typename alloc_containers::DS7<alloc_adaptors<combined_containers::DS3_poly>::polymorphic, alloc_adaptors<int>::polymorphic>,
+		typename alloc_containers::DS7<alloc_adaptors<combined_containers::DS3_static>::static_monotonic, alloc_adaptors<int>::static_monotonic>,
 		process_DS7>, "**DS7**");
 	run_nested_loop(&run_base_allocations<typename containers::DS8,
 		typename alloc_containers::DS8<string::monotonic, alloc_adaptors<combined_containers::DS4_mono>::monotonic, alloc_adaptors<string::monotonic>::monotonic>,
 		typename alloc_containers::DS8<string::multipool, alloc_adaptors<combined_containers::DS4_multi>::multipool, alloc_adaptors<string::multipool>::multipool>,
 		typename alloc_containers::DS8<string::polymorphic, alloc_adaptors<combined_containers::DS4_poly>::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic>,
+		typename alloc_containers::DS8<string::static_monotonic, alloc_adaptors<combined_containers::DS4_static>::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic>,
 		process_DS8>, "**DS8**");
 	run_nested_loop(&run_base_allocations<typename containers::DS9,
 		typename alloc_containers::DS9<alloc_adaptors<combined_containers::DS1_mono>::monotonic, alloc_adaptors<int>::monotonic>,
 		typename alloc_containers::DS9<alloc_adaptors<combined_containers::DS1_multi>::multipool, alloc_adaptors<int>::multipool>,
 		typename alloc_containers::DS9<alloc_adaptors<combined_containers::DS1_poly>::polymorphic, alloc_adaptors<int>::polymorphic>,
+		typename alloc_containers::DS9<alloc_adaptors<combined_containers::DS1_static>::static_monotonic, alloc_adaptors<int>::static_monotonic>,
 		process_DS9>, "**DS9**");
 	run_nested_loop(&run_base_allocations<typename containers::DS10,
 		typename alloc_containers::DS10<string::monotonic, alloc_adaptors<combined_containers::DS2_mono>::monotonic, alloc_adaptors<string::monotonic>::monotonic>,
 		typename alloc_containers::DS10<string::multipool, alloc_adaptors<combined_containers::DS2_multi>::multipool, alloc_adaptors<string::multipool>::multipool>,
 		typename alloc_containers::DS10<string::polymorphic, alloc_adaptors<combined_containers::DS2_poly>::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic>,
+		typename alloc_containers::DS10<string::static_monotonic, alloc_adaptors<combined_containers::DS2_static>::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic>,
 		process_DS10>, "**DS10**");
 	run_nested_loop(&run_base_allocations<typename containers::DS11,
 		typename alloc_containers::DS11<alloc_adaptors<combined_containers::DS3_mono>::monotonic, alloc_adaptors<int>::monotonic>,
 		typename alloc_containers::DS11<alloc_adaptors<combined_containers::DS3_multi>::multipool, alloc_adaptors<int>::multipool>,
 		typename alloc_containers::DS11<alloc_adaptors<combined_containers::DS3_poly>::polymorphic, alloc_adaptors<int>::polymorphic>,
+		typename alloc_containers::DS11<alloc_adaptors<combined_containers::DS3_static>::static_monotonic, alloc_adaptors<int>::static_monotonic>,
 		process_DS11>, "**DS11**");
 	run_nested_loop(&run_base_allocations<typename containers::DS12,
 		typename alloc_containers::DS12<string::monotonic, alloc_adaptors<combined_containers::DS4_mono>::monotonic, alloc_adaptors<string::monotonic>::monotonic>,
 		typename alloc_containers::DS12<string::multipool, alloc_adaptors<combined_containers::DS4_multi>::multipool, alloc_adaptors<string::multipool>::multipool>,
 		typename alloc_containers::DS12<string::polymorphic, alloc_adaptors<combined_containers::DS4_poly>::polymorphic, alloc_adaptors<string::polymorphic>::polymorphic>,
+		typename alloc_containers::DS12<string::static_monotonic, alloc_adaptors<combined_containers::DS4_static>::static_monotonic, alloc_adaptors<string::static_monotonic>::static_monotonic>,
 		process_DS12>, "**DS12**");
 
 	std::cout << "Done" << std::endl;
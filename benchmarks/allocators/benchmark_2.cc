@@ -55,10 +55,22 @@ public:
 	DefaultSubsystem() : d_list() {}
 };
 
+// Each subsystem accounts its memory to a node of a tree rooted at a single
+// process-wide allocator, as a host enforcing per-subsystem quotas would.
+BloombergLP::bdlma::HierarchicalAllocator *hierarchical_root = 0;
+
+class HierarchicalSubsystem {
+public:
+	BloombergLP::bdlma::HierarchicalAllocator d_alloc;
+	std::list<int, alloc_adaptor<int, BloombergLP::bdlma::HierarchicalAllocator> > d_list;
+	HierarchicalSubsystem() : d_alloc("subsystem", hierarchical_root), d_list(&d_alloc) {}
+};
+
 // Convenience typedefs
 struct subsystems {
 	typedef DefaultSubsystem def;
 	typedef AllocSubsystem<BloombergLP::bdlma::MultipoolAllocator> multipool;
+	typedef HierarchicalSubsystem hierarchical;
 };
 
 template<typename VECTOR>
@@ -218,6 +230,13 @@ void generate_table(int G, int alloc_num, int shuffle_sign) {
 						result = run_combination<typename subsystems::multipool>(G, S, af, sf*shuffle_sign, rf);
 						break;
 					}
+
+					case 8: {
+						// Never deleted, like the subsystems attached to it
+						hierarchical_root = new BloombergLP::bdlma::HierarchicalAllocator("process");
+						result = run_combination<typename subsystems::hierarchical>(G, S, af, sf*shuffle_sign, rf);
+						break;
+					}
 				}
 				std::cout << result << " " << std::flush;
 				exit(0);
@@ -257,6 +276,12 @@ int main(int argc, char *argv[]) {
 	std::cout << "Problem Size 2^21 With Allocators (Table 18) +ve shuffle" << std::endl;
 	generate_table(21, 7, 1);
 
+	std::cout << "Problem Size 2^21 With Hierarchical Quota Allocators -ve shuffle" << std::endl;
+	generate_table(21, 8, -1);
+
+	std::cout << "Problem Size 2^21 With Hierarchical Quota Allocators +ve shuffle" << std::endl;
+	generate_table(21, 8, 1);
+
 	std::cout << "Problem Size 2^25 Without Allocators (Table 17) -ve shuffle" << std::endl;
 	generate_table(25, 0, -1);
 
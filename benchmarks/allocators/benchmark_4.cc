@@ -55,7 +55,27 @@ void run_row(size_t N, size_t S, size_t W, size_t repeat = 1) {
 
 	std::cout << "N=^" << N << " S=" << S << " W=" << W << " " << std::flush;
 
-	for (size_t i = 0; i < 8; i++) {
+	// The workers of case 8 share one segment, created once for the row
+	// before any of them is forked.  Its name is removed at once: the workers
+	// inherit the mapping, and the segment is reclaimed when the last mapping
+	// of it goes away.
+	BloombergLP::bdlma::SharedMemoryPool shared_pool;
+	bool shared_pool_created = false;
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "/benchmark_4.%d", (int)getpid());
+		if (shared_pool.create(name, 1ull << 26) == 0) {
+			BloombergLP::bdlma::SharedMemoryPool::remove(name);
+			shared_pool_created = true;
+		}
+	}
+
+	for (size_t i = 0; i < 10; i++) {
+
+		if (i == 8 && !shared_pool_created) {
+			std::cout << "FAIL " << std::flush;
+			continue;
+		}
 
 		std::chrono::time_point<std::chrono::system_clock> start, end;
 		start = std::chrono::system_clock::now(); // Note: using wall time because CPU time would only benchmark main threat (no work being done)
@@ -154,6 +174,30 @@ void run_row(size_t N, size_t S, size_t W, size_t repeat = 1) {
 					}
 					break;
 				}
+				case 8: {
+#ifdef DEBUG_V3
+					std::cout << std::endl << "AS15" << std::endl;
+#endif // DEBUG_V3
+					for (size_t j = 0; j < repeat; j++)
+					{
+						run_allocation<typename alloc_adaptors<char>::shared>(N_expanded, S_expanded, &shared_pool, thread);
+					}
+					break;
+				}
+				case 9: {
+#ifdef DEBUG_V3
+					std::cout << std::endl << "AS16" << std::endl;
+#endif // DEBUG_V3
+					// As case 4, but the blocks of each short-lived multipool
+					// are recycled through a cache outliving the iterations.
+					BloombergLP::bdlma::BlockCacheAllocator block_cache;
+					for (size_t j = 0; j < repeat; j++)
+					{
+						BloombergLP::bdlma::MultipoolAllocator alloc(&block_cache);
+						run_allocation<typename alloc_adaptors<char>::multipool>(N_expanded, S_expanded, &alloc, thread);
+					}
+					break;
+				}
 				default:
 					break;
 				}
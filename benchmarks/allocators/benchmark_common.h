@@ -14,8 +14,12 @@
 
 #include <bsl_memory.h>
 #include <bslma_newdeleteallocator.h>
+#include <bslma_staticallocator.h>
+#include <bdlma_blockcacheallocator.h>
 #include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_hierarchicalallocator.h>
 #include <bdlma_multipoolallocator.h>
+#include <bdlma_sharedmemorypool.h>
 
 // Debugging
 #include <typeinfo>
@@ -139,10 +143,22 @@ bool operator!= (alloc_adaptor<T, A> const& a0, alloc_adaptor<T, A> const& a1) {
 	return !(a0 == a1);
 }
 
+// 'bslma::StaticAllocator' calls its concrete allocator non-virtually only if
+// that type is 'final', so the monotonic allocator is measured through a
+// 'final' class that overrides nothing.
+struct final_monotonic final : BloombergLP::bdlma::BufferedSequentialAllocator {
+	using BloombergLP::bdlma::BufferedSequentialAllocator::BufferedSequentialAllocator;
+};
+
+template <typename T, typename ALLOC>
+using static_adaptor = BloombergLP::bslma::StaticAllocator<T, ALLOC>;
+
 template< typename BASE>
 struct alloc_adaptors {
 	typedef alloc_adaptor<BASE, BloombergLP::bslma::NewDeleteAllocator> newdel;
 	typedef alloc_adaptor<BASE, BloombergLP::bdlma::BufferedSequentialAllocator> monotonic;
 	typedef alloc_adaptor<BASE, BloombergLP::bdlma::MultipoolAllocator> multipool;
+	typedef alloc_adaptor<BASE, BloombergLP::bdlma::SharedMemoryPool> shared;
+	typedef static_adaptor<BASE, final_monotonic> static_monotonic;
 	typedef bsl::allocator<BASE> polymorphic;
 };
@@ -0,0 +1,232 @@
+// bdlma_autorewinder.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLMA_AUTOREWINDER
+#define INCLUDED_BDLMA_AUTOREWINDER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a proctor to rewind a sequential allocator to a checkpoint.
+//
+//@CLASSES:
+//  bdlma::AutoRewinder: proctor to rewind a sequential allocator/pool
+//
+//@SEE_ALSO: bdlma_autoreleaser, bdlma_sequentialallocator,
+//           bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This component provides a proctor object,
+// 'bdlma::AutoRewinder', that records a checkpoint of a sequential allocator
+// or pool at construction and, at destruction, rewinds the allocator or pool
+// to that checkpoint, reclaiming all memory allocated through it in the
+// meantime, unless the proctor's 'release' method has been called.  The
+// proctor can also rewind its allocator or pool explicitly (and remain in
+// effect) using its 'rewind' method, which is convenient when the same
+// scratch memory is reused by each iteration of a loop.
+//
+// Rewinding is cheap: no memory is returned to the underlying allocator if
+// the allocations made since the checkpoint all fit in the buffer that was
+// current when the checkpoint was taken, and otherwise only the buffers and
+// blocks obtained since the checkpoint are returned.  Memory allocated before
+// the checkpoint is unaffected.  Note that no destructors are run; objects
+// created in the reclaimed memory must either be destroyed beforehand or not
+// require destruction.
+//
+///Requirements
+///------------
+// The object of the (template parameter) type 'ALLOCATOR' must provide a
+// nested type 'Checkpoint' and methods having the following signatures:
+//..
+//  Checkpoint checkpoint() const;
+//  void rewind(const Checkpoint& checkpoint);
+//..
+// 'bdlma::SequentialPool', 'bdlma::SequentialAllocator',
+// 'bdlma::BufferedSequentialPool', and 'bdlma::BufferedSequentialAllocator'
+// satisfy these requirements.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Scratch Memory Across Requests
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service parses a sequence of requests, each requiring a
+// moderate amount of temporary memory that is no longer needed once the
+// request has been processed.  Rather than constructing a new allocator for
+// each request (or deallocating each temporary object individually), we can
+// use a single sequential allocator for all requests and rewind it to a
+// checkpoint after each one.
+//
+// First, we define a function that splits a request into its space-separated
+// words, using the supplied allocator for the temporary word array, and
+// returns the number of words:
+//..
+//  int countWords(const char *request, bslma::Allocator *scratch)
+//      // Return the number of space-separated words in the specified
+//      // 'request', using the specified 'scratch' allocator to supply
+//      // temporary memory.
+//  {
+//      const int   length = static_cast<int>(bsl::strlen(request));
+//      char       *copy   = static_cast<char *>(
+//                                              scratch->allocate(length + 1));
+//      bsl::memcpy(copy, request, length + 1);
+//
+//      const char **words = static_cast<const char **>(
+//                                  scratch->allocate(length * sizeof *words));
+//      int numWords = 0;
+//      for (char *p = bsl::strtok(copy, " "); p; p = bsl::strtok(0, " ")) {
+//          words[numWords++] = p;
+//      }
+//      return numWords;
+//  }
+//..
+// Then, we create a sequential allocator that will supply the scratch memory
+// for all requests, with an initial buffer large enough for a typical
+// request:
+//..
+//  bslma::TestAllocator        testAllocator;
+//  bdlma::SequentialAllocator  scratch(1024, &testAllocator);
+//
+//  const char *REQUESTS[] = { "get quote IBM",
+//                             "get quote MSFT",
+//                             "cancel order 42 now" };
+//  const int   NUM_REQUESTS = sizeof REQUESTS / sizeof *REQUESTS;
+//..
+// Next, we process each request within the scope of a 'bdlma::AutoRewinder',
+// so that the memory used by a request is reclaimed when the iteration ends:
+//..
+//  for (int i = 0; i < NUM_REQUESTS; ++i) {
+//      bdlma::AutoRewinder<bdlma::SequentialAllocator> rewinder(&scratch);
+//
+//      const int numWords = countWords(REQUESTS[i], &scratch);
+//      assert(3 <= numWords);
+//  }
+//..
+// Finally, we observe that the allocator obtained only its initial buffer
+// from the underlying allocator, which was reused by every request:
+//..
+//  assert(1 == testAllocator.numBlocksTotal());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ==================
+                        // class AutoRewinder
+                        // ==================
+
+template <class ALLOCATOR>
+class AutoRewinder {
+    // This class implements a proctor that records a checkpoint of its
+    // managed sequential allocator or pool at construction, and rewinds the
+    // allocator or pool to that checkpoint at destruction unless the
+    // proctor's 'release' method is invoked.
+
+    // PRIVATE TYPES
+    typedef typename ALLOCATOR::Checkpoint Checkpoint;
+
+    // DATA
+    ALLOCATOR  *d_allocator_p;  // allocator or pool (held, not owned)
+
+    Checkpoint  d_checkpoint;   // state to which to rewind 'd_allocator_p'
+
+  private:
+    // NOT IMPLEMENTED
+    AutoRewinder(const AutoRewinder&);
+    AutoRewinder& operator=(const AutoRewinder&);
+
+  public:
+    // CREATORS
+    explicit
+    AutoRewinder(ALLOCATOR *allocator);
+        // Create a proctor object to manage the specified 'allocator',
+        // recording its current allocation state.  Unless the 'release'
+        // method of this proctor is invoked, 'allocator' is rewound to that
+        // state upon destruction of this proctor.  The behavior is undefined
+        // unless 'allocator' is non-null.
+
+    ~AutoRewinder();
+        // Destroy this proctor object and, unless the 'release' method has
+        // been invoked on this object, rewind the held allocator or pool to
+        // the state recorded at construction.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the allocator or pool currently managed by
+        // this proctor, so that it is not rewound at destruction.  If no
+        // allocator or pool is currently being managed, this method has no
+        // effect.
+
+    void rewind();
+        // Rewind the allocator or pool managed by this proctor to the state
+        // recorded at construction, reclaiming all memory allocated through it
+        // since then.  The allocator or pool remains managed by this proctor.
+        // The behavior is undefined unless an allocator or pool is currently
+        // being managed.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ------------------
+                        // class AutoRewinder
+                        // ------------------
+
+// CREATORS
+template <class ALLOCATOR>
+inline
+AutoRewinder<ALLOCATOR>::AutoRewinder(ALLOCATOR *allocator)
+: d_allocator_p(allocator)
+, d_checkpoint(allocator->checkpoint())
+{
+}
+
+template <class ALLOCATOR>
+inline
+AutoRewinder<ALLOCATOR>::~AutoRewinder()
+{
+    if (d_allocator_p) {
+        d_allocator_p->rewind(d_checkpoint);
+    }
+}
+
+// MANIPULATORS
+template <class ALLOCATOR>
+inline
+void AutoRewinder<ALLOCATOR>::release()
+{
+    d_allocator_p = 0;
+}
+
+template <class ALLOCATOR>
+inline
+void AutoRewinder<ALLOCATOR>::rewind()
+{
+    d_allocator_p->rewind(d_checkpoint);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,543 @@
+// bdlma_autorewinder.t.cpp                                           -*-C++-*-
+#include <bdlma_autorewinder.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_bufferedsequentialpool.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_sequentialpool.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing a proctor object to ensure that it records a checkpoint of
+// the managed allocator or pool at construction and, when the proctor object
+// goes out of scope, rewinds the allocator or pool to that checkpoint unless
+// 'release' has been called.  We first use a local 'TestPool' that models
+// the allocation state as a simple counter and records the number of calls
+// to 'rewind'.  We then instantiate the proctor with each of the sequential
+// allocators and pools in this package and verify that memory obtained from
+// the underlying allocator after the checkpoint is returned on rewind.
+// ----------------------------------------------------------------------------
+// [ 2] bdlma::AutoRewinder<ALLOCATOR>(ALLOCATOR *allocator);
+// [ 2] ~bdlma::AutoRewinder<ALLOCATOR>();
+// [ 2] void release();
+// [ 2] void rewind();
+// [ 3] CONCERN: works with sequential allocators and pools
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+// [ 1] Ensure local helper class TestPool works as expected.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                               TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+class TestPool {
+    // This test class models the allocation state of a sequential pool as
+    // the number of outstanding allocations, and maintains a count of the
+    // number of times 'rewind' has been called.
+
+    // DATA
+    int d_numAllocations;  // number of outstanding allocations
+    int d_numRewinds;      // number of calls to 'rewind'
+
+  public:
+    // TYPES
+    typedef int Checkpoint;
+
+    // CREATORS
+    TestPool() : d_numAllocations(0), d_numRewinds(0) {}
+        // Create a test pool object having no outstanding allocations.
+
+    ~TestPool() {}
+        // Destroy this object.
+
+    // MANIPULATORS
+    void allocate() { ++d_numAllocations; }
+        // Increment the number of outstanding allocations.
+
+    void rewind(const Checkpoint& checkpoint)
+        // Set the number of outstanding allocations to the specified
+        // 'checkpoint', and increment the number of calls to 'rewind'.
+    {
+        d_numAllocations = checkpoint;
+        ++d_numRewinds;
+    }
+
+    // ACCESSORS
+    Checkpoint checkpoint() const { return d_numAllocations; }
+        // Return the current number of outstanding allocations.
+
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of outstanding allocations.
+
+    int numRewinds() const { return d_numRewinds; }
+        // Return the number of times 'rewind' has been called.
+};
+
+template <class ALLOCATOR>
+void testSequential(ALLOCATOR *allocator, bslma::TestAllocator *upstream)
+    // Verify that a 'bdlma::AutoRewinder' managing the specified 'allocator',
+    // which obtains its memory from the specified 'upstream' allocator,
+    // returns all memory obtained from 'upstream' within the scope of the
+    // proctor, and that the allocator resumes allocating from the position
+    // recorded by the proctor.
+{
+    void *p0 = allocator->allocate(8);  (void)p0;
+
+    const bsls::Types::Int64 NUM_BLOCKS = upstream->numBlocksInUse();
+
+    void *p1;
+    {
+        bdlma::AutoRewinder<ALLOCATOR> rewinder(allocator);
+
+        p1 = allocator->allocate(8);
+        for (int i = 0; i < 16; ++i) {
+            allocator->allocate(1000);
+        }
+        ASSERTV(NUM_BLOCKS, upstream->numBlocksInUse(),
+                NUM_BLOCKS < upstream->numBlocksInUse());
+
+        rewinder.rewind();
+        ASSERTV(NUM_BLOCKS, upstream->numBlocksInUse(),
+                NUM_BLOCKS == upstream->numBlocksInUse());
+        ASSERT(p1 == allocator->allocate(8));
+
+        for (int i = 0; i < 16; ++i) {
+            allocator->allocate(1000);
+        }
+    }
+    ASSERTV(NUM_BLOCKS, upstream->numBlocksInUse(),
+            NUM_BLOCKS == upstream->numBlocksInUse());
+    ASSERT(p1 == allocator->allocate(8));
+
+    {
+        bdlma::AutoRewinder<ALLOCATOR> rewinder(allocator);
+
+        for (int i = 0; i < 16; ++i) {
+            allocator->allocate(1000);
+        }
+        rewinder.release();
+    }
+    ASSERTV(NUM_BLOCKS, upstream->numBlocksInUse(),
+            NUM_BLOCKS < upstream->numBlocksInUse());
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Scratch Memory Across Requests
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service parses a sequence of requests, each requiring a
+// moderate amount of temporary memory that is no longer needed once the
+// request has been processed.  Rather than constructing a new allocator for
+// each request (or deallocating each temporary object individually), we can
+// use a single sequential allocator for all requests and rewind it to a
+// checkpoint after each one.
+//
+// First, we define a function that splits a request into its space-separated
+// words, using the supplied allocator for the temporary word array, and
+// returns the number of words:
+//..
+    int countWords(const char *request, bslma::Allocator *scratch)
+        // Return the number of space-separated words in the specified
+        // 'request', using the specified 'scratch' allocator to supply
+        // temporary memory.
+    {
+        const int   length = static_cast<int>(bsl::strlen(request));
+        char       *copy   = static_cast<char *>(
+                                                scratch->allocate(length + 1));
+        bsl::memcpy(copy, request, length + 1);
+
+        const char **words = static_cast<const char **>(
+                                    scratch->allocate(length * sizeof *words));
+        int numWords = 0;
+        for (char *p = bsl::strtok(copy, " "); p; p = bsl::strtok(0, " ")) {
+            words[numWords++] = p;
+        }
+        return numWords;
+    }
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a sequential allocator that will supply the scratch memory
+// for all requests, with an initial buffer large enough for a typical
+// request:
+//..
+    bslma::TestAllocator        testAllocator;
+    bdlma::SequentialAllocator  scratch(1024, &testAllocator);
+
+    const char *REQUESTS[] = { "get quote IBM",
+                               "get quote MSFT",
+                               "cancel order 42 now" };
+    const int   NUM_REQUESTS = sizeof REQUESTS / sizeof *REQUESTS;
+//..
+// Next, we process each request within the scope of a 'bdlma::AutoRewinder',
+// so that the memory used by a request is reclaimed when the iteration ends:
+//..
+    for (int i = 0; i < NUM_REQUESTS; ++i) {
+        bdlma::AutoRewinder<bdlma::SequentialAllocator> rewinder(&scratch);
+
+        const int numWords = countWords(REQUESTS[i], &scratch);
+        ASSERT(3 <= numWords);
+    }
+//..
+// Finally, we observe that the allocator obtained only its initial buffer
+// from the underlying allocator, which was reused by every request:
+//..
+    ASSERT(1 == testAllocator.numBlocksTotal());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SEQUENTIAL ALLOCATORS AND POOLS
+        //   Ensure that 'bdlma::AutoRewinder' can be instantiated with each of
+        //   the sequential allocators and pools in this package.
+        //
+        // Concerns:
+        //: 1 Memory obtained from the underlying allocator within the scope
+        //:   of the proctor is returned when the proctor is destroyed, and
+        //:   when 'rewind' is called explicitly.
+        //:
+        //: 2 Memory allocated before the proctor was created is unaffected.
+        //:
+        //: 3 After rewinding, the allocator or pool resumes allocating from
+        //:   the position recorded at construction of the proctor.
+        //:
+        //: 4 Memory is not returned if 'release' has been called.
+        //
+        // Plan:
+        //: 1 For each of 'bdlma::SequentialPool',
+        //:   'bdlma::SequentialAllocator', 'bdlma::BufferedSequentialPool',
+        //:   and 'bdlma::BufferedSequentialAllocator', supplied by a
+        //:   'bslma::TestAllocator', invoke the 'testSequential' helper,
+        //:   which allocates enough memory within the scope of a proctor to
+        //:   force new blocks to be obtained from the test allocator, and
+        //:   verifies the number of blocks in use after rewinding.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: works with sequential allocators and pools
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEQUENTIAL ALLOCATORS AND POOLS" << endl
+                          << "===============================" << endl;
+
+        bsls::AlignmentUtil::MaxAlignedType buffer[32];
+
+        if (verbose) cout << "Testing 'bdlma::SequentialPool'." << endl;
+        {
+            bslma::TestAllocator ta(veryVerbose);
+            bdlma::SequentialPool mX(&ta);
+            testSequential(&mX, &ta);
+        }
+
+        if (verbose) cout << "Testing 'bdlma::SequentialAllocator'." << endl;
+        {
+            bslma::TestAllocator ta(veryVerbose);
+            bdlma::SequentialAllocator mX(&ta);
+            testSequential(&mX, &ta);
+        }
+
+        if (verbose) cout << "Testing 'bdlma::BufferedSequentialPool'."
+                          << endl;
+        {
+            bslma::TestAllocator ta(veryVerbose);
+            bdlma::BufferedSequentialPool mX(reinterpret_cast<char *>(buffer),
+                                             sizeof buffer,
+                                             &ta);
+            testSequential(&mX, &ta);
+        }
+
+        if (verbose) cout << "Testing 'bdlma::BufferedSequentialAllocator'."
+                          << endl;
+        {
+            bslma::TestAllocator ta(veryVerbose);
+            bdlma::BufferedSequentialAllocator mX(
+                                              reinterpret_cast<char *>(buffer),
+                                              sizeof buffer,
+                                              &ta);
+            testSequential(&mX, &ta);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BASIC TEST
+        //   Ensure that 'bdlma::AutoRewinder' works as expected.
+        //
+        // Concerns:
+        //: 1 A proctor rewinds its managed allocator or pool to the state
+        //:   recorded at construction upon destruction.
+        //:
+        //: 2 A proctor does *not* rewind an allocator or pool that has been
+        //:   released from management prior to destruction.
+        //:
+        //: 3 The 'rewind' method rewinds the managed allocator or pool to the
+        //:   state recorded at construction, and the allocator or pool
+        //:   remains under management.
+        //
+        // Plan:
+        //: 1 Create a 'TestPool', 'a', and allocate from it.  Create a
+        //:   'bdlma::AutoRewinder' proctor initialized with 'a', and allocate
+        //:   from 'a' again.
+        //:
+        //: 2 Allow the proctor created in P-1 to go out of scope and verify
+        //:   that 'a' has been rewound to the state prior to the proctor's
+        //:   creation.  (C-1)
+        //:
+        //: 3 Repeat P-1..2, but invoke the proctor's 'release' method before
+        //:   the proctor goes out of scope.  Verify that 'a' has *not* been
+        //:   rewound.  (C-2)
+        //:
+        //: 4 Repeat P-1..2, but invoke the proctor's 'rewind' method several
+        //:   times, allocating in between, before the proctor goes out of
+        //:   scope.  Verify the state of 'a' after each call to 'rewind' and
+        //:   after destruction of the proctor.  (C-3)
+        //
+        // Testing:
+        //   bdlma::AutoRewinder<ALLOCATOR>(ALLOCATOR *allocator);
+        //   ~bdlma::AutoRewinder<ALLOCATOR>();
+        //   void release();
+        //   void rewind();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BASIC TEST" << endl
+                                  << "==========" << endl;
+
+        if (verbose) cout << "Testing constructor." << endl;
+        {
+            // C-1
+
+            TestPool a;  const TestPool &A = a;
+            a.allocate();
+            {
+                const bdlma::AutoRewinder<TestPool> X(&a);
+                a.allocate();
+                a.allocate();
+                ASSERT(3 == A.numAllocations());
+                ASSERT(0 == A.numRewinds());
+            }
+            ASSERT(1 == A.numAllocations());
+            ASSERT(1 == A.numRewinds());
+        }
+
+        if (verbose) cout << "Testing 'release'." << endl;
+        {
+            // C-2
+
+            TestPool a;  const TestPool &A = a;
+            a.allocate();
+            {
+                bdlma::AutoRewinder<TestPool> x(&a);
+                a.allocate();
+                x.release();
+            }
+            ASSERT(2 == A.numAllocations());
+            ASSERT(0 == A.numRewinds());
+        }
+
+        if (verbose) cout << "Testing 'rewind'." << endl;
+        {
+            // C-3
+
+            TestPool a;  const TestPool &A = a;
+            a.allocate();
+            {
+                bdlma::AutoRewinder<TestPool> x(&a);
+                for (int i = 1; i <= 3; ++i) {
+                    a.allocate();
+                    a.allocate();
+                    x.rewind();
+                    ASSERTV(i, 1 == A.numAllocations());
+                    ASSERTV(i, i == A.numRewinds());
+                }
+                a.allocate();
+            }
+            ASSERT(1 == A.numAllocations());
+            ASSERT(4 == A.numRewinds());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // HELPER CLASS TEST
+        //   Ensure that the 'TestPool' works as expected.
+        //
+        // Concerns:
+        //: 1 A newly created 'TestPool' has no outstanding allocations and
+        //:   has not been rewound.
+        //:
+        //: 2 'allocate' increments the number of outstanding allocations.
+        //:
+        //: 3 'checkpoint' returns the number of outstanding allocations, and
+        //:   'rewind' restores it and increments the number of rewinds.
+        //
+        // Plan:
+        //: 1 Create a 'TestPool' object and verify the values returned by
+        //:   its accessors.  (C-1)
+        //:
+        //: 2 Invoke 'allocate' and verify 'numAllocations'.  (C-2)
+        //:
+        //: 3 Take a checkpoint, allocate, rewind to the checkpoint, and
+        //:   verify the values returned by the accessors.  (C-3)
+        //
+        // Testing:
+        //   TestPool();
+        //   ~TestPool();
+        //   void allocate();
+        //   void rewind(const Checkpoint& checkpoint);
+        //   Checkpoint checkpoint() const;
+        //   int numAllocations() const;
+        //   int numRewinds() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "HELPER CLASS TEST" << endl
+                                  << "=================" << endl;
+
+        if (verbose) cout << "Testing 'TestPool'." << endl;
+
+        // C-1
+
+        TestPool mX;  const TestPool &X = mX;
+        ASSERT(0 == X.numAllocations());
+        ASSERT(0 == X.numRewinds());
+        ASSERT(0 == X.checkpoint());
+
+        // C-2
+
+        mX.allocate();
+        ASSERT(1 == X.numAllocations());
+
+        // C-3
+
+        const TestPool::Checkpoint CP = X.checkpoint();
+        ASSERT(1 == CP);
+
+        mX.allocate();  mX.allocate();
+        ASSERT(3 == X.numAllocations());
+
+        mX.rewind(CP);
+        ASSERT(1 == X.numAllocations());
+        ASSERT(1 == X.numRewinds());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
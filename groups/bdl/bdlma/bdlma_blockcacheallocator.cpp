@@ -0,0 +1,372 @@
+// bdlma_blockcacheallocator.cpp                                      -*-C++-*-
+#include <bdlma_blockcacheallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_blockcacheallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_threadshardutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bslma::Allocator::size_type OFFSET =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+enum {
+    k_MIN_SHIFT = 8  // base-2 logarithm of 'k_MIN_BLOCK_SIZE'
+};
+
+BSLMF_ASSERT(BlockCacheAllocator::k_MIN_BLOCK_SIZE == 1 << k_MIN_SHIFT);
+
+// HELPER FUNCTIONS
+
+inline
+int sizeClass(bslma::Allocator::size_type *classSize,
+              bslma::Allocator::size_type  size)
+    // Return the size class of a block of the specified 'size' (in bytes),
+    // and load the size of that class into the specified 'classSize'.  The
+    // behavior is undefined unless
+    // '0 < size <= BlockCacheAllocator::k_MAX_CACHED_BLOCK_SIZE'.
+{
+    if (size <= BlockCacheAllocator::k_MIN_BLOCK_SIZE) {
+        *classSize = BlockCacheAllocator::k_MIN_BLOCK_SIZE;
+        return 0;                                                     // RETURN
+    }
+
+    // With 'n = size - 1' having its highest set bit at 'exponent', the class
+    // of 'size' is determined by 'exponent' and the two bits following it.
+
+    const bslma::Allocator::size_type n = size - 1;
+
+    int exponent = k_MIN_SHIFT;
+    while (n >> (exponent + 1)) {
+        ++exponent;
+    }
+
+    const int                         shift    = exponent - 2;
+    const bslma::Allocator::size_type quarters = n >> shift;  // in [4 .. 7]
+
+    *classSize = (quarters + 1) << shift;
+    return (exponent - k_MIN_SHIFT) * 4 + static_cast<int>(quarters - 4) + 1;
+}
+
+inline
+bslma::Allocator::size_type classSizeOf(int sizeClass)
+    // Return the size of the specified 'sizeClass'.
+{
+    if (0 == sizeClass) {
+        return BlockCacheAllocator::k_MIN_BLOCK_SIZE;                 // RETURN
+    }
+
+    const int exponent = k_MIN_SHIFT + (sizeClass - 1) / 4;
+    const int quarters = 4 + (sizeClass - 1) % 4;
+
+    return static_cast<bslma::Allocator::size_type>(quarters + 1)
+                                                           << (exponent - 2);
+}
+
+}  // close unnamed namespace
+
+                      // --------------------------------
+                      // struct BlockCacheAllocator::Shard
+                      // --------------------------------
+
+// CREATORS
+BlockCacheAllocator::Shard::Shard()
+{
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        d_freeLists[i] = 0;
+        d_numBlocks[i] = 0;
+    }
+}
+
+                         // -------------------------
+                         // class BlockCacheAllocator
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+int BlockCacheAllocator::shardIndex()
+{
+    return ThreadShardUtil::shardIndex(k_NUM_SHARDS);
+}
+
+// PRIVATE MANIPULATORS
+BlockCacheAllocator::FreeBlock *BlockCacheAllocator::popBlock(Shard *shard,
+                                                              int    sizeClass)
+{
+    bsls::BslLockGuard guard(&shard->d_lock);
+
+    FreeBlock *block = shard->d_freeLists[sizeClass];
+    if (block) {
+        shard->d_freeLists[sizeClass] = block->d_next_p;
+        --shard->d_numBlocks[sizeClass];
+    }
+    return block;
+}
+
+BlockCacheAllocator::FreeBlock *BlockCacheAllocator::stealBlocks(
+                                                             int index,
+                                                             int sizeClass)
+{
+    int victim = static_cast<int>(
+                         static_cast<unsigned int>(d_nextVictim.addRelaxed(1))
+                                                             % k_NUM_SHARDS);
+    if (victim == index) {
+        victim = (victim + 1) % k_NUM_SHARDS;
+    }
+
+    FreeBlock *block;
+    int        numBlocks;
+
+    {
+        Shard&             shard = d_shards[victim];
+        bsls::BslLockGuard guard(&shard.d_lock);
+
+        block     = shard.d_freeLists[sizeClass];
+        numBlocks = shard.d_numBlocks[sizeClass];
+
+        shard.d_freeLists[sizeClass] = 0;
+        shard.d_numBlocks[sizeClass] = 0;
+    }
+
+    if (numBlocks <= 1) {
+        return block;                                                 // RETURN
+    }
+
+    // Keep the first block, and cache the others where the calling thread
+    // will find them.
+
+    FreeBlock *first = block->d_next_p;
+    FreeBlock *last  = first;
+    while (last->d_next_p) {
+        last = last->d_next_p;
+    }
+
+    {
+        Shard&             shard = d_shards[index];
+        bsls::BslLockGuard guard(&shard.d_lock);
+
+        if (shard.d_numBlocks[sizeClass] + numBlocks - 1 <= k_SHARD_CAPACITY)
+        {
+            last->d_next_p                = shard.d_freeLists[sizeClass];
+            shard.d_freeLists[sizeClass]  = first;
+            shard.d_numBlocks[sizeClass] += numBlocks - 1;
+            return block;                                             // RETURN
+        }
+    }
+
+    bsls::BslLockGuard guard(&d_depot.d_lock);
+
+    last->d_next_p                  = d_depot.d_freeLists[sizeClass];
+    d_depot.d_freeLists[sizeClass]  = first;
+    d_depot.d_numBlocks[sizeClass] += numBlocks - 1;
+    return block;
+}
+
+void BlockCacheAllocator::releaseShard(Shard *shard)
+{
+    FreeBlock *lists[k_NUM_SIZE_CLASSES];
+
+    {
+        bsls::BslLockGuard guard(&shard->d_lock);
+
+        for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+            lists[i]               = shard->d_freeLists[i];
+            shard->d_freeLists[i]  = 0;
+            shard->d_numBlocks[i]  = 0;
+        }
+    }
+
+    // Return the blocks to the upstream allocator without holding the lock.
+
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        const bsls::Types::Int64 classSize =
+                               static_cast<bsls::Types::Int64>(classSizeOf(i));
+
+        FreeBlock *block = lists[i];
+        while (block) {
+            FreeBlock *next = block->d_next_p;
+
+            d_numBytesCached.addRelaxed(-classSize);
+            d_allocator_p->deallocate(reinterpret_cast<char *>(block)
+                                                                    - OFFSET);
+
+            block = next;
+        }
+    }
+}
+
+// CREATORS
+BlockCacheAllocator::BlockCacheAllocator(bslma::Allocator *basicAllocator)
+: d_nextVictim(0)
+, d_numBytesCached(0)
+, d_maxCachedBytes(k_DEFAULT_MAX_CACHED_BYTES)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_allocator_p);
+}
+
+BlockCacheAllocator::BlockCacheAllocator(bsls::Types::Int64  maxCachedBytes,
+                                         bslma::Allocator   *basicAllocator)
+: d_nextVictim(0)
+, d_numBytesCached(0)
+, d_maxCachedBytes(maxCachedBytes)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= maxCachedBytes);
+    BSLS_ASSERT(d_allocator_p);
+}
+
+BlockCacheAllocator::~BlockCacheAllocator()
+{
+    release();
+
+    BSLS_ASSERT(0 == numBytesCached());
+}
+
+// MANIPULATORS
+void *BlockCacheAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           size > k_MAX_CACHED_BLOCK_SIZE)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const size_type blockSize =
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+        char *address = static_cast<char *>(
+                                  d_allocator_p->allocate(OFFSET + blockSize));
+
+        *reinterpret_cast<int *>(address) = k_NUM_SIZE_CLASSES;
+        return address + OFFSET;                                      // RETURN
+    }
+
+    size_type classSize;
+    const int sc = sizeClass(&classSize, size);
+
+    // Take a cached block from the shard of the calling thread or, failing
+    // that, from the depot or (at most) one other shard.
+
+    const int  index = shardIndex();
+    FreeBlock *block = popBlock(&d_shards[index], sc);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == block)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        block = popBlock(&d_depot, sc);
+
+        if (0 == block) {
+            block = stealBlocks(index, sc);
+        }
+    }
+
+    if (block) {
+        d_numBytesCached.addRelaxed(-static_cast<bsls::Types::Int64>(
+                                                                  classSize));
+        return block;                                                 // RETURN
+    }
+
+    char *address = static_cast<char *>(
+                                  d_allocator_p->allocate(OFFSET + classSize));
+
+    *reinterpret_cast<int *>(address) = sc;
+    return address + OFFSET;
+}
+
+void BlockCacheAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    char      *header = static_cast<char *>(address) - OFFSET;
+    const int  sc     = *reinterpret_cast<int *>(header);
+
+    BSLS_ASSERT(0 <= sc);
+    BSLS_ASSERT(sc <= k_NUM_SIZE_CLASSES);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_NUM_SIZE_CLASSES == sc)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_allocator_p->deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 classSize =
+                              static_cast<bsls::Types::Int64>(classSizeOf(sc));
+
+    // Reserve room in the cache for the block, or return it upstream if the
+    // cache is full.
+
+    if (d_numBytesCached.addRelaxed(classSize) > d_maxCachedBytes) {
+        d_numBytesCached.addRelaxed(-classSize);
+        d_allocator_p->deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    FreeBlock *block = static_cast<FreeBlock *>(address);
+
+    {
+        Shard& shard = d_shards[shardIndex()];
+
+        bsls::BslLockGuard guard(&shard.d_lock);
+
+        if (shard.d_numBlocks[sc] < k_SHARD_CAPACITY) {
+            block->d_next_p       = shard.d_freeLists[sc];
+            shard.d_freeLists[sc] = block;
+            ++shard.d_numBlocks[sc];
+            return;                                                   // RETURN
+        }
+    }
+
+    // The class is full in the shard of the calling thread: overflow to the
+    // depot.
+
+    bsls::BslLockGuard guard(&d_depot.d_lock);
+
+    block->d_next_p         = d_depot.d_freeLists[sc];
+    d_depot.d_freeLists[sc] = block;
+    ++d_depot.d_numBlocks[sc];
+}
+
+void BlockCacheAllocator::release()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        releaseShard(&d_shards[i]);
+    }
+    releaseShard(&d_depot);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,375 @@
+// bdlma_blockcacheallocator.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLMA_BLOCKCACHEALLOCATOR
+#define INCLUDED_BDLMA_BLOCKCACHEALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator recycling the blocks of short-lived arenas.
+//
+//@CLASSES:
+//  bdlma::BlockCacheAllocator: thread-sharded cache of deallocated blocks
+//
+//@SEE_ALSO: bdlma_blocklist, bdlma_infrequentdeleteblocklist,
+//           bdlma_sequentialpool, bdlma_multipoolallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::BlockCacheAllocator', that implements the 'bslma::Allocator'
+// protocol by caching the blocks deallocated to it, and supplying them again
+// to subsequent allocations of similar sizes, rather than returning them to
+// (and obtaining new ones from) an upstream allocator supplied at
+// construction:
+//..
+//   ,--------------------------.
+//  ( bdlma::BlockCacheAllocator )
+//   `--------------------------'
+//                |         ctor/dtor
+//                |         release
+//                |         maxCachedBytes
+//                |         numBytesCached
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                          allocate
+//                          deallocate
+//..
+// A block cache allocator is intended to be the upstream allocator of
+// short-lived arenas, e.g., the 'bdlma::SequentialAllocator',
+// 'bdlma::BufferedSequentialAllocator' (beyond its buffer), or
+// 'bdlma::MultipoolAllocator' created for each request handled by a server.
+// The 'bdlma::BlockList', 'bdlma::InfrequentDeleteBlockList', and
+// 'bdlma::SequentialPool' underlying those arenas obtain large blocks from
+// their allocator, and return all of them when the arena is destroyed; with a
+// block cache allocator as their allocator, creating and destroying an arena
+// (once the cache is warm) does not call the upstream allocator (e.g.,
+// 'malloc' and 'free') at all.
+//
+///Size Classes
+///------------
+// Each block is served from a *size* *class*: the size requested is rounded
+// up to the next of four sizes evenly spaced within each power of two (e.g.,
+// 1024, 1280, 1536, 1792, 2048 bytes), starting at 'k_MIN_BLOCK_SIZE', so
+// that blocks of similar sizes (such as those requested by successive arenas
+// whose requested sizes vary slightly) share a class, at a cost of at most a
+// quarter of the block.  A deallocated block is cached for reuse by an
+// allocation of the same class.  Blocks larger than 'k_MAX_CACHED_BLOCK_SIZE'
+// are not cached: they are allocated from, and returned to, the upstream
+// allocator directly.  Each block is preceded by a header of maximal
+// alignment recording its size class.
+//
+///Thread-Local Caches and Global Overflow
+///---------------------------------------
+// Deallocated blocks are cached in one of 'k_NUM_SHARDS' *shards*, each
+// holding a few blocks of each size class, and having its own lock.  Each
+// thread is assigned a shard the first time it uses any block cache
+// allocator, in round-robin order (see 'bdlma_threadshardutil'), so that up
+// to 'k_NUM_SHARDS' threads each have their own (and, in effect,
+// thread-local) cache, whose lock is uncontended.  A thread deallocating a
+// block whose class is full in its shard passes the block to a global *depot*
+// instead, and a thread allocating a block whose class is empty in its shard
+// takes one from the depot, so that blocks deallocated by one thread are
+// reused by others.  If the depot is empty as well, the allocating thread
+// takes the blocks of the class from one other shard, chosen in round-robin
+// order, keeping one and moving the rest to its own shard, and calls the
+// upstream allocator only if that shard has none either.  An allocation thus
+// acquires at most three locks, and the blocks cached by a thread that has
+// exited are not stranded, but reclaimed by the misses of other threads.
+//
+// The total size of the cached blocks is bounded by the 'maxCachedBytes'
+// supplied at construction (by default, 'k_DEFAULT_MAX_CACHED_BYTES'); a
+// block deallocated while the cache is full is returned to the upstream
+// allocator.  The 'release' method returns all cached blocks to the upstream
+// allocator, as does the destructor.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::BlockCacheAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction is
+// fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recycling the Blocks of Per-Request Arenas
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server handles each request using an arena, a
+// 'bdlma::SequentialAllocator', from which all of the memory needed by the
+// request is allocated, and which is destroyed (releasing all of that memory
+// at once) when the request is done.
+//
+// First, we create a block cache allocator, shared by all requests, on top of
+// the allocator supplying the memory of the server (here, a
+// 'bslma::TestAllocator', so that we can observe its use):
+//..
+//  bslma::TestAllocator       upstream;
+//  bdlma::BlockCacheAllocator cache(&upstream);
+//..
+// Then, we define a function handling a request, whose arena obtains its
+// blocks from the block cache allocator:
+//..
+//  void handleRequest(bslma::Allocator *requestAllocator, int requestSize)
+//  {
+//      bdlma::SequentialAllocator arena(requestAllocator);
+//
+//      for (int i = 0; i < requestSize; ++i) {
+//          arena.allocate(100);
+//      }
+//  }
+//..
+// Next, we handle a first request, which (with the cache empty) obtains the
+// blocks of its arena from the upstream allocator, but does not return them:
+//..
+//  handleRequest(&cache, 100);
+//
+//  const bsls::Types::Int64 numAllocations = upstream.numAllocations();
+//
+//  assert(0 < numAllocations);
+//  assert(0 < upstream.numBlocksInUse());
+//  assert(0 < cache.numBytesCached());
+//..
+// Finally, we handle more requests, and observe that the blocks of their
+// arenas are all supplied by the cache:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      handleRequest(&cache, 100);
+//  }
+//
+//  assert(numAllocations == upstream.numAllocations());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // =========================
+                         // class BlockCacheAllocator
+                         // =========================
+
+class BlockCacheAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete allocator mechanism that implements the
+    // 'bslma::Allocator' protocol, and caches the blocks deallocated to it,
+    // by size class, in per-thread shards and a global depot, supplying them
+    // again to subsequent allocations instead of obtaining new blocks from
+    // the allocator supplied at construction.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_SHARDS               = 16,          // number of shards
+
+        k_MIN_BLOCK_SIZE           = 256,         // size of the smallest
+                                                  // class
+
+        k_MAX_CACHED_BLOCK_SIZE    = 1024 * 1024, // size of the largest class
+
+        k_DEFAULT_MAX_CACHED_BYTES = 16 * 1024 * 1024
+                                                  // default bound on the
+                                                  // total size of the cached
+                                                  // blocks
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_SIZE_CLASSES = 49,  // four classes per power of two from
+                                  // 'k_MIN_BLOCK_SIZE' (exclusive) to
+                                  // 'k_MAX_CACHED_BLOCK_SIZE' (inclusive),
+                                  // plus 'k_MIN_BLOCK_SIZE'
+
+        k_SHARD_CAPACITY   = 4    // maximum number of blocks of each class
+                                  // cached in a shard
+    };
+
+    struct FreeBlock {
+        // This 'struct' links the cached blocks of a size class.
+
+        FreeBlock *d_next_p;  // next cached block, or 0
+    };
+
+    struct Shard {
+        // This 'struct' holds the cached blocks of each size class of a shard
+        // (or of the depot), padded so that the locks of two shards do not
+        // share a cache line.
+
+        bsls::BslLock  d_lock;                           // guards the lists
+
+        FreeBlock     *d_freeLists[k_NUM_SIZE_CLASSES];  // cached blocks, by
+                                                         // class
+
+        int            d_numBlocks[k_NUM_SIZE_CLASSES];  // length of each
+                                                         // list
+
+        char           d_padding[64];
+
+        // CREATORS
+        Shard();
+            // Create a shard caching no blocks.
+    };
+
+    // DATA
+    Shard              d_shards[k_NUM_SHARDS];  // cached blocks, by shard
+
+    Shard              d_depot;                 // blocks overflowing the
+                                                // shards
+
+    bsls::AtomicInt    d_nextVictim;            // counter selecting the
+                                                // shard to steal from
+
+    bsls::AtomicInt64  d_numBytesCached;        // total size of the classes
+                                                // of the cached blocks
+
+    bsls::Types::Int64 d_maxCachedBytes;        // bound on
+                                                // 'd_numBytesCached'
+
+    bslma::Allocator  *d_allocator_p;           // upstream allocator (held,
+                                                // not owned)
+
+  private:
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard assigned to the calling thread,
+        // assigning one on the first call from that thread.
+
+    // PRIVATE MANIPULATORS
+    FreeBlock *popBlock(Shard *shard, int sizeClass);
+        // Remove the first cached block of the specified 'sizeClass' from the
+        // specified 'shard', and return its address, or return 0 if 'shard'
+        // caches no block of 'sizeClass'.
+
+    FreeBlock *stealBlocks(int index, int sizeClass);
+        // Remove the cached blocks of the specified 'sizeClass' from a shard
+        // other than the one having the specified 'index', chosen in
+        // round-robin order, move all but the first of them to the shard
+        // having 'index' (or, if they do not fit, to the depot), and return
+        // the address of the first, or return 0 if the chosen shard caches no
+        // block of 'sizeClass'.
+
+    void releaseShard(Shard *shard);
+        // Return the cached blocks of the specified 'shard' to the upstream
+        // allocator.
+
+  private:
+    // NOT IMPLEMENTED
+    BlockCacheAllocator(const BlockCacheAllocator&);
+    BlockCacheAllocator& operator=(const BlockCacheAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    BlockCacheAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    BlockCacheAllocator(bsls::Types::Int64  maxCachedBytes,
+                        bslma::Allocator   *basicAllocator = 0);
+        // Create a block cache allocator.  Optionally specify
+        // 'maxCachedBytes', the bound on the total size (in bytes) of the
+        // blocks cached at any one time.  If 'maxCachedBytes' is not
+        // specified, 'k_DEFAULT_MAX_CACHED_BYTES' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 <= maxCachedBytes'.
+
+    virtual ~BlockCacheAllocator();
+        // Return all cached blocks to the upstream allocator, and destroy
+        // this allocator.  The behavior is undefined unless every block
+        // allocated from this allocator has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes), taken from the cache if a
+        // block of the size class of 'size' is cached, and obtained from the
+        // upstream allocator otherwise.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator, caching it unless it is larger than
+        // 'k_MAX_CACHED_BLOCK_SIZE' or the cache is full, in which case it is
+        // returned to the upstream allocator.  If 'address' is 0, this
+        // function has no effect.  The behavior is undefined unless 'address'
+        // was allocated using this allocator object and has not already been
+        // deallocated.
+
+    void release();
+        // Return all cached blocks to the upstream allocator.  Note that
+        // blocks in use are not affected.
+
+    // ACCESSORS
+    bsls::Types::Int64 maxCachedBytes() const;
+        // Return the bound on the total size (in bytes) of the blocks cached
+        // at any one time.
+
+    bsls::Types::Int64 numBytesCached() const;
+        // Return the total size (in bytes) of the size classes of the blocks
+        // currently cached.  Note that, if other threads are allocating or
+        // deallocating concurrently, the value returned may be out of date.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class BlockCacheAllocator
+                         // -------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 BlockCacheAllocator::maxCachedBytes() const
+{
+    return d_maxCachedBytes;
+}
+
+inline
+bsls::Types::Int64 BlockCacheAllocator::numBytesCached() const
+{
+    return d_numBytesCached.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1000 @@
+// bdlma_blockcacheallocator.t.cpp                                    -*-C++-*-
+#include <bdlma_blockcacheallocator.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::BlockCacheAllocator' caches deallocated blocks by size class, and
+// supplies them again to later allocations.  The primary concerns are that
+// allocations are served from the cache exactly when a block of the same size
+// class is cached, so that arenas created and destroyed repeatedly on top of
+// the cache stop calling the upstream allocator; that the total size of the
+// cached blocks respects the bound supplied at construction; that blocks
+// overflowing the shard of a thread are cached in the depot and reused by
+// other threads; and that 'release' and the destructor return every cached
+// block upstream.  A 'bslma::TestAllocator' is used as the upstream allocator
+// throughout, to observe the calls to it.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BlockCacheAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] BlockCacheAllocator(Int64 maxCachedBytes, Allocator *ba = 0);
+// [ 2] ~BlockCacheAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void release();
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 maxCachedBytes() const;
+// [ 3] bsls::Types::Int64 numBytesCached() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: The total size of the cached blocks is bounded.
+// [ 5] CONCERN: Short-lived arenas do not call the upstream allocator.
+// [ 6] CONCERN: The allocator is thread-safe, and threads share blocks.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::BlockCacheAllocator Obj;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum {
+    k_MAX_ALIGN  = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+    k_MIN_SIZE   = Obj::k_MIN_BLOCK_SIZE,
+    k_MAX_CACHED = Obj::k_MAX_CACHED_BLOCK_SIZE
+};
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+Int64 classSize(Int64 size)
+    // Return the size of the size class of a block of the specified 'size'
+    // (in bytes), computed by brute force.
+{
+    if (size <= k_MIN_SIZE) {
+        return k_MIN_SIZE;                                            // RETURN
+    }
+
+    Int64 power = k_MIN_SIZE;
+    while (2 * power < size) {
+        power *= 2;
+    }
+
+    Int64 result = power;
+    while (result < size) {
+        result += power / 4;
+    }
+    return result;
+}
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase6 {
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_ITERATIONS = 500,
+    k_NUM_BLOCKS     = 20,
+    k_SHARD_CAPACITY = 4     // blocks of each class cached in a shard
+};
+
+struct ThreadInfo {
+    int   d_id;
+    Obj  *d_obj_p;
+    int   d_numErrors;
+};
+
+inline
+int blockSize(int index)
+    // Return the size of the block having the specified 'index'.
+{
+    return 100 + index * 397;
+}
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    char *blocks[k_NUM_BLOCKS];
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            blocks[j] = static_cast<char *>(
+                                      info->d_obj_p->allocate(blockSize(j)));
+            bsl::memset(blocks[j], info->d_id, blockSize(j));
+        }
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            for (int k = 0; k < blockSize(j); ++k) {
+                if (info->d_id != blocks[j][k]) {
+                    ++info->d_numErrors;
+                    break;
+                }
+            }
+            info->d_obj_p->deallocate(blocks[j]);
+        }
+    }
+
+    return arg;
+}
+
+struct HandoffInfo {
+    Obj   *d_obj_p;
+    void  *d_blocks[16];
+    int    d_numBlocks;
+};
+
+extern "C" void *deallocateFunction(void *arg)
+{
+    HandoffInfo *info = static_cast<HandoffInfo *>(arg);
+
+    for (int i = 0; i < info->d_numBlocks; ++i) {
+        info->d_obj_p->deallocate(info->d_blocks[i]);
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase6
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recycling the Blocks of Per-Request Arenas
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server handles each request using an arena, a
+// 'bdlma::SequentialAllocator', from which all of the memory needed by the
+// request is allocated, and which is destroyed (releasing all of that memory
+// at once) when the request is done.
+//
+// First, we create a block cache allocator, shared by all requests, on top of
+// the allocator supplying the memory of the server (here, a
+// 'bslma::TestAllocator', so that we can observe its use):
+//..
+//  bslma::TestAllocator       upstream;
+//  bdlma::BlockCacheAllocator cache(&upstream);
+//..
+// Then, we define a function handling a request, whose arena obtains its
+// blocks from the block cache allocator:
+//..
+    void handleRequest(bslma::Allocator *requestAllocator, int requestSize)
+    {
+        bdlma::SequentialAllocator arena(requestAllocator);
+
+        for (int i = 0; i < requestSize; ++i) {
+            arena.allocate(100);
+        }
+    }
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+    bslma::TestAllocator       upstream("upstream", veryVeryVerbose);
+    bdlma::BlockCacheAllocator cache(&upstream);
+
+// Next, we handle a first request, which (with the cache empty) obtains the
+// blocks of its arena from the upstream allocator, but does not return them:
+//..
+    handleRequest(&cache, 100);
+
+    const bsls::Types::Int64 numAllocations = upstream.numAllocations();
+
+    ASSERT(0 < numAllocations);
+    ASSERT(0 < upstream.numBlocksInUse());
+    ASSERT(0 < cache.numBytesCached());
+//..
+// Finally, we handle more requests, and observe that the blocks of their
+// arenas are all supplied by the cache:
+//..
+    for (int i = 0; i < 100; ++i) {
+        handleRequest(&cache, 100);
+    }
+
+    ASSERT(numAllocations == upstream.numAllocations());
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY AND SHARING BETWEEN THREADS
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate' never hand out a
+        //:   block that is in use.
+        //:
+        //: 2 Blocks deallocated by one thread beyond the capacity of its shard
+        //:   are reused by another thread without calling the upstream
+        //:   allocator.
+        //:
+        //: 3 Blocks left in the shard of a thread that has exited are reused
+        //:   by another thread, whose allocations missing its own shard and
+        //:   the depot each look in one other shard.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate a batch of blocks of
+        //:   various sizes, fill each block with a per-thread pattern, verify
+        //:   the pattern, and deallocate the blocks.  Verify that the number
+        //:   of blocks obtained from upstream is bounded by the number in use
+        //:   at any one time plus the number that the shards can cache.
+        //:   (C-1)
+        //:
+        //: 2 Allocate many blocks of one class in the main thread, deallocate
+        //:   them in another thread, and allocate them again in the main
+        //:   thread.  Verify that the blocks overflowing the shard of the
+        //:   other thread are supplied without calling the upstream
+        //:   allocator, and that those left in its shard are supplied within
+        //:   'k_NUM_SHARDS' further calls to the upstream allocator.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe, and threads share blocks.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY AND SHARING BETWEEN "
+                          << "THREADS" << endl
+                          << "=========================================="
+                          << "=======" << endl;
+
+        using namespace TestCase6;
+
+        if (verbose) cout << "\nTesting concurrent use." << endl;
+        {
+            bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+            Obj mX(Int64(1) << 30, &ta);
+
+            ThreadId   threads[k_NUM_THREADS];
+            ThreadInfo infos[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                infos[i].d_id        = i + 1;
+                infos[i].d_obj_p     = &mX;
+                infos[i].d_numErrors = 0;
+
+                threads[i] = createThread(&threadFunction, &infos[i]);
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+                ASSERTV(i, infos[i].d_numErrors, 0 == infos[i].d_numErrors);
+            }
+
+            if (veryVerbose) { P(ta.numAllocations()) }
+
+            // A block is obtained from upstream only while the depot caches
+            // no block of its class, i.e., while every other block of its
+            // class is either in use or in a shard.
+
+            ASSERTV(ta.numAllocations(),
+                    ta.numAllocations() <= k_NUM_BLOCKS
+                                         * (k_NUM_THREADS
+                                          + Obj::k_NUM_SHARDS
+                                                          * k_SHARD_CAPACITY));
+        }
+
+        if (verbose) cout << "\nTesting handoff between threads." << endl;
+        {
+            bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            HandoffInfo info;
+            info.d_obj_p     = &mX;
+            info.d_numBlocks = 16;
+
+            for (int i = 0; i < info.d_numBlocks; ++i) {
+                info.d_blocks[i] = mX.allocate(4000);
+            }
+            ASSERT(16 == ta.numAllocations());
+
+            joinThread(createThread(&deallocateFunction, &info));
+
+            ASSERT(16 * classSize(4000) == X.numBytesCached());
+
+            // The exited thread left 4 blocks in its shard, and 12 in the
+            // depot.
+
+            void *blocks[12 + Obj::k_NUM_SHARDS + 4];
+            int   numBlocks = 0;
+
+            while (numBlocks < 12) {
+                blocks[numBlocks++] = mX.allocate(4000);
+            }
+            ASSERT(16                  == ta.numAllocations());
+            ASSERT(4 * classSize(4000) == X.numBytesCached());
+
+            while (0 < X.numBytesCached()
+                && numBlocks < 12 + Obj::k_NUM_SHARDS + 4) {
+                blocks[numBlocks++] = mX.allocate(4000);
+            }
+            if (veryVerbose) { P(numBlocks) }
+
+            ASSERT(0 == X.numBytesCached());
+            ASSERTV(numBlocks, ta.numAllocations(),
+                    numBlocks == ta.numAllocations());
+
+            for (int i = 0; i < numBlocks; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: SHORT-LIVED ARENAS
+        //
+        // Concerns:
+        //: 1 Arenas built on 'bdlma::BlockList' ('SequentialAllocator'),
+        //:   'bdlma::SequentialPool' ('BufferedSequentialAllocator' beyond its
+        //:   buffer), and 'bdlma::InfrequentDeleteBlockList'
+        //:   ('MultipoolAllocator'), created and destroyed repeatedly on top
+        //:   of a block cache allocator, call the upstream allocator only
+        //:   while the cache is warming up.
+        //
+        // Plan:
+        //: 1 For each kind of arena, run a few identical "requests", each
+        //:   creating an arena, allocating from it, and destroying it, and
+        //:   verify that the number of upstream allocations does not change
+        //:   after the first request, and that no block is then in use
+        //:   except for those cached.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Short-lived arenas do not call the upstream allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: SHORT-LIVED ARENAS" << endl
+                          << "===========================" << endl;
+
+        enum { k_NUM_REQUESTS = 10, k_NUM_ALLOCATIONS = 500 };
+
+        for (int kind = 0; kind < 3; ++kind) {
+            bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            Int64 numAllocations = 0;
+
+            for (int i = 0; i < k_NUM_REQUESTS; ++i) {
+                switch (kind) {
+                  case 0: {
+                    bdlma::SequentialAllocator arena(&mX);
+                    for (int j = 0; j < k_NUM_ALLOCATIONS; ++j) {
+                        arena.allocate(1 + j % 200);
+                    }
+                  } break;
+                  case 1: {
+                    char buffer[512];
+                    bdlma::BufferedSequentialAllocator arena(buffer,
+                                                             sizeof buffer,
+                                                             &mX);
+                    for (int j = 0; j < k_NUM_ALLOCATIONS; ++j) {
+                        arena.allocate(1 + j % 200);
+                    }
+                  } break;
+                  case 2: {
+                    bdlma::MultipoolAllocator arena(&mX);
+                    for (int j = 0; j < k_NUM_ALLOCATIONS; ++j) {
+                        arena.allocate(1 + j % 200);
+                    }
+                  } break;
+                }
+
+                if (0 == i) {
+                    numAllocations = ta.numAllocations();
+                    ASSERTV(kind, 0 < numAllocations);
+                }
+
+                ASSERTV(kind, i, numAllocations, ta.numAllocations(),
+                        numAllocations == ta.numAllocations());
+                ASSERTV(kind, i, 0 == ta.numDeallocations());
+            }
+
+            ASSERTV(kind, 0 < X.numBytesCached());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'release' AND THE BOUND ON CACHED BYTES
+        //
+        // Concerns:
+        //: 1 A block deallocated while caching it would exceed
+        //:   'maxCachedBytes' is returned upstream, and other blocks are
+        //:   cached.
+        //:
+        //: 2 A cache whose bound is 0 caches nothing.
+        //:
+        //: 3 Blocks of a class deallocated beyond the capacity of the shard of
+        //:   the calling thread are cached (in the depot) and reused.
+        //:
+        //: 4 'release' returns every cached block upstream, and the cache
+        //:   remains usable.
+        //
+        // Plan:
+        //: 1 With a bound of two blocks, deallocate three blocks and verify
+        //:   the number of bytes cached and the upstream deallocations.
+        //:   (C-1)
+        //:
+        //: 2 Repeat with a bound of 0.  (C-2)
+        //:
+        //: 3 Deallocate many blocks of one class, verify that all are cached,
+        //:   and reallocate them without calling upstream.  (C-3)
+        //:
+        //: 4 Call 'release' with blocks cached (in shards and in the depot),
+        //:   and verify that no block remains in use upstream.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   CONCERN: The total size of the cached blocks is bounded.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release' AND THE BOUND ON CACHED BYTES" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the bound." << endl;
+        {
+            Obj mX(2 * 1024, &ta);  const Obj& X = mX;
+
+            void *a = mX.allocate(1024);
+            void *b = mX.allocate(1024);
+            void *c = mX.allocate(1024);
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+            ASSERT(2048 == X.numBytesCached());
+            ASSERT(0    == ta.numDeallocations());
+
+            mX.deallocate(c);
+            ASSERT(2048 == X.numBytesCached());
+            ASSERT(1    == ta.numDeallocations());
+            ASSERT(2    == ta.numBlocksInUse());
+
+            ASSERT(b == mX.allocate(1000));
+            ASSERT(1024 == X.numBytesCached());
+
+            mX.deallocate(b);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting a bound of 0." << endl;
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            mX.deallocate(mX.allocate(1000));
+            ASSERT(0 == X.numBytesCached());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting overflow to the depot." << endl;
+        {
+            enum { k_NUM_BLOCKS = 20 };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            void *blocks[k_NUM_BLOCKS];
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(300);
+            }
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(k_NUM_BLOCKS * 320 == X.numBytesCached());
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(320);
+            }
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(0               == X.numBytesCached());
+
+            if (verbose) cout << "\nTesting 'release'." << endl;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(mX.allocate(5000));
+
+            const Int64 NUM_BLOCKS_IN_USE = ta.numBlocksInUse();
+            ASSERT(k_NUM_BLOCKS + 1 == NUM_BLOCKS_IN_USE);
+
+            mX.release();
+            ASSERT(0 == X.numBytesCached());
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == X.numBytesCached());
+
+            mX.deallocate(mX.allocate(5000));
+            ASSERT(classSize(5000) == X.numBytesCached());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, writable blocks of at least
+        //:   the requested size.
+        //:
+        //: 2 An allocation is served from the cache if, and only if, a block
+        //:   of its size class is cached, in which case the most recently
+        //:   deallocated such block is returned.
+        //:
+        //: 3 The size classes are four evenly spaced sizes within each power
+        //:   of two, from 'k_MIN_BLOCK_SIZE' to 'k_MAX_CACHED_BLOCK_SIZE'.
+        //:
+        //: 4 'numBytesCached' is the total size of the classes of the cached
+        //:   blocks.
+        //:
+        //: 5 Blocks larger than 'k_MAX_CACHED_BLOCK_SIZE' are allocated from,
+        //:   and returned to, the upstream allocator directly.
+        //:
+        //: 6 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //
+        // Plan:
+        //: 1 For a set of sizes around each class boundary, allocate a block
+        //:   of that size, write every byte, deallocate it, and verify that
+        //:   allocations of the smallest and largest sizes of its class reuse
+        //:   it, while allocations of the neighboring classes do not.
+        //:   (C-1..4)
+        //:
+        //: 2 Allocate and deallocate blocks larger than the largest class, and
+        //:   verify the upstream calls.  (C-5)
+        //:
+        //: 3 Call 'allocate(0)' and 'deallocate(0)'.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesCached() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting size classes." << endl;
+        {
+            Obj mX(Int64(1) << 30, &ta);  const Obj& X = mX;
+
+            for (Int64 size = 1; size <= k_MAX_CACHED; size += size / 7 + 1) {
+                const Int64 CLASS = classSize(size);
+                const Int64 LOW   = CLASS <= k_MIN_SIZE
+                                  ? 1
+                                  : classSize(CLASS - 1) == CLASS
+                                    ? CLASS - CLASS / 8 + 1  // never below
+                                    : CLASS;                 // the class
+
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, 0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGN);
+
+                bsl::memset(p, 'x', static_cast<bsl::size_t>(size));
+
+                mX.deallocate(p);
+                ASSERTV(size, CLASS == X.numBytesCached());
+
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+                // The largest size of the class reuses the block.
+
+                ASSERTV(size, p == mX.allocate(CLASS));
+                ASSERTV(size, 0 == X.numBytesCached());
+                mX.deallocate(p);
+
+                // So does a smaller size of the same class.
+
+                ASSERTV(size, classSize(LOW) == CLASS);
+                ASSERTV(size, p == mX.allocate(LOW));
+                mX.deallocate(p);
+
+                ASSERTV(size, NUM_ALLOCATIONS == ta.numAllocations());
+
+                // The next class does not.
+
+                if (CLASS < k_MAX_CACHED) {
+                    void *q = mX.allocate(CLASS + 1);
+                    ASSERTV(size, p != q);
+                    ASSERTV(size, NUM_ALLOCATIONS + 1 == ta.numAllocations());
+                    mX.deallocate(q);
+                }
+
+                mX.release();
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting class boundaries." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_size;
+                int d_classSize;
+            } DATA[] = {
+                //LINE  SIZE     CLASS
+                //----  -------  -------
+                { L_,         1,     256 },
+                { L_,       256,     256 },
+                { L_,       257,     320 },
+                { L_,       320,     320 },
+                { L_,       321,     384 },
+                { L_,       449,     512 },
+                { L_,       512,     512 },
+                { L_,       513,     640 },
+                { L_,      1025,    1280 },
+                { L_,      4097,    5120 },
+                { L_,    786433,  917504 },
+                { L_,   1048576, 1048576 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int SIZE  = DATA[ti].d_size;
+                const int CLASS = DATA[ti].d_classSize;
+
+                Obj mX(&ta);  const Obj& X = mX;
+
+                mX.deallocate(mX.allocate(SIZE));
+                ASSERTV(LINE, X.numBytesCached(), CLASS == X.numBytesCached());
+                ASSERTV(LINE, CLASS == classSize(SIZE));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting large blocks." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            char *p = static_cast<char *>(mX.allocate(k_MAX_CACHED + 1));
+            ASSERT(0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGN);
+            bsl::memset(p, 'x', k_MAX_CACHED + 1);
+
+            ASSERT(1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == X.numBytesCached());
+        }
+
+        if (verbose) cout << "\nTesting 0." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(0 == ta.numAllocations() - ta.numDeallocations());
+            ASSERT(0 == X.numBytesCached());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, DTOR, AND 'maxCachedBytes'
+        //
+        // Concerns:
+        //: 1 A default-constructed cache uses the default allocator, and the
+        //:   default bound on cached bytes.
+        //:
+        //: 2 The bound and allocator supplied at construction are used.
+        //:
+        //: 3 The destructor returns all cached blocks upstream.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct caches with and without each argument, allocate and
+        //:   deallocate a block, and verify which allocator supplied it, the
+        //:   value of 'maxCachedBytes', and that no block remains in use
+        //:   after destruction.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative bound.  (C-4)
+        //
+        // Testing:
+        //   BlockCacheAllocator(bslma::Allocator *basicAllocator = 0);
+        //   BlockCacheAllocator(Int64 maxCachedBytes, Allocator *ba = 0);
+        //   ~BlockCacheAllocator();
+        //   bsls::Types::Int64 maxCachedBytes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, DTOR, AND 'maxCachedBytes'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            Obj *objPtr = 0;
+            bslma::TestAllocator *upstream = &ta;
+
+            switch (cfg) {
+              case 'a': {
+                objPtr   = new (globalAllocator) Obj();
+                upstream = &da;
+              } break;
+              case 'b': {
+                objPtr = new (globalAllocator) Obj(&ta);
+              } break;
+              case 'c': {
+                objPtr   = new (globalAllocator) Obj(4096);
+                upstream = &da;
+              } break;
+              case 'd': {
+                objPtr = new (globalAllocator) Obj(4096, &ta);
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            const Int64 EXP_MAX = cfg <= 'b'
+                                ? Int64(Obj::k_DEFAULT_MAX_CACHED_BYTES)
+                                : 4096;
+
+            ASSERTV(cfg, EXP_MAX == X.maxCachedBytes());
+            ASSERTV(cfg, 0       == X.numBytesCached());
+
+            mX.deallocate(mX.allocate(1000));
+            mX.deallocate(mX.allocate(2000));
+
+            ASSERTV(cfg, 2 == upstream->numBlocksInUse());
+            ASSERTV(cfg, 0 < X.numBytesCached());
+
+            globalAllocator.deleteObject(objPtr);
+
+            ASSERTV(cfg, 0 == da.numBlocksInUse());
+            ASSERTV(cfg, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(0, &ta));
+            ASSERT_FAIL(Obj(-1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks, and verify that deallocated
+        //:   blocks are reused without calling the upstream allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(1000);
+            void *q = mX.allocate(1000);
+            ASSERT(p != q);
+            ASSERT(2 == ta.numAllocations());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == ta.numDeallocations());
+            ASSERT(0 <  X.numBytesCached());
+
+            ASSERT(q == mX.allocate(1000));
+            ASSERT(p == mX.allocate(1000));
+            ASSERT(2 == ta.numAllocations());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
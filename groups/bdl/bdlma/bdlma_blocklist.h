@@ -12,7 +12,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlma::BlockList: memory manager that allocates and manages memory blocks
 //
-//@SEE_ALSO: bdlma_infrequentdeleteblocklist
+//@SEE_ALSO: bdlma_infrequentdeleteblocklist, bdlma_blockcacheallocator
 //
 //@DESCRIPTION: This component implements a low-level memory manager,
 // 'bdlma::BlockList', that allocates and manages a sequence of memory blocks,
@@ -69,6 +69,14 @@ BSLS_IDENT("$Id: $")
 // 'allocate' with the pool directly.  However, the allocator interface is much
 // more widely accepted across objects, and hence more general purpose.
 //
+// The 'allocate', 'deallocate', and 'release' methods of
+// 'bdlma::BufferedSequentialAllocator' are declared 'final' (when compiled as
+// C++11) and are defined inline, so calls made through a pointer or reference
+// to this class (or to 'bdlma::LocalSequentialAllocator', which derives from
+// it) may be devirtualized by the compiler; 'bslma::StaticAllocator' can be
+// used to preserve the concrete type when supplying the allocator to a
+// container.
+//
 ///Optional 'maxBufferSize' Parameter
 /// - - - - - - - - - - - - - - - - -
 // An optional 'maxBufferSize' parameter can be supplied at construction to
@@ -90,6 +98,22 @@ BSLS_IDENT("$Id: $")
 // wasted depends on whether natural alignment, maximum alignment, or 1-byte
 // alignment is used (see 'bsls_alignment' for more details).
 //
+///Checkpoints
+///-----------
+// The 'checkpoint' method returns a value recording the current allocation
+// state of the allocator, and the 'rewind' method restores the allocator to a
+// state previously recorded by 'checkpoint', reclaiming all memory allocated
+// since then without regard to the number of individual allocations: the
+// buffers and separately-allocated blocks obtained after the checkpoint are
+// returned to the underlying allocator, and subsequent allocations resume from
+// the position in the buffer that was current when the checkpoint was taken.
+// If the checkpoint was obtained while the allocator was still allocating from
+// the external buffer, rewinding returns all dynamically-allocated memory and
+// resumes allocating from the external buffer.  Memory allocated before the
+// checkpoint is unaffected, and a allocator may be rewound to the same
+// checkpoint repeatedly.  See 'bdlma_autorewinder' for a proctor that rewinds
+// a allocator to a checkpoint on scope exit.
+//
 ///Usage
 ///-----
 ///Example 1: Using 'bdlma::BufferedSequentialAllocator' with Exact Calculation
@@ -200,6 +224,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_blockgrowth.h>
 #endif
 
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -220,6 +252,13 @@ class BufferedSequentialAllocator : public ManagedAllocator {
     // allocator supplied at construction.  Note that in no case will the
     // buffered sequential allocator attempt to deallocate the external buffer.
 
+  public:
+    // PUBLIC TYPES
+    typedef BufferedSequentialPool::Checkpoint Checkpoint;
+        // 'Checkpoint' is an alias for the type recording the allocation
+        // state of this allocator, as returned by 'checkpoint'.
+
+  private:
     // DATA
     BufferedSequentialPool d_pool;  // manager for allocated memory blocks
 
@@ -315,7 +354,7 @@ class BufferedSequentialAllocator : public ManagedAllocator {
         // from this allocator is released.
 
     // MANIPULATORS
-    virtual void *allocate(size_type size);
+    virtual void *allocate(size_type size) BSLS_CPP11_FINAL;
         // Return the address of a contiguous block of memory of the specified
         // 'size' (in bytes) according to the alignment strategy specified at
         // construction.  If 'size' is 0, no memory is allocated and 0 is
@@ -323,19 +362,63 @@ class BufferedSequentialAllocator : public ManagedAllocator {
         // memory space in the external buffer supplied at construction, use
         // memory obtained from the allocator supplied at construction.
 
-    virtual void deallocate(void *address);
+    virtual void *allocateAligned(size_type size, size_type alignment)
+                                                              BSLS_CPP11_FINAL;
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) whose address is a multiple of the specified
+        // 'alignment', ignoring the alignment strategy specified at
+        // construction.  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  If the allocation request (including the padding needed
+        // to reach a suitably aligned address) exceeds the remaining free
+        // memory space in the current buffer, use memory obtained from the
+        // allocator supplied at construction.  The behavior is undefined
+        // unless 'alignment' is a positive power of two.  Note that
+        // 'alignment' may exceed 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'.
+
+    virtual void deallocate(void *address) BSLS_CPP11_FINAL;
         // This method has no effect on the memory block at the specified
         // 'address' as all memory allocated by this allocator is managed.  The
         // behavior is undefined unless 'address' is 0, or was allocated by
         // this allocator and has not already been deallocated.
 
-    virtual void release();
+    virtual void release() BSLS_CPP11_FINAL;
         // Release all memory currently allocated through this allocator.  This
         // method deallocates all memory (if any) allocated with the allocator
         // provided at construction, and makes the memory from the entire
         // external buffer supplied at construction available for subsequent
         // allocations, but has no effect on the contents of the buffer.  Note
         // that this allocator is reset to its initial state by this method.
+
+    void rewind(const Checkpoint& checkpoint);
+        // Release all memory allocated through this allocator since the
+        // specified 'checkpoint' was obtained from it, returning any
+        // dynamically allocated buffers and blocks obtained since then to the
+        // allocator supplied at construction, and resume allocating from the
+        // position recorded by 'checkpoint'.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this allocator, and neither 'release'
+        // nor 'rewind' to a checkpoint obtained earlier than 'checkpoint' has
+        // been called since.  See 'bdlma::BufferedSequentialPool::rewind'.
+
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize) BSLS_CPP11_FINAL;
+        // Attempt to increase the amount of memory allocated at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' now spans 'newSize' bytes, and
+        // 'false' with no effect otherwise.  This method can only expand the
+        // memory block returned by the most recent 'allocate' request from
+        // this allocator, and only if the remaining free memory in the
+        // current buffer suffices.  The behavior is undefined unless the
+        // memory at 'address' was originally allocated by this allocator, the
+        // size of the memory block at 'address' is 'originalSize',
+        // '0 < originalSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.
+
+    // ACCESSORS
+    Checkpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // allocator, for use with 'rewind'.
 };
 
 // ============================================================================
@@ -437,6 +520,29 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
 }
 
 // MANIPULATORS
+inline
+void *BufferedSequentialAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_pool.allocate(size);
+}
+
+inline
+void *BufferedSequentialAllocator::allocateAligned(size_type size,
+                                                   size_type alignment)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_pool.allocate(size, alignment);
+}
+
 inline
 void BufferedSequentialAllocator::deallocate(void *)
 {
@@ -448,6 +554,28 @@ void BufferedSequentialAllocator::release()
     d_pool.release();
 }
 
+inline
+void BufferedSequentialAllocator::rewind(const Checkpoint& checkpoint)
+{
+    d_pool.rewind(checkpoint);
+}
+
+inline
+bool BufferedSequentialAllocator::tryExpand(void      *address,
+                                            size_type  originalSize,
+                                            size_type  newSize)
+{
+    return d_pool.tryExpand(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+BufferedSequentialAllocator::Checkpoint
+BufferedSequentialAllocator::checkpoint() const
+{
+    return d_pool.checkpoint();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -9,8 +9,10 @@
 
 #include <bsls_alignedbuffer.h>
 #include <bsls_asserttest.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdio.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_string.h>
@@ -68,11 +70,17 @@ using namespace bsl;
 //
 // // MANIPULATORS
 // [ 2] void *allocate(size_type size);
+// [ 6] void *allocateAligned(size_type size, size_type alignment);
 // [ 3] void deallocate(void *address);
 // [ 4] void release();
+// [ 7] void rewind(const Checkpoint& checkpoint);
+// [ 8] bool tryExpand(void *, size_type oldSize, size_type newSize);
+//
+// // ACCESSORS
+// [ 7] Checkpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -247,7 +255,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 6: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -329,6 +337,192 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'tryExpand' TEST
+        //
+        // Concerns:
+        //: 1 'tryExpand', invoked through the 'bslma::Allocator' protocol,
+        //:   forwards to the underlying pool: the most recently allocated
+        //:   block is expanded in place if the current buffer has room.
+        //:
+        //: 2 A block that cannot be expanded is left untouched.
+        //
+        // Plan:
+        //: 1 Through a 'bslma::Allocator' pointer, allocate two blocks from
+        //:   the external buffer and attempt to expand each, verifying the
+        //:   return value, the contents of the blocks, the address of the
+        //:   next allocation, and that no memory is obtained from the object
+        //:   allocator.  (C-1..2)
+        //
+        // Testing:
+        //   bool tryExpand(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'tryExpand' TEST" << endl
+                                  << "================" << endl;
+
+        {
+            Obj mX(bufferStorage.buffer(),
+                   BUFFER_SIZE,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+            bslma::Allocator *a = &mX;
+
+            char *p = static_cast<char *>(a->allocate(16));
+            char *q = static_cast<char *>(a->allocate(16));
+            bsl::memset(p, 'x', 16);
+            bsl::memset(q, 'y', 16);
+
+            ASSERT(false == a->tryExpand(p, 16, 32));
+            ASSERT(true  == a->tryExpand(q, 16, 64));
+            ASSERT(false == a->tryExpand(q, 64, BUFFER_SIZE));
+
+            for (int i = 0; i < 16; ++i) {
+                LOOP_ASSERT(i, 'x' == p[i]);
+                LOOP_ASSERT(i, 'y' == q[i]);
+            }
+            bsl::memset(q, 'z', 64);
+
+            ASSERT(q + 64 == a->allocate(1));
+            ASSERT(0      == objectAllocator.numBlocksInUse());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'checkpoint' AND 'rewind' TEST
+        //
+        // Concerns:
+        //: 1 'checkpoint' and 'rewind' forward to the underlying pool: memory
+        //:   obtained since the checkpoint (including memory allocated
+        //:   through the 'bslma::Allocator' protocol) is returned to the
+        //:   allocator supplied at construction, and allocation resumes from
+        //:   the position recorded by the checkpoint.
+        //:
+        //: 2 Memory allocated before the checkpoint is unaffected.
+        //:
+        //: 3 The allocator can be rewound to the same checkpoint repeatedly.
+        //
+        // Plan:
+        //: 1 Create an allocator with a small external buffer, allocate once,
+        //:   take a checkpoint, and allocate enough memory through a
+        //:   'bslma::Allocator' pointer to obtain several new blocks.  Rewind,
+        //:   and verify the number of blocks and bytes in use, the contents of
+        //:   the memory allocated before the checkpoint, and the address of
+        //:   the next allocation.  Repeat several times.  (C-1..3)
+        //
+        // Testing:
+        //   void rewind(const Checkpoint& checkpoint);
+        //   Checkpoint checkpoint() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'checkpoint' AND 'rewind' TEST" << endl
+                                  << "==============================" << endl;
+
+        {
+            bsls::AlignedBuffer<64> buffer;
+            Obj mX(buffer.buffer(), 64, &objectAllocator);
+            bslma::Allocator *a = &mX;
+
+            char *p0 = static_cast<char *>(a->allocate(16));
+            bsl::memset(p0, 'x', 16);
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                              objectAllocator.numBlocksInUse();
+            const bsls::Types::Int64 NUM_BYTES  =
+                                               objectAllocator.numBytesInUse();
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            void *p1 = a->allocate(8);
+
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 16; ++j) {
+                    bsl::memset(a->allocate(1000), 'y', 1000);
+                }
+                LOOP_ASSERT(i, NUM_BLOCKS < objectAllocator.numBlocksInUse());
+
+                mX.rewind(CP);
+                LOOP_ASSERT(i, NUM_BLOCKS ==
+                                             objectAllocator.numBlocksInUse());
+                LOOP_ASSERT(i, NUM_BYTES  == objectAllocator.numBytesInUse());
+                LOOP_ASSERT(i, p1         == a->allocate(8));
+
+                for (int k = 0; k < 16; ++k) {
+                    LOOP2_ASSERT(i, k, 'x' == p0[k]);
+                }
+            }
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'allocateAligned' TEST:
+        //
+        // Concerns:
+        //: 1 'allocateAligned', invoked through the 'bslma::Allocator'
+        //:   protocol, returns memory whose address is a multiple of the
+        //:   requested alignment, including alignments exceeding the maximal
+        //:   alignment.
+        //:
+        //: 2 Requesting 0 bytes returns 0 with no effect.
+        //:
+        //: 3 All memory is reclaimed by 'release'.
+        //
+        // Plan:
+        //: 1 Using an allocator supplied with a test allocator, request blocks
+        //:   having various sizes and alignments through a base-class
+        //:   reference, verify the alignment of each address, and write to
+        //:   each block in its entirety so that the test allocator detects
+        //:   any overrun.  Verify that a request for 0 bytes returns 0.
+        //:   Finally, invoke 'release' and verify that no memory remains in
+        //:   use.  (C-1..3)
+        //
+        // Testing:
+        //   void *allocateAligned(size_type size, size_type alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocateAligned' TEST" << endl
+                                  << "======================" << endl;
+
+        typedef bsls::Types::IntPtr IntPtr;
+
+        const int SIZES[]      = { 1, 7, 64, 100, 1000, 5000 };
+        const int NUM_SIZES    = sizeof SIZES / sizeof *SIZES;
+
+        const int ALIGNS[]     = { 1, 2, 8, 16, 32, 64, 256, 4096 };
+        const int NUM_ALIGNS   = sizeof ALIGNS / sizeof *ALIGNS;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        char *buffer = bufferStorage.buffer();
+
+        Obj mX(buffer, BUFFER_SIZE, &ta);
+
+        bslma::Allocator& a = mX;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_ALIGNS; ++j) {
+                const int SIZE  = SIZES[i];
+                const int ALIGN = ALIGNS[j];
+
+                if (veryVerbose) { T_ P_(SIZE) P(ALIGN) }
+
+                void *p = a.allocateAligned(SIZE, ALIGN);
+                ASSERTV(SIZE, ALIGN,
+                        0 == reinterpret_cast<IntPtr>(p) % ALIGN);
+                memset(p, 0xa5, SIZE);
+            }
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+        ASSERT(0 == a.allocateAligned(0, 64));
+        ASSERT(NUM_BLOCKS == ta.numBlocksTotal());
+
+        mX.release();
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // DTOR TEST
@@ -24,7 +24,12 @@ BSLS_IDENT("$Id: $")
 // growth strategy is specified at construction, geometric growth is used.
 // Users can also optionally specify an alignment strategy at construction that
 // governs the alignment of allocated memory blocks.  If no alignment strategy
-// is specified, natural alignment is used.
+// is specified, natural alignment is used.  Note that, with adaptive growth
+// ('bsls::BlockGrowth::BSLS_ADAPTIVE'), the dynamically-allocated buffers grow
+// geometrically as long as each request fits after at most two growth steps;
+// a larger request is served by a separate memory block and the current
+// buffer is kept, so that an occasional outsized request does not inflate the
+// size of every subsequent buffer.
 //
 // 'bdlma::BufferedSequentialPool' is typically used when users have a
 // reasonable estimation of the amount of memory needed.  This amount of memory
@@ -58,6 +63,22 @@ BSLS_IDENT("$Id: $")
 // wasted depends on whether natural alignment, maximum alignment, or 1-byte
 // alignment is used (see 'bsls_alignment' for more details).
 //
+///Checkpoints
+///-----------
+// The 'checkpoint' method returns a value recording the current allocation
+// state of the pool, and the 'rewind' method restores the pool to a state
+// previously recorded by 'checkpoint', reclaiming all memory allocated since
+// then without regard to the number of individual allocations: the buffers and
+// separately-allocated blocks obtained after the checkpoint are returned to
+// the underlying allocator, and subsequent allocations resume from the
+// position in the buffer that was current when the checkpoint was taken.  If
+// the checkpoint was obtained while the pool was still allocating from the
+// external buffer, rewinding returns all dynamically-allocated memory and
+// resumes allocating from the external buffer.  Memory allocated before the
+// checkpoint is unaffected, and a pool may be rewound to the same checkpoint
+// repeatedly.  See 'bdlma_autorewinder' for a proctor that rewinds a pool to a
+// checkpoint on scope exit.
+//
 ///Usage
 ///-----
 ///Example 1: Using 'bdlma::BufferedSequentialPool' for Efficient Allocations
@@ -346,6 +367,21 @@ class BufferedSequentialPool {
     // construction.  Note that in no case will the buffered sequential pool
     // attempt to deallocate the external buffer.
 
+  public:
+    // PUBLIC TYPES
+    struct Checkpoint {
+        // This 'struct' records the allocation state of a buffered sequential
+        // pool, as returned by 'checkpoint', so that the pool can later be
+        // rewound to that state using 'rewind'.  Its members are
+        // implementation details and must not be used directly by clients.
+
+        char *d_buffer_p;    // current buffer (if any)
+        int   d_bufferSize;  // size (in bytes) of current buffer
+        int   d_cursor;      // offset of next available byte in buffer
+        void *d_block_p;     // most recently allocated block (if any)
+    };
+
+  private:
     // DATA
     char                *d_initialBuffer_p;  // external buffer supplied at
                                              // construction
@@ -465,6 +501,18 @@ class BufferedSequentialPool {
         // memory obtained from the allocator supplied at construction.  The
         // behavior is undefined unless '0 < size'.
 
+    void *allocate(bsls::Types::size_type size,
+                   bsls::Types::size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) whose address is a multiple of the specified
+        // 'alignment', ignoring the alignment strategy specified at
+        // construction.  If the allocation request (including the padding
+        // needed to reach a suitably aligned address) exceeds the remaining
+        // free memory space in the current buffer, use memory obtained from
+        // the allocator supplied at construction.  The behavior is undefined
+        // unless '0 < size' and 'alignment' is a positive power of two.  Note
+        // that 'alignment' may exceed 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'.
+
     void deallocate(void*) {}
 
     template <class TYPE>
@@ -486,6 +534,40 @@ class BufferedSequentialPool {
         // external buffer supplied at construction available for subsequent
         // allocations, but has no effect on the contents of the buffer.  Note
         // that this pool is reset to its initial state by this method.
+
+    void rewind(const Checkpoint& checkpoint);
+        // Release all memory allocated through this pool since the specified
+        // 'checkpoint' was obtained from it, returning any dynamically
+        // allocated buffers and blocks obtained since then to the allocator
+        // supplied at construction, and resume allocating from the position
+        // recorded by 'checkpoint' (which may lie within the external buffer
+        // supplied at construction).  Memory allocated before 'checkpoint'
+        // was obtained is unaffected.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this pool, and neither 'release' nor
+        // 'rewind' to a checkpoint obtained earlier than 'checkpoint' has
+        // been called since.  Note that 'checkpoint' remains valid after this
+        // call, so the pool may be rewound to it repeatedly.
+
+    bool tryExpand(void                   *address,
+                   bsls::Types::size_type  originalSize,
+                   bsls::Types::size_type  newSize);
+        // Attempt to increase the amount of memory allocated at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' now spans 'newSize' bytes, and
+        // 'false' with no effect otherwise.  This method can only expand the
+        // memory block returned by the most recent 'allocate' request from
+        // this pool, and only if the remaining free memory in the current
+        // buffer suffices.  The behavior is undefined unless the memory at
+        // 'address' was originally allocated by this pool, the size of the
+        // memory block at 'address' is 'originalSize',
+        // '0 < originalSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.
+
+    // ACCESSORS
+    Checkpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // pool, for use with 'rewind'.
 };
 
 }  // close package namespace
@@ -598,6 +680,41 @@ void BufferedSequentialPool::release()
     d_blockList.release();
 }
 
+inline
+void BufferedSequentialPool::rewind(const Checkpoint& checkpoint)
+{
+    d_blockList.releaseAfter(checkpoint.d_block_p);
+    d_buffer.restore(checkpoint.d_buffer_p,
+                     checkpoint.d_bufferSize,
+                     checkpoint.d_cursor);
+}
+
+inline
+bool BufferedSequentialPool::tryExpand(void                   *address,
+                                       bsls::Types::size_type  originalSize,
+                                       bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 < originalSize);
+    BSLS_ASSERT_SAFE(originalSize <= newSize);
+
+    return d_buffer.tryExpand(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+BufferedSequentialPool::Checkpoint BufferedSequentialPool::checkpoint() const
+{
+    Checkpoint checkpoint;
+
+    checkpoint.d_buffer_p   = d_buffer.buffer();
+    checkpoint.d_bufferSize = d_buffer.bufferSize();
+    checkpoint.d_cursor     = d_buffer.cursor();
+    checkpoint.d_block_p    = d_blockList.mostRecentBlock();
+
+    return checkpoint;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -12,6 +12,7 @@
 #include <bsls_alignedbuffer.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_asserttest.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -65,14 +66,20 @@ using namespace bsl;
 //
 // // MANIPULATORS
 // [ 4] void *allocate(size_type size);
+// [ 9] void *allocate(size_type size, size_type alignment);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
+// [10] void rewind(const Checkpoint& checkpoint);
+// [11] bool tryExpand(void *, size_type oldSize, size_type newSize);
+//
+// // ACCESSORS
+// [10] Checkpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [ 8] FREE FUNCTION: 'operator new(size_t, bdlma::BufferedSequentialPool)'
-// [ 9] USAGE TEST
+// [12] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -486,7 +493,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -509,6 +516,272 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // 'tryExpand' TEST
+        //
+        // Concerns:
+        //: 1 'tryExpand' succeeds for the most recently allocated block if the
+        //:   remaining free memory in the current buffer suffices, both in
+        //:   the external buffer and in a dynamically-allocated buffer.
+        //:
+        //: 2 'tryExpand' fails, with no effect, for a block other than the
+        //:   most recently allocated one, or if the remaining free memory is
+        //:   insufficient; in particular, it never allocates memory.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks from the external buffer, attempt to expand them
+        //:   to various sizes, and verify the return value, the address of
+        //:   the next allocation, and that no memory is obtained from the
+        //:   object allocator.  (C-1..2)
+        //:
+        //: 2 Exhaust the external buffer and repeat for a block in the
+        //:   dynamically-allocated buffer that follows.  (C-1..2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   bool tryExpand(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'tryExpand' TEST" << endl
+                                  << "================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting expansion in the external buffer."
+                          << endl;
+        {
+            Obj mX(buffer,
+                   BUFFER_SIZE,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            char *q = static_cast<char *>(mX.allocate(8));
+
+            ASSERT(false == mX.tryExpand(p, 8, 16));
+            ASSERT(true  == mX.tryExpand(q, 8, 8));
+            ASSERT(true  == mX.tryExpand(q, 8, BUFFER_SIZE - 8));
+            ASSERT(false == mX.tryExpand(q, BUFFER_SIZE - 8, BUFFER_SIZE));
+
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+
+            // The external buffer is now exhausted.
+
+            char *r = static_cast<char *>(mX.allocate(8));
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting expansion in an internal buffer."
+                              << endl;
+
+            ASSERT(true  == mX.tryExpand(r, 8, 32));
+            ASSERT(r + 32 == mX.allocate(1));
+            ASSERT(false == mX.tryExpand(r, 32, 64));
+
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(buffer, BUFFER_SIZE, &objectAllocator);
+
+            void *p = mX.allocate(8);
+
+            ASSERT_SAFE_PASS(mX.tryExpand(p, 8, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(0, 8, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(p, 0, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(p, 8, 7));
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // 'checkpoint' AND 'rewind' TEST
+        //
+        // Concerns:
+        //: 1 Rewinding to a checkpoint taken while allocating from the
+        //:   external buffer returns all dynamically-allocated memory and
+        //:   resumes allocating from the external buffer at the position
+        //:   recorded by the checkpoint.
+        //:
+        //: 2 Rewinding to a checkpoint taken while allocating from a
+        //:   dynamically-allocated buffer returns only the memory obtained
+        //:   since the checkpoint.
+        //:
+        //: 3 A pool can be rewound to the same checkpoint repeatedly.
+        //
+        // Plan:
+        //: 1 Allocate from the external buffer, take a checkpoint, and
+        //:   allocate enough memory to obtain several dynamically-allocated
+        //:   blocks.  Rewind, and verify that no memory is in use by the
+        //:   object allocator and that the next allocation returns the
+        //:   address that followed the checkpoint.  Repeat several times.
+        //:   (C-1, 3)
+        //:
+        //: 2 Exhaust the external buffer, take a checkpoint, allocate enough
+        //:   memory to obtain several more blocks, rewind, and verify the
+        //:   number of blocks in use and the address of the next allocation.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void rewind(const Checkpoint& checkpoint);
+        //   Checkpoint checkpoint() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'checkpoint' AND 'rewind' TEST" << endl
+                                  << "==============================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting rewind to the external buffer."
+                          << endl;
+        {
+            Obj mX(buffer, BUFFER_SIZE, &objectAllocator);
+            mX.allocate(8);
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            ASSERT(buffer <= p);
+            ASSERT(p      <  buffer + BUFFER_SIZE);
+
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 8; ++j) {
+                    mX.allocate(BUFFER_SIZE);
+                }
+                LOOP_ASSERT(i, 0 < objectAllocator.numBlocksInUse());
+
+                mX.rewind(CP);
+                LOOP_ASSERT(i, 0 == objectAllocator.numBlocksInUse());
+                LOOP_ASSERT(i, p == mX.allocate(8));
+            }
+        }
+
+        if (verbose) cout << "\nTesting rewind to a dynamic buffer." << endl;
+        {
+            Obj mX(buffer, BUFFER_SIZE, &objectAllocator);
+            mX.allocate(BUFFER_SIZE);
+            mX.allocate(8);
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                            objectAllocator.numBlocksInUse();
+            const bsls::Types::Int64 NUM_BYTES  =
+                                             objectAllocator.numBytesInUse();
+            ASSERT(0 < NUM_BLOCKS);
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            void *p = mX.allocate(8);
+
+            for (int i = 0; i < 8; ++i) {
+                mX.allocate(BUFFER_SIZE);
+            }
+            mX.allocate(64 * BUFFER_SIZE);
+            ASSERT(NUM_BLOCKS < objectAllocator.numBlocksInUse());
+
+            mX.rewind(CP);
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+            ASSERT(NUM_BYTES  == objectAllocator.numBytesInUse());
+            ASSERT(p          == mX.allocate(8));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // ALIGNED 'allocate' TEST:
+        //
+        // Concerns:
+        //: 1 The returned address is a multiple of the requested alignment,
+        //:   and aligned requests are carved from the external buffer,
+        //:   consuming only the padding needed to reach an aligned address.
+        //:
+        //: 2 When the external buffer is exhausted, a dynamically allocated
+        //:   buffer large enough for the block and its alignment slack is
+        //:   used.
+        //:
+        //: 3 A request exceeding the maximum buffer size is satisfied by a
+        //:   dedicated block.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a pool constructed with a page-aligned external buffer and
+        //:   a test allocator, request blocks with various alignments and
+        //:   verify the returned addresses and the number of blocks allocated
+        //:   from the test allocator.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size, size_type alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ALIGNED 'allocate' TEST" << endl
+                                  << "=======================" << endl;
+
+        typedef bsls::Types::IntPtr IntPtr;
+
+        enum { PAGE = 4096 };
+
+        static char storage[2 * PAGE];
+        char *buffer = storage
+                     + bsls::AlignmentUtil::calculateAlignmentOffset(storage,
+                                                                     PAGE);
+
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(buffer, BUFFER_SIZE, 512, &ta);
+
+            ASSERT(buffer       == mX.allocate(1, 1));
+            ASSERT(buffer +  64 == mX.allocate(10, 64));
+            ASSERT(buffer + 128 == mX.allocate(100, 128));
+            ASSERT(0 == ta.numBlocksInUse());
+
+            void *p = mX.allocate(64, 64);
+            ASSERTV(p, 0 == reinterpret_cast<IntPtr>(p) % 64);
+            ASSERT(1 == ta.numBlocksInUse());
+            memset(p, 0xa5, 64);
+
+            char *q = static_cast<char *>(mX.allocate(1000, 256));
+            ASSERTV(q, 0 == reinterpret_cast<IntPtr>(q) % 256);
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(blockSize(1000 + 256 - MAX_ALIGN)
+                                          == (int)ta.lastAllocatedNumBytes());
+            memset(q, 0xa5, 1000);
+
+            void *r = mX.allocate(8, 8);
+            ASSERT(static_cast<char *>(p) + 64 == r);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+
+            ASSERT(buffer == mX.allocate(1, PAGE));
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(buffer, BUFFER_SIZE, &objectAllocator);
+
+            ASSERT_PASS(mX.allocate(1, 64));
+            ASSERT_FAIL(mX.allocate(0, 64));
+            ASSERT_FAIL(mX.allocate(1,  0));
+            ASSERT_FAIL(mX.allocate(1, 48));
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // GLOBAL OPERATOR NEW TEST
@@ -134,6 +134,39 @@ void *BufferImpUtil::allocateOneByteAlignedFromBuffer(int  *cursor,
     return result;
 }
 
+void *BufferImpUtil::allocateAlignedFromBuffer(int  *cursor,
+                                               char *buffer,
+                                               int   bufferSize,
+                                               int   size,
+                                               int   alignment)
+{
+    BSLS_ASSERT(cursor);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= bufferSize);
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT(0 <= *cursor);
+    BSLS_ASSERT(*cursor <= bufferSize);
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                              buffer + *cursor,
+                                                              alignment);
+
+    // Compare against the remaining space rather than the sum of the cursor,
+    // offset, and size, which could overflow for very large alignments.
+
+    if (offset > bufferSize - *cursor
+     || size   > bufferSize - *cursor - offset) {
+        return 0;                                                     // RETURN
+    }
+
+    void *result = &buffer[*cursor + offset];
+    *cursor += offset + size;
+
+    return result;
+}
+
 void *BufferImpUtil::allocateFromBufferRaw(int                       *cursor,
                                            char                      *buffer,
                                            int                        size,
@@ -211,6 +244,28 @@ void *BufferImpUtil::allocateNaturallyAlignedFromBufferRaw(int  *cursor,
     return result;
 }
 
+void *BufferImpUtil::allocateAlignedFromBufferRaw(int  *cursor,
+                                                  char *buffer,
+                                                  int   size,
+                                                  int   alignment)
+{
+    BSLS_ASSERT(cursor);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT(0 <= *cursor);
+
+    const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                              buffer + *cursor,
+                                                              alignment);
+
+    void *result = &buffer[*cursor + offset];
+    *cursor += offset + size;
+
+    return result;
+}
+
 void *BufferImpUtil::allocateOneByteAlignedFromBufferRaw(int  *cursor,
                                                          char *buffer,
                                                          int   size)
@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 // free memory within the buffer, and the allocation size.  Two of the
 // procedures, 'allocateFromBuffer' and 'allocateFromBufferRaw', take an
 // additional argument that specifies the memory alignment strategy to apply.
-// The other six procedures apply a specific memory alignment strategy as
+// Six other procedures apply a specific memory alignment strategy as
 // indicated by their names (e.g., 'allocateNaturallyAlignedFromBuffer' and
 // 'allocateMaximallyAlignedFromBufferRaw').  In all cases, a pointer to the
 // allocated memory is returned, and the cursor passed in is updated to point
@@ -73,6 +73,16 @@ BSLS_IDENT("$Id: $")
 // strategy (otherwise, more bytes would have been skipped if maximum alignment
 // was used).  See 'bsls_alignment' for more details about memory alignment.
 //
+///Explicit Alignment
+///------------------
+// In addition to the three alignment strategies, 'allocateAlignedFromBuffer'
+// and 'allocateAlignedFromBufferRaw' take an explicit power-of-two alignment,
+// which may exceed the maximal fundamental alignment of the platform (e.g., a
+// 64-byte cache line or a 4096-byte page).  Only the bytes between the cursor
+// and the next suitably aligned position are skipped, so a buffer manager can
+// satisfy over-aligned requests without padding each block by the full
+// alignment.
+//
 ///Raw vs. Non-Raw
 ///---------------
 // The raw and non-raw versions differ in behavior only when the requested
@@ -243,6 +253,25 @@ struct BufferImpUtil {
         // behavior is undefined unless '0 <= bufferSize', '0 < size',
         // '0 <= *cursor', and '*cursor <= bufferSize'.
 
+    static void *allocateAlignedFromBuffer(int  *cursor,
+                                           char *buffer,
+                                           int   bufferSize,
+                                           int   size,
+                                           int   alignment);
+        // Allocate a memory block of the specified 'size' (in bytes), aligned
+        // to the specified 'alignment', from the specified 'buffer' having the
+        // specified 'bufferSize' (in bytes) at the specified 'cursor'
+        // position.  Return the address of the allocated memory block if
+        // 'buffer' contains sufficient available memory, and 0 otherwise.  The
+        // 'cursor' is set to the first byte position immediately after the
+        // allocated memory if there is sufficient memory, and not modified
+        // otherwise.  The behavior is undefined unless '0 <= bufferSize',
+        // '0 < size', 'alignment' is a positive power of two, '0 <= *cursor',
+        // and '*cursor <= bufferSize'.  Note that 'alignment' may exceed
+        // 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT', in which case only the
+        // bytes skipped to reach the next suitably aligned position are
+        // consumed as padding.
+
     static void *allocateFromBufferRaw(int                       *cursor,
                                        char                      *buffer,
                                        int                        size,
@@ -277,6 +306,18 @@ struct BufferImpUtil {
         // 'buffer' contains sufficient available memory, and 'cursor' refers
         // to a valid position in 'buffer'.
 
+    static void *allocateAlignedFromBufferRaw(int  *cursor,
+                                              char *buffer,
+                                              int   size,
+                                              int   alignment);
+        // Allocate a memory block of the specified 'size' (in bytes), aligned
+        // to the specified 'alignment', from the specified 'buffer' at the
+        // specified 'cursor' position.  Return the address of the allocated
+        // memory block.  The 'cursor' is set to the first byte position
+        // immediately after the allocated memory.  The behavior is undefined
+        // unless '0 < size', 'alignment' is a positive power of two, 'buffer'
+        // contains sufficient available memory, and 'cursor' refers to a valid
+        // position in 'buffer'.
 
     static void *allocateOneByteAlignedFromBufferRaw(int  *cursor,
                                                      char *buffer,
@@ -46,8 +46,10 @@ using namespace bsl;
 // [ 1] void *allocateMaximallyAlignedFromBufferRaw(cur, buf, sz, Strat);
 // [ 1] void *allocateNaturallyAlignedFromBufferRaw(cur, buf, sz, Strat);
 // [ 1] void *allocateOneByteAlignedFromBufferRaw(cur, buf, sz, Strat);
+// [ 2] void *allocateAlignedFromBuffer(cur, buf, bs, sz, align);
+// [ 2] void *allocateAlignedFromBufferRaw(cur, buf, sz, align);
 //-----------------------------------------------------------------------------
-// [ 2] USAGE EXAMPLE
+// [ 3] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -223,7 +225,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -246,6 +248,158 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // EXPLICIT ALIGNMENT TEST
+        //
+        // Concerns:
+        //: 1 The address of the allocated memory block is a multiple of the
+        //:   specified alignment, including alignments that exceed the
+        //:   maximal fundamental alignment.
+        //:
+        //: 2 Only the bytes between the cursor and the next suitably aligned
+        //:   position are skipped, i.e., the block is not padded by the full
+        //:   alignment.
+        //:
+        //: 3 The cursor is updated to the position of the first byte
+        //:   immediately after the allocated memory.
+        //:
+        //: 4 When the non-raw method is used and the request (including the
+        //:   alignment padding) would exceed the capacity of the buffer, 0 is
+        //:   returned and the cursor is not affected.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, allocate blocks having various
+        //:   sizes and alignments from a page-aligned buffer at various cursor
+        //:   positions, and verify the returned address and resulting cursor
+        //:   against the expected values.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   void *allocateAlignedFromBuffer(cur, buf, bs, sz, align);
+        //   void *allocateAlignedFromBufferRaw(cur, buf, sz, align);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "EXPLICIT ALIGNMENT TEST" << endl
+                                  << "=======================" << endl;
+
+        enum { PAGE = 4096 };
+
+        static char storage[3 * PAGE];
+        char *buffer = storage
+                     + bsls::AlignmentUtil::calculateAlignmentOffset(storage,
+                                                                     PAGE);
+
+        static const struct {
+            int d_line;       // line number
+            int d_cursor;     // initial cursor position
+            int d_bufSize;    // buffer size
+            int d_allocSize;  // allocation request size
+            int d_alignment;  // requested alignment
+            int d_expOffset;  // expected memory offset (-1 if none)
+            int d_expCursor;  // expected cursor position after request
+        } DATA[] = {
+
+   // LINE  CURSOR  BUFSIZE   ALLOCSIZE   ALIGN   EXPOFFSET  EXPCURSOR
+   // ----  ------  -------   ---------   -----   ---------  ---------
+
+   {  L_,    0,     256,      1,          1,       0,        1 },
+   {  L_,    3,     256,      1,          1,       3,        4 },
+   {  L_,    3,     256,      1,          2,       4,        5 },
+   {  L_,    3,     256,      8,          4,       4,       12 },
+   {  L_,    0,     256,     40,         32,       0,       40 },
+   {  L_,    1,     256,     40,         32,      32,       72 },
+   {  L_,   32,     256,     40,         32,      32,       72 },
+   {  L_,   33,     256,     40,         32,      64,      104 },
+   {  L_,    1,     256,      1,         64,      64,       65 },
+   {  L_,   65,     256,     64,         64,     128,      192 },
+   {  L_,  129,     256,     64,         64,     192,      256 },
+   {  L_,  129,     256,     65,         64,      -1,      129 },
+   {  L_,  193,     256,      1,         64,      -1,      193 },
+   {  L_,  256,     256,      1,          1,      -1,      256 },
+   {  L_,    0,    8192,    100,       4096,       0,      100 },
+   {  L_,    1,    8192,    100,       4096,    4096,     4196 },
+   {  L_,    1,    8192,   4096,       4096,    4096,     8192 },
+   {  L_,    1,    8192,   4097,       4096,      -1,        1 },
+   {  L_,    1,    4096,      1,       4096,      -1,        1 },
+
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE      = DATA[ti].d_line;
+            const int CURSOR    = DATA[ti].d_cursor;
+            const int BUFSIZE   = DATA[ti].d_bufSize;
+            const int ALLOCSIZE = DATA[ti].d_allocSize;
+            const int ALIGN     = DATA[ti].d_alignment;
+            const int EXPOFFSET = DATA[ti].d_expOffset;
+            const int EXPCURSOR = DATA[ti].d_expCursor;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(CURSOR) P_(BUFSIZE) P_(ALLOCSIZE) P(ALIGN)
+            }
+
+            int   cursor  = CURSOR;
+            void *address = Obj::allocateAlignedFromBuffer(&cursor,
+                                                           buffer,
+                                                           BUFSIZE,
+                                                           ALLOCSIZE,
+                                                           ALIGN);
+            if (-1 == EXPOFFSET) {
+                LOOP_ASSERT(LINE, 0 == address);
+            }
+            else {
+                LOOP_ASSERT(LINE, &buffer[EXPOFFSET] == address);
+                LOOP_ASSERT(LINE, 0 ==
+                             bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                                      address,
+                                                                      ALIGN));
+
+                cursor  = CURSOR;
+                address = Obj::allocateAlignedFromBufferRaw(&cursor,
+                                                            buffer,
+                                                            ALLOCSIZE,
+                                                            ALIGN);
+                LOOP_ASSERT(LINE, &buffer[EXPOFFSET] == address);
+            }
+            LOOP3_ASSERT(LINE, EXPCURSOR, cursor, EXPCURSOR == cursor);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            int cursor = 0;
+
+            ASSERT_PASS(Obj::allocateAlignedFromBuffer(&cursor, buffer, 64,
+                                                       1, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBuffer(     0, buffer, 64,
+                                                       1, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBuffer(&cursor,     0, 64,
+                                                       1, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBuffer(&cursor, buffer, 64,
+                                                       0, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBuffer(&cursor, buffer, 64,
+                                                       1,  0));
+            ASSERT_FAIL(Obj::allocateAlignedFromBuffer(&cursor, buffer, 64,
+                                                       1, 24));
+
+            cursor = 0;
+
+            ASSERT_PASS(Obj::allocateAlignedFromBufferRaw(&cursor, buffer,
+                                                          1, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBufferRaw(&cursor, buffer,
+                                                          0, 32));
+            ASSERT_FAIL(Obj::allocateAlignedFromBufferRaw(&cursor, buffer,
+                                                          1, 24));
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // CLASS METHODS TEST
@@ -73,6 +73,28 @@ int BufferManager::truncate(void *address, int originalSize, int newSize)
     return originalSize;
 }
 
+bool BufferManager::tryExpand(void                   *address,
+                              bsls::Types::size_type  originalSize,
+                              bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < originalSize);
+    BSLS_ASSERT(originalSize <= newSize);
+    BSLS_ASSERT(d_buffer_p);
+    BSLS_ASSERT(0 <= d_cursor);
+    BSLS_ASSERT(d_cursor <= d_bufferSize);
+
+    if (static_cast<char *>(address) + originalSize == d_buffer_p + d_cursor
+     && newSize - originalSize
+                     <= static_cast<bsls::Types::size_type>(d_bufferSize
+                                                            - d_cursor)) {
+        d_cursor += static_cast<int>(newSize - originalSize);
+        return true;                                                  // RETURN
+    }
+
+    return false;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
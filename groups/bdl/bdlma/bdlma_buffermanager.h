@@ -239,6 +239,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_BUFFERIMPUTIL
+#include <bdlma_bufferimputil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ALIGNMENT
 #include <bsls_alignment.h>
 #endif
@@ -332,6 +336,18 @@ class BufferManager {
         // behavior is undefined unless '0 < size' and this object is currently
         // managing a buffer.
 
+    void *allocate(bsls::Types::size_type size,
+                   bsls::Types::size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) aligned to the specified 'alignment' on success,
+        // and 0 if the allocation request (including any padding needed to
+        // reach an address that is a multiple of 'alignment') exceeds the
+        // remaining free memory space in the external buffer.  The behavior
+        // is undefined unless '0 < size', 'alignment' is a positive power of
+        // two, and this object is currently managing a buffer.  Note that the
+        // alignment strategy specified at construction is not used, and that
+        // 'alignment' may exceed 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'.
+
     void *allocateRaw(int size);
         // Return the address of a contiguous block of memory of the specified
         // 'size' (in bytes) according to the alignment strategy specified at
@@ -340,6 +356,14 @@ class BufferManager {
         // external buffer, '0 < size', and this object is currently managing
         // a buffer.
 
+    void *allocateRaw(int size, int alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) aligned to the specified 'alignment'.  The
+        // behavior is undefined unless the allocation request (including any
+        // alignment padding) does not exceed the remaining free memory space
+        // in the external buffer, '0 < size', 'alignment' is a positive power
+        // of two, and this object is currently managing a buffer.
+
     template <class TYPE>
     void deleteObjectRaw(const TYPE *object);
         // Destroy the specified 'object'.  Note that memory associated with
@@ -389,6 +413,18 @@ class BufferManager {
         // of this object with no effect on the outstanding allocated memory
         // blocks.
 
+    void restore(char *buffer, int bufferSize, int cursor);
+        // Make this object manage the specified 'buffer' of the specified
+        // 'bufferSize' (in bytes), with the specified 'cursor' as the offset
+        // of the next available byte, or, if 'buffer' is 0, reset this object
+        // as if by 'reset'.  The memory blocks previously allocated from
+        // 'buffer' at offsets at or above 'cursor' (if any) are thereby
+        // reclaimed for reuse.  The behavior is undefined unless either
+        // 'buffer' is 0 and '0 == bufferSize' and '0 == cursor', or 'buffer'
+        // has at least 'bufferSize' bytes and '0 <= cursor <= bufferSize'.
+        // Note that the arguments are typically values previously obtained
+        // from 'buffer', 'bufferSize', and 'cursor'.
+
     int truncate(void *address, int originalSize, int newSize);
         // Reduce the amount of memory allocated at the specified 'address'
         // of the specified 'originalSize' (in bytes) to the specified
@@ -402,6 +438,22 @@ class BufferManager {
         // 'newSize <= originalSize', '0 <= newSize', and 'release' was not
         // called after allocating the memory at 'address'.
 
+    bool tryExpand(void                   *address,
+                   bsls::Types::size_type  originalSize,
+                   bsls::Types::size_type  newSize);
+        // Attempt to increase the amount of memory allocated at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory at 'address' now spans 'newSize' bytes, and 'false' with
+        // no effect otherwise.  This method can only expand the memory block
+        // returned by the most recent 'allocate' or 'allocateRaw' request
+        // from this object, and only if the remaining free memory in the
+        // buffer suffices.  The behavior is undefined unless the memory at
+        // 'address' was originally allocated by this buffer manager, the size
+        // of the memory at 'address' is 'originalSize',
+        // '0 < originalSize <= newSize', and 'release' was not called after
+        // allocating the memory at 'address'.
+
     // ACCESSORS
     char *buffer() const;
         // Return an address providing modifiable access to the buffer
@@ -412,6 +464,11 @@ class BufferManager {
         // Return the size (in bytes) of the buffer currently managed by this
         // object, or 0 if this object currently manages no buffer.
 
+    int cursor() const;
+        // Return the offset (in bytes) of the next available byte in the
+        // buffer currently managed by this object, or 0 if this object
+        // currently manages no buffer.
+
     bool hasSufficientCapacity(int size) const;
         // Return 'true' if there is sufficient memory space in the buffer to
         // allocate a contiguous memory block of the specified 'size' (in
@@ -487,6 +544,41 @@ void *BufferManager::allocateRaw(int size)
     return (*d_allocateRaw_p)(&d_cursor, d_buffer_p, size);
 }
 
+inline
+void *BufferManager::allocate(bsls::Types::size_type size,
+                              bsls::Types::size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT_SAFE(d_buffer_p);
+    BSLS_ASSERT_SAFE(0 <= d_cursor);
+    BSLS_ASSERT_SAFE(d_cursor <= d_bufferSize);
+
+    return BufferImpUtil::allocateAlignedFromBuffer(
+                                               &d_cursor,
+                                               d_buffer_p,
+                                               d_bufferSize,
+                                               static_cast<int>(size),
+                                               static_cast<int>(alignment));
+}
+
+inline
+void *BufferManager::allocateRaw(int size, int alignment)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT_SAFE(d_buffer_p);
+    BSLS_ASSERT_SAFE(0 <= d_cursor);
+    BSLS_ASSERT_SAFE(d_cursor <= d_bufferSize);
+
+    return BufferImpUtil::allocateAlignedFromBufferRaw(&d_cursor,
+                                                       d_buffer_p,
+                                                       size,
+                                                       alignment);
+}
+
 template <class TYPE>
 inline
 void BufferManager::deleteObjectRaw(const TYPE *object)
@@ -535,6 +627,18 @@ void BufferManager::reset()
     d_cursor     = 0;
 }
 
+inline
+void BufferManager::restore(char *buffer, int bufferSize, int cursor)
+{
+    BSLS_ASSERT_SAFE(buffer || 0 == bufferSize);
+    BSLS_ASSERT_SAFE(0 <= cursor);
+    BSLS_ASSERT_SAFE(cursor <= bufferSize);
+
+    d_buffer_p   = buffer;
+    d_bufferSize = bufferSize;
+    d_cursor     = cursor;
+}
+
 // ACCESSORS
 inline
 char *BufferManager::buffer() const
@@ -548,6 +652,12 @@ int BufferManager::bufferSize() const
     return d_bufferSize;
 }
 
+inline
+int BufferManager::cursor() const
+{
+    return d_cursor;
+}
+
 inline
 bool BufferManager::hasSufficientCapacity(int size) const
 {
@@ -55,21 +55,26 @@ using namespace bsl;
 // // MANIPULATORS
 // [ 3] void *allocate(size_type size);
 // [ 3] void *allocateRaw(int size);
+// [11] void *allocate(size_type size, size_type alignment);
+// [11] void *allocateRaw(int size, int alignment);
 // [ 8] void deleteObjectRaw(const TYPE *object);
 // [ 8] void deleteObject(const TYPE *object);
 // [ 9] int expand(void *address, int size);
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
+// [12] void restore(char *buffer, int bufferSize, int cursor);
 // [10] int truncate(void *address, int originalSize, int newSize);
+// [13] bool tryExpand(void *, size_type oldSize, size_type newSize);
 //
 // // ACCESSORS
 // [ 2] char *buffer() const;
 // [ 2] int bufferSize() const;
+// [12] int cursor() const;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -369,7 +374,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 11: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -400,6 +405,294 @@ int main(int argc, char *argv[])
         ASSERT(false == result);
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // 'tryExpand' TEST
+        //
+        // Concerns:
+        //: 1 'tryExpand' succeeds for the most recently allocated block if the
+        //:   remaining free memory in the buffer suffices, advancing the
+        //:   cursor by the difference in size.
+        //:
+        //: 2 'tryExpand' fails, with no effect, for a block other than the
+        //:   most recently allocated one, or if the remaining free memory is
+        //:   insufficient.
+        //:
+        //: 3 An expanded block can be expanded again, and truncated using its
+        //:   new size.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks from a buffer manager, and attempt to expand
+        //:   them to various sizes, verifying the return value and the cursor
+        //:   after each attempt.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   bool tryExpand(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'tryExpand' TEST" << endl
+                                  << "================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        {
+            Obj mX(buffer, 64, bsls::Alignment::BSLS_BYTEALIGNED);
+            const Obj& X = mX;
+
+            void *p = mX.allocate(8);
+            void *q = mX.allocate(8);
+            ASSERT(16 == X.cursor());
+
+            ASSERT(false == mX.tryExpand(p, 8, 16));
+            ASSERT(16    == X.cursor());
+
+            ASSERT(true  == mX.tryExpand(q, 8, 8));
+            ASSERT(16    == X.cursor());
+
+            ASSERT(true  == mX.tryExpand(q, 8, 24));
+            ASSERT(32    == X.cursor());
+
+            ASSERT(true  == mX.tryExpand(q, 24, 48));
+            ASSERT(56    == X.cursor());
+
+            ASSERT(false == mX.tryExpand(q, 48, 57));
+            ASSERT(56    == X.cursor());
+
+            ASSERT(true  == mX.tryExpand(q, 48, 56));
+            ASSERT(64    == X.cursor());
+
+            ASSERT(40 == mX.truncate(q, 56, 40));
+            ASSERT(48 == X.cursor());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(buffer, 64);
+
+            void *p = mX.allocate(8);
+
+            ASSERT_PASS(mX.tryExpand(p, 8, 8));
+            ASSERT_FAIL(mX.tryExpand(0, 8, 8));
+            ASSERT_FAIL(mX.tryExpand(p, 0, 8));
+            ASSERT_FAIL(mX.tryExpand(p, 8, 7));
+
+            Obj mY;
+
+            ASSERT_FAIL(mY.tryExpand(p, 8, 8));
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // 'cursor' AND 'restore' TEST
+        //
+        // Concerns:
+        //: 1 'cursor' is 0 for an object managing no buffer, and otherwise
+        //:   reflects the offset of the next available byte.
+        //:
+        //: 2 'restore' with values obtained from 'buffer', 'bufferSize', and
+        //:   'cursor' returns the object to that state, even after the buffer
+        //:   has been replaced, so that subsequent allocations return the
+        //:   same addresses as before.
+        //:
+        //: 3 'restore' with a null buffer is equivalent to 'reset'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Record the state of a buffer manager, allocate from it, replace
+        //:   its buffer, then 'restore' the recorded state and verify the
+        //:   accessors and the addresses of subsequent allocations.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void restore(char *buffer, int bufferSize, int cursor);
+        //   int cursor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'cursor' AND 'restore' TEST" << endl
+                                  << "===========================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.cursor());
+
+            mX.replaceBuffer(buffer, BUFFER_SIZE / 2);
+            ASSERT(0 == X.cursor());
+
+            mX.allocate(3);
+            const int CURSOR = X.cursor();
+            ASSERT(3 == CURSOR);
+
+            void *p = mX.allocate(8);
+            ASSERT(CURSOR < X.cursor());
+
+            mX.replaceBuffer(buffer + BUFFER_SIZE / 2, BUFFER_SIZE / 2);
+            mX.allocate(8);
+
+            mX.restore(buffer, BUFFER_SIZE / 2, CURSOR);
+            ASSERT(buffer          == X.buffer());
+            ASSERT(BUFFER_SIZE / 2 == X.bufferSize());
+            ASSERT(CURSOR          == X.cursor());
+            ASSERT(p == mX.allocate(8));
+
+            mX.restore(0, 0, 0);
+            ASSERT(0 == X.buffer());
+            ASSERT(0 == X.bufferSize());
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;
+
+            ASSERT_SAFE_PASS(mX.restore(0,      0,           0));
+            ASSERT_SAFE_PASS(mX.restore(buffer, BUFFER_SIZE, 0));
+            ASSERT_SAFE_PASS(mX.restore(buffer, BUFFER_SIZE, BUFFER_SIZE));
+
+            ASSERT_SAFE_FAIL(mX.restore(0,      BUFFER_SIZE, 0));
+            ASSERT_SAFE_FAIL(mX.restore(buffer, BUFFER_SIZE, -1));
+            ASSERT_SAFE_FAIL(mX.restore(buffer, BUFFER_SIZE, BUFFER_SIZE + 1));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // ALIGNED ALLOCATE TEST
+        //
+        // Concerns:
+        //: 1 The aligned 'allocate' and 'allocateRaw' return memory whose
+        //:   address is a multiple of the requested alignment, for alignments
+        //:   both below and above the maximal fundamental alignment.
+        //:
+        //: 2 Only the padding needed to reach the next suitably aligned
+        //:   address is consumed from the buffer.
+        //:
+        //: 3 The aligned 'allocate' returns 0, leaving the buffer unaffected,
+        //:   if the request (including padding) does not fit.
+        //:
+        //: 4 The alignment strategy supplied at construction does not affect
+        //:   the aligned methods.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct a buffer manager, using each alignment strategy, over
+        //:   a page-aligned buffer.  Allocate a single byte to misalign the
+        //:   cursor, then request 64-byte and page-aligned blocks, verifying
+        //:   the returned addresses and the position of a subsequent
+        //:   one-byte-aligned allocation.  (C-1..2, 4)
+        //:
+        //: 2 Request a block that cannot fit after alignment padding and
+        //:   verify that 0 is returned and that the next allocation is
+        //:   unaffected.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size, size_type alignment);
+        //   void *allocateRaw(int size, int alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ALIGNED ALLOCATE TEST" << endl
+                                  << "=====================" << endl;
+
+        enum { PAGE = 4096, SIZE = 2 * PAGE };
+
+        static char storage[SIZE + PAGE];
+        char *buffer = storage
+                     + bsls::AlignmentUtil::calculateAlignmentOffset(storage,
+                                                                     PAGE);
+
+        const Strat STRATS[] = { bsls::Alignment::BSLS_NATURAL,
+                                 bsls::Alignment::BSLS_MAXIMUM,
+                                 bsls::Alignment::BSLS_BYTEALIGNED };
+        const int NUM_STRATS = sizeof STRATS / sizeof *STRATS;
+
+        for (int ti = 0; ti < NUM_STRATS; ++ti) {
+            const Strat STRAT = STRATS[ti];
+
+            if (veryVerbose) { T_ P(STRAT) }
+
+            {
+                Obj mX(buffer, SIZE, STRAT);
+
+                ASSERTV(ti, buffer == mX.allocate(1));
+
+                void *p = mX.allocate(10, 64);
+                ASSERTV(ti, buffer + 64 == p);
+
+                p = mX.allocate(1, 1);
+                ASSERTV(ti, buffer + 74 == p);
+
+                p = mX.allocate(100, PAGE);
+                ASSERTV(ti, buffer + PAGE == p);
+
+                ASSERTV(ti, 0 == mX.allocate(PAGE, PAGE));
+
+                p = mX.allocate(1, 1);
+                ASSERTV(ti, buffer + PAGE + 100 == p);
+
+                p = mX.allocate(PAGE - 128, 64);
+                ASSERTV(ti, buffer + PAGE + 128 == p);
+
+                ASSERTV(ti, 0 == mX.allocate(1, 64));
+            }
+
+            {
+                Obj mX(buffer, SIZE, STRAT);
+
+                ASSERTV(ti, buffer == mX.allocateRaw(1));
+
+                void *p = mX.allocateRaw(10, 32);
+                ASSERTV(ti, buffer + 32 == p);
+
+                p = mX.allocateRaw(16, PAGE);
+                ASSERTV(ti, buffer + PAGE == p);
+
+                p = mX.allocateRaw(1, 1);
+                ASSERTV(ti, buffer + PAGE + 16 == p);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(buffer, SIZE);
+
+            ASSERT_SAFE_PASS(mX.allocate(1, 64));
+            ASSERT_SAFE_FAIL(mX.allocate(0, 64));
+            ASSERT_SAFE_FAIL(mX.allocate(1, 0));
+            ASSERT_SAFE_FAIL(mX.allocate(1, 48));
+
+            ASSERT_SAFE_PASS(mX.allocateRaw(1, 64));
+            ASSERT_SAFE_FAIL(mX.allocateRaw(0, 64));
+            ASSERT_SAFE_FAIL(mX.allocateRaw(1, 0));
+            ASSERT_SAFE_FAIL(mX.allocateRaw(1, 48));
+
+            Obj mY;
+
+            ASSERT_SAFE_FAIL(mY.allocate(1, 64));
+            ASSERT_SAFE_FAIL(mY.allocateRaw(1, 64));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TRUNCATE TEST
@@ -7,7 +7,8 @@
 //@CLASSES:
 //  bdlma::CountingAllocator: concrete allocator that counts allocated bytes
 //
-//@SEE_ALSO: bslma_allocator, bslma_testallocator
+//@SEE_ALSO: bslma_allocator, bslma_testallocator,
+//           bdlma_shardedcountingallocator
 //
 //@DESCRIPTION: This component provides a special-purpose counting allocator,
 // 'bdlma::CountingAllocator', that implements the 'bslma::Allocator' protocol
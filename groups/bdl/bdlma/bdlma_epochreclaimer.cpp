@@ -0,0 +1,351 @@
+// bdlma_epochreclaimer.cpp                                           -*-C++-*-
+#include <bdlma_epochreclaimer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_epochreclaimer_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <new>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bsls::Types::Int64 k_SAFE_DISTANCE = 2;
+    // number of epochs by which the epoch must advance after a block is
+    // retired before the block can be reclaimed
+
+}  // close unnamed namespace
+
+                           // --------------------
+                           // class EpochReclaimer
+                           // --------------------
+
+// PRIVATE MANIPULATORS
+void EpochReclaimer::adoptOrphans(EpochReclaimer_Record *records,
+                                  bsls::Types::Int64     epoch)
+{
+    EpochReclaimer_Record *head = 0;
+    int                    n    = 0;
+
+    for (EpochReclaimer_Record *r = records; r; r = r->d_next_p) {
+        EpochReclaimer_Record *orphan = static_cast<EpochReclaimer_Record *>(
+                      d_allocator_p->allocate(sizeof(EpochReclaimer_Record)));
+
+        *orphan          = *r;
+        orphan->d_next_p = head;
+        orphan->d_epoch  = epoch;
+        head             = orphan;
+        ++n;
+    }
+
+    if (0 == n) {
+        return;                                                       // RETURN
+    }
+
+    EpochReclaimer_Record *tail = head;
+    while (tail->d_next_p) {
+        tail = tail->d_next_p;
+    }
+
+    bsls::BslLockGuard guard(&d_orphanLock);
+
+    tail->d_next_p = d_orphans_p;
+    d_orphans_p    = head;
+    d_numOrphans.addRelaxed(n);
+}
+
+EpochReclaimer_Slot *EpochReclaimer::claimSlot()
+{
+    for (EpochReclaimer_Slot *slot = d_slots.loadAcquire();
+         slot;
+         slot = slot->d_next_p) {
+        if (0 == slot->d_isClaimed.loadRelaxed()
+         && 0 == slot->d_isClaimed.testAndSwapAcqRel(0, 1)) {
+            d_numParticipants.addRelaxed(1);
+            return slot;                                              // RETURN
+        }
+    }
+
+    EpochReclaimer_Slot *slot = new (d_allocator_p->allocate(
+                                   sizeof(EpochReclaimer_Slot)))
+                                                         EpochReclaimer_Slot();
+
+    slot->d_state.storeRelaxed(0);
+    slot->d_isClaimed.storeRelaxed(1);
+
+    EpochReclaimer_Slot *head = d_slots.loadRelaxed();
+    for (;;) {
+        slot->d_next_p = head;
+
+        EpochReclaimer_Slot *oldHead = d_slots.testAndSwapAcqRel(head, slot);
+        if (oldHead == head) {
+            d_numParticipants.addRelaxed(1);
+            return slot;                                              // RETURN
+        }
+        head = oldHead;
+    }
+}
+
+void EpochReclaimer::releaseSlot(EpochReclaimer_Slot *slot)
+{
+    BSLS_ASSERT(slot);
+    BSLS_ASSERT(0 == (slot->d_state.loadRelaxed() & 1));
+
+    slot->d_isClaimed.storeRelease(0);
+    d_numParticipants.addRelaxed(-1);
+}
+
+// CREATORS
+EpochReclaimer::EpochReclaimer(bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_slots(0)
+, d_numParticipants(0)
+, d_orphans_p(0)
+, d_numOrphans(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    BSLS_ASSERT(0 == d_numParticipants.load());
+
+    while (d_orphans_p) {
+        EpochReclaimer_Record *orphan = d_orphans_p;
+
+        d_orphans_p = orphan->d_next_p;
+        orphan->d_function(orphan->d_address_p, orphan->d_context_p);
+        d_allocator_p->deallocate(orphan);
+    }
+
+    EpochReclaimer_Slot *slot = d_slots.loadRelaxed();
+    while (slot) {
+        EpochReclaimer_Slot *next = slot->d_next_p;
+
+        d_allocator_p->deallocate(slot);
+        slot = next;
+    }
+}
+
+// MANIPULATORS
+int EpochReclaimer::reclaim()
+{
+    if (0 == d_numOrphans.load()) {
+        return 0;                                                     // RETURN
+    }
+
+    tryAdvance();
+
+    const bsls::Types::Int64 epoch = d_epoch.load();
+
+    // Unlink the orphans that can be reclaimed under the lock, and reclaim
+    // them after releasing it.
+
+    EpochReclaimer_Record *ready = 0;
+    int                    n     = 0;
+    {
+        bsls::BslLockGuard guard(&d_orphanLock);
+
+        EpochReclaimer_Record **link = &d_orphans_p;
+        while (*link) {
+            EpochReclaimer_Record *orphan = *link;
+
+            if (orphan->d_epoch + k_SAFE_DISTANCE <= epoch) {
+                *link            = orphan->d_next_p;
+                orphan->d_next_p = ready;
+                ready            = orphan;
+                ++n;
+            }
+            else {
+                link = &orphan->d_next_p;
+            }
+        }
+
+        d_numOrphans.addRelaxed(-n);
+    }
+
+    while (ready) {
+        EpochReclaimer_Record *orphan = ready;
+
+        ready = orphan->d_next_p;
+        orphan->d_function(orphan->d_address_p, orphan->d_context_p);
+        d_allocator_p->deallocate(orphan);
+    }
+
+    return n;
+}
+
+bool EpochReclaimer::tryAdvance()
+{
+    const bsls::Types::Int64 epoch  = d_epoch.load();
+    const bsls::Types::Int64 active = (epoch << 1) | 1;
+
+    for (EpochReclaimer_Slot *slot = d_slots.loadAcquire();
+         slot;
+         slot = slot->d_next_p) {
+        const bsls::Types::Int64 state = slot->d_state.load();
+
+        if ((state & 1) && state != active) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // If the exchange fails, a concurrent call has advanced the epoch.
+
+    d_epoch.testAndSwap(epoch, epoch + 1);
+    return true;
+}
+
+                          // ----------------------
+                          // class EpochParticipant
+                          // ----------------------
+
+// PRIVATE MANIPULATORS
+int EpochParticipant::reclaimList(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_LIMBO_LISTS);
+
+    int n = 0;
+
+    EpochReclaimer_Record *record = d_limbo_p[index];
+    d_limbo_p[index] = 0;
+
+    while (record) {
+        EpochReclaimer_Record *next = record->d_next_p;
+
+        record->d_function(record->d_address_p, record->d_context_p);
+        d_recordPool.deallocate(record);
+
+        record = next;
+        ++n;
+    }
+
+    d_numRetired -= n;
+    return n;
+}
+
+// CREATORS
+EpochParticipant::EpochParticipant(EpochReclaimer *reclaimer)
+: d_numRetired(0)
+, d_numRetiredSinceReclaim(0)
+, d_depth(0)
+, d_slot_p(0)
+, d_reclaimer_p(reclaimer)
+, d_recordPool(static_cast<int>(sizeof(EpochReclaimer_Record)),
+               reclaimer->allocator())
+{
+    BSLS_ASSERT(reclaimer);
+
+    for (int i = 0; i < k_NUM_LIMBO_LISTS; ++i) {
+        d_limbo_p[i]    = 0;
+        d_limboEpoch[i] = 0;
+    }
+
+    d_slot_p = d_reclaimer_p->claimSlot();
+}
+
+EpochParticipant::~EpochParticipant()
+{
+    BSLS_ASSERT(0 == d_depth);
+
+    // Each call to 'reclaim' advances the epoch at most once, so the blocks
+    // retired in the current epoch need 'k_SAFE_DISTANCE' calls, unless a
+    // reader holds the epoch back, in which case they are orphaned.
+
+    for (int i = 0; d_numRetired && i < k_SAFE_DISTANCE; ++i) {
+        reclaim();
+    }
+
+    for (int i = 0; i < k_NUM_LIMBO_LISTS; ++i) {
+        if (d_limbo_p[i]) {
+            d_reclaimer_p->adoptOrphans(d_limbo_p[i], d_limboEpoch[i]);
+            d_limbo_p[i] = 0;
+        }
+    }
+    d_numRetired = 0;
+
+    d_reclaimer_p->releaseSlot(d_slot_p);
+
+    // The records are released by the destructor of 'd_recordPool'.
+}
+
+// MANIPULATORS
+int EpochParticipant::reclaim()
+{
+    d_numRetiredSinceReclaim = 0;
+
+    if (0 == d_numRetired) {
+        return 0;                                                     // RETURN
+    }
+
+    d_reclaimer_p->tryAdvance();
+
+    const bsls::Types::Int64 epoch = d_reclaimer_p->epoch();
+
+    int n = 0;
+    for (int i = 0; i < k_NUM_LIMBO_LISTS; ++i) {
+        if (d_limbo_p[i] && d_limboEpoch[i] + k_SAFE_DISTANCE <= epoch) {
+            n += reclaimList(i);
+        }
+    }
+
+    return n;
+}
+
+void EpochParticipant::retire(void            *address,
+                              ReclaimFunction  function,
+                              void            *context)
+{
+    BSLS_ASSERT(function);
+
+    const bsls::Types::Int64 epoch = d_reclaimer_p->epoch();
+    const int                index = static_cast<int>(epoch
+                                                         % k_NUM_LIMBO_LISTS);
+
+    // The list at 'index', if not of the current epoch, was retired at least
+    // three epochs ago, and can be reclaimed.
+
+    if (d_limbo_p[index] && d_limboEpoch[index] != epoch) {
+        reclaimList(index);
+    }
+
+    EpochReclaimer_Record *record = static_cast<EpochReclaimer_Record *>(
+                                                     d_recordPool.allocate());
+
+    record->d_next_p    = d_limbo_p[index];
+    record->d_address_p = address;
+    record->d_function  = function;
+    record->d_context_p = context;
+    record->d_epoch     = epoch;
+
+    d_limbo_p[index]    = record;
+    d_limboEpoch[index] = epoch;
+    ++d_numRetired;
+
+    if (k_RECLAIM_INTERVAL <= ++d_numRetiredSinceReclaim) {
+        reclaim();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
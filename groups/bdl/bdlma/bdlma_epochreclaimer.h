@@ -0,0 +1,677 @@
+// bdlma_epochreclaimer.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLMA_EPOCHRECLAIMER
+#define INCLUDED_BDLMA_EPOCHRECLAIMER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based deferred reclamation of memory blocks.
+//
+//@CLASSES:
+//  bdlma::EpochReclaimer: epoch shared by the participants in reclamation
+//  bdlma::EpochParticipant: per-thread critical sections and retired blocks
+//  bdlma::EpochGuard: scoped guard of the critical section of a participant
+//
+//@SEE_ALSO: bdlma_pool, bdlma_multipool
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlma::EpochReclaimer',
+// and its per-thread companion, 'bdlma::EpochParticipant', that defer the
+// reclamation of memory blocks (e.g., the nodes of a concurrent list, or the
+// snapshots of a read-mostly table) until no thread can still be reading
+// them, without reference counting: readers access shared blocks inside
+// *critical* *sections* (delimited by a 'bdlma::EpochGuard'), which cost a
+// store to a location owned by the reader on entry and on exit, and writers
+// *retire* the blocks they have unlinked from a shared structure, rather than
+// deallocating them immediately.  A retired block is handed back to the pool
+// (or allocator) that supplied it once every reader has been observed
+// outside any critical section begun before the block was retired.
+//
+///Epochs
+///------
+// A reclaimer maintains a global *epoch* counter.  Entering a critical
+// section records the current epoch in the slot of the participant, and
+// 'tryAdvance' increments the epoch only if every participant that is in a
+// critical section has recorded the current epoch.  A block retired in epoch
+// 'E' was unlinked before any reader could enter a critical section in epoch
+// 'E + 1', and every reader that could still see it has left once the epoch
+// has advanced to 'E + 2', at which point the block is reclaimed.
+//
+// Each participant keeps the blocks it retires in one of three *limbo* lists,
+// indexed by the epoch of retirement modulo three, so that retiring a block
+// and reclaiming the blocks of an old epoch take constant time per block and
+// no synchronization beyond reading the epoch.  Every few dozen retirements
+// (and on each explicit call to 'reclaim'), a participant attempts to advance
+// the epoch and reclaims the lists that have become safe.
+//
+///Reclaiming Blocks
+///-----------------
+// A block is retired together with the function (and context) that reclaims
+// it, which allows blocks of a 'bdlma::Pool', a 'bdlma::Multipool', or any
+// 'bslma::Allocator' to be retired through the same participant.  The
+// 'retire' and 'retireObject' function templates supply a function that
+// returns the block to a (template parameter) 'ALLOCATOR' type providing a
+// 'deallocate(void *)' method (the latter after destroying the object
+// occupying the block).
+//
+// The reclaim function of a block is invoked by the thread using the
+// participant that retired the block, except for *orphaned* blocks, which a
+// participant still holds when it is destroyed, and which are transferred to
+// the reclaimer, to be reclaimed by a later call to 'EpochReclaimer::reclaim'
+// or, at the latest, by the destructor of the reclaimer.  Blocks retired from
+// a pool that is not thread-safe should therefore be retired by the thread
+// using the pool, which should also call 'EpochReclaimer::reclaim' if its
+// participants may be destroyed with blocks pending.
+//
+///Memory Ordering
+///---------------
+// Entering a critical section publishes the epoch of the participant with a
+// sequentially consistent exchange (which acts as a full fence), and
+// 'tryAdvance' inspects the slots of the participants with sequentially
+// consistent loads, so that a reader is either observed in its critical
+// section by an advancing thread, or enters it in an epoch late enough that
+// the blocks it can reach have not been retired yet.
+// Shared pointers read inside a critical section should be loaded with
+// acquire semantics (e.g., 'bsls::AtomicPointer::loadAcquire'), and published
+// with release semantics, as usual.
+//
+///Thread Safety
+///-------------
+// 'bdlma::EpochReclaimer' is fully thread-safe, provided that the allocator
+// supplied at construction is fully thread-safe.  A 'bdlma::EpochParticipant'
+// (and a 'bdlma::EpochGuard' of it) must be used by only one thread at a
+// time; typically, each thread creates a participant of its own, whose slot
+// is reused by a later participant once it is destroyed.  A reclaimer must
+// outlive its participants.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Replacing a Read-Mostly Snapshot
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service consults, on every request, a table of limits that
+// is replaced (rarely) by a configuration thread, and that we want readers
+// neither to take a lock nor to update a reference count.
+//
+// First, we define the snapshot of the limits, which is supplied by a
+// 'bdlma::Pool' used only by the configuration thread:
+//..
+//  struct Limits {
+//      // This 'struct' holds a snapshot of the limits of a service.
+//
+//      int d_version;
+//      int d_maxRequests;
+//      int d_maxBytes;
+//  };
+//
+//  bslma::TestAllocator         ta;
+//  bdlma::Pool                  pool(sizeof(Limits), &ta);
+//  bdlma::EpochReclaimer        reclaimer(&ta);
+//  bsls::AtomicPointer<Limits>  current;
+//
+//  Limits *initial = new (pool.allocate()) Limits();
+//  initial->d_version     = 1;
+//  initial->d_maxRequests = 100;
+//  initial->d_maxBytes    = 4096;
+//  current.storeRelease(initial);
+//..
+// Then, a reader, having a participant of its own, reads the current limits
+// in a critical section, so that the snapshot it reads is not reclaimed while
+// it uses it:
+//..
+//  bdlma::EpochParticipant reader(&reclaimer);
+//  {
+//      bdlma::EpochGuard guard(&reader);
+//
+//      const Limits *limits = current.loadAcquire();
+//      assert(1   == limits->d_version);
+//      assert(100 == limits->d_maxRequests);
+//  }
+//..
+// Next, the configuration thread publishes new limits, and retires the
+// snapshot it replaced, which is not returned to the pool immediately:
+//..
+//  bdlma::EpochParticipant writer(&reclaimer);
+//
+//  Limits *next = new (pool.allocate()) Limits();
+//  next->d_version     = 2;
+//  next->d_maxRequests = 200;
+//  next->d_maxBytes    = 8192;
+//
+//  Limits *previous = current.swapAcqRel(next);
+//  writer.retire(previous, &pool);
+//
+//  assert(1 == writer.numRetired());
+//..
+// Now, while the reader is in a critical section, the epoch cannot advance
+// far enough for the retired snapshot to be reclaimed:
+//..
+//  reader.enter();
+//
+//  assert(0 == writer.reclaim());
+//  assert(0 == writer.reclaim());
+//  assert(1 == writer.numRetired());
+//
+//  reader.leave();
+//..
+// Finally, once the reader has left its critical section, the snapshot is
+// returned to the pool after the epoch advances twice:
+//..
+//  writer.reclaim();
+//  writer.reclaim();
+//
+//  assert(0 == writer.numRetired());
+//
+//  pool.deallocate(current.loadRelaxed());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_POOL
+#include <bdlma_pool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct EpochReclaimer_Record;
+struct EpochReclaimer_Slot;
+
+                           // ====================
+                           // class EpochReclaimer
+                           // ====================
+
+class EpochReclaimer {
+    // This class maintains the epoch shared by the participants in the
+    // deferred reclamation of memory blocks, and the blocks orphaned by
+    // participants destroyed before their blocks could be reclaimed.
+
+  public:
+    // TYPES
+    typedef void (*ReclaimFunction)(void *address, void *context);
+        // Alias for a function reclaiming the block at the specified
+        // 'address', using the specified 'context' supplied when the block
+        // was retired.
+
+  private:
+    // DATA
+    bsls::AtomicInt64                     d_epoch;         // global epoch
+
+    bsls::AtomicPointer<EpochReclaimer_Slot>
+                                          d_slots;         // slots of the
+                                                           // participants
+
+    bsls::AtomicInt                       d_numParticipants;
+                                                           // number of
+                                                           // claimed slots
+
+    bsls::BslLock                         d_orphanLock;    // protects
+                                                           // 'd_orphans_p'
+
+    EpochReclaimer_Record                *d_orphans_p;     // orphaned blocks
+
+    bsls::AtomicInt                       d_numOrphans;    // number of
+                                                           // orphaned blocks
+
+    bslma::Allocator                     *d_allocator_p;   // memory
+                                                           // allocator (held,
+                                                           // not owned)
+
+    // FRIENDS
+    friend class EpochParticipant;
+
+  private:
+    // NOT IMPLEMENTED
+    EpochReclaimer(const EpochReclaimer&);
+    EpochReclaimer& operator=(const EpochReclaimer&);
+
+    // PRIVATE MANIPULATORS
+    void adoptOrphans(EpochReclaimer_Record *records,
+                      bsls::Types::Int64     epoch);
+        // Take ownership of the specified 'records', retired in the
+        // specified 'epoch', to be reclaimed by 'reclaim' or by the
+        // destructor of this reclaimer.  The records are copied into records
+        // supplied by the allocator of this reclaimer.
+
+    EpochReclaimer_Slot *claimSlot();
+        // Return a slot for the exclusive use of a new participant, reusing
+        // the slot of a destroyed participant if one is available.
+
+    void releaseSlot(EpochReclaimer_Slot *slot);
+        // Release the specified 'slot' of a destroyed participant, making it
+        // available to a later call to 'claimSlot'.
+
+  public:
+    // CREATORS
+    explicit EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+        // Create a reclaimer in epoch 0 having no participants.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless the allocator is fully
+        // thread-safe.
+
+    ~EpochReclaimer();
+        // Reclaim every block orphaned by the participants of this reclaimer,
+        // and destroy this reclaimer.  The behavior is undefined unless every
+        // participant of this reclaimer has been destroyed.
+
+    // MANIPULATORS
+    int reclaim();
+        // Attempt to advance the epoch, then reclaim every orphaned block
+        // that no reader can still be accessing.  Return the number of blocks
+        // reclaimed.
+
+    bool tryAdvance();
+        // Increment the epoch if every participant that is in a critical
+        // section entered it in the current epoch.  Return 'true' if the
+        // epoch was incremented (by this call or by a concurrent one), and
+        // 'false' otherwise.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this reclaimer to supply memory.
+
+    bsls::Types::Int64 epoch() const;
+        // Return the current epoch of this reclaimer.
+
+    int numOrphans() const;
+        // Return the number of orphaned blocks that have not been reclaimed.
+
+    int numParticipants() const;
+        // Return the number of participants of this reclaimer.
+};
+
+                        // ============================
+                        // struct EpochReclaimer_Record
+                        // ============================
+
+struct EpochReclaimer_Record {
+    // This 'struct' records a retired block, linked into a list of the blocks
+    // retired in the same epoch.  This 'struct' is an implementation detail
+    // of this component, and should not be used outside it.
+
+    // DATA
+    EpochReclaimer_Record           *d_next_p;     // next record in the list
+    void                            *d_address_p;  // retired block
+    EpochReclaimer::ReclaimFunction  d_function;   // reclaims the block
+    void                            *d_context_p;  // context of 'd_function'
+    bsls::Types::Int64               d_epoch;      // epoch of retirement
+                                                   // (orphans only)
+};
+
+                         // ==========================
+                         // struct EpochReclaimer_Slot
+                         // ==========================
+
+struct EpochReclaimer_Slot {
+    // This 'struct' records whether the participant owning the slot is in a
+    // critical section and, if so, the epoch in which it entered it.  This
+    // 'struct' is an implementation detail of this component, and should not
+    // be used outside it.
+
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+    // DATA
+    bsls::AtomicInt64    d_state;      // '(epoch << 1) | 1' while in a
+                                       // critical section, and 0 otherwise
+
+    bsls::AtomicInt      d_isClaimed;  // 1 if owned by a participant
+
+    EpochReclaimer_Slot *d_next_p;     // next slot (immutable once the slot
+                                       // is published)
+
+    char                 d_padding[k_CACHE_LINE_SIZE];
+                                       // keeps the slots of different
+                                       // participants on different cache
+                                       // lines
+};
+
+                          // ======================
+                          // class EpochParticipant
+                          // ======================
+
+class EpochParticipant {
+    // This class represents the participation of a thread in the deferred
+    // reclamation managed by an 'EpochReclaimer': it delimits the critical
+    // sections of the thread, and holds the blocks retired by the thread
+    // until they can be reclaimed.  An object of this class must be used by
+    // only one thread at a time.
+
+  public:
+    // TYPES
+    typedef EpochReclaimer::ReclaimFunction ReclaimFunction;
+        // Alias for a function reclaiming a retired block.
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_LIMBO_LISTS  = 3,   // lists of blocks retired in the last three
+                                  // epochs
+
+        k_RECLAIM_INTERVAL = 64   // number of retirements between automatic
+                                  // calls to 'reclaim'
+    };
+
+    // DATA
+    EpochReclaimer_Record *d_limbo_p[k_NUM_LIMBO_LISTS];
+                                                 // blocks retired in each
+                                                 // epoch, indexed by epoch
+                                                 // modulo 3
+
+    bsls::Types::Int64     d_limboEpoch[k_NUM_LIMBO_LISTS];
+                                                 // epoch of each limbo list
+
+    int                    d_numRetired;         // number of blocks not yet
+                                                 // reclaimed
+
+    int                    d_numRetiredSinceReclaim;
+                                                 // retirements since the
+                                                 // last call to 'reclaim'
+
+    int                    d_depth;              // nesting depth of the
+                                                 // current critical section
+
+    EpochReclaimer_Slot   *d_slot_p;             // slot of this participant
+
+    EpochReclaimer        *d_reclaimer_p;        // reclaimer (held, not
+                                                 // owned)
+
+    Pool                   d_recordPool;         // supplies the records of
+                                                 // retired blocks
+
+  private:
+    // NOT IMPLEMENTED
+    EpochParticipant(const EpochParticipant&);
+    EpochParticipant& operator=(const EpochParticipant&);
+
+    // PRIVATE CLASS METHODS
+    template <class ALLOCATOR>
+    static void deallocateBlock(void *address, void *allocator);
+        // Deallocate the block at the specified 'address' from the specified
+        // 'allocator' of the (template parameter) 'ALLOCATOR' type.
+
+    template <class TYPE, class ALLOCATOR>
+    static void deleteObject(void *address, void *allocator);
+        // Destroy the object of the (template parameter) 'TYPE' at the
+        // specified 'address', and deallocate its footprint from the
+        // specified 'allocator' of the (template parameter) 'ALLOCATOR' type.
+
+    // PRIVATE MANIPULATORS
+    int reclaimList(int index);
+        // Reclaim every block in the limbo list at the specified 'index', and
+        // return the number of blocks reclaimed.
+
+  public:
+    // CREATORS
+    explicit EpochParticipant(EpochReclaimer *reclaimer);
+        // Create a participant, outside any critical section and having no
+        // retired blocks, in the reclamation managed by the specified
+        // 'reclaimer', and using the allocator of 'reclaimer' to supply
+        // memory.
+
+    ~EpochParticipant();
+        // Reclaim the blocks retired by this participant that can be
+        // reclaimed, transfer the others to the reclaimer of this participant
+        // as orphans, and destroy this participant.  The behavior is
+        // undefined if this participant is in a critical section.
+
+    // MANIPULATORS
+    void enter();
+        // Enter a critical section, during which no block reachable from a
+        // shared structure when the critical section is entered is reclaimed.
+        // Critical sections may be nested, in which case only the outermost
+        // one has an effect.
+
+    void leave();
+        // Leave the critical section entered by the most recent unmatched
+        // call to 'enter'.  The behavior is undefined unless this participant
+        // is in a critical section.
+
+    int reclaim();
+        // Attempt to advance the epoch, then reclaim every block retired by
+        // this participant that no reader can still be accessing.  Return
+        // the number of blocks reclaimed.
+
+    void retire(void            *address,
+                ReclaimFunction  function,
+                void            *context);
+        // Retire the block at the specified 'address', which has been made
+        // unreachable from the shared structures read in critical sections,
+        // so that the specified 'function' is invoked with 'address' and the
+        // specified 'context' once no reader can still be accessing it.  The
+        // behavior is undefined unless 'function' does not throw.
+
+    template <class ALLOCATOR>
+    void retire(void *address, ALLOCATOR *allocator);
+        // Retire the block at the specified 'address', which has been made
+        // unreachable from the shared structures read in critical sections,
+        // so that it is deallocated from the specified 'allocator' (by
+        // calling 'allocator->deallocate(address)') once no reader can still
+        // be accessing it.  The (template parameter) 'ALLOCATOR' type may be,
+        // e.g., 'bdlma::Pool', 'bdlma::Multipool', or 'bslma::Allocator'.
+
+    template <class TYPE, class ALLOCATOR>
+    void retireObject(TYPE *object, ALLOCATOR *allocator);
+        // Retire the specified 'object', which has been made unreachable from
+        // the shared structures read in critical sections, so that it is
+        // destroyed, and its footprint deallocated from the specified
+        // 'allocator', once no reader can still be accessing it.  The
+        // behavior is undefined unless the destructor of the (template
+        // parameter) 'TYPE' does not throw.
+
+    // ACCESSORS
+    bool isInCriticalSection() const;
+        // Return 'true' if this participant is in a critical section, and
+        // 'false' otherwise.
+
+    int numRetired() const;
+        // Return the number of blocks retired by this participant that have
+        // not been reclaimed.
+
+    EpochReclaimer *reclaimer() const;
+        // Return the reclaimer of this participant.
+};
+
+                              // ================
+                              // class EpochGuard
+                              // ================
+
+class EpochGuard {
+    // This class implements a guard keeping a participant in a critical
+    // section for the lifetime of the guard.
+
+    // DATA
+    EpochParticipant *d_participant_p;  // guarded participant
+
+  private:
+    // NOT IMPLEMENTED
+    EpochGuard(const EpochGuard&);
+    EpochGuard& operator=(const EpochGuard&);
+
+  public:
+    // CREATORS
+    explicit EpochGuard(EpochParticipant *participant);
+        // Create a guard entering the specified 'participant' into a critical
+        // section.
+
+    ~EpochGuard();
+        // Leave the critical section entered by this guard, and destroy this
+        // guard.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // class EpochReclaimer
+                           // --------------------
+
+// ACCESSORS
+inline
+bslma::Allocator *EpochReclaimer::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Int64 EpochReclaimer::epoch() const
+{
+    return d_epoch.load();
+}
+
+inline
+int EpochReclaimer::numOrphans() const
+{
+    return d_numOrphans.load();
+}
+
+inline
+int EpochReclaimer::numParticipants() const
+{
+    return d_numParticipants.load();
+}
+
+                          // ----------------------
+                          // class EpochParticipant
+                          // ----------------------
+
+// PRIVATE CLASS METHODS
+template <class ALLOCATOR>
+void EpochParticipant::deallocateBlock(void *address, void *allocator)
+{
+    static_cast<ALLOCATOR *>(allocator)->deallocate(address);
+}
+
+template <class TYPE, class ALLOCATOR>
+void EpochParticipant::deleteObject(void *address, void *allocator)
+{
+    static_cast<TYPE *>(address)->~TYPE();
+    static_cast<ALLOCATOR *>(allocator)->deallocate(address);
+}
+
+// MANIPULATORS
+inline
+void EpochParticipant::enter()
+{
+    if (0 == d_depth++) {
+        // A sequentially consistent exchange, so that the loads of the
+        // critical section are not performed before the epoch is published.
+
+        d_slot_p->d_state.swap((d_reclaimer_p->d_epoch.load() << 1) | 1);
+    }
+}
+
+inline
+void EpochParticipant::leave()
+{
+    BSLS_ASSERT(0 < d_depth);
+
+    if (0 == --d_depth) {
+        d_slot_p->d_state.storeRelease(0);
+    }
+}
+
+template <class ALLOCATOR>
+inline
+void EpochParticipant::retire(void *address, ALLOCATOR *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(address, &deallocateBlock<ALLOCATOR>, allocator);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+void EpochParticipant::retireObject(TYPE *object, ALLOCATOR *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(static_cast<void *>(object),
+           &deleteObject<TYPE, ALLOCATOR>,
+           allocator);
+}
+
+// ACCESSORS
+inline
+bool EpochParticipant::isInCriticalSection() const
+{
+    return 0 < d_depth;
+}
+
+inline
+int EpochParticipant::numRetired() const
+{
+    return d_numRetired;
+}
+
+inline
+EpochReclaimer *EpochParticipant::reclaimer() const
+{
+    return d_reclaimer_p;
+}
+
+                              // ----------------
+                              // class EpochGuard
+                              // ----------------
+
+// CREATORS
+inline
+EpochGuard::EpochGuard(EpochParticipant *participant)
+: d_participant_p(participant)
+{
+    BSLS_ASSERT(participant);
+
+    d_participant_p->enter();
+}
+
+inline
+EpochGuard::~EpochGuard()
+{
+    d_participant_p->leave();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
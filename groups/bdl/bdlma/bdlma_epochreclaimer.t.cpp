@@ -0,0 +1,1149 @@
+// bdlma_epochreclaimer.t.cpp                                         -*-C++-*-
+#include <bdlma_epochreclaimer.h>
+
+#include <bdlma_multipool.h>
+#include <bdlma_pool.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::EpochReclaimer' and 'bdlma::EpochParticipant' defer the reclamation
+// of retired blocks until the epoch has advanced twice, which it cannot do
+// while a participant remains in a critical section entered in an earlier
+// epoch.  The primary concerns are that a retired block is never reclaimed
+// while a reader that could see it is in a critical section, and is reclaimed
+// (exactly once, by the supplied function) soon after no such reader
+// remains; that the blocks of a destroyed participant are orphaned to the
+// reclaimer rather than leaked or reclaimed early; that the slots of
+// destroyed participants are reused; and that concurrent readers never
+// observe a reclaimed block.  A reclaim function counting its invocations
+// and poisoning the reclaimed block is used throughout.
+// ----------------------------------------------------------------------------
+// EpochReclaimer
+// [ 2] EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+// [ 4] ~EpochReclaimer();
+// [ 4] int reclaim();
+// [ 3] bool tryAdvance();
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] bsls::Types::Int64 epoch() const;
+// [ 4] int numOrphans() const;
+// [ 2] int numParticipants() const;
+//
+// EpochParticipant
+// [ 2] explicit EpochParticipant(EpochReclaimer *reclaimer);
+// [ 4] ~EpochParticipant();
+// [ 2] void enter();
+// [ 2] void leave();
+// [ 3] int reclaim();
+// [ 3] void retire(void *address, ReclaimFunction function, void *context);
+// [ 3] void retire(void *address, ALLOCATOR *allocator);
+// [ 3] void retireObject(TYPE *object, ALLOCATOR *allocator);
+// [ 2] bool isInCriticalSection() const;
+// [ 3] int numRetired() const;
+// [ 2] EpochReclaimer *reclaimer() const;
+//
+// EpochGuard
+// [ 2] explicit EpochGuard(EpochParticipant *participant);
+// [ 2] ~EpochGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: The slots of destroyed participants are reused.
+// [ 3] CONCERN: A block is not reclaimed while a reader may access it.
+// [ 4] CONCERN: Blocks of destroyed participants are orphaned.
+// [ 5] CONCERN: Readers never observe a reclaimed block.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::EpochReclaimer   Obj;
+typedef bdlma::EpochParticipant Participant;
+typedef bdlma::EpochGuard       Guard;
+typedef bsls::Types::Int64      Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+enum { k_POISON = -1 };
+
+struct Block {
+    // This 'struct' is a retired block, poisoned when reclaimed.
+
+    int d_values[4];
+};
+
+extern "C" void countReclaim(void *address, void *context)
+    // Poison the 'Block' at the specified 'address', and increment the 'int'
+    // counter at the specified 'context'.
+{
+    Block *block = static_cast<Block *>(address);
+    for (int i = 0; i < 4; ++i) {
+        block->d_values[i] = k_POISON;
+    }
+    ++*static_cast<int *>(context);
+}
+
+class CountedObject {
+    // This class counts its live instances.
+
+  public:
+    // CLASS DATA
+    static int s_numLive;  // number of live instances
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    CountedObject()
+    : d_value(0)
+    {
+        ++s_numLive;
+    }
+
+    ~CountedObject()
+    {
+        --s_numLive;
+    }
+};
+
+int CountedObject::s_numLive = 0;
+
+struct CountingDeallocator {
+    // This 'struct' is a minimal allocator counting its deallocations.
+
+    // DATA
+    int d_numDeallocations;
+
+    // CREATORS
+    CountingDeallocator()
+    : d_numDeallocations(0)
+    {
+    }
+
+    // MANIPULATORS
+    void deallocate(void *)
+    {
+        ++d_numDeallocations;
+    }
+};
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+void yieldThread()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+namespace TestCase5 {
+
+enum {
+    k_NUM_READERS    = 4,
+    k_NUM_WRITERS    = 2,
+    k_NUM_ITERATIONS = 20000
+};
+
+struct Shared {
+    // This 'struct' holds the state shared by the threads of the test.
+
+    Obj                        *d_reclaimer_p;
+    bsls::AtomicPointer<Block>  d_current;
+    bsls::AtomicInt             d_numWritersDone;
+    bslma::Allocator           *d_allocator_p;
+};
+
+struct ThreadInfo {
+    Shared *d_shared_p;
+    int     d_id;
+    int     d_numErrors;
+    int     d_numReads;
+    int     d_maxRetired;
+};
+
+extern "C" void poisonAndFree(void *address, void *context)
+    // Poison the 'Block' at the specified 'address', and deallocate it from
+    // the 'bslma::Allocator' at the specified 'context'.
+{
+    Block *block = static_cast<Block *>(address);
+    for (int i = 0; i < 4; ++i) {
+        block->d_values[i] = k_POISON;
+    }
+    static_cast<bslma::Allocator *>(context)->deallocate(block);
+}
+
+extern "C" void *readerFunction(void *arg)
+{
+    ThreadInfo *info   = static_cast<ThreadInfo *>(arg);
+    Shared     *shared = info->d_shared_p;
+
+    Participant participant(shared->d_reclaimer_p);
+
+    while (shared->d_numWritersDone.loadAcquire() < k_NUM_WRITERS) {
+        Guard guard(&participant);
+
+        const Block *block = shared->d_current.loadAcquire();
+
+        // Read the block several times, so that a concurrent reclamation
+        // would likely be observed.
+
+        for (int r = 0; r < 8; ++r) {
+            const int value = block->d_values[0];
+            for (int i = 1; i < 4; ++i) {
+                if (k_POISON == value || value != block->d_values[i]) {
+                    ++info->d_numErrors;
+                }
+            }
+        }
+        ++info->d_numReads;
+
+        // Yield outside the critical section, so that, on a machine having
+        // fewer processors than threads, readers are seldom preempted inside
+        // their critical sections (which would hold the epoch back).
+
+        yieldThread();
+    }
+
+    return arg;
+}
+
+extern "C" void *writerFunction(void *arg)
+{
+    ThreadInfo *info   = static_cast<ThreadInfo *>(arg);
+    Shared     *shared = info->d_shared_p;
+
+    {
+        Participant participant(shared->d_reclaimer_p);
+
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            Block *block = static_cast<Block *>(
+                               shared->d_allocator_p->allocate(sizeof(Block)));
+            for (int j = 0; j < 4; ++j) {
+                block->d_values[j] = info->d_id * k_NUM_ITERATIONS + i;
+            }
+
+            Block *previous = shared->d_current.swapAcqRel(block);
+            participant.retire(previous, &poisonAndFree,
+                               shared->d_allocator_p);
+
+            if (info->d_maxRetired < participant.numRetired()) {
+                info->d_maxRetired = participant.numRetired();
+            }
+
+            // Yield periodically, so that a reader preempted inside its
+            // critical section can leave it.
+
+            if (0 == i % 16) {
+                yieldThread();
+            }
+        }
+    }
+
+    shared->d_numWritersDone.addAcqRel(1);
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Replacing a Read-Mostly Snapshot
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service consults, on every request, a table of limits that
+// is replaced (rarely) by a configuration thread, and that we want readers
+// neither to take a lock nor to update a reference count.
+//
+// First, we define the snapshot of the limits, which is supplied by a
+// 'bdlma::Pool' used only by the configuration thread:
+//..
+    struct Limits {
+        // This 'struct' holds a snapshot of the limits of a service.
+
+        int d_version;
+        int d_maxRequests;
+        int d_maxBytes;
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+//..
+    bslma::TestAllocator         ta("test", veryVeryVerbose);
+    bdlma::Pool                  pool(sizeof(Limits), &ta);
+    bdlma::EpochReclaimer        reclaimer(&ta);
+    bsls::AtomicPointer<Limits>  current;
+
+    Limits *initial = new (pool.allocate()) Limits();
+    initial->d_version     = 1;
+    initial->d_maxRequests = 100;
+    initial->d_maxBytes    = 4096;
+    current.storeRelease(initial);
+//..
+// Then, a reader, having a participant of its own, reads the current limits
+// in a critical section, so that the snapshot it reads is not reclaimed while
+// it uses it:
+//..
+    bdlma::EpochParticipant reader(&reclaimer);
+    {
+        bdlma::EpochGuard guard(&reader);
+
+        const Limits *limits = current.loadAcquire();
+        ASSERT(1   == limits->d_version);
+        ASSERT(100 == limits->d_maxRequests);
+    }
+//..
+// Next, the configuration thread publishes new limits, and retires the
+// snapshot it replaced, which is not returned to the pool immediately:
+//..
+    bdlma::EpochParticipant writer(&reclaimer);
+
+    Limits *next = new (pool.allocate()) Limits();
+    next->d_version     = 2;
+    next->d_maxRequests = 200;
+    next->d_maxBytes    = 8192;
+
+    Limits *previous = current.swapAcqRel(next);
+    writer.retire(previous, &pool);
+
+    ASSERT(1 == writer.numRetired());
+//..
+// Now, while the reader is in a critical section, the epoch cannot advance
+// far enough for the retired snapshot to be reclaimed:
+//..
+    reader.enter();
+
+    ASSERT(0 == writer.reclaim());
+    ASSERT(0 == writer.reclaim());
+    ASSERT(1 == writer.numRetired());
+
+    reader.leave();
+//..
+// Finally, once the reader has left its critical section, the snapshot is
+// returned to the pool after the epoch advances twice:
+//..
+    writer.reclaim();
+    writer.reclaim();
+
+    ASSERT(0 == writer.numRetired());
+
+    pool.deallocate(current.loadRelaxed());
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 A reader in a critical section never observes a block reclaimed
+        //:   by a concurrent writer.
+        //:
+        //: 2 Writers reclaim their blocks while readers repeatedly enter and
+        //:   leave critical sections, so that the number of pending blocks
+        //:   remains bounded.
+        //:
+        //: 3 Every block is eventually reclaimed.
+        //
+        // Plan:
+        //: 1 Run several readers, each repeatedly reading the current block
+        //:   in a critical section and verifying that it is not poisoned,
+        //:   while several writers replace the current block and retire the
+        //:   block they replaced, with a function poisoning it before
+        //:   deallocating it.  (C-1)
+        //:
+        //: 2 Verify, in each writer, that the number of pending blocks stays
+        //:   bounded.  (C-2)
+        //:
+        //: 3 Verify that no memory is in use once the threads have joined,
+        //:   the last block has been deallocated, and the reclaimer has been
+        //:   destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Readers never observe a reclaimed block.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace TestCase5;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(&ta);
+
+            Shared shared;
+            shared.d_reclaimer_p = &mX;
+            shared.d_allocator_p = &ta;
+
+            Block *initial = static_cast<Block *>(ta.allocate(sizeof(Block)));
+            for (int j = 0; j < 4; ++j) {
+                initial->d_values[j] = 0;
+            }
+            shared.d_current.storeRelease(initial);
+
+            enum { k_NUM_THREADS = k_NUM_READERS + k_NUM_WRITERS };
+
+            ThreadInfo info[k_NUM_THREADS];
+            ThreadId   ids[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                info[i].d_shared_p  = &shared;
+                info[i].d_id        = i;
+                info[i].d_numErrors = 0;
+                info[i].d_numReads  = 0;
+                info[i].d_maxRetired = 0;
+                ids[i] = createThread(i < k_NUM_READERS ? &readerFunction
+                                                        : &writerFunction,
+                                      &info[i]);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+                ASSERTV(i, info[i].d_numErrors, 0 == info[i].d_numErrors);
+                ASSERTV(i, info[i].d_maxRetired,
+                        info[i].d_maxRetired < k_NUM_ITERATIONS / 4);
+            }
+
+            if (veryVerbose) {
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    T_ P_(i) P(info[i].d_numReads)
+                }
+                for (int i = k_NUM_READERS; i < k_NUM_THREADS; ++i) {
+                    T_ P_(i) P(info[i].d_maxRetired)
+                }
+                T_ P(mX.epoch())
+            }
+
+            ASSERTV(mX.numParticipants(), 0 == mX.numParticipants());
+
+            mX.reclaim();
+            mX.reclaim();
+            ASSERTV(mX.numOrphans(), 0 == mX.numOrphans());
+
+            ta.deallocate(shared.d_current.loadRelaxed());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: ORPHANED BLOCKS
+        //
+        // Concerns:
+        //: 1 A participant destroyed with retired blocks reclaims the blocks
+        //:   it can, possibly after advancing the epoch.
+        //:
+        //: 2 The blocks that cannot be reclaimed (because a reader holds the
+        //:   epoch back) are orphaned to the reclaimer, and are not reclaimed
+        //:   by 'EpochReclaimer::reclaim' while the reader remains in its
+        //:   critical section.
+        //:
+        //: 3 'EpochReclaimer::reclaim' reclaims the orphans once the reader
+        //:   has left, and returns their number.
+        //:
+        //: 4 The destructor of the reclaimer reclaims the remaining orphans,
+        //:   and releases all memory.
+        //
+        // Plan:
+        //: 1 Destroy a participant with retired blocks and no reader, and
+        //:   verify that the blocks are reclaimed.  (C-1)
+        //:
+        //: 2 Destroy a participant with retired blocks while a reader is in
+        //:   a critical section, and verify the number of orphans, and that
+        //:   'reclaim' reclaims none of them.  (C-2)
+        //:
+        //: 3 Let the reader leave, and call 'reclaim' until all orphans are
+        //:   reclaimed.  (C-3)
+        //:
+        //: 4 Orphan blocks, destroy the reclaimer, and verify that the blocks
+        //:   are reclaimed and no memory is in use.  (C-4)
+        //
+        // Testing:
+        //   ~EpochReclaimer();
+        //   int reclaim();
+        //   int numOrphans() const;
+        //   ~EpochParticipant();
+        //   CONCERN: Blocks of destroyed participants are orphaned.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ORPHANED BLOCKS" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Block blocks[8];
+        int   numReclaimed = 0;
+
+        if (verbose) cout << "\nDestroying a participant with no reader."
+                          << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            {
+                Participant writer(&mX);
+
+                for (int i = 0; i < 3; ++i) {
+                    writer.retire(&blocks[i], &countReclaim, &numReclaimed);
+                }
+                ASSERT(0 == numReclaimed);
+            }
+            ASSERTV(numReclaimed, 3 == numReclaimed);
+            ASSERT(0 == X.numOrphans());
+            ASSERT(0 == mX.reclaim());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nDestroying a participant while a reader "
+                             "is in a critical section." << endl;
+        {
+            numReclaimed = 0;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            Participant reader(&mX);
+            reader.enter();
+            {
+                Participant writer(&mX);
+
+                for (int i = 0; i < 5; ++i) {
+                    writer.retire(&blocks[i], &countReclaim, &numReclaimed);
+                }
+            }
+            ASSERTV(numReclaimed, 0 == numReclaimed);
+            ASSERTV(X.numOrphans(), 5 == X.numOrphans());
+            ASSERTV(X.numParticipants(), 1 == X.numParticipants());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.reclaim());
+            }
+            ASSERT(5 == X.numOrphans());
+
+            reader.leave();
+
+            int n = 0;
+            for (int i = 0; i < 3 && X.numOrphans(); ++i) {
+                n += mX.reclaim();
+            }
+            ASSERTV(n, 5 == n);
+            ASSERTV(numReclaimed, 5 == numReclaimed);
+            ASSERT(0 == X.numOrphans());
+            ASSERT(0 == mX.reclaim());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nDestroying the reclaimer with orphans."
+                          << endl;
+        {
+            numReclaimed = 0;
+
+            Obj mX(&ta);  const Obj& X = mX;
+            {
+                Participant reader(&mX);
+                reader.enter();
+                {
+                    Participant writer(&mX);
+
+                    for (int i = 0; i < 8; ++i) {
+                        writer.retire(&blocks[i],
+                                      &countReclaim,
+                                      &numReclaimed);
+                    }
+                }
+                reader.leave();
+            }
+            ASSERT(8 == X.numOrphans());
+            ASSERT(0 == numReclaimed);
+        }
+        ASSERTV(numReclaimed, 8 == numReclaimed);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'retire', 'reclaim', AND 'tryAdvance'
+        //
+        // Concerns:
+        //: 1 A retired block is reclaimed, exactly once and by its function
+        //:   invoked with its context, after the epoch has advanced twice.
+        //:
+        //: 2 The epoch does not advance while a participant remains in a
+        //:   critical section entered in an earlier epoch, but does advance
+        //:   while participants are in critical sections entered in the
+        //:   current epoch.
+        //:
+        //: 3 Retiring blocks reclaims older blocks automatically, so that the
+        //:   number of pending blocks remains bounded without explicit calls
+        //:   to 'reclaim'.
+        //:
+        //: 4 The 'retire' and 'retireObject' templates return blocks to a
+        //:   'bdlma::Pool', a 'bdlma::Multipool', a 'bslma::Allocator', and
+        //:   any type having a 'deallocate' method, destroying the object in
+        //:   the case of 'retireObject'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Retire a block, and verify that 'reclaim' reclaims it on its
+        //:   second call.  (C-1)
+        //:
+        //: 2 Verify the result of 'tryAdvance' and the epoch with a reader in
+        //:   a critical section entered in the current and in an earlier
+        //:   epoch, and that blocks are not reclaimed in the latter case.
+        //:   (C-2)
+        //:
+        //: 3 Retire many blocks without calling 'reclaim', and verify that
+        //:   the number of pending blocks remains bounded.  (C-3)
+        //:
+        //: 4 Retire blocks of each kind of allocator, and verify that the
+        //:   allocators get their blocks back.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   bool tryAdvance();
+        //   bsls::Types::Int64 epoch() const;
+        //   int reclaim();
+        //   void retire(void *address, ReclaimFunction function, void *ctx);
+        //   void retire(void *address, ALLOCATOR *allocator);
+        //   void retireObject(TYPE *object, ALLOCATOR *allocator);
+        //   int numRetired() const;
+        //   CONCERN: A block is not reclaimed while a reader may access it.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'retire', 'reclaim', AND 'tryAdvance'" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        Block blocks[4];
+        int   numReclaimed = 0;
+
+        if (verbose) cout << "\nReclaiming after two epochs." << endl;
+        {
+            Obj         mX(&ta);  const Obj& X = mX;
+            Participant writer(&mX);
+
+            ASSERT(0 == X.epoch());
+
+            writer.retire(&blocks[0], &countReclaim, &numReclaimed);
+            ASSERT(1 == writer.numRetired());
+            ASSERT(0 == numReclaimed);
+
+            ASSERT(0 == writer.reclaim());
+            ASSERT(1 == X.epoch());
+            ASSERT(1 == writer.numRetired());
+
+            ASSERT(1 == writer.reclaim());
+            ASSERT(2 == X.epoch());
+            ASSERT(0 == writer.numRetired());
+            ASSERT(1 == numReclaimed);
+            ASSERT(k_POISON == blocks[0].d_values[0]);
+
+            ASSERT(0 == writer.reclaim());
+            ASSERT(1 == numReclaimed);
+        }
+
+        if (verbose) cout << "\nAdvancing with readers." << endl;
+        {
+            numReclaimed = 0;
+
+            Obj         mX(&ta);  const Obj& X = mX;
+            Participant reader(&mX);
+            Participant writer(&mX);
+
+            {
+                Guard guard(&reader);
+
+                ASSERT(true == mX.tryAdvance());
+                ASSERT(1    == X.epoch());
+
+                ASSERT(false == mX.tryAdvance());
+                ASSERT(1     == X.epoch());
+
+                writer.retire(&blocks[0], &countReclaim, &numReclaimed);
+
+                for (int i = 0; i < 4; ++i) {
+                    ASSERT(0 == writer.reclaim());
+                }
+                ASSERT(1 == X.epoch());
+                ASSERT(1 == writer.numRetired());
+            }
+
+            {
+                // A reader entering in the current epoch does not hold the
+                // epoch back.
+
+                Guard guard(&reader);
+
+                ASSERT(true == mX.tryAdvance());
+                ASSERT(2    == X.epoch());
+
+                ASSERT(0 == numReclaimed);
+            }
+
+            ASSERT(1 == writer.reclaim());
+            ASSERT(3 == X.epoch());
+            ASSERT(1 == numReclaimed);
+        }
+
+        if (verbose) cout << "\nReclaiming automatically." << endl;
+        {
+            numReclaimed = 0;
+
+            Obj         mX(&ta);
+            Participant writer(&mX);
+
+            for (int i = 0; i < 10000; ++i) {
+                writer.retire(&blocks[i % 4], &countReclaim, &numReclaimed);
+                ASSERTV(i, writer.numRetired(),
+                        writer.numRetired() <= 3 * 64);
+            }
+            ASSERTV(numReclaimed, 10000 - numReclaimed
+                                                  == writer.numRetired());
+        }
+
+        if (verbose) cout << "\nRetiring blocks of allocators." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            bdlma::Pool      pool(sizeof(CountedObject), &ta);
+            bdlma::Multipool multipool(&ta);
+
+            Obj mX(&ta);
+            {
+                Participant writer(&mX);
+
+                void *p = pool.allocate();
+                writer.retire(p, &pool);
+
+                void *q = multipool.allocate(100);
+                writer.retire(q, &multipool);
+
+                void *r = oa.allocate(100);
+                writer.retire(r, static_cast<bslma::Allocator *>(&oa));
+
+                CountingDeallocator cd;
+                writer.retire(&cd, &cd);
+
+                CountedObject *object = new (pool.allocate()) CountedObject();
+                ASSERT(1 == CountedObject::s_numLive);
+                writer.retireObject(object, &pool);
+                ASSERT(1 == CountedObject::s_numLive);
+
+                ASSERT(5 == writer.numRetired());
+
+                writer.reclaim();
+                writer.reclaim();
+
+                ASSERT(0 == writer.numRetired());
+                ASSERT(0 == CountedObject::s_numLive);
+                ASSERT(0 == oa.numBlocksInUse());
+                ASSERT(1 == cd.d_numDeallocations);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj         mX(&ta);
+            Participant writer(&mX);
+
+            ASSERT_FAIL(writer.retire(&blocks[0], 0, 0));
+            ASSERT_PASS(writer.retire(&blocks[0],
+                                      &countReclaim,
+                                      &numReclaimed));
+
+            ASSERT_FAIL(writer.retire(&blocks[1],
+                                      static_cast<bdlma::Pool *>(0)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PARTICIPANTS AND CRITICAL SECTIONS
+        //
+        // Concerns:
+        //: 1 A reclaimer is created in epoch 0, using the supplied (or the
+        //:   default) allocator, and has no participants.
+        //:
+        //: 2 A participant refers to its reclaimer, is counted as one of its
+        //:   participants until destroyed, and is created outside any
+        //:   critical section.
+        //:
+        //: 3 'enter' and 'leave' nest, and only the outermost pair has an
+        //:   effect; 'EpochGuard' enters and leaves a critical section.
+        //:
+        //: 4 The slot of a destroyed participant is reused by a later
+        //:   participant, without allocating memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a reclaimer with and without an allocator, and verify its
+        //:   attributes.  (C-1)
+        //:
+        //: 2 Create and destroy participants, and verify their attributes and
+        //:   the number of participants.  (C-2)
+        //:
+        //: 3 Nest calls to 'enter', 'leave', and guards, and verify
+        //:   'isInCriticalSection' and that the epoch can advance only after
+        //:   the outermost 'leave'.  (C-3)
+        //:
+        //: 4 Create participants after destroying others, and verify that no
+        //:   memory is allocated for their slots.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+        //   bslma::Allocator *allocator() const;
+        //   int numParticipants() const;
+        //   explicit EpochParticipant(EpochReclaimer *reclaimer);
+        //   void enter();
+        //   void leave();
+        //   bool isInCriticalSection() const;
+        //   EpochReclaimer *reclaimer() const;
+        //   explicit EpochGuard(EpochParticipant *participant);
+        //   ~EpochGuard();
+        //   CONCERN: The slots of destroyed participants are reused.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARTICIPANTS AND CRITICAL SECTIONS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the reclaimer." << endl;
+        {
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == X.epoch());
+            ASSERT(0   == X.numParticipants());
+            ASSERT(0   == X.numOrphans());
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            ASSERT(&ta == Y.allocator());
+        }
+
+        if (verbose) cout << "\nTesting participants." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            {
+                Participant p1(&mX);
+                ASSERT(&mX   == p1.reclaimer());
+                ASSERT(false == p1.isInCriticalSection());
+                ASSERT(0     == p1.numRetired());
+                ASSERT(1     == X.numParticipants());
+
+                Participant p2(&mX);
+                ASSERT(2 == X.numParticipants());
+            }
+            ASSERT(0 == X.numParticipants());
+
+            const Int64 numBlocks = ta.numBlocksTotal();
+            {
+                Participant p1(&mX);
+                Participant p2(&mX);
+                ASSERT(2 == X.numParticipants());
+
+                // The pool supplying retired-block records allocates lazily,
+                // so no memory is allocated.
+
+                ASSERT(numBlocks == ta.numBlocksTotal());
+            }
+            ASSERT(0 == X.numParticipants());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting critical sections." << endl;
+        {
+            Obj         mX(&ta);  const Obj& X = mX;
+            Participant p(&mX);
+
+            p.enter();
+            ASSERT(true == p.isInCriticalSection());
+            {
+                Guard guard(&p);
+                ASSERT(true == p.isInCriticalSection());
+
+                p.enter();
+                p.leave();
+                ASSERT(true == p.isInCriticalSection());
+            }
+            ASSERT(true == p.isInCriticalSection());
+
+            ASSERT(true  == mX.tryAdvance());
+            ASSERT(false == mX.tryAdvance());
+            ASSERT(1     == X.epoch());
+
+            p.leave();
+            ASSERT(false == p.isInCriticalSection());
+
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(true == mX.tryAdvance());
+            ASSERT(3    == X.epoch());
+
+            {
+                Guard guard(&p);
+                ASSERT(true == p.isInCriticalSection());
+            }
+            ASSERT(false == p.isInCriticalSection());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj         mX(&ta);
+            Participant p(&mX);
+
+            ASSERT_FAIL(p.leave());
+            p.enter();
+            ASSERT_PASS(p.leave());
+
+            ASSERT_FAIL(Guard(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Retire blocks from a participant, with and without a reader in a
+        //:   critical section, and reclaim them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            bdlma::Pool pool(sizeof(Block), &ta);
+
+            Obj         mX(&ta);
+            Participant reader(&mX);
+            Participant writer(&mX);
+
+            Block *block = static_cast<Block *>(pool.allocate());
+            {
+                Guard guard(&reader);
+
+                writer.retire(block, &pool);
+                ASSERT(1 == writer.numRetired());
+
+                writer.reclaim();
+                writer.reclaim();
+                ASSERT(1 == writer.numRetired());
+            }
+
+            writer.reclaim();
+            writer.reclaim();
+            ASSERT(0 == writer.numRetired());
+
+            ASSERT(block == pool.allocate());
+            pool.deallocate(block);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
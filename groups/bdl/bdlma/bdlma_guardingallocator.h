@@ -7,7 +7,7 @@
 //@CLASSES:
 //  bdlma::GuardingAllocator: memory allocator that detects buffer overruns
 //
-//@SEE_ALSO: bslma_allocator, bslma_testallocator
+//@SEE_ALSO: bslma_allocator, bslma_testallocator, bdlma_guardingpoolallocator
 //
 //@DESCRIPTION: This component provides a concrete allocation mechanism,
 // 'bdlma::GuardingAllocator', that implements the 'bslma::Allocator' protocol
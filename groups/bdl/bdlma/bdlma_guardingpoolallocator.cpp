@@ -0,0 +1,476 @@
+// bdlma_guardingpoolallocator.cpp                                    -*-C++-*-
+#include <bdlma_guardingpoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_guardingpoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_threadshardutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>  // 'madvise', 'mmap', 'mprotect', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+// HELPER FUNCTIONS
+
+int getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return pageSize.loadRelaxed();
+}
+
+char *systemReserve(bsl::size_t size)
+    // Reserve a page-aligned region of virtual memory of the specified 'size'
+    // (in bytes), protected from read/write access and not backed by physical
+    // memory, and return the address of the region, or 0 if it cannot be
+    // reserved.  The behavior is undefined unless 'size > 0'.
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return static_cast<char *>(
+                     VirtualAlloc(0, size, MEM_RESERVE, PAGE_NOACCESS));
+                                                                      // RETURN
+
+#else
+
+#ifdef MAP_NORESERVE
+    const int flags = MAP_ANON | MAP_PRIVATE | MAP_NORESERVE;
+#else
+    const int flags = MAP_ANON | MAP_PRIVATE;
+#endif
+
+    void *address = mmap(0, size, PROT_NONE, flags, -1, 0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return static_cast<char *>(address);                              // RETURN
+
+#endif
+}
+
+void systemRelease(char *address, bsl::size_t size)
+    // Release the region of virtual memory of the specified 'size' (in bytes)
+    // at the specified 'address'.  The behavior is undefined unless 'address'
+    // and 'size' describe a region returned by 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void) size;
+
+#else
+
+    munmap(address, size);
+
+#endif
+}
+
+int systemCommit(char *address, bsl::size_t size)
+    // Make the pages of the specified 'size' (in bytes) at the specified
+    // 'address' accessible for reading and writing.  Return 0 on success, and
+    // a non-zero value otherwise.  The behavior is undefined unless the pages
+    // lie within a region returned by 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return 0 == VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    return mprotect(address, size, PROT_READ | PROT_WRITE);           // RETURN
+
+#endif
+}
+
+int systemDecommit(char *address, bsl::size_t size)
+    // Return the physical memory backing the pages of the specified 'size'
+    // (in bytes) at the specified 'address' to the operating system, and
+    // protect the pages from read/write access, without releasing their
+    // virtual addresses.  Return 0 on success, and a non-zero value
+    // otherwise.  The behavior is undefined unless the pages lie within a
+    // region returned by 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return !VirtualFree(address, size, MEM_DECOMMIT);                 // RETURN
+
+#else
+
+#ifdef MADV_DONTNEED
+    madvise(address, size, MADV_DONTNEED);
+#endif
+
+    return mprotect(address, size, PROT_NONE);                        // RETURN
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                        // ---------------------------
+                        // class GuardingPoolAllocator
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+void *GuardingPoolAllocator::allocateGuarded(size_type size)
+{
+    if (!d_region_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const size_type paddedSize =
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+    // Find the smallest size class whose slots hold 'paddedSize' bytes.
+
+    int sizeClass = 0;
+    while (sizeClass < k_NUM_SIZE_CLASSES
+        && (static_cast<size_type>(d_pageSize) << sizeClass) < paddedSize) {
+        ++sizeClass;
+    }
+
+    if (k_NUM_SIZE_CLASSES == sizeClass) {
+        return 0;                                                     // RETURN
+    }
+
+    SizeClass& sc = d_classes[sizeClass];
+
+    // Prefer slots never used to quarantined ones, and reuse the slot that
+    // has been quarantined the longest, so that a use of a deallocated block
+    // keeps faulting for as long as possible.
+
+    int slot;
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        if (sc.d_numCarved < d_numSlots) {
+            slot = sc.d_numCarved++;
+        }
+        else if (sc.d_numFree > 0) {
+            slot      = sc.d_freeSlots_p[sc.d_head];
+            sc.d_head = sc.d_head + 1 < d_numSlots ? sc.d_head + 1 : 0;
+            --sc.d_numFree;
+        }
+        else {
+            return 0;                                                 // RETURN
+        }
+
+        sc.d_inUse_p[slot] = true;
+        ++d_numGuardedInUse;
+    }
+
+    // The slot is now owned by the caller, so its pages can be made
+    // accessible outside of the lock.
+
+    const bsl::size_t dataSize  = static_cast<bsl::size_t>(d_pageSize)
+                                                                  << sizeClass;
+    char             *slotBegin = sc.d_begin_p + slot * slotSize(sizeClass);
+    char             *data      = GuardingAllocator::e_BEFORE_USER_BLOCK
+                                                         == d_guardPageLocation
+                                  ? slotBegin + d_pageSize
+                                  : slotBegin;
+
+    if (0 != systemCommit(data, dataSize)) {
+        bsls::BslLockGuard guard(&d_lock);
+
+        sc.d_inUse_p[slot] = false;
+        quarantine(&sc, slot);
+        --d_numGuardedInUse;
+        return 0;                                                     // RETURN
+    }
+
+    return GuardingAllocator::e_BEFORE_USER_BLOCK == d_guardPageLocation
+           ? data
+           : data + dataSize - paddedSize;
+}
+
+void GuardingPoolAllocator::initialize()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_countdown.storeRelaxed(d_samplingPeriod);
+    }
+
+    d_pageSize = getSystemPageSize();
+
+    // The quarantines of all size classes are followed, in the same block, by
+    // the states of all slots.
+
+    const int numSlotsTotal = k_NUM_SIZE_CLASSES * d_numSlots;
+
+    d_freeSlots_p = static_cast<int *>(d_allocator_p->allocate(
+                             (sizeof(int) + sizeof(bool)) * numSlotsTotal));
+
+    bool *inUse = reinterpret_cast<bool *>(d_freeSlots_p + numSlotsTotal);
+
+    bsl::size_t offset = 0;
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        d_classes[i].d_begin_p     = 0;
+        d_classes[i].d_numCarved   = 0;
+        d_classes[i].d_numFree     = 0;
+        d_classes[i].d_head        = 0;
+        d_classes[i].d_freeSlots_p = d_freeSlots_p + i * d_numSlots;
+        d_classes[i].d_inUse_p     = inUse + i * d_numSlots;
+
+        offset += d_numSlots * slotSize(i);
+    }
+
+    d_regionSize = offset;
+    d_region_p   = systemReserve(d_regionSize);
+
+    if (!d_region_p) {
+        d_allocator_p->deallocate(d_freeSlots_p);
+        d_freeSlots_p = 0;
+        d_regionSize  = 0;
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return;                                                       // RETURN
+#endif
+    }
+
+    offset = 0;
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        d_classes[i].d_begin_p = d_region_p + offset;
+
+        offset += d_numSlots * slotSize(i);
+    }
+}
+
+void GuardingPoolAllocator::quarantine(SizeClass *sizeClass, int slot)
+{
+    BSLS_ASSERT_SAFE(sizeClass->d_numFree < d_numSlots);
+
+    int tail = sizeClass->d_head + sizeClass->d_numFree;
+    if (tail >= d_numSlots) {
+        tail -= d_numSlots;
+    }
+
+    sizeClass->d_freeSlots_p[tail] = slot;
+    ++sizeClass->d_numFree;
+}
+
+// PRIVATE ACCESSORS
+bsl::size_t GuardingPoolAllocator::slotSize(int sizeClass) const
+{
+    BSLS_ASSERT_SAFE(0 <= sizeClass);
+    BSLS_ASSERT_SAFE(     sizeClass < k_NUM_SIZE_CLASSES);
+
+    return ((static_cast<bsl::size_t>(1) << sizeClass) + 1) * d_pageSize;
+}
+
+// CREATORS
+GuardingPoolAllocator::GuardingPoolAllocator(bslma::Allocator *basicAllocator)
+: d_samplingPeriod(k_DEFAULT_SAMPLING_PERIOD)
+, d_numSlots(k_DEFAULT_NUM_SLOTS)
+, d_guardPageLocation(GuardingAllocator::e_AFTER_USER_BLOCK)
+, d_pageSize(0)
+, d_region_p(0)
+, d_regionSize(0)
+, d_freeSlots_p(0)
+, d_numGuardedInUse(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+GuardingPoolAllocator::GuardingPoolAllocator(
+                                       int                samplingPeriod,
+                                       int                numSlotsPerSizeClass,
+                                       GuardPageLocation  guardLocation,
+                                       bslma::Allocator  *basicAllocator)
+: d_samplingPeriod(samplingPeriod)
+, d_numSlots(numSlotsPerSizeClass)
+, d_guardPageLocation(guardLocation)
+, d_pageSize(0)
+, d_region_p(0)
+, d_regionSize(0)
+, d_freeSlots_p(0)
+, d_numGuardedInUse(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= samplingPeriod);
+    BSLS_ASSERT(1 <= numSlotsPerSizeClass);
+
+    initialize();
+}
+
+GuardingPoolAllocator::~GuardingPoolAllocator()
+{
+    BSLS_ASSERT(0 == d_numGuardedInUse);
+
+    if (d_region_p) {
+        systemRelease(d_region_p, d_regionSize);
+        d_allocator_p->deallocate(d_freeSlots_p);
+    }
+}
+
+// MANIPULATORS
+void *GuardingPoolAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    // Count this allocation down on the countdown of the shard of the
+    // calling thread, restarting the countdown at the sampling period when
+    // it expires.  The countdown is read and written separately (rather than
+    // atomically decremented) since it is shared only by the threads
+    // assigned to the same shard, for which an occasional lost update merely
+    // shifts the next sample by one allocation.
+
+    Shard&    shard     = d_shards[ThreadShardUtil::shardIndex(k_NUM_SHARDS)];
+    const int countdown = shard.d_countdown.loadRelaxed();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(1 >= countdown)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        shard.d_countdown.storeRelaxed(d_samplingPeriod);
+
+        void *address = allocateGuarded(size);
+        if (address) {
+            return address;                                           // RETURN
+        }
+    }
+    else {
+        shard.d_countdown.storeRelaxed(countdown - 1);
+    }
+
+    return d_allocator_p->allocate(size);
+}
+
+void GuardingPoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!isGuarded(address))) {
+        d_allocator_p->deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    // Find the size class, and the slot within it, holding 'address'.
+
+    char *p = static_cast<char *>(address);
+
+    int sizeClass = k_NUM_SIZE_CLASSES - 1;
+    while (p < d_classes[sizeClass].d_begin_p) {
+        --sizeClass;
+    }
+
+    SizeClass&        sc        = d_classes[sizeClass];
+    const bsl::size_t size      = slotSize(sizeClass);
+    const int         slot      = static_cast<int>((p - sc.d_begin_p) / size);
+    char             *slotBegin = sc.d_begin_p + slot * size;
+    char             *data      = GuardingAllocator::e_BEFORE_USER_BLOCK
+                                                         == d_guardPageLocation
+                                  ? slotBegin + d_pageSize
+                                  : slotBegin;
+
+    BSLS_ASSERT(data <= p);
+    BSLS_ASSERT(p < data + size - d_pageSize);
+
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        // Report a double free: the slot of a guarded block that is not in
+        // use is either quarantined or being quarantined.
+
+        BSLS_ASSERT_OPT(sc.d_inUse_p[slot]);
+
+        sc.d_inUse_p[slot] = false;
+    }
+
+    // The slot is still owned by the caller (it is neither in use nor
+    // quarantined), so its pages can be protected outside of the lock.
+
+    const int rc = systemDecommit(data, size - d_pageSize);
+    (void)rc;
+
+    BSLS_ASSERT_OPT(0 == rc);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    quarantine(&sc, slot);
+    --d_numGuardedInUse;
+}
+
+// ACCESSORS
+int GuardingPoolAllocator::numGuardedBlocksInUse() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numGuardedInUse;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
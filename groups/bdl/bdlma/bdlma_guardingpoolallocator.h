@@ -0,0 +1,420 @@
+// bdlma_guardingpoolallocator.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMA_GUARDINGPOOLALLOCATOR
+#define INCLUDED_BDLMA_GUARDINGPOOLALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a low-overhead allocator guarding sampled blocks.
+//
+//@CLASSES:
+//  bdlma::GuardingPoolAllocator: pooled, sampling guard-page allocator
+//
+//@SEE_ALSO: bdlma_guardingallocator, bdlma_threadshardutil
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::GuardingPoolAllocator', that implements the 'bslma::Allocator'
+// protocol and, like 'bdlma::GuardingAllocator', adjoins a read/write
+// protected guard page to memory blocks returned by 'allocate', so that a
+// buffer overrun (or underrun) causes a memory fault at the point of the
+// faulty access.  Unlike 'bdlma::GuardingAllocator', which maps (and unmaps)
+// memory from the operating system on every call, this allocator is intended
+// to be left enabled in production:
+//
+//: o Only one in every 'samplingPeriod()' allocations is guarded; the others
+//:   are forwarded to an underlying allocator supplied at construction.
+//:
+//: o Guarded blocks are carved from a region of virtual memory reserved once,
+//:   at construction, whose guard pages are never accessible.  A guarded
+//:   block is handed out from a slot of its size class, and is recycled on
+//:   deallocation by returning its physical memory to the operating system
+//:   (e.g., using 'madvise(MADV_DONTNEED)') and protecting it from access,
+//:   rather than by unmapping it, so that a use of the block after it is
+//:   deallocated also causes a memory fault (see {Quarantine}).
+//
+// The cost of an unguarded allocation is that of the underlying allocator
+// plus the update of a countdown private to the shard of the calling thread
+// (see {Sampling}), and that of deallocating any block is an address
+// comparison plus (for guarded blocks) two system calls.
+//
+///Size Classes and Slots
+///----------------------
+// Guarded blocks are served from 'k_NUM_SIZE_CLASSES' size classes.  A slot
+// of size class 'c' consists of '2^c' memory pages, which hold the block, and
+// one guard page, which precedes or follows them according to the
+// 'GuardPageLocation' supplied at construction (see
+// 'bdlma::GuardingAllocator').  Each size class has 'numSlotsPerSizeClass()'
+// slots, all reserved (but not committed) at construction; the memory pages
+// of a slot are committed the first time the slot is used.  A block is
+// guarded only if its size does not exceed 'maxGuardedBlockSize()', and if
+// a slot of its size class is free; otherwise, it is obtained from the
+// underlying allocator, unguarded.
+//
+// If the guard page follows the block, the block is placed at the end of the
+// memory pages of its slot (subject to maximal alignment), so that an access
+// beyond the end of the block faults; if the guard page precedes the block,
+// the block is placed at the start of its slot.
+//
+///Quarantine
+///----------
+// A deallocated slot is not reused right away: the slots of a size class that
+// have never been used are handed out first, and the deallocated slots are
+// then reused in the order in which they were deallocated (i.e., first-in,
+// first-out).  A deallocated block therefore remains protected for as long as
+// possible, so that a use of the block long after it is deallocated is still
+// detected.  A block deallocated a second time while its slot is not in use
+// is reported as a double free by a 'BSLS_ASSERT_OPT' failure.  Note that a
+// double free cannot be detected once the slot has been reused.
+//
+///Sampling
+///--------
+// Every 'samplingPeriod()'-th call to 'allocate' is guarded, so that a
+// sampling period of 1 guards every allocation (subject to the availability
+// of slots).  Guarding a small fraction of allocations is enough to detect,
+// over a fleet of hosts and a period of time, most of the overruns a program
+// performs, at a small fraction of the cost of guarding every allocation.
+//
+// Allocations are counted by a countdown kept in each of 'k_NUM_SHARDS'
+// shards, each on its own cache line, the shard being selected by
+// 'bdlma::ThreadShardUtil', so that the common (unguarded) path reads and
+// writes a counter used by the calling thread only, and does not perform an
+// atomic read-modify-write operation on memory shared by all threads.  The
+// allocations of each thread are therefore sampled independently, and, when
+// more threads than 'k_NUM_SHARDS' allocate concurrently, the threads
+// sharing a shard may occasionally sample one allocation more (or fewer)
+// than exactly one in every 'samplingPeriod()'.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::GuardingPoolAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary') provided that the underlying allocator (established at
+// construction) is fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Overruns on Canary Hosts
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service is occasionally observed to corrupt its heap, and
+// that we want to catch the culprit in the act on the hosts that first
+// receive new releases, without slowing the service down noticeably.
+//
+// First, we create a guarding pool allocator that guards one allocation in
+// every 100, and install it as the default allocator of the service:
+//..
+//  bdlma::GuardingPoolAllocator allocator(
+//                             100,
+//                             64,
+//                             bdlma::GuardingAllocator::e_AFTER_USER_BLOCK);
+//
+//  bslma::DefaultAllocatorGuard guard(&allocator);
+//..
+// Then, the service runs as usual:
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      bsl::string message("a message that does not fit in a short string");
+//  }
+//..
+// Any overrun of one of the (approximately) 10 messages that were guarded
+// would have raised a memory fault at the faulting instruction, for which a
+// core file can be analyzed.  Finally, we verify that the allocator has no
+// more guarded blocks in use:
+//..
+//  assert(0 == allocator.numGuardedBlocksInUse());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_GUARDINGALLOCATOR
+#include <bdlma_guardingallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ===========================
+                        // class GuardingPoolAllocator
+                        // ===========================
+
+class GuardingPoolAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete thread-safe "guarding" allocator mechanism
+    // that implements the 'bslma::Allocator' protocol, and adjoins a
+    // read/write protected guard page to one in every 'samplingPeriod()'
+    // blocks of memory returned by the 'allocate' method, serving those
+    // blocks from slots of a region of virtual memory reserved at
+    // construction, and the other blocks from an underlying allocator.
+
+  public:
+    // TYPES
+    typedef GuardingAllocator::GuardPageLocation GuardPageLocation;
+
+    // CONSTANTS
+    enum {
+        k_NUM_SIZE_CLASSES        = 8,   // number of size classes of slots
+
+        k_NUM_SHARDS              = 16,  // number of sampling countdowns
+
+        k_DEFAULT_SAMPLING_PERIOD = 1,   // default sampling period
+
+        k_DEFAULT_NUM_SLOTS       = 256  // default number of slots per size
+                                         // class
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_SIZE = 128  // size (in bytes) of each shard, large enough
+                            // that the countdowns of two shards never share
+                            // a cache line (or a pair of adjacent lines)
+    };
+
+    struct Shard {
+        // This 'struct' holds the sampling countdown of the threads assigned
+        // to one shard, padded to 'k_SHARD_SIZE' bytes.
+
+        bsls::AtomicInt d_countdown;  // allocations until the next guarded
+                                      // one
+
+        char            d_padding[k_SHARD_SIZE - sizeof(bsls::AtomicInt)];
+    };
+
+    struct SizeClass {
+        // This 'struct' describes the slots of one size class, and holds the
+        // quarantine of deallocated slots, a circular queue of capacity
+        // 'numSlotsPerSizeClass()'.
+
+        char *d_begin_p;     // first slot of this size class
+
+        int   d_numCarved;   // number of slots used at least once
+
+        int   d_numFree;     // number of slots in the quarantine
+
+        int   d_head;        // position, in 'd_freeSlots_p', of the slot
+                             // deallocated least recently
+
+        int  *d_freeSlots_p; // indices of the quarantined slots (held, not
+                             // owned)
+
+        bool *d_inUse_p;     // 'true' for each slot in use (held, not owned)
+    };
+
+    // DATA
+    Shard              d_shards[k_NUM_SHARDS];
+                                              // sampling countdowns, by shard
+
+    const int          d_samplingPeriod;      // one in this many allocations
+                                              // is guarded
+
+    const int          d_numSlots;            // number of slots per size
+                                              // class
+
+    const GuardPageLocation
+                       d_guardPageLocation;   // location of the guard page
+                                              // of each slot
+
+    int                d_pageSize;            // size of a memory page
+
+    char              *d_region_p;            // reserved region of slots
+
+    bsl::size_t        d_regionSize;          // size of 'd_region_p'
+
+    SizeClass          d_classes[k_NUM_SIZE_CLASSES];
+                                              // slots, by size class
+
+    int               *d_freeSlots_p;         // storage for the quarantines
+                                              // and slot states of all size
+                                              // classes (owned)
+
+    int                d_numGuardedInUse;     // guarded blocks in use
+
+    mutable bsls::BslLock
+                       d_lock;                // guards the size classes and
+                                              // 'd_numGuardedInUse'
+
+    bslma::Allocator  *d_allocator_p;         // underlying allocator (held,
+                                              // not owned)
+
+  private:
+    // PRIVATE MANIPULATORS
+    void *allocateGuarded(size_type size);
+        // Return a block of the specified 'size' (in bytes) carved from a slot
+        // of the smallest size class that fits 'size', or 0 if 'size' exceeds
+        // 'maxGuardedBlockSize()' or no slot of that class is free.
+
+    void initialize();
+        // Initialize the sampling countdowns, allocate the quarantines and
+        // slot states of the size classes, and reserve the region of slots.
+        // Throw 'bsl::bad_alloc' if the region cannot be reserved.
+
+    void quarantine(SizeClass *sizeClass, int slot);
+        // Append the specified 'slot' of the specified 'sizeClass' to the
+        // quarantine of 'sizeClass'.  The behavior is undefined unless
+        // 'd_lock' is held by the calling thread.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t slotSize(int sizeClass) const;
+        // Return the size (in bytes) of a slot of the specified 'sizeClass',
+        // including its guard page.
+
+  private:
+    // NOT IMPLEMENTED
+    GuardingPoolAllocator(const GuardingPoolAllocator&);
+    GuardingPoolAllocator& operator=(const GuardingPoolAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    GuardingPoolAllocator(bslma::Allocator *basicAllocator = 0);
+    GuardingPoolAllocator(int                samplingPeriod,
+                          int                numSlotsPerSizeClass,
+                          GuardPageLocation  guardLocation,
+                          bslma::Allocator  *basicAllocator = 0);
+        // Create a guarding pool allocator.  Optionally specify a
+        // 'samplingPeriod' indicating that one in every 'samplingPeriod'
+        // allocations is guarded, a 'numSlotsPerSizeClass' indicating the
+        // maximum number of guarded blocks of each size class that can be in
+        // use at the same time, and a 'guardLocation' indicating where guard
+        // pages are placed with respect to guarded blocks.  If these are not
+        // specified, 'k_DEFAULT_SAMPLING_PERIOD', 'k_DEFAULT_NUM_SLOTS', and
+        // 'GuardingAllocator::e_AFTER_USER_BLOCK' are used, respectively.
+        // Optionally specify a 'basicAllocator' used to supply unguarded
+        // blocks and the bookkeeping of slots.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  Throw
+        // 'bsl::bad_alloc' if the region of slots cannot be reserved (or, if
+        // exceptions are disabled, create an allocator that guards no
+        // block).  The behavior is undefined unless '1 <= samplingPeriod' and
+        // '1 <= numSlotsPerSizeClass'.
+
+    virtual ~GuardingPoolAllocator();
+        // Destroy this allocator object, and release the region of slots to
+        // the operating system.  The behavior is undefined unless no guarded
+        // block allocated from this object is in use.  Note that destroying
+        // this allocator has no effect on outstanding unguarded blocks.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes).  If this allocation is one of those
+        // sampled (see {Sampling}), 'size <= maxGuardedBlockSize()', and a
+        // slot of the size class of 'size' is free, the block is guarded by a
+        // read/write protected page located immediately before or after it
+        // according to the 'GuardPageLocation' indicated at construction;
+        // otherwise, the block is obtained from the underlying allocator.  If
+        // 'size' is 0, no memory is allocated and 0 is returned.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  If the
+        // block is guarded, the physical memory of its slot is returned to
+        // the operating system and the slot is quarantined (see
+        // {Quarantine}); otherwise, the block is returned to the underlying
+        // allocator.  Note that the memory pages of a deallocated guarded
+        // block are protected from read/write access until its slot is
+        // reused, so that an access to the block after it is deallocated
+        // also causes a memory fault.  The behavior is undefined unless
+        // 'address' was returned by 'allocate' and has not already been
+        // deallocated; a guarded block deallocated again before its slot is
+        // reused is detected, and reported by a 'BSLS_ASSERT_OPT' failure.
+
+    // ACCESSORS
+    bool isGuarded(const void *address) const;
+        // Return 'true' if the specified 'address' lies within the region of
+        // slots of this allocator (i.e., was returned by 'allocate' as a
+        // guarded block), and 'false' otherwise.
+
+    int maxGuardedBlockSize() const;
+        // Return the size (in bytes) of the largest block that can be
+        // guarded, i.e., the size of the memory pages of a slot of the
+        // largest size class.
+
+    int numGuardedBlocksInUse() const;
+        // Return the number of guarded blocks currently allocated from this
+        // object.
+
+    int numSlotsPerSizeClass() const;
+        // Return the number of slots of each size class.
+
+    int samplingPeriod() const;
+        // Return the number of allocations among which one is guarded.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class GuardingPoolAllocator
+                        // ---------------------------
+
+// ACCESSORS
+inline
+bool GuardingPoolAllocator::isGuarded(const void *address) const
+{
+    const char *p = static_cast<const char *>(address);
+
+    return d_region_p <= p && p < d_region_p + d_regionSize;
+}
+
+inline
+int GuardingPoolAllocator::maxGuardedBlockSize() const
+{
+    return d_pageSize << (k_NUM_SIZE_CLASSES - 1);
+}
+
+inline
+int GuardingPoolAllocator::numSlotsPerSizeClass() const
+{
+    return d_numSlots;
+}
+
+inline
+int GuardingPoolAllocator::samplingPeriod() const
+{
+    return d_samplingPeriod;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
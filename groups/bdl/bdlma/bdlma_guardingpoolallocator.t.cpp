@@ -0,0 +1,958 @@
+// bdlma_guardingpoolallocator.t.cpp                                  -*-C++-*-
+#include <bdlma_guardingpoolallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+#include <setjmp.h>
+#include <signal.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+  #include <windows.h>  // 'GetSystemInfo', 'CreateThread'
+#else
+  #include <pthread.h>
+  #include <unistd.h>   // 'sysconf'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::GuardingPoolAllocator' guards one in every 'samplingPeriod()'
+// allocations with a read/write protected page, serving guarded blocks from
+// size-class slots of a region reserved at construction and forwarding the
+// other allocations to an underlying allocator.  The primary concerns are that
+// guarded blocks are adjoined by a protected page on the side indicated at
+// construction, that the expected fraction of allocations is guarded, that
+// slots are recycled (and protected while not in use), and that allocations
+// that cannot be guarded fall back to the underlying allocator.  As in the
+// test driver of 'bdlma_guardingallocator', 'setjmp' and 'longjmp' are used in
+// conjunction with a signal handler to test that memory is protected.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit GuardingPoolAllocator(bslma::Allocator *ba = 0);
+// [ 2] GuardingPoolAllocator(int, int, GuardPageLocation, Allocator *ba = 0);
+// [ 2] ~GuardingPoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 3] bool isGuarded(const void *address) const;
+// [ 2] int maxGuardedBlockSize() const;
+// [ 3] int numGuardedBlocksInUse() const;
+// [ 2] int numSlotsPerSizeClass() const;
+// [ 2] int samplingPeriod() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: One in every 'samplingPeriod()' allocations is guarded.
+// [ 4] CONCERN: Slots are recycled, and exhausted classes fall back.
+// [ 4] CONCERN: Freed slots are quarantined; double frees are reported.
+// [ 5] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::GuardingPoolAllocator Obj;
+typedef bdlma::GuardingAllocator     GA;
+
+typedef bsls::Types::UintPtr UintPtr;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef jmp_buf    JumpBuffer;
+#else
+typedef sigjmp_buf JumpBuffer;
+#endif
+
+static JumpBuffer g_jumpBuffer;
+static bool       g_withinTestFlag = false;  // see 'signalHandler' (below)
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+extern "C" {
+
+void signalHandler(int signal)
+    // Handle the specified 'signal'.  Note that this signal handler is
+    // intended for 'SIGSEGV' and 'SIGBUS' only.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    ASSERT(SIGSEGV == signal);
+#else
+    ASSERT(SIGSEGV == signal || SIGBUS == signal);
+#endif
+
+    if (g_withinTestFlag) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        longjmp   (g_jumpBuffer, 1);
+#else
+        siglongjmp(g_jumpBuffer, 1);
+#endif
+    }
+    else {
+        ASSERT("Unexpected invocation of 'signalHandler'."  && 0);
+    }
+}
+
+}  // close extern "C"
+
+static
+bool causesMemoryFault(void *address, int offset, char value)
+    // Return 'true' if assigning the specified 'value' to the byte at the
+    // specified 'offset' from the specified 'address' causes a memory fault,
+    // and 'false' otherwise.
+{
+    volatile bool faultFlag = false;
+
+    signal(SIGSEGV, signalHandler);
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    signal(SIGBUS,  signalHandler);
+#endif
+
+    g_withinTestFlag = true;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const int rc = setjmp(g_jumpBuffer);
+#else
+    const int rc = sigsetjmp(g_jumpBuffer, 1);
+#endif
+
+    if (0 == rc) {
+        *(static_cast<char *>(address) + offset) = value;
+    }
+    else if (1 == rc) {
+        faultFlag = true;
+    }
+    else {
+        ASSERT("Unexpected return value from 'setjmp' or 'sigsetjmp'."  && 0);
+    }
+
+    signal(SIGSEGV, SIG_DFL);
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    signal(SIGBUS,  SIG_DFL);
+#endif
+
+    g_withinTestFlag = false;
+
+    return faultFlag;
+}
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase5 {
+
+enum { k_NUM_BLOCKS = 8 };
+
+struct ThreadInfo {
+    int  d_numIterations;
+    int  d_seed;
+    Obj *d_obj_p;
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_obj_p;
+
+    void *blocks[k_NUM_BLOCKS] = { 0 };
+    int   sizes[k_NUM_BLOCKS]  = { 0 };
+
+    unsigned int state = info->d_seed;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        state = state * 1103515245 + 12345;
+
+        const int j = static_cast<int>((state >> 16) % k_NUM_BLOCKS);
+
+        if (blocks[j]) {
+            // Verify that the block was not overwritten by another thread.
+
+            const char *p = static_cast<char *>(blocks[j]);
+            for (int k = 0; k < sizes[j]; ++k) {
+                ASSERTV(j, k, static_cast<char>(j) == p[k]);
+            }
+            mX.deallocate(blocks[j]);
+            blocks[j] = 0;
+        }
+        else {
+            sizes[j]  = 1 + static_cast<int>((state >> 8) % 10000);
+            blocks[j] = mX.allocate(sizes[j]);
+            bsl::memset(blocks[j], j, sizes[j]);
+        }
+    }
+
+    for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+        mX.deallocate(blocks[j]);
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const int pageSize = static_cast<int>(info.dwPageSize);
+#else
+    const int pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+#endif
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Overruns on Canary Hosts
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service is occasionally observed to corrupt its heap, and
+// that we want to catch the culprit in the act on the hosts that first
+// receive new releases, without slowing the service down noticeably.
+//
+// First, we create a guarding pool allocator that guards one allocation in
+// every 100, and install it as the default allocator of the service:
+//..
+    bdlma::GuardingPoolAllocator allocator(
+                               100,
+                               64,
+                               bdlma::GuardingAllocator::e_AFTER_USER_BLOCK);
+
+    bslma::DefaultAllocatorGuard guard(&allocator);
+//..
+// Then, the service runs as usual:
+//..
+    for (int i = 0; i < 1000; ++i) {
+        bsl::string message("a message that does not fit in a short string");
+    }
+//..
+// Any overrun of one of the (approximately) 10 messages that were guarded
+// would have raised a memory fault at the faulting instruction, for which a
+// core file can be analyzed.  Finally, we verify that the allocator has no
+// more guarded blocks in use:
+//..
+    ASSERT(0 == allocator.numGuardedBlocksInUse());
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 The 'allocate' and 'deallocate' methods are thread-safe.
+        //:
+        //: 2 Blocks allocated concurrently do not overlap.
+        //
+        // Plan:
+        //: 1 Create a guarding pool allocator with a short sampling period and
+        //:   few slots, so that allocations are guarded, recycled, and fall
+        //:   back to the underlying allocator.  Have several threads allocate
+        //:   and deallocate blocks of random sizes, filling each block with a
+        //:   per-block pattern and verifying that the pattern is intact before
+        //:   deallocating the block.  Verify that no guarded block is in use
+        //:   and no unguarded memory is outstanding after the threads are
+        //:   joined.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace TestCase5;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 10000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(3, 16, GA::e_AFTER_USER_BLOCK, &ta);
+
+            ThreadId   threads[k_NUM_THREADS];
+            ThreadInfo infos[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                infos[i].d_numIterations = k_NUM_ITERATIONS;
+                infos[i].d_seed          = i + 1;
+                infos[i].d_obj_p         = &mX;
+
+                threads[i] = createThread(&threadFunction, &infos[i]);
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+
+            ASSERTV(mX.numGuardedBlocksInUse(),
+                    0 == mX.numGuardedBlocksInUse());
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING, RECYCLING, AND FALLBACK
+        //
+        // Concerns:
+        //: 1 Exactly one in every 'samplingPeriod()' allocations is guarded
+        //:   (in the absence of concurrent allocations), starting with the
+        //:   'samplingPeriod()'-th one.
+        //:
+        //: 2 When all the slots of a size class are in use, a sampled
+        //:   allocation of that class is obtained from the underlying
+        //:   allocator, and other size classes are unaffected.
+        //:
+        //: 3 A deallocated slot is not reused while a slot of its size class
+        //:   has never been used, deallocated slots are then reused in the
+        //:   order in which they were deallocated, and (on platforms where
+        //:   returning memory to the system discards its contents) a reused
+        //:   block is zeroed.
+        //:
+        //: 4 A guarded block is protected from read/write access once it is
+        //:   deallocated.
+        //:
+        //: 5 Deallocating a guarded block whose slot is quarantined is
+        //:   reported.
+        //
+        // Plan:
+        //: 1 For a set of sampling periods, allocate a sequence of blocks and
+        //:   verify that exactly the blocks at the expected positions are
+        //:   guarded.  (C-1)
+        //:
+        //: 2 Using a sampling period of 1 and 4 slots per size class, allocate
+        //:   6 blocks of one size class, and verify that the last 2 are
+        //:   unguarded, and that a block of another size class is guarded.
+        //:   (C-2)
+        //:
+        //: 3 Using 4 slots per size class, deallocate a guarded block after
+        //:   writing to it, and verify that it can no longer be written to.
+        //:   Allocate and deallocate 3 more guarded blocks of its class, and
+        //:   verify that each has a distinct address.  Then, verify that the
+        //:   next 4 guarded blocks of the class reuse the 4 slots in the
+        //:   order in which they were deallocated, and that the first of them
+        //:   is zeroed.  (C-3..4)
+        //:
+        //: 4 Verify that, in appropriate build modes, deallocating a guarded
+        //:   block a second time is reported.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: One in every 'samplingPeriod()' allocations is guarded.
+        //   CONCERN: Slots are recycled, and exhausted classes fall back.
+        //   CONCERN: Freed slots are quarantined; double frees are reported.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING, RECYCLING, AND FALLBACK" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting sampling." << endl;
+        {
+            static const int PERIODS[] = { 1, 2, 3, 7, 10, 100 };
+            const int NUM_PERIODS = sizeof PERIODS / sizeof *PERIODS;
+
+            enum { k_NUM_BLOCKS = 300 };
+
+            for (int ti = 0; ti < NUM_PERIODS; ++ti) {
+                const int PERIOD = PERIODS[ti];
+
+                Obj mX(PERIOD, k_NUM_BLOCKS, GA::e_AFTER_USER_BLOCK, &ta);
+                const Obj& X = mX;
+
+                void *blocks[k_NUM_BLOCKS];
+                int   numGuarded = 0;
+
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    blocks[i] = mX.allocate(100);
+
+                    const bool EXP = 0 == (i + 1) % PERIOD;
+
+                    ASSERTV(PERIOD, i, EXP == X.isGuarded(blocks[i]));
+
+                    numGuarded += EXP;
+                }
+
+                ASSERTV(PERIOD, numGuarded == X.numGuardedBlocksInUse());
+                ASSERTV(PERIOD, k_NUM_BLOCKS / PERIOD == numGuarded);
+
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+
+                ASSERTV(PERIOD, 0 == X.numGuardedBlocksInUse());
+                ASSERTV(PERIOD, 1 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting fallback." << endl;
+        {
+            Obj mX(1, 4, GA::e_AFTER_USER_BLOCK, &ta);  const Obj& X = mX;
+
+            void *blocks[6];
+            for (int i = 0; i < 6; ++i) {
+                blocks[i] = mX.allocate(pageSize);
+
+                ASSERTV(i, (i < 4) == X.isGuarded(blocks[i]));
+            }
+            ASSERT(4 == X.numGuardedBlocksInUse());
+            ASSERT(3 == ta.numBlocksInUse());
+
+            void *other = mX.allocate(pageSize + 1);
+
+            ASSERT(X.isGuarded(other));
+            ASSERT(5 == X.numGuardedBlocksInUse());
+
+            mX.deallocate(other);
+            for (int i = 0; i < 6; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numGuardedBlocksInUse());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting recycling." << endl;
+        {
+            Obj mX(1, 4, GA::e_BEFORE_USER_BLOCK, &ta);  const Obj& X = mX;
+
+            char *p = static_cast<char *>(mX.allocate(100));
+
+            ASSERT(X.isGuarded(p));
+
+            bsl::memset(p, 'a', 100);
+
+            ASSERT(!causesMemoryFault(p, 0, 'b'));
+
+            mX.deallocate(p);
+
+            ASSERT(0 == X.numGuardedBlocksInUse());
+
+            ASSERT(causesMemoryFault(p,  0, 'c'));
+            ASSERT(causesMemoryFault(p, 99, 'c'));
+
+            // The slots never used are handed out before 'p' is reused.
+
+            char *blocks[4] = { p, 0, 0, 0 };
+            for (int i = 1; i < 4; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(100));
+
+                ASSERTV(i, X.isGuarded(blocks[i]));
+                for (int j = 0; j < i; ++j) {
+                    ASSERTV(i, j, blocks[j] != blocks[i]);
+                }
+
+                mX.deallocate(blocks[i]);
+            }
+
+            ASSERT(0 == X.numGuardedBlocksInUse());
+
+            // The quarantined slots are reused first-in, first-out.
+
+            char *q = static_cast<char *>(mX.allocate(50));
+
+            ASSERT(p == q);
+            ASSERT(1 == X.numGuardedBlocksInUse());
+
+            for (int i = 1; i < 4; ++i) {
+                void *r = mX.allocate(100);
+
+                ASSERTV(i, blocks[i] == r);
+
+                mX.deallocate(r);
+            }
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_WINDOWS)
+            // The physical memory of the slot was returned to the system, so
+            // the reused block is backed by fresh, zero-filled pages.
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, 0 == q[i]);
+            }
+#endif
+
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(1, 4, GA::e_AFTER_USER_BLOCK, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(100);
+
+            ASSERT(X.isGuarded(p));
+
+            ASSERT_OPT_PASS(mX.deallocate(p));
+            ASSERT_OPT_FAIL(mX.deallocate(p));
+
+            ASSERT(0 == X.numGuardedBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 A guarded block is maximally aligned, and can be written to in
+        //:   its entirety.
+        //:
+        //: 2 The byte just past the end of a guarded block (for
+        //:   'e_AFTER_USER_BLOCK'), and the byte just before it (for
+        //:   'e_BEFORE_USER_BLOCK'), is protected, as is the rest of the guard
+        //:   page.
+        //:
+        //: 3 'isGuarded' returns 'true' for guarded blocks only.
+        //:
+        //: 4 Blocks larger than 'maxGuardedBlockSize()' are obtained from the
+        //:   underlying allocator.
+        //:
+        //: 5 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //
+        // Plan:
+        //: 1 For both guard page locations, and a set of sizes spanning every
+        //:   size class, allocate a block using a sampling period of 1, verify
+        //:   its alignment, write to every byte of it, verify that the
+        //:   adjacent guard page is protected, and deallocate it.  (C-1..3)
+        //:
+        //: 2 Allocate a block of 'maxGuardedBlockSize() + 1' bytes, and verify
+        //:   that it is obtained from the underlying allocator.  (C-3..4)
+        //:
+        //: 3 Call 'allocate(0)' and 'deallocate(0)', and verify that they have
+        //:   no effect.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bool isGuarded(const void *address) const;
+        //   int numGuardedBlocksInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        const int MAX = pageSize << (Obj::k_NUM_SIZE_CLASSES - 1);
+
+        const int SIZES[] = {
+            1, 2, 7, 8, 15, 16, 17, 100,
+            pageSize - 1, pageSize, pageSize + 1,
+            2 * pageSize, 3 * pageSize, 5 * pageSize + 3,
+            MAX / 2 + 1, MAX - 1, MAX
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const GA::GuardPageLocation LOCATIONS[] = {
+            GA::e_AFTER_USER_BLOCK,
+            GA::e_BEFORE_USER_BLOCK
+        };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int li = 0; li < 2; ++li) {
+            const GA::GuardPageLocation LOC = LOCATIONS[li];
+
+            Obj mX(1, 2, LOC, &ta);  const Obj& X = mX;
+
+            ASSERT(MAX == X.maxGuardedBlockSize());
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE   = SIZES[ti];
+                const int PADDED = static_cast<int>(
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(SIZE));
+
+                if (veryVerbose) { T_ P_(LOC) P(SIZE) }
+
+                char *p = static_cast<char *>(mX.allocate(SIZE));
+
+                ASSERTV(LOC, SIZE, X.isGuarded(p));
+                ASSERTV(LOC, SIZE, 1 == X.numGuardedBlocksInUse());
+                ASSERTV(LOC, SIZE,
+                        0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGN);
+
+                bsl::memset(p, 0xff, SIZE);
+
+                if (GA::e_AFTER_USER_BLOCK == LOC) {
+                    ASSERTV(SIZE, causesMemoryFault(p, PADDED,     'x'));
+                    ASSERTV(SIZE, causesMemoryFault(p, PADDED + pageSize - 1,
+                                                    'x'));
+                }
+                else {
+                    ASSERTV(SIZE, 0 == reinterpret_cast<UintPtr>(p)
+                                                                  % pageSize);
+                    ASSERTV(SIZE, causesMemoryFault(p, -1,        'x'));
+                    ASSERTV(SIZE, causesMemoryFault(p, -pageSize, 'x'));
+                }
+
+                mX.deallocate(p);
+
+                ASSERTV(LOC, SIZE, 0 == X.numGuardedBlocksInUse());
+            }
+
+            if (verbose) cout << "\nTesting oversized blocks." << endl;
+            {
+                const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+                void *p = mX.allocate(MAX + 1);
+
+                ASSERTV(LOC, !X.isGuarded(p));
+                ASSERTV(LOC, 0 == X.numGuardedBlocksInUse());
+                ASSERTV(LOC, NUM_BYTES + MAX + 1 == ta.numBytesInUse());
+
+                mX.deallocate(p);
+
+                ASSERTV(LOC, NUM_BYTES == ta.numBytesInUse());
+            }
+
+            if (verbose) cout << "\nTesting null requests." << endl;
+            {
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+                ASSERTV(LOC, 0 == mX.allocate(0));
+
+                mX.deallocate(0);
+
+                ASSERTV(LOC, NUM_BLOCKS == ta.numBlocksTotal());
+                ASSERTV(LOC, 0          == X.numGuardedBlocksInUse());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, DTOR, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor uses the documented defaults.
+        //:
+        //: 2 The value constructor retains the specified sampling period and
+        //:   number of slots.
+        //:
+        //: 3 The free lists of the slots are obtained from the allocator
+        //:   supplied at construction (or the default allocator), and are
+        //:   released on destruction.
+        //:
+        //: 4 'maxGuardedBlockSize' returns the size of the memory pages of a
+        //:   slot of the largest size class.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, and verify the accessors and the memory in use from
+        //:   the default and supplied allocators.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   explicit GuardingPoolAllocator(bslma::Allocator *ba = 0);
+        //   GuardingPoolAllocator(int, int, GuardPageLocation, Allocator *ba);
+        //   ~GuardingPoolAllocator();
+        //   int maxGuardedBlockSize() const;
+        //   int numSlotsPerSizeClass() const;
+        //   int samplingPeriod() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, DTOR, AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("test",    veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int MAX = pageSize << (Obj::k_NUM_SIZE_CLASSES - 1);
+
+        {
+            const Obj X;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_PERIOD == X.samplingPeriod());
+            ASSERT(Obj::k_DEFAULT_NUM_SLOTS == X.numSlotsPerSizeClass());
+            ASSERT(MAX == X.maxGuardedBlockSize());
+            ASSERT(0   == X.numGuardedBlocksInUse());
+
+            ASSERT(1   == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        {
+            const Obj X(&ta);
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_PERIOD == X.samplingPeriod());
+            ASSERT(Obj::k_DEFAULT_NUM_SLOTS == X.numSlotsPerSizeClass());
+
+            ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+            ASSERT(1                  == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            const Obj X(17, 3, GA::e_BEFORE_USER_BLOCK, &ta);
+
+            ASSERT(17  == X.samplingPeriod());
+            ASSERT(3   == X.numSlotsPerSizeClass());
+            ASSERT(MAX == X.maxGuardedBlockSize());
+            ASSERT(0   == X.numGuardedBlocksInUse());
+
+            ASSERT(1   == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS_RAW(Obj( 1,  1, GA::e_AFTER_USER_BLOCK, &ta));
+            ASSERT_FAIL_RAW(Obj( 0,  1, GA::e_AFTER_USER_BLOCK, &ta));
+            ASSERT_FAIL_RAW(Obj(-1,  1, GA::e_AFTER_USER_BLOCK, &ta));
+            ASSERT_FAIL_RAW(Obj( 1,  0, GA::e_AFTER_USER_BLOCK, &ta));
+            ASSERT_FAIL_RAW(Obj( 1, -1, GA::e_AFTER_USER_BLOCK, &ta));
+        }
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object guarding every other allocation, allocate and
+        //:   deallocate a few blocks, and verify which are guarded, that the
+        //:   guard page of a guarded block is protected, and the memory in use
+        //:   from the underlying allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(2, 8, GA::e_AFTER_USER_BLOCK, &ta);  const Obj& X = mX;
+
+            ASSERT(1 == ta.numBlocksInUse());
+
+            char *p1 = static_cast<char *>(mX.allocate(10));
+            char *p2 = static_cast<char *>(mX.allocate(16));
+            char *p3 = static_cast<char *>(mX.allocate(5000));
+            char *p4 = static_cast<char *>(mX.allocate(5000));
+
+            ASSERT(!X.isGuarded(p1));
+            ASSERT( X.isGuarded(p2));
+            ASSERT(!X.isGuarded(p3));
+            ASSERT( X.isGuarded(p4));
+
+            ASSERT(2 == X.numGuardedBlocksInUse());
+            ASSERT(3 == ta.numBlocksInUse());
+
+            bsl::memset(p2, 'x', 16);
+            bsl::memset(p4, 'x', 5000);
+
+            ASSERT(causesMemoryFault(p2, 16, 'y'));
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+            mX.deallocate(p4);
+
+            ASSERT(0 == X.numGuardedBlocksInUse());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
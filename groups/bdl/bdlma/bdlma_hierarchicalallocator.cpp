@@ -0,0 +1,364 @@
+// bdlma_hierarchicalallocator.cpp                                    -*-C++-*-
+#include <bdlma_hierarchicalallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hierarchicalallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_limits.h>
+#include <bsl_new.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bslma::Allocator::size_type OFFSET =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// HELPER FUNCTIONS
+
+inline
+void updateMax(bsls::AtomicInt64 *maximum, bsls::Types::Int64 value)
+    // Set the specified 'maximum' to the specified 'value' if 'value' is
+    // greater.
+{
+    bsls::Types::Int64 current = maximum->loadRelaxed();
+    while (value > current) {
+        const bsls::Types::Int64 previous =
+                                      maximum->testAndSwap(current, value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+void printLimit(bsl::ostream& stream, bsls::Types::Int64 limit)
+    // Write the specified 'limit' to the specified 'stream', or "none" if
+    // 'limit' is 'HierarchicalAllocator::k_UNLIMITED'.
+{
+    if (HierarchicalAllocator::k_UNLIMITED == limit) {
+        stream << "none";
+    }
+    else {
+        stream << limit;
+    }
+}
+
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // class HierarchicalAllocator
+                        // ---------------------------
+
+// CONSTANTS
+const bsls::Types::Int64 HierarchicalAllocator::k_UNLIMITED =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+
+// PRIVATE MANIPULATORS
+HierarchicalAllocator *HierarchicalAllocator::charge(
+                                                   bsls::Types::Int64 numBytes)
+{
+    // The count of this node is incremented, and its hard limit checked,
+    // before those of its ancestors (by the recursive call), but its maximum
+    // count is updated, and its soft limit checked, only after the hard
+    // limits of all of its ancestors are found to be respected, so that a
+    // rejected allocation updates no maximum and invokes no soft-limit
+    // callback.
+
+    const bsls::Types::Int64 numBytesInUse =
+                                          d_numBytesInUse.addRelaxed(numBytes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                  numBytesInUse > d_hardLimit.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_numBytesInUse.addRelaxed(-numBytes);
+        return this;                                                  // RETURN
+    }
+
+    if (d_parent_p) {
+        HierarchicalAllocator *limited = d_parent_p->charge(numBytes);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != limited)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            d_numBytesInUse.addRelaxed(-numBytes);
+            return limited;                                           // RETURN
+        }
+    }
+
+    updateMax(&d_numBytesMax, numBytesInUse);
+
+    // Invoke the callback only for the allocation that crosses the soft
+    // limit, so that it is not invoked again until usage has dropped below
+    // the limit.
+
+    const bsls::Types::Int64 softLimit = d_softLimit.loadRelaxed();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                      numBytesInUse > softLimit
+                                   && numBytesInUse - numBytes <= softLimit)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (d_callback) {
+            d_callback(d_context_p, this, e_SOFT_LIMIT);
+        }
+    }
+
+    return 0;
+}
+
+void HierarchicalAllocator::uncharge(bsls::Types::Int64     numBytes,
+                                     HierarchicalAllocator *end)
+{
+    for (HierarchicalAllocator *node = this;
+         node != end;
+         node = node->d_parent_p) {
+        node->d_numBytesInUse.addRelaxed(-numBytes);
+    }
+}
+
+void HierarchicalAllocator::linkChild(HierarchicalAllocator *child)
+{
+    BSLS_ASSERT(child);
+
+    bsls::BslLockGuard guard(&d_childrenLock);
+
+    child->d_nextSibling_p = d_firstChild_p;
+    d_firstChild_p         = child;
+}
+
+void HierarchicalAllocator::unlinkChild(HierarchicalAllocator *child)
+{
+    BSLS_ASSERT(child);
+
+    bsls::BslLockGuard guard(&d_childrenLock);
+
+    HierarchicalAllocator **link = &d_firstChild_p;
+    while (*link != child) {
+        BSLS_ASSERT(*link);
+
+        link = &(*link)->d_nextSibling_p;
+    }
+    *link = child->d_nextSibling_p;
+}
+
+// PRIVATE ACCESSORS
+void HierarchicalAllocator::printTree(bsl::ostream& stream, int level) const
+{
+    for (int i = 0; i < level; ++i) {
+        stream << "  ";
+    }
+
+    stream << (d_name_p ? d_name_p : "(unnamed)")
+           << ": inUse="    << numBytesInUse()
+           << " max="       << numBytesMax()
+           << " soft=";
+    printLimit(stream, softLimit());
+    stream << " hard=";
+    printLimit(stream, hardLimit());
+    stream << " failures="  << numLimitFailures() << "\n";
+
+    bsls::BslLockGuard guard(&d_childrenLock);
+
+    for (const HierarchicalAllocator *child = d_firstChild_p;
+         child;
+         child = child->d_nextSibling_p) {
+        child->printTree(stream, level + 1);
+    }
+}
+
+// CREATORS
+HierarchicalAllocator::HierarchicalAllocator(bslma::Allocator *basicAllocator)
+: d_numBytesInUse(0)
+, d_numBytesMax(0)
+, d_softLimit(k_UNLIMITED)
+, d_hardLimit(k_UNLIMITED)
+, d_numLimitFailures(0)
+, d_callback(0)
+, d_context_p(0)
+, d_name_p(0)
+, d_parent_p(0)
+, d_firstChild_p(0)
+, d_nextSibling_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_allocator_p);
+}
+
+HierarchicalAllocator::HierarchicalAllocator(const char       *name,
+                                             bslma::Allocator *basicAllocator)
+: d_numBytesInUse(0)
+, d_numBytesMax(0)
+, d_softLimit(k_UNLIMITED)
+, d_hardLimit(k_UNLIMITED)
+, d_numLimitFailures(0)
+, d_callback(0)
+, d_context_p(0)
+, d_name_p(name)
+, d_parent_p(0)
+, d_firstChild_p(0)
+, d_nextSibling_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_allocator_p);
+}
+
+HierarchicalAllocator::HierarchicalAllocator(const char            *name,
+                                             HierarchicalAllocator *parent)
+: d_numBytesInUse(0)
+, d_numBytesMax(0)
+, d_softLimit(k_UNLIMITED)
+, d_hardLimit(k_UNLIMITED)
+, d_numLimitFailures(0)
+, d_callback(0)
+, d_context_p(0)
+, d_name_p(name)
+, d_parent_p(parent)
+, d_firstChild_p(0)
+, d_nextSibling_p(0)
+, d_allocator_p(0)
+{
+    BSLS_ASSERT(parent);
+
+    d_allocator_p = parent->d_allocator_p;
+    parent->linkChild(this);
+}
+
+HierarchicalAllocator::~HierarchicalAllocator()
+{
+    BSLS_ASSERT(0 == d_firstChild_p);
+    BSLS_ASSERT(0 <= numBytesInUse());
+    BSLS_ASSERT(numBytesInUse() <= numBytesMax());
+
+    if (d_parent_p) {
+        d_parent_p->unlinkChild(this);
+    }
+}
+
+// MANIPULATORS
+void *HierarchicalAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    HierarchicalAllocator *limited = charge(numBytes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != limited)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Give the node whose hard limit would be exceeded a chance to free
+        // memory, and retry once.
+
+        if (limited->d_callback) {
+            limited->d_callback(limited->d_context_p, limited, e_HARD_LIMIT);
+        }
+
+        limited = charge(numBytes);
+        if (0 != limited) {
+            limited->d_numLimitFailures.addRelaxed(1);
+
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+    }
+
+    // Round up 'size' for maximal alignment and add sufficient space to record
+    // 'size' in the allocated block.
+
+    const size_type totalSize =
+                 bsls::AlignmentUtil::roundUpToMaximalAlignment(size) + OFFSET;
+
+    void *address;
+
+    BSLS_TRY {
+        address = d_allocator_p->allocate(totalSize);
+    }
+    BSLS_CATCH(...) {
+        uncharge(numBytes, 0);
+        BSLS_RETHROW;
+    }
+
+    *static_cast<size_type *>(address) = size;
+
+    return static_cast<char *>(address) + OFFSET;
+}
+
+void HierarchicalAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    address = static_cast<char *>(address) - OFFSET;
+
+    const size_type recordedSize = *static_cast<size_type *>(address);
+
+    uncharge(static_cast<bsls::Types::Int64>(recordedSize), 0);
+
+    d_allocator_p->deallocate(address);
+}
+
+void HierarchicalAllocator::setHardLimit(bsls::Types::Int64 limit)
+{
+    BSLS_ASSERT(0 <= limit);
+
+    d_hardLimit.storeRelaxed(limit);
+}
+
+void HierarchicalAllocator::setPressureCallback(PressureCallback  callback,
+                                                void             *context)
+{
+    d_callback  = callback;
+    d_context_p = context;
+}
+
+void HierarchicalAllocator::setSoftLimit(bsls::Types::Int64 limit)
+{
+    BSLS_ASSERT(0 <= limit);
+
+    d_softLimit.storeRelaxed(limit);
+}
+
+// ACCESSORS
+bsl::ostream& HierarchicalAllocator::print(bsl::ostream& stream) const
+{
+    printTree(stream, 0);
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
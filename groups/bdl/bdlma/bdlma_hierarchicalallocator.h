@@ -0,0 +1,512 @@
+// bdlma_hierarchicalallocator.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMA_HIERARCHICALALLOCATOR
+#define INCLUDED_BDLMA_HIERARCHICALALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a tree of allocators enforcing per-subsystem memory quotas.
+//
+//@CLASSES:
+//  bdlma::HierarchicalAllocator: counting allocator node with soft/hard limits
+//
+//@SEE_ALSO: bdlma_countingallocator, bdlma_shardedcountingallocator
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'bdlma::HierarchicalAllocator', that implements the 'bslma::Allocator'
+// protocol and that can be nested: each hierarchical allocator is either a
+// *root*, which obtains memory from an underlying allocator supplied at
+// construction, or the *child* of another hierarchical allocator (its
+// *parent*), forming a tree that typically mirrors the subsystems of a
+// process.  Each node of the tree tracks the number of bytes currently
+// allocated from it *or from any of its descendants*, as well as the maximum
+// of that number, and enforces an optional *soft* and *hard* limit on it:
+//..
+//   ,----------------------------.
+//  ( bdlma::HierarchicalAllocator )
+//   `----------------------------'
+//                |           ctor/dtor
+//                |           setSoftLimit
+//                |           setHardLimit
+//                |           setPressureCallback
+//                |           numBytesInUse
+//                |           numBytesMax
+//                |           numLimitFailures
+//                |           name
+//                |           parent
+//                |           print
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                            allocate
+//                            deallocate
+//..
+// Memory allocated from a child is obtained directly from the underlying
+// allocator of the root of its tree (i.e., *not* through the 'allocate'
+// method of its parent), and is accounted, using a single relaxed atomic
+// addition per node, to the child and to each of its ancestors.  The cost of
+// an allocation is thus proportional to the depth of the node in the tree,
+// and no lock is acquired on the allocation path.
+//
+///Limits and Pressure Callbacks
+///-----------------------------
+// The *soft limit* of a node is an advisory threshold: an allocation that
+// takes the number of bytes in use by the node above its soft limit succeeds,
+// but invokes the *pressure callback* of the node (if any), with the
+// 'e_SOFT_LIMIT' level, so that the subsystem may shed load (e.g., by
+// evicting entries from a cache) before its quota is exhausted.  The
+// callback is invoked once each time the soft limit is crossed (upwards),
+// rather than on every allocation above the limit.
+//
+// The *hard limit* of a node is enforced: an allocation that would take the
+// number of bytes in use by the node (or by any of its ancestors) above its
+// hard limit first invokes the pressure callback of the node whose limit
+// would be exceeded with the 'e_HARD_LIMIT' level, which may free memory to
+// make room, and is then retried once.  If the retry also exceeds the limit,
+// the allocation fails: 'bsl::bad_alloc' is thrown (or, if exceptions are
+// disabled, a null pointer is returned), the number of limit failures of
+// that node is incremented, and the byte counts of the tree are unaffected.
+// One misbehaving subsystem thereby fails its own allocations, rather than
+// consuming the memory of the whole host.
+//
+// Both limits default to 'k_UNLIMITED'.  Pressure callbacks are invoked by
+// the thread that allocates, without holding any lock, and may deallocate
+// memory from any node of the tree; a callback that allocates from the node
+// whose limit triggered it is likely to trigger it again, and should not.
+//
+///Byte Counts
+///-----------
+// Like 'bdlma::CountingAllocator', a hierarchical allocator counts the
+// number of bytes *requested* in calls to 'allocate' (not the number of bytes
+// actually obtained from the underlying allocator, which includes a header
+// for each block).  The counts of a node include those of its descendants,
+// so that the counts of the root describe the whole tree.  Blocks must be
+// deallocated through the node from which they were allocated.
+//
+// The counts are not taken atomically with respect to concurrent allocations
+// from the tree, and a node may momentarily observe a count that includes a
+// pending allocation that is subsequently rejected by the hard limit of one
+// of its ancestors.  The maximum count of a node ('numBytesMax') is updated,
+// and its soft limit checked, only once the hard limits of all of its
+// ancestors are known to be respected, so that a rejected allocation raises
+// no maximum and invokes no soft-limit callback.
+//
+///Usage Tree Snapshot
+///-------------------
+// The 'print' method writes a snapshot of the usage of a node and of all of
+// its descendants, one node per line, indented by depth:
+//..
+//  <name>: inUse=<numBytesInUse> max=<numBytesMax> soft=<softLimit>
+//          hard=<hardLimit> failures=<numLimitFailures>
+//..
+// (the two lines above form a single line), where each limit is shown as
+// 'none' if it is 'k_UNLIMITED', and the name of an unnamed node is shown as
+// '(unnamed)'.  The children of a node are listed in the reverse order of
+// their construction.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HierarchicalAllocator' is fully thread-safe, provided that the
+// underlying allocator of the root is.  The limits may be changed while the
+// tree is in use; 'setPressureCallback' must not be called concurrently with
+// allocations from the node or from its descendants.  Constructing and
+// destroying children may proceed concurrently with allocations and with
+// 'print'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Giving Subsystems a Memory Budget
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a process hosts a cache and a request handler, and that the
+// cache must shed entries before the process as a whole runs out of its
+// memory budget.  First, we define the pressure callback of the cache, which
+// here merely records that it was invoked:
+//..
+//  static int s_numPressureEvents = 0;
+//
+//  void onCachePressure(
+//                      void                                        *context,
+//                      bdlma::HierarchicalAllocator                *allocator,
+//                      bdlma::HierarchicalAllocator::PressureLevel  level)
+//  {
+//      (void)context;
+//      (void)allocator;
+//      (void)level;
+//
+//      ++s_numPressureEvents;
+//  }
+//..
+// Then, we create the root of the tree, with a hard limit of 1 megabyte for
+// the whole process, and a child for each subsystem:
+//..
+//  bdlma::HierarchicalAllocator process("process");
+//  process.setHardLimit(1024 * 1024);
+//
+//  bdlma::HierarchicalAllocator cache("cache", &process);
+//  cache.setSoftLimit(64 * 1024);
+//  cache.setHardLimit(128 * 1024);
+//  cache.setPressureCallback(&onCachePressure, 0);
+//
+//  bdlma::HierarchicalAllocator handler("handler", &process);
+//..
+// Next, each subsystem allocates from its own node, and the allocations are
+// accounted to the process as well:
+//..
+//  void *entry   = cache.allocate(100 * 1024);
+//  void *request = handler.allocate(1000);
+//
+//  assert(1 == s_numPressureEvents);
+//
+//  assert(100 * 1024        == cache.numBytesInUse());
+//  assert(100 * 1024 + 1000 == process.numBytesInUse());
+//..
+// Then, we observe that the cache cannot exceed its quota, and that the
+// failed allocation affects neither the cache nor the process:
+//..
+//  #ifdef BDE_BUILD_TARGET_EXC
+//  try {
+//      cache.allocate(100 * 1024);
+//      assert(false);
+//  }
+//  catch (const bsl::bad_alloc&) {
+//  }
+//
+//  assert(1                 == cache.numLimitFailures());
+//  assert(100 * 1024        == cache.numBytesInUse());
+//  assert(100 * 1024 + 1000 == process.numBytesInUse());
+//  #endif
+//..
+// Next, we take a snapshot of the usage of the process:
+//..
+//  bsl::ostringstream snapshot;
+//  process.print(snapshot);
+//
+//  assert(bsl::string::npos != snapshot.str().find("  cache: inUse=102400"));
+//..
+// Finally, the subsystems return their memory:
+//..
+//  cache.deallocate(entry);
+//  handler.deallocate(request);
+//
+//  assert(                0 == process.numBytesInUse());
+//  assert(100 * 1024 + 1000 == process.numBytesMax());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ===========================
+                        // class HierarchicalAllocator
+                        // ===========================
+
+class HierarchicalAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete allocator mechanism that implements the
+    // 'bslma::Allocator' protocol, forms a node of a tree of such allocators,
+    // and tracks the number of bytes in use by the node and its descendants,
+    // enforcing the soft and hard limits described in the component-level
+    // documentation.
+
+  public:
+    // TYPES
+    enum PressureLevel {
+        // Enumerate the conditions under which a pressure callback is
+        // invoked.
+
+        e_SOFT_LIMIT,  // the soft limit of the node has been exceeded
+        e_HARD_LIMIT   // an allocation would exceed the hard limit of the
+                       // node
+    };
+
+    typedef void (*PressureCallback)(void                  *context,
+                                     HierarchicalAllocator *allocator,
+                                     PressureLevel          level);
+        // 'PressureCallback' is an alias for a pointer to a function invoked
+        // with the context supplied to 'setPressureCallback', the node whose
+        // limit was reached, and the limit reached.
+
+    // CONSTANTS
+    static const bsls::Types::Int64 k_UNLIMITED;
+        // the value of a limit that is not enforced
+
+  private:
+    // DATA
+    bsls::AtomicInt64      d_numBytesInUse;     // bytes in use by this node
+                                                // and its descendants
+
+    bsls::AtomicInt64      d_numBytesMax;       // maximum of
+                                                // 'd_numBytesInUse'
+
+    bsls::AtomicInt64      d_softLimit;         // soft limit, or
+                                                // 'k_UNLIMITED'
+
+    bsls::AtomicInt64      d_hardLimit;         // hard limit, or
+                                                // 'k_UNLIMITED'
+
+    bsls::AtomicInt64      d_numLimitFailures;  // allocations failed due to
+                                                // the hard limit
+
+    PressureCallback       d_callback;          // pressure callback, or 0
+
+    void                  *d_context_p;         // context of 'd_callback'
+
+    const char            *d_name_p;            // optionally specified name
+                                                // of this node (or 0)
+
+    HierarchicalAllocator *d_parent_p;          // parent (held, not owned),
+                                                // or 0 for a root
+
+    HierarchicalAllocator *d_firstChild_p;      // most recently constructed
+                                                // child, or 0
+
+    HierarchicalAllocator *d_nextSibling_p;     // next (older) child of
+                                                // 'd_parent_p', or 0
+
+    mutable bsls::BslLock  d_childrenLock;      // guards the list of children
+
+    bslma::Allocator      *d_allocator_p;       // underlying allocator of the
+                                                // root (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    HierarchicalAllocator(const HierarchicalAllocator&);
+    HierarchicalAllocator& operator=(const HierarchicalAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    HierarchicalAllocator *charge(bsls::Types::Int64 numBytes);
+        // Add the specified 'numBytes' to the byte counts of this node and of
+        // each of its ancestors, checking the hard limit of every node before
+        // updating the maximum count of any node, and then invoking the
+        // pressure callback of each node whose soft limit is thereby crossed.
+        // Return 0 on success, and the node (closest to this node) whose hard
+        // limit would be exceeded otherwise, in which case the byte counts
+        // are unaffected and no callback is invoked.
+
+    void uncharge(bsls::Types::Int64     numBytes,
+                  HierarchicalAllocator *end);
+        // Subtract the specified 'numBytes' from the byte counts of this
+        // node and of each of its ancestors, up to but excluding the
+        // specified 'end' node (or up to the root if 'end' is 0).
+
+    void linkChild(HierarchicalAllocator *child);
+        // Add the specified 'child' to the list of children of this node.
+
+    void unlinkChild(HierarchicalAllocator *child);
+        // Remove the specified 'child' from the list of children of this
+        // node.  The behavior is undefined unless 'child' is a child of this
+        // node.
+
+    // PRIVATE ACCESSORS
+    void printTree(bsl::ostream& stream, int level) const;
+        // Write the usage of this node, indented by the specified 'level',
+        // and then that of each of its descendants, to the specified
+        // 'stream'.
+
+  public:
+    // CREATORS
+    explicit
+    HierarchicalAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    HierarchicalAllocator(const char       *name,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a hierarchical allocator that is the root of a tree, having
+        // no limits and no pressure callback.  Optionally specify a 'name'
+        // (associated with this object) to be included in the output of the
+        // 'print' method.  If 'name' is 0 (or not specified), the node is
+        // unnamed.  Optionally specify a 'basicAllocator' used to supply the
+        // memory of the tree.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'name', if specified, remains valid for the lifetime of this
+        // object.
+
+    HierarchicalAllocator(const char *name, HierarchicalAllocator *parent);
+        // Create a hierarchical allocator having the specified 'name' that is
+        // a child of the specified 'parent', having no limits and no pressure
+        // callback.  If 'name' is 0, the node is unnamed.  Memory allocated
+        // from this object is obtained from the underlying allocator of the
+        // root of the tree of 'parent', and is accounted to this object and
+        // to each of its ancestors.  The behavior is undefined unless
+        // 'parent' outlives this object and 'name', if not 0, remains valid
+        // for the lifetime of this object.
+
+    virtual ~HierarchicalAllocator();
+        // Destroy this allocator object, removing it from the children of its
+        // parent (if any).  The behavior is undefined unless this object has
+        // no children.  Note that destroying this allocator has no effect on
+        // any outstanding allocated memory, which remains accounted to the
+        // ancestors of this object.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated block of memory of the specified 'size' (in
+        // bytes).  If 'size' is 0, a null pointer is returned with no other
+        // effect.  Otherwise, account 'size' bytes to this node and to each
+        // of its ancestors, invoking pressure callbacks as described in
+        // {Limits and Pressure Callbacks}, and obtain the block from the
+        // underlying allocator of the root.  If the allocation would exceed
+        // the hard limit of this node or of one of its ancestors, throw
+        // 'bsl::bad_alloc' if exceptions are enabled, and return 0 otherwise.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator, and subtract its size from the byte counts of this node
+        // and of each of its ancestors.  If 'address' is 0, this function has
+        // no effect.  The behavior is undefined unless 'address' was
+        // allocated using this allocator object and has not already been
+        // deallocated.
+
+    void setHardLimit(bsls::Types::Int64 limit);
+        // Set the hard limit of this node to the specified 'limit' (in
+        // bytes), or to no limit if 'limit' is 'k_UNLIMITED'.  Allocations
+        // already made are unaffected.  The behavior is undefined unless
+        // '0 <= limit' or 'k_UNLIMITED == limit'.
+
+    void setPressureCallback(PressureCallback  callback,
+                             void             *context);
+        // Set the pressure callback of this node to the specified 'callback',
+        // to be invoked with the specified 'context', or remove the callback
+        // if 'callback' is 0.
+
+    void setSoftLimit(bsls::Types::Int64 limit);
+        // Set the soft limit of this node to the specified 'limit' (in
+        // bytes), or to no limit if 'limit' is 'k_UNLIMITED'.  The behavior
+        // is undefined unless '0 <= limit' or 'k_UNLIMITED == limit'.
+
+    // ACCESSORS
+    bsls::Types::Int64 hardLimit() const;
+        // Return the hard limit of this node, or 'k_UNLIMITED' if it has
+        // none.
+
+    const char *name() const;
+        // Return the name of this node, or 0 if it is unnamed.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently allocated from this node and
+        // from its descendants (see {Byte Counts}).
+
+    bsls::Types::Int64 numBytesMax() const;
+        // Return the maximum number of bytes that have been in use by this
+        // node and its descendants at any one time (see {Byte Counts}).
+
+    bsls::Types::Int64 numLimitFailures() const;
+        // Return the number of allocations that have failed because they
+        // would have exceeded the hard limit of this node.
+
+    HierarchicalAllocator *parent() const;
+        // Return the address of the parent of this node, or 0 if this node is
+        // a root.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write a snapshot of the usage of this node and of its descendants
+        // to the specified 'stream' in the format described in {Usage Tree
+        // Snapshot}, and return a reference to 'stream'.
+
+    bsls::Types::Int64 softLimit() const;
+        // Return the soft limit of this node, or 'k_UNLIMITED' if it has
+        // none.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class HierarchicalAllocator
+                        // ---------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HierarchicalAllocator::hardLimit() const
+{
+    return d_hardLimit.loadRelaxed();
+}
+
+inline
+const char *HierarchicalAllocator::name() const
+{
+    return d_name_p;
+}
+
+inline
+bsls::Types::Int64 HierarchicalAllocator::numBytesInUse() const
+{
+    return d_numBytesInUse.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 HierarchicalAllocator::numBytesMax() const
+{
+    return d_numBytesMax.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 HierarchicalAllocator::numLimitFailures() const
+{
+    return d_numLimitFailures.loadRelaxed();
+}
+
+inline
+HierarchicalAllocator *HierarchicalAllocator::parent() const
+{
+    return d_parent_p;
+}
+
+inline
+bsls::Types::Int64 HierarchicalAllocator::softLimit() const
+{
+    return d_softLimit.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1177 @@
+// bdlma_hierarchicalallocator.t.cpp                                  -*-C++-*-
+#include <bdlma_hierarchicalallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HierarchicalAllocator' is a counting allocator that forms a node of
+// a tree, accounts each allocation to the node and to all of its ancestors,
+// and enforces a soft and a hard limit on the number of bytes in use by each
+// node.  The primary concerns are that the byte counts of every node of the
+// tree are correctly maintained, that memory is obtained from the allocator
+// of the root, that the hard limit of any node on the path to the root
+// rejects an allocation without affecting the counts, that pressure
+// callbacks are invoked when (and only when) intended, and that the usage
+// tree snapshot reflects the structure of the tree as children are created
+// and destroyed.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HierarchicalAllocator(Allocator *ba = 0);
+// [ 2] HierarchicalAllocator(const char *name, Allocator *ba = 0);
+// [ 2] HierarchicalAllocator(const char *name, HierarchicalAllocator *p);
+// [ 2] ~HierarchicalAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void setHardLimit(Int64 limit);
+// [ 4] void setPressureCallback(PressureCallback callback, void *context);
+// [ 4] void setSoftLimit(Int64 limit);
+//
+// ACCESSORS
+// [ 4] Int64 hardLimit() const;
+// [ 2] const char *name() const;
+// [ 3] Int64 numBytesInUse() const;
+// [ 3] Int64 numBytesMax() const;
+// [ 4] Int64 numLimitFailures() const;
+// [ 2] HierarchicalAllocator *parent() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream) const;
+// [ 4] Int64 softLimit() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ 4] CONCERN: A failed upstream allocation leaves the counts unchanged.
+// [ 6] CONCERN: Counts and limits are exact under concurrent allocation.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HierarchicalAllocator Obj;
+
+typedef bsls::Types::Int64 Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase4 {
+
+struct PressureRecorder {
+    // This 'struct' records the invocations of a pressure callback, and
+    // optionally frees a block when the hard limit is reached.
+
+    int       d_numSoft;      // number of 'e_SOFT_LIMIT' invocations
+    int       d_numHard;      // number of 'e_HARD_LIMIT' invocations
+    Obj      *d_lastNode_p;   // node of the last invocation
+    Obj      *d_owner_p;      // node from which to free 'd_victim_p'
+    void     *d_victim_p;     // block to free on 'e_HARD_LIMIT', or 0
+};
+
+void recordPressure(void *context, Obj *allocator, Obj::PressureLevel level)
+    // Record the invocation of a pressure callback having the specified
+    // 'allocator' and 'level' in the 'PressureRecorder' at the specified
+    // 'context', and free its victim block (if any) on 'e_HARD_LIMIT'.
+{
+    PressureRecorder *recorder = static_cast<PressureRecorder *>(context);
+
+    recorder->d_lastNode_p = allocator;
+
+    if (Obj::e_SOFT_LIMIT == level) {
+        ++recorder->d_numSoft;
+    }
+    else {
+        ++recorder->d_numHard;
+
+        if (recorder->d_victim_p) {
+            recorder->d_owner_p->deallocate(recorder->d_victim_p);
+            recorder->d_victim_p = 0;
+        }
+    }
+}
+
+}  // close namespace TestCase4
+
+namespace TestCase6 {
+
+enum {
+    k_NUM_BLOCKS = 8,     // blocks held at once by each thread
+    k_BLOCK_SIZE = 100    // size of each block
+};
+
+struct ThreadInfo {
+    int    d_numIterations;   // number of rounds of allocations
+    Obj   *d_obj_p;           // node to allocate from
+    Int64  d_numFailures;     // allocations rejected by a limit
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj& mX = *info->d_obj_p;
+
+    void *blocks[k_NUM_BLOCKS];
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+#ifdef BDE_BUILD_TARGET_EXC
+            try {
+                blocks[j] = mX.allocate(k_BLOCK_SIZE);
+            }
+            catch (const bsl::bad_alloc&) {
+                blocks[j] = 0;
+            }
+#else
+            blocks[j] = mX.allocate(k_BLOCK_SIZE);
+#endif
+            if (blocks[j]) {
+                bsl::memset(blocks[j], 0xff, k_BLOCK_SIZE);
+            }
+            else {
+                ++info->d_numFailures;
+            }
+        }
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            mX.deallocate(blocks[j]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase6
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+static int s_numPressureEvents = 0;
+
+void onCachePressure(
+                    void                                        *context,
+                    bdlma::HierarchicalAllocator                *allocator,
+                    bdlma::HierarchicalAllocator::PressureLevel  level)
+{
+    (void)context;
+    (void)allocator;
+    (void)level;
+
+    ++s_numPressureEvents;
+}
+
+}  // close namespace UsageExample
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace UsageExample;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create the root of the tree, with a hard limit of 1 megabyte for
+// the whole process, and a child for each subsystem:
+//..
+    bdlma::HierarchicalAllocator process("process");
+    process.setHardLimit(1024 * 1024);
+
+    bdlma::HierarchicalAllocator cache("cache", &process);
+    cache.setSoftLimit(64 * 1024);
+    cache.setHardLimit(128 * 1024);
+    cache.setPressureCallback(&onCachePressure, 0);
+
+    bdlma::HierarchicalAllocator handler("handler", &process);
+//..
+// Next, each subsystem allocates from its own node, and the allocations are
+// accounted to the process as well:
+//..
+    void *entry   = cache.allocate(100 * 1024);
+    void *request = handler.allocate(1000);
+
+    ASSERT(1 == s_numPressureEvents);
+
+    ASSERT(100 * 1024        == cache.numBytesInUse());
+    ASSERT(100 * 1024 + 1000 == process.numBytesInUse());
+//..
+// Then, we observe that the cache cannot exceed its quota, and that the
+// failed allocation affects neither the cache nor the process:
+//..
+    #ifdef BDE_BUILD_TARGET_EXC
+    try {
+        cache.allocate(100 * 1024);
+        ASSERT(false);
+    }
+    catch (const bsl::bad_alloc&) {
+    }
+
+    ASSERT(1                 == cache.numLimitFailures());
+    ASSERT(100 * 1024        == cache.numBytesInUse());
+    ASSERT(100 * 1024 + 1000 == process.numBytesInUse());
+    #endif
+//..
+// Next, we take a snapshot of the usage of the process:
+//..
+    bsl::ostringstream snapshot;
+    process.print(snapshot);
+
+    ASSERT(bsl::string::npos != snapshot.str().find("  cache: inUse=102400"));
+//..
+// Finally, the subsystems return their memory:
+//..
+    cache.deallocate(entry);
+    handler.deallocate(request);
+
+    ASSERT(                0 == process.numBytesInUse());
+    ASSERT(100 * 1024 + 1000 == process.numBytesMax());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that the counts and limits hold under concurrent use.
+        //
+        // Concerns:
+        //: 1 'allocate' and 'deallocate' are thread-safe, and, once the
+        //:   threads using the tree are joined, the counts of every node are
+        //:   exact.
+        //:
+        //: 2 The hard limit of a shared ancestor is never exceeded, even when
+        //:   several children allocate concurrently.
+        //:
+        //: 3 Children may be created and destroyed while other nodes of the
+        //:   tree are in use.
+        //
+        // Plan:
+        //: 1 Create a root whose hard limit is smaller than the combined
+        //:   demand of a number of threads, each allocating from a child of
+        //:   its own.  Join the threads, and verify that every count is 0,
+        //:   that the maximum of the root does not exceed its limit, and that
+        //:   some allocations were rejected.  (C-1..2)
+        //:
+        //: 2 While the threads run, repeatedly create and destroy a child of
+        //:   the root and print the tree from the main thread.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Counts and limits are exact under concurrent allocation.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase6;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum {
+            k_NUM_THREADS    = 8,
+            k_NUM_ITERATIONS = 20000,
+            k_LIMIT          = k_NUM_THREADS * k_NUM_BLOCKS * k_BLOCK_SIZE / 2
+        };
+
+        Obj mRoot("root", &sa);  const Obj& ROOT = mRoot;
+        mRoot.setHardLimit(k_LIMIT);
+
+        Obj        *children[k_NUM_THREADS];
+        ThreadInfo  info[k_NUM_THREADS];
+        ThreadId    ids[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            children[i] = new (da) Obj("child", &mRoot);
+
+            info[i].d_numIterations = k_NUM_ITERATIONS;
+            info[i].d_obj_p         = children[i];
+            info[i].d_numFailures   = 0;
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ids[i] = createThread(&threadFunction, &info[i]);
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            Obj transient("transient", &mRoot);
+
+            bsl::ostringstream os(&da);
+            ROOT.print(os);
+            ASSERTV(i, bsl::string::npos != os.str().find("  transient: "));
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(ids[i]);
+        }
+
+        Int64 numFailures = 0;
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            const Obj& CHILD = *children[i];
+
+            ASSERTV(i, 0 == CHILD.numBytesInUse());
+            ASSERTV(i, CHILD.numBytesMax() <= k_NUM_BLOCKS * k_BLOCK_SIZE);
+            ASSERTV(i, 0 == CHILD.numLimitFailures());
+
+            numFailures += info[i].d_numFailures;
+        }
+
+        if (veryVerbose) {
+            P_(numFailures) P(ROOT.numBytesMax())
+        }
+
+        ASSERT(0           == ROOT.numBytesInUse());
+        ASSERTV(ROOT.numBytesMax(), ROOT.numBytesMax() <= k_LIMIT);
+        ASSERT(numFailures == ROOT.numLimitFailures());
+        ASSERT(0           == sa.numBlocksInUse());
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            da.deleteObject(children[i]);
+        }
+
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PRINT METHOD
+        //
+        // Concerns:
+        //: 1 The 'print' method writes one line per node of the subtree of
+        //:   the object, in the intended format, indented by depth.
+        //:
+        //: 2 Children that have been destroyed are no longer printed.
+        //:
+        //: 3 The 'print' method returns the supplied 'ostream', and allocates
+        //:   no memory from the object allocator.
+        //
+        // Plan:
+        //: 1 Build a tree of depth three having named, unnamed, and limited
+        //:   nodes, print it, and compare against the expected output, and
+        //:   (using a 'bslma::TestAllocatorMonitor') verify that no memory is
+        //:   allocated from the object allocator.  (C-1, 3)
+        //:
+        //: 2 Destroy a child, print the tree again, and compare.  (C-2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT METHOD" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mR("root", &sa);  const Obj& R = mR;
+        mR.setHardLimit(1000);
+
+        Obj mA("a", &mR);
+        mA.setSoftLimit(100);
+
+        Obj *mB = new (da) Obj(0, &mR);
+
+        Obj mC("c", &mA);
+
+        void *p = mC.allocate(50);
+        void *q = mB->allocate(20);
+        mB->deallocate(q);
+
+        {
+            bsl::ostringstream os(&da);
+
+            bslma::TestAllocatorMonitor sam(&sa);
+
+            ASSERT(&os == &R.print(os));
+
+            ASSERT(sam.isTotalSame());
+
+            const char *EXPECTED =
+                "root: inUse=50 max=70 soft=none hard=1000 failures=0\n"
+                "  (unnamed): inUse=0 max=20 soft=none hard=none failures=0\n"
+                "  a: inUse=50 max=50 soft=100 hard=none failures=0\n"
+                "    c: inUse=50 max=50 soft=none hard=none failures=0\n";
+
+            if (veryVerbose) {
+                cout << "ACTUAL:"   << endl << os.str() << endl;
+                cout << "EXPECTED:" << endl << EXPECTED << endl;
+            }
+
+            ASSERTV(os.str(), EXPECTED == os.str());
+        }
+
+        da.deleteObject(mB);
+
+        {
+            bsl::ostringstream os(&da);
+
+            mA.print(os);
+
+            const char *EXPECTED =
+                "a: inUse=50 max=50 soft=100 hard=none failures=0\n"
+                "  c: inUse=50 max=50 soft=none hard=none failures=0\n";
+
+            ASSERTV(os.str(), EXPECTED == os.str());
+        }
+        {
+            bsl::ostringstream os(&da);
+
+            R.print(os);
+
+            ASSERTV(os.str(),
+                    bsl::string::npos == os.str().find("(unnamed)"));
+        }
+
+        mC.deallocate(p);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LIMITS AND PRESSURE CALLBACKS
+        //
+        // Concerns:
+        //: 1 The limits are 'k_UNLIMITED' by default, and are set by
+        //:   'setSoftLimit' and 'setHardLimit'.
+        //:
+        //: 2 An allocation that crosses the soft limit of a node succeeds,
+        //:   and invokes the pressure callback of that node, with its
+        //:   context, once per crossing.
+        //:
+        //: 3 An allocation that would exceed the hard limit of the node, or
+        //:   of any of its ancestors, invokes the pressure callback of the
+        //:   limited node and is retried; if the callback freed enough
+        //:   memory, the allocation succeeds.
+        //:
+        //: 4 Otherwise the allocation fails, the number of limit failures of
+        //:   the limited node is incremented, and the counts (including the
+        //:   maximum counts) of every node are unchanged.  No memory is
+        //:   requested from the allocator, and no soft-limit callback is
+        //:   invoked, even for a descendant of the limited node whose soft
+        //:   limit the allocation would have crossed.
+        //:
+        //: 5 An allocation of exactly the hard limit succeeds.
+        //:
+        //: 6 If the underlying allocator throws, the counts are unchanged.
+        //:
+        //: 7 Negative limits are rejected (using 'BSLS_ASSERT').
+        //
+        // Plan:
+        //: 1 Verify the default limits, set them, and verify the accessors.
+        //:   (C-1)
+        //:
+        //: 2 Using a callback that records its invocations, allocate across
+        //:   the soft limit of a node several times, and verify the number of
+        //:   invocations.  (C-2)
+        //:
+        //: 3 Allocate up to the hard limit of a node, and then beyond it,
+        //:   with and without a callback that frees a block, and beyond the
+        //:   hard limit of an ancestor, verifying the outcome, the callback
+        //:   invocations, and the counts of every node.  Then allocate,
+        //:   beyond the hard limit of an ancestor, from a node whose soft
+        //:   limit is thereby crossed, and verify that the soft-limit
+        //:   callback is not invoked and that no maximum count is raised.
+        //:   (C-3..5)
+        //:
+        //: 4 Set the allocation limit of the test allocator to 0, allocate,
+        //:   and verify that the counts are unchanged.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for negative limits.  (C-7)
+        //
+        // Testing:
+        //   void setHardLimit(Int64 limit);
+        //   void setPressureCallback(PressureCallback callback, void *ctx);
+        //   void setSoftLimit(Int64 limit);
+        //   Int64 hardLimit() const;
+        //   Int64 numLimitFailures() const;
+        //   Int64 softLimit() const;
+        //   CONCERN: A failed upstream allocation leaves the counts unchanged.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LIMITS AND PRESSURE CALLBACKS" << endl
+                          << "=============================" << endl;
+
+        using namespace TestCase4;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nDefault and specified limits." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(Obj::k_UNLIMITED == X.softLimit());
+            ASSERT(Obj::k_UNLIMITED == X.hardLimit());
+
+            mX.setSoftLimit(10);
+            mX.setHardLimit(20);
+            ASSERT(10 == X.softLimit());
+            ASSERT(20 == X.hardLimit());
+
+            mX.setSoftLimit(Obj::k_UNLIMITED);
+            mX.setHardLimit(0);
+            ASSERT(Obj::k_UNLIMITED == X.softLimit());
+            ASSERT(0                == X.hardLimit());
+        }
+
+        if (verbose) cout << "\nSoft limit." << endl;
+        {
+            PressureRecorder recorder = { 0, 0, 0, 0, 0 };
+
+            Obj mR(&sa);
+            Obj mX("x", &mR);  const Obj& X = mX;
+
+            mX.setSoftLimit(100);
+            mX.setPressureCallback(&recordPressure, &recorder);
+
+            void *p = mX.allocate(100);
+            ASSERT(0 == recorder.d_numSoft);
+
+            void *q = mX.allocate(1);
+            ASSERT(1   == recorder.d_numSoft);
+            ASSERT(&mX == recorder.d_lastNode_p);
+
+            void *r = mX.allocate(50);
+            ASSERT(1 == recorder.d_numSoft);
+
+            mX.deallocate(q);
+            mX.deallocate(r);
+            ASSERT(100 == X.numBytesInUse());
+
+            q = mX.allocate(10);
+            ASSERT(2 == recorder.d_numSoft);
+            ASSERT(0 == recorder.d_numHard);
+
+            // A callback set on the parent is not invoked for its child's
+            // soft limit.
+
+            mX.setPressureCallback(0, 0);
+            mR.setPressureCallback(&recordPressure, &recorder);
+            mX.deallocate(q);
+            q = mX.allocate(10);
+            ASSERT(2 == recorder.d_numSoft);
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+
+        if (verbose) cout << "\nHard limit." << endl;
+        {
+            PressureRecorder recorder = { 0, 0, 0, 0, 0 };
+
+            Obj mR("r", &sa);  const Obj& R = mR;
+            Obj mX("x", &mR);  const Obj& X = mX;
+            Obj mY("y", &mR);  const Obj& Y = mY;
+
+            mR.setHardLimit(1000);
+            mX.setHardLimit(400);
+            mX.setPressureCallback(&recordPressure, &recorder);
+            mR.setPressureCallback(&recordPressure, &recorder);
+
+            void *p = mX.allocate(300);
+            void *q = mX.allocate(100);  // exactly the limit
+
+            ASSERT(400 == X.numBytesInUse());
+            ASSERT(400 == R.numBytesInUse());
+            ASSERT(0   == recorder.d_numHard);
+
+            const Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.allocate(1);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#else
+            ASSERT(0 == mX.allocate(1));
+#endif
+            ASSERT(1          == recorder.d_numHard);
+            ASSERT(&mX        == recorder.d_lastNode_p);
+            ASSERT(1          == X.numLimitFailures());
+            ASSERT(0          == R.numLimitFailures());
+            ASSERT(400        == X.numBytesInUse());
+            ASSERT(400        == X.numBytesMax());
+            ASSERT(400        == R.numBytesInUse());
+            ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+
+            // The callback frees a block, and the retry succeeds.
+
+            recorder.d_owner_p  = &mX;
+            recorder.d_victim_p = q;
+
+            void *r = mX.allocate(50);
+            ASSERT(r);
+            ASSERT(2   == recorder.d_numHard);
+            ASSERT(0   == recorder.d_victim_p);
+            ASSERT(1   == X.numLimitFailures());
+            ASSERT(350 == X.numBytesInUse());
+            ASSERT(350 == R.numBytesInUse());
+
+            // The limit of the parent applies to its children.
+
+            void *s = mY.allocate(600);
+            ASSERT(950 == R.numBytesInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            caught = false;
+            try {
+                mY.allocate(51);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#else
+            ASSERT(0 == mY.allocate(51));
+#endif
+            ASSERT(3   == recorder.d_numHard);
+            ASSERT(&mR == recorder.d_lastNode_p);
+            ASSERT(1   == R.numLimitFailures());
+            ASSERT(0   == Y.numLimitFailures());
+            ASSERT(600 == Y.numBytesInUse());
+            ASSERT(950 == R.numBytesInUse());
+
+            mX.deallocate(p);
+            mX.deallocate(r);
+            mY.deallocate(s);
+
+            ASSERT(0 == R.numBytesInUse());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nHard limit of an ancestor." << endl;
+        {
+            PressureRecorder recorder = { 0, 0, 0, 0, 0 };
+
+            Obj mR("r", &sa);  const Obj& R = mR;
+            Obj mX("x", &mR);  const Obj& X = mX;
+
+            mR.setHardLimit(100);
+            mX.setSoftLimit(50);
+            mX.setPressureCallback(&recordPressure, &recorder);
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.allocate(120);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#else
+            ASSERT(0 == mX.allocate(120));
+#endif
+            ASSERT(0 == recorder.d_numSoft);
+            ASSERT(0 == recorder.d_numHard);
+            ASSERT(1 == R.numLimitFailures());
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesMax());
+            ASSERT(0 == R.numBytesInUse());
+            ASSERT(0 == R.numBytesMax());
+
+            // Once the ancestor admits the allocation, the soft limit of the
+            // node is crossed.
+
+            void *p = mX.allocate(60);
+            ASSERT(1   == recorder.d_numSoft);
+            ASSERT(&mX == recorder.d_lastNode_p);
+            ASSERT(60  == X.numBytesMax());
+            ASSERT(60  == R.numBytesMax());
+
+            mX.deallocate(p);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nFailure of the underlying allocator." << endl;
+        {
+            Obj mR(&sa);       const Obj& R = mR;
+            Obj mX("x", &mR);  const Obj& X = mX;
+
+            void *p = mX.allocate(10);
+
+            sa.setAllocationLimit(0);
+
+            bool caught = false;
+            try {
+                mX.allocate(20);
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            sa.setAllocationLimit(-1);
+
+            ASSERT(10 == X.numBytesInUse());
+            ASSERT(10 == R.numBytesInUse());
+            ASSERT(0  == X.numLimitFailures());
+
+            mX.deallocate(p);
+        }
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&sa);
+
+            ASSERT_PASS(mX.setSoftLimit(0));
+            ASSERT_FAIL(mX.setSoftLimit(-1));
+            ASSERT_PASS(mX.setHardLimit(0));
+            ASSERT_FAIL(mX.setHardLimit(-1));
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate', 'deallocate', AND BYTE COUNTS
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of (at least) the
+        //:   requested size obtained from the allocator of the root, and
+        //:   increases the number of bytes in use of the node and of each of
+        //:   its ancestors, but not of its siblings, by the requested size.
+        //:
+        //: 2 'deallocate' returns the block to the allocator of the root, and
+        //:   decreases the same counts by the requested size.
+        //:
+        //: 3 'numBytesMax' is the maximum of 'numBytesInUse' of each node.
+        //:
+        //: 4 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //
+        // Plan:
+        //: 1 Create a tree of depth three.  Allocate blocks of a range of
+        //:   sizes from the deepest node and from a sibling of its parent,
+        //:   write to them, and verify their alignment and the counts of
+        //:   every node.  Then deallocate them, verifying the same.  (C-1..3)
+        //:
+        //: 2 Verify that 'allocate(0)' and 'deallocate(0)' have no effect.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   Int64 numBytesInUse() const;
+        //   Int64 numBytesMax() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate', 'deallocate', AND BYTE COUNTS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { k_NUM_BLOCKS = 20 };
+
+        const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+        {
+            Obj mR("r", &sa);  const Obj& R = mR;
+            Obj mA("a", &mR);  const Obj& A = mA;
+            Obj mB("b", &mR);  const Obj& B = mB;
+            Obj mC("c", &mA);  const Obj& C = mC;
+
+            ASSERT(0 == mC.allocate(0));
+            ASSERT(0 == R.numBytesMax());
+            ASSERT(0 == sa.numBlocksTotal());
+
+            mC.deallocate(0);
+            ASSERT(0 == sa.numBlocksTotal());
+
+            void  *blocks[k_NUM_BLOCKS];
+            Int64  inUseC = 0;
+            Int64  inUseB = 0;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                const int  SIZE = i * 7 + 1;
+                Obj&       mX   = i % 2 ? mB : mC;
+
+                blocks[i] = mX.allocate(SIZE);
+                bsl::memset(blocks[i], 0xa5, SIZE);
+                (i % 2 ? inUseB : inUseC) += SIZE;
+
+                ASSERTV(i, 0 == bsls::Types::UintPtr(blocks[i]) % MAX_ALIGN);
+                ASSERTV(i, inUseC          == C.numBytesInUse());
+                ASSERTV(i, inUseC          == A.numBytesInUse());
+                ASSERTV(i, inUseB          == B.numBytesInUse());
+                ASSERTV(i, inUseB + inUseC == R.numBytesInUse());
+                ASSERTV(i, inUseB + inUseC == R.numBytesMax());
+                ASSERTV(i, inUseC          == C.numBytesMax());
+                ASSERTV(i, i + 1           == sa.numBlocksInUse());
+            }
+
+            const Int64 MAX_R = R.numBytesMax();
+            const Int64 MAX_C = C.numBytesMax();
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                const int  SIZE = i * 7 + 1;
+                Obj&       mX   = i % 2 ? mB : mC;
+
+                mX.deallocate(blocks[i]);
+                (i % 2 ? inUseB : inUseC) -= SIZE;
+
+                ASSERTV(i, inUseC          == C.numBytesInUse());
+                ASSERTV(i, inUseC          == A.numBytesInUse());
+                ASSERTV(i, inUseB          == B.numBytesInUse());
+                ASSERTV(i, inUseB + inUseC == R.numBytesInUse());
+                ASSERTV(i, MAX_R           == R.numBytesMax());
+                ASSERTV(i, MAX_C           == C.numBytesMax());
+                ASSERTV(i, MAX_C           == A.numBytesMax());
+                ASSERTV(i, k_NUM_BLOCKS - i - 1 == sa.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, DTOR, 'name', AND 'parent'
+        //
+        // Concerns:
+        //: 1 A root created with either root constructor has no parent, byte
+        //:   counts of 0, and the name, if any, specified at construction.
+        //:
+        //: 2 The memory of a root is supplied by the specified allocator, or
+        //:   by the default allocator if none is specified.
+        //:
+        //: 3 A child has the specified parent and name, and its memory is
+        //:   supplied by the allocator of the root of the tree.
+        //:
+        //: 4 Constructing and destroying nodes allocates no memory.
+        //
+        // Plan:
+        //: 1 Create roots using each constructor, with and without an
+        //:   allocator, and a child and a grandchild of each.  Verify 'name',
+        //:   'parent', and the byte counts, and allocate a block from each
+        //:   node to verify the allocator supplying memory.  (C-1..4)
+        //
+        // Testing:
+        //   HierarchicalAllocator(Allocator *ba = 0);
+        //   HierarchicalAllocator(const char *name, Allocator *ba = 0);
+        //   HierarchicalAllocator(const char *name, HierarchicalAllocator *p);
+        //   ~HierarchicalAllocator();
+        //   const char *name() const;
+        //   HierarchicalAllocator *parent() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, DTOR, 'name', AND 'parent'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *NAME = "Hierarchical";
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator& oa = 'b' == CONFIG || 'd' == CONFIG
+                                     ? sa
+                                     : da;
+
+            const char *expectedName = 'c' <= CONFIG ? NAME : 0;
+
+            const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            {
+                Obj *objPtr = 0;
+
+                bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+                switch (CONFIG) {
+                  case 'a': {
+                    objPtr = new (scratch) Obj();
+                  } break;
+                  case 'b': {
+                    objPtr = new (scratch) Obj(&sa);
+                  } break;
+                  case 'c': {
+                    objPtr = new (scratch) Obj(NAME);
+                  } break;
+                  case 'd': {
+                    objPtr = new (scratch) Obj(NAME, &sa);
+                  } break;
+                }
+
+                Obj& mR = *objPtr;  const Obj& R = mR;
+
+                ASSERTV(CONFIG, expectedName == R.name());
+                ASSERTV(CONFIG, 0            == R.parent());
+                ASSERTV(CONFIG, 0            == R.numBytesInUse());
+                ASSERTV(CONFIG, 0            == R.numBytesMax());
+                ASSERTV(CONFIG, 0            == R.numLimitFailures());
+
+                {
+                    Obj mC("child", &mR);       const Obj& C = mC;
+                    Obj mG(0,       &mC);       const Obj& G = mG;
+
+                    ASSERTV(CONFIG, NUM_BLOCKS == oa.numBlocksTotal());
+
+                    ASSERTV(CONFIG, 0 == bsl::strcmp("child", C.name()));
+                    ASSERTV(CONFIG, &mR == C.parent());
+                    ASSERTV(CONFIG, 0   == G.name());
+                    ASSERTV(CONFIG, &mC == G.parent());
+                    ASSERTV(CONFIG, 0   == G.numBytesInUse());
+
+                    void *p = mR.allocate(1);
+                    void *q = mC.allocate(2);
+                    void *r = mG.allocate(4);
+
+                    ASSERTV(CONFIG, NUM_BLOCKS + 3 == oa.numBlocksTotal());
+                    ASSERTV(CONFIG, 3              == oa.numBlocksInUse());
+                    ASSERTV(CONFIG, 7              == R.numBytesInUse());
+
+                    mG.deallocate(r);
+                    mC.deallocate(q);
+                    mR.deallocate(p);
+                }
+
+                scratch.deleteObject(objPtr);
+            }
+
+            ASSERTV(CONFIG, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a root and a child, allocate and deallocate a few blocks,
+        //:   and verify the byte counts of both.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mR("root", &sa);  const Obj& R = mR;
+            Obj mX("x",    &mR);  const Obj& X = mX;
+
+            void *p = mR.allocate(16);
+            void *q = mX.allocate(64);
+
+            ASSERT(80 == R.numBytesInUse());
+            ASSERT(64 == X.numBytesInUse());
+            ASSERT( 2 == sa.numBlocksInUse());
+
+            mR.deallocate(p);
+            ASSERT(64 == R.numBytesInUse());
+            ASSERT(80 == R.numBytesMax());
+
+            mX.deallocate(q);
+            ASSERT( 0 == R.numBytesInUse());
+            ASSERT( 0 == X.numBytesInUse());
+            ASSERT(64 == X.numBytesMax());
+            ASSERT( 0 == sa.numBlocksInUse());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
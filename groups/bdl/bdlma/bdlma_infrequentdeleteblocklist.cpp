@@ -83,6 +83,17 @@ void InfrequentDeleteBlockList::release()
     }
 }
 
+void InfrequentDeleteBlockList::releaseAfter(void *address)
+{
+    while (d_head_p && &d_head_p->d_memory != address) {
+        void *lastBlock = d_head_p;
+        d_head_p        = d_head_p->d_next_p;
+        d_allocator_p->deallocate(lastBlock);
+    }
+
+    BSLS_ASSERT(!address || d_head_p);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -12,7 +12,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlma::InfrequentDeleteBlockList: manager of infrequently deleted blocks
 //
-//@SEE_ALSO: bdlma_blocklist
+//@SEE_ALSO: bdlma_blocklist, bdlma_blockcacheallocator
 //
 //@DESCRIPTION: This component implements a low-level memory manager,
 // 'bdlma::InfrequentDeleteBlockList', that allocates and manages a sequence of
@@ -23,7 +23,10 @@ BSLS_IDENT("$Id: $")
 // to 'bdlma::BlockList', the 'bdlma::InfrequentDeleteBlockList' class does
 // *not* support the deallocation of individual items.  In particular, although
 // 'bdlma::InfrequentDeleteBlockList' has a 'deallocate' method, that method
-// has no effect.
+// has no effect.  However, the blocks allocated after a given block can be
+// deallocated together, most recent first, using 'releaseAfter', which
+// enables client memory managers to roll back to an earlier state (e.g., see
+// 'bdlma::SequentialPool::rewind').
 //
 ///Usage
 ///-----
@@ -247,6 +250,20 @@ class InfrequentDeleteBlockList {
     void release();
         // Deallocate all memory blocks currently managed by this object,
         // returning it to its default-constructed state.
+
+    void releaseAfter(void *address);
+        // Deallocate all memory blocks allocated by this object after the
+        // block at the specified 'address', or all memory blocks if 'address'
+        // is 0.  The behavior is undefined unless 'address' is 0 or the
+        // address of a memory block currently managed by this object.  Note
+        // that 'address' is typically a value previously returned by
+        // 'mostRecentBlock'.
+
+    // ACCESSORS
+    void *mostRecentBlock() const;
+        // Return the address of the memory block most recently allocated by
+        // this object that is still managed by it, or 0 if this object
+        // manages no memory blocks.
 };
 
 // ============================================================================
@@ -272,6 +289,13 @@ void InfrequentDeleteBlockList::deallocate(void *)
 {
 }
 
+// ACCESSORS
+inline
+void *InfrequentDeleteBlockList::mostRecentBlock() const
+{
+    return d_head_p ? &d_head_p->d_memory : 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -37,9 +37,11 @@ using namespace bsl;
 // [ 2] void *allocate(int size);
 // [ 4] void deallocate(void *address);
 // [ 3] void release();
+// [ 5] void releaseAfter(void *address);
+// [ 5] void *mostRecentBlock() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: There is no temporary allocation from any allocator.
 // [ 2] CONCERN: Precondition violations are detected when enabled.
@@ -287,7 +289,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -329,6 +331,82 @@ int main(int argc, char *argv[])
         }
         ASSERT(0 == a.numBytesInUse());
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'releaseAfter' AND 'mostRecentBlock'
+        //
+        // Concerns:
+        //: 1 'mostRecentBlock' returns 0 for an empty list, and otherwise the
+        //:   address most recently returned by 'allocate'.
+        //:
+        //: 2 'releaseAfter' deallocates exactly those blocks allocated after
+        //:   the specified block, leaving earlier blocks intact.
+        //:
+        //: 3 'releaseAfter(0)' deallocates all blocks.
+        //:
+        //: 4 Allocation may continue after 'releaseAfter'.
+        //
+        // Plan:
+        //: 1 Allocate a sequence of blocks, recording 'mostRecentBlock' after
+        //:   each, then invoke 'releaseAfter' with recorded addresses in
+        //:   reverse order and verify the number of blocks in use by the
+        //:   object allocator.  (C-1..4)
+        //
+        // Testing:
+        //   void releaseAfter(void *address);
+        //   void *mostRecentBlock() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'releaseAfter' AND 'mostRecentBlock'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            enum { NUM_BLOCKS = 5 };
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.mostRecentBlock());
+            mX.releaseAfter(0);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            void *marks[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                void *p = mX.allocate(16 * (i + 1));
+                marks[i] = X.mostRecentBlock();
+                LOOP_ASSERT(i, p == marks[i]);
+                bsl::memset(p, 0xa5, 16 * (i + 1));
+            }
+            ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+
+            mX.releaseAfter(marks[NUM_BLOCKS - 1]);
+            ASSERT(NUM_BLOCKS == oa.numBlocksInUse());
+
+            mX.releaseAfter(marks[2]);
+            ASSERT(3 == oa.numBlocksInUse());
+            ASSERT(marks[2] == X.mostRecentBlock());
+
+            void *p = mX.allocate(8);
+            ASSERT(4 == oa.numBlocksInUse());
+            ASSERT(p == X.mostRecentBlock());
+
+            mX.releaseAfter(marks[0]);
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(marks[0] == X.mostRecentBlock());
+
+            mX.releaseAfter(0);
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == X.mostRecentBlock());
+
+            mX.allocate(8);
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING DEALLOCATE
@@ -0,0 +1,758 @@
+// bdlma_largeobjectallocator.cpp                                     -*-C++-*-
+#include <bdlma_largeobjectallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_largeobjectallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>             // 'bsl::memcpy'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>  // 'madvise', 'mmap', 'mremap', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslma::Allocator::size_type size_type;
+
+const size_type HUGE_PAGE_SIZE =
+                               bdlma::LargeObjectAllocator::k_HUGE_PAGE_SIZE;
+
+// HELPER FUNCTIONS
+
+inline
+size_type hashAddress(const void *address)
+    // Return a hash value for the specified 'address', which is expected to
+    // be aligned on a page boundary.
+{
+    const bsls::Types::Uint64 page = static_cast<bsls::Types::Uint64>(
+                      reinterpret_cast<bsls::Types::UintPtr>(address)) >> 12;
+
+    return static_cast<size_type>((page * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+size_type getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return static_cast<size_type>(pageSize.loadRelaxed());
+}
+
+inline
+bool isPageAligned(const void *address)
+    // Return 'true' if the specified 'address' is aligned on a page boundary,
+    // and 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                        % getSystemPageSize();
+}
+
+inline
+size_type roundUpToPageSize(size_type size)
+    // Return the specified 'size' rounded up to a multiple of the page size.
+{
+    const size_type pageSize = getSystemPageSize();
+
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+void adviseHugePages(void *address, size_type size)
+    // Advise the operating system that the specified 'size' bytes at the
+    // specified 'address' should be backed by huge pages, if 'size' is at
+    // least 'HUGE_PAGE_SIZE' and the platform supports such advice.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+
+    if (size >= HUGE_PAGE_SIZE) {
+        madvise(address, size, MADV_HUGEPAGE);
+    }
+
+#else
+
+    (void)address;
+    (void)size;
+
+#endif
+}
+
+void *systemMap(size_type size)
+    // Create an anonymous read-write mapping of the specified 'size' (in
+    // bytes), aligned on a 'HUGE_PAGE_SIZE' boundary and advised to be backed
+    // by huge pages if 'size' is at least 'HUGE_PAGE_SIZE', and return its
+    // address, or 0 if the mapping cannot be created.  The behavior is
+    // undefined unless 'size' is a non-zero multiple of the page size.
+{
+    BSLS_ASSERT(0 < size);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    if (size < HUGE_PAGE_SIZE) {
+        void *address = mmap(0,
+                             size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANON | MAP_PRIVATE,
+                             -1,
+                             0);
+
+        return MAP_FAILED == address ? 0 : address;                   // RETURN
+    }
+
+    // Map enough to contain an aligned region of 'size' bytes, and unmap the
+    // excess at either end.
+
+    const size_type extendedSize = size + HUGE_PAGE_SIZE;
+
+    if (extendedSize < size) {
+        return 0;                                                     // RETURN
+    }
+
+    char *extended = static_cast<char *>(mmap(0,
+                                              extendedSize,
+                                              PROT_READ | PROT_WRITE,
+                                              MAP_ANON | MAP_PRIVATE,
+                                              -1,
+                                              0));
+
+    if (MAP_FAILED == static_cast<void *>(extended)) {
+        return 0;                                                     // RETURN
+    }
+
+    const size_type head = (HUGE_PAGE_SIZE
+                            - reinterpret_cast<bsls::Types::UintPtr>(extended)
+                                                           % HUGE_PAGE_SIZE)
+                                                           % HUGE_PAGE_SIZE;
+    char *address = extended + head;
+
+    if (head) {
+        munmap(extended, head);
+    }
+    munmap(address + size, extendedSize - head - size);
+
+    adviseHugePages(address, size);
+
+    return address;
+
+#endif
+}
+
+void systemUnmap(void *address, size_type size)
+    // Remove the mapping at the specified 'address' having the specified
+    // 'size' (in bytes).  The behavior is undefined unless 'address' and
+    // 'size' describe a mapping created by 'systemMap' (or 'systemRemap').
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+void *systemRemap(void      *address,
+                  size_type  size,
+                  size_type  newSize,
+                  bool       mayMove)
+    // Resize the mapping at the specified 'address', having the specified
+    // 'size' (in bytes), to the specified 'newSize' (in bytes), moving it if
+    // the specified 'mayMove' flag is 'true' and it cannot be extended in
+    // place, and return its (possibly new) address, or return 0 with no
+    // effect if the mapping cannot be resized (e.g., because the platform
+    // does not support resizing mappings).  The behavior is undefined unless
+    // 'address' and 'size' describe a mapping created by 'systemMap' (or
+    // 'systemRemap'), and 'newSize' is a multiple of the page size greater
+    // than 'size'.
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(size < newSize);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+    void *newAddress = mremap(address,
+                              size,
+                              newSize,
+                              mayMove ? MREMAP_MAYMOVE : 0);
+
+    if (MAP_FAILED == newAddress) {
+        return 0;                                                     // RETURN
+    }
+
+    adviseHugePages(newAddress, newSize);
+
+    return newAddress;
+
+#else
+
+    (void)address;
+    (void)size;
+    (void)newSize;
+    (void)mayMove;
+
+    return 0;
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                         // --------------------------
+                         // class LargeObjectAllocator
+                         // --------------------------
+
+// PRIVATE MANIPULATORS
+bool LargeObjectAllocator::growTable()
+{
+    // The table starts with the slots that fit in one page, and doubles.
+
+    const size_type newCapacity = d_tableCapacity
+                                ? 2 * d_tableCapacity
+                                : getSystemPageSize() / sizeof(Mapping);
+
+    // Anonymous mappings are zero-filled, so every slot of the new table is
+    // empty.
+
+    Mapping *newTable = static_cast<Mapping *>(
+                                     systemMap(newCapacity * sizeof(Mapping)));
+    if (0 == newTable) {
+        return false;                                                 // RETURN
+    }
+
+    Mapping         *table    = d_table_p;
+    const size_type  capacity = d_tableCapacity;
+
+    d_table_p       = newTable;
+    d_tableCapacity = newCapacity;
+
+    for (size_type i = 0; i < capacity; ++i) {
+        if (table[i].d_address_p) {
+            *findSlot(table[i].d_address_p) = table[i];
+        }
+    }
+
+    if (table) {
+        systemUnmap(table, capacity * sizeof(Mapping));
+    }
+
+    return true;
+}
+
+bool LargeObjectAllocator::addMapping(void *address, size_type size)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < size);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    // Keep the table at most half full, so that probes are short.
+
+    if (2 * (d_numInUse + 1) > d_tableCapacity && !growTable()) {
+        return false;                                                 // RETURN
+    }
+
+    Mapping *slot = findSlot(address);
+
+    BSLS_ASSERT(0 == slot->d_address_p);
+
+    slot->d_address_p = address;
+    slot->d_size      = size;
+    ++d_numInUse;
+
+    return true;
+}
+
+void LargeObjectAllocator::eraseSlot(Mapping *slot)
+{
+    BSLS_ASSERT(slot->d_address_p);
+
+    const size_type mask = d_tableCapacity - 1;
+
+    size_type hole = static_cast<size_type>(slot - d_table_p);
+    size_type next = hole;
+
+    // Move back each following mapping whose probe sequence (from the slot
+    // its address hashes to) passes through the hole, until an empty slot.
+
+    while (d_table_p[next = (next + 1) & mask].d_address_p) {
+        const size_type home = hashAddress(d_table_p[next].d_address_p)
+                                                                       & mask;
+
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            d_table_p[hole] = d_table_p[next];
+            hole            = next;
+        }
+    }
+
+    d_table_p[hole].d_address_p = 0;
+    d_table_p[hole].d_size      = 0;
+    --d_numInUse;
+}
+
+void LargeObjectAllocator::moveMapping(void      *address,
+                                       void      *newAddress,
+                                       size_type  newSize)
+{
+    BSLS_ASSERT(newAddress);
+    BSLS_ASSERT(0 < newSize);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    BSLS_ASSERT(d_table_p);
+
+    // Removing the mapping first leaves room for it, so the table need not
+    // grow.
+
+    eraseSlot(findSlot(address));
+
+    Mapping *slot = findSlot(newAddress);
+
+    slot->d_address_p = newAddress;
+    slot->d_size      = newSize;
+    ++d_numInUse;
+}
+
+LargeObjectAllocator::size_type LargeObjectAllocator::removeMapping(
+                                                                void *address)
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    if (0 == d_table_p) {
+        return 0;                                                     // RETURN
+    }
+
+    Mapping *slot = findSlot(address);
+
+    if (0 == slot->d_address_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const size_type size = slot->d_size;
+
+    eraseSlot(slot);
+
+    return size;
+}
+
+void *LargeObjectAllocator::map(size_type size)
+{
+    BSLS_ASSERT(0 < size);
+
+    void      *mapping     = 0;
+    size_type  mappingSize = 0;
+
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        // Take the smallest cached mapping of at least 'size' bytes, unless
+        // it is more than twice as large as needed.
+
+        int best = -1;
+        for (int i = 0; i < d_numCached; ++i) {
+            const size_type cachedSize = d_cache[i].d_size;
+
+            if (size <= cachedSize
+             && cachedSize / 2 <= size
+             && (best < 0 || cachedSize < d_cache[best].d_size)) {
+                best = i;
+            }
+        }
+
+        if (0 <= best) {
+            mapping     = d_cache[best].d_address_p;
+            mappingSize = d_cache[best].d_size;
+
+            for (int i = best + 1; i < d_numCached; ++i) {
+                d_cache[i - 1] = d_cache[i];
+            }
+            --d_numCached;
+
+            d_numBytesCached.addRelaxed(
+                               -static_cast<bsls::Types::Int64>(mappingSize));
+        }
+    }
+
+    if (0 == mapping) {
+        mapping = systemMap(size);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == mapping)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        mappingSize = size;
+        d_numBytesMapped.addRelaxed(static_cast<bsls::Types::Int64>(size));
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       !addMapping(mapping, mappingSize))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        unmap(mapping, mappingSize);
+
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    return mapping;
+}
+
+void LargeObjectAllocator::unmap(void *mapping, size_type size)
+{
+    BSLS_ASSERT(mapping);
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    if (numBytes > d_maxCachedBytes) {
+        systemUnmap(mapping, size);
+        d_numBytesMapped.addRelaxed(-numBytes);
+        return;                                                       // RETURN
+    }
+
+    // Evict the least recently cached mappings until 'mapping' fits, and
+    // unmap them after releasing the lock.
+
+    Mapping evicted[k_MAX_CACHED_MAPPINGS];
+    int     numEvicted = 0;
+
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        while (k_MAX_CACHED_MAPPINGS == d_numCached - numEvicted
+            || d_numBytesCached.loadRelaxed() + numBytes > d_maxCachedBytes) {
+            BSLS_ASSERT(numEvicted < d_numCached);
+
+            evicted[numEvicted] = d_cache[numEvicted];
+            d_numBytesCached.addRelaxed(
+                 -static_cast<bsls::Types::Int64>(evicted[numEvicted].d_size));
+            ++numEvicted;
+        }
+
+        for (int i = numEvicted; i < d_numCached; ++i) {
+            d_cache[i - numEvicted] = d_cache[i];
+        }
+        d_numCached -= numEvicted;
+
+        d_cache[d_numCached].d_address_p = mapping;
+        d_cache[d_numCached].d_size      = size;
+        ++d_numCached;
+
+        d_numBytesCached.addRelaxed(numBytes);
+    }
+
+    for (int i = 0; i < numEvicted; ++i) {
+        systemUnmap(evicted[i].d_address_p, evicted[i].d_size);
+        d_numBytesMapped.addRelaxed(
+                       -static_cast<bsls::Types::Int64>(evicted[i].d_size));
+    }
+}
+
+// PRIVATE ACCESSORS
+LargeObjectAllocator::Mapping *
+LargeObjectAllocator::findSlot(const void *address) const
+{
+    BSLS_ASSERT(d_table_p);
+
+    const size_type mask = d_tableCapacity - 1;
+
+    size_type index = hashAddress(address) & mask;
+    while (d_table_p[index].d_address_p
+        && d_table_p[index].d_address_p != address) {
+        index = (index + 1) & mask;
+    }
+
+    return d_table_p + index;
+}
+
+LargeObjectAllocator::size_type
+LargeObjectAllocator::mappingSize(const void *address) const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    if (0 == d_table_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const Mapping *slot = findSlot(address);
+
+    return slot->d_address_p ? slot->d_size : 0;
+}
+
+// CREATORS
+LargeObjectAllocator::LargeObjectAllocator(bslma::Allocator *basicAllocator)
+: d_numCached(0)
+, d_table_p(0)
+, d_tableCapacity(0)
+, d_numInUse(0)
+, d_numBytesCached(0)
+, d_numBytesMapped(0)
+, d_minMappedSize(k_DEFAULT_MIN_MAPPED_SIZE)
+, d_maxCachedBytes(k_DEFAULT_MAX_CACHED_BYTES)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(d_allocator_p);
+}
+
+LargeObjectAllocator::LargeObjectAllocator(
+                                      size_type           minMappedSize,
+                                      bsls::Types::Int64  maxCachedBytes,
+                                      bslma::Allocator   *basicAllocator)
+: d_numCached(0)
+, d_table_p(0)
+, d_tableCapacity(0)
+, d_numInUse(0)
+, d_numBytesCached(0)
+, d_numBytesMapped(0)
+, d_minMappedSize(minMappedSize)
+, d_maxCachedBytes(maxCachedBytes)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < minMappedSize);
+    BSLS_ASSERT(0 <= maxCachedBytes);
+    BSLS_ASSERT(d_allocator_p);
+}
+
+LargeObjectAllocator::~LargeObjectAllocator()
+{
+    release();
+
+    BSLS_ASSERT(0 == numBytesCached());
+    BSLS_ASSERT(0 == numBytesMapped());
+    BSLS_ASSERT(0 == d_numInUse);
+
+    if (d_table_p) {
+        systemUnmap(d_table_p, d_tableCapacity * sizeof(Mapping));
+    }
+}
+
+// MANIPULATORS
+void *LargeObjectAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (size < d_minMappedSize) {
+        return d_allocator_p->allocate(size);                         // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                      size > ~static_cast<size_type>(0) - HUGE_PAGE_SIZE)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    return map(roundUpToPageSize(size));
+}
+
+void LargeObjectAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    // Only the table records whether a block is mapped, and a mapped block
+    // is aligned on a page boundary.
+
+    if (isPageAligned(address)) {
+        const size_type size = removeMapping(address);
+
+        if (size) {
+            unmap(address, size);
+            return;                                                   // RETURN
+        }
+    }
+
+    d_allocator_p->deallocate(address);
+}
+
+void *LargeObjectAllocator::reallocate(void      *address,
+                                       size_type  originalSize,
+                                       size_type  newSize)
+{
+    if (0 == address) {
+        return allocate(newSize);                                     // RETURN
+    }
+
+    if (0 == newSize) {
+        deallocate(address);
+        return 0;                                                     // RETURN
+    }
+
+    if (newSize <= originalSize
+     || tryExpand(address, originalSize, newSize)) {
+        return address;                                               // RETURN
+    }
+
+    // Move a mapped block that is to remain mapped by remapping its pages.
+
+    const size_type size = isPageAligned(address) ? mappingSize(address)
+                                                  : 0;
+
+    if (0 != size
+     && d_minMappedSize <= newSize
+     && newSize <= ~static_cast<size_type>(0) - HUGE_PAGE_SIZE) {
+        const size_type newMappingSize = roundUpToPageSize(newSize);
+
+        void *newAddress = systemRemap(address, size, newMappingSize, true);
+
+        if (newAddress) {
+            moveMapping(address, newAddress, newMappingSize);
+            d_numBytesMapped.addRelaxed(
+                       static_cast<bsls::Types::Int64>(newMappingSize)
+                                      - static_cast<bsls::Types::Int64>(size));
+
+            return newAddress;                                        // RETURN
+        }
+    }
+
+    void *newAddress = allocate(newSize);
+
+    if (newAddress) {
+        bsl::memcpy(newAddress, address, originalSize);
+        deallocate(address);
+    }
+
+    return newAddress;
+}
+
+void LargeObjectAllocator::release()
+{
+    Mapping mappings[k_MAX_CACHED_MAPPINGS];
+    int     numMappings;
+
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        numMappings = d_numCached;
+        for (int i = 0; i < numMappings; ++i) {
+            mappings[i] = d_cache[i];
+        }
+        d_numCached = 0;
+    }
+
+    for (int i = 0; i < numMappings; ++i) {
+        const bsls::Types::Int64 numBytes =
+                           static_cast<bsls::Types::Int64>(mappings[i].d_size);
+
+        systemUnmap(mappings[i].d_address_p, mappings[i].d_size);
+
+        d_numBytesCached.addRelaxed(-numBytes);
+        d_numBytesMapped.addRelaxed(-numBytes);
+    }
+}
+
+bool LargeObjectAllocator::tryExpand(void      *address,
+                                     size_type  originalSize,
+                                     size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < originalSize);
+    BSLS_ASSERT(originalSize <= newSize);
+
+    const size_type size = isPageAligned(address) ? mappingSize(address)
+                                                  : 0;
+
+    if (0 == size) {
+        return d_allocator_p->tryExpand(address,
+                                        originalSize,
+                                        newSize);                     // RETURN
+    }
+
+    if (newSize <= size) {
+        return true;                                                  // RETURN
+    }
+
+    if (newSize > ~static_cast<size_type>(0) - HUGE_PAGE_SIZE) {
+        return false;                                                 // RETURN
+    }
+
+    const size_type newMappingSize = roundUpToPageSize(newSize);
+
+    if (0 == systemRemap(address, size, newMappingSize, false)) {
+        return false;                                                 // RETURN
+    }
+
+    moveMapping(address, address, newMappingSize);
+    d_numBytesMapped.addRelaxed(static_cast<bsls::Types::Int64>(newMappingSize)
+                                      - static_cast<bsls::Types::Int64>(size));
+
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
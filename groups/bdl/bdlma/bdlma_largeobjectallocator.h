@@ -0,0 +1,476 @@
+// bdlma_largeobjectallocator.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLMA_LARGEOBJECTALLOCATOR
+#define INCLUDED_BDLMA_LARGEOBJECTALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator mapping large blocks directly from the system.
+//
+//@CLASSES:
+//  bdlma::LargeObjectAllocator: allocator of memory-mapped large blocks
+//
+//@SEE_ALSO: bdlma_blockcacheallocator, bdlma_multipool, bdlma_sequentialpool
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::LargeObjectAllocator', that implements the 'bslma::Allocator'
+// protocol by obtaining each large block (of at least the 'minMappedSize'
+// supplied at construction) as an anonymous memory mapping of its own
+// directly from the operating system (i.e., using 'mmap' on UNIX, and
+// 'VirtualAlloc' on Windows), and forwarding smaller requests to an allocator
+// supplied at construction:
+//..
+//   ,---------------------------.
+//  ( bdlma::LargeObjectAllocator )
+//   `---------------------------'
+//                |         ctor/dtor
+//                |         reallocate
+//                |         release
+//                |         maxCachedBytes
+//                |         minMappedSize
+//                |         numBytesCached
+//                |         numBytesMapped
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                          allocate
+//                          deallocate
+//                          tryExpand
+//..
+// A large object allocator is intended for multi-megabyte buffers, such as
+// the bucket arrays of large hash tables and the maps of large deques, and to
+// be the upstream allocator of pools, such as 'bdlma::Multipool' (whose
+// blocks larger than 'maxPooledBlockSize' are allocated from its upstream
+// allocator directly) and 'bdlma::SequentialPool' (whose buffers grow
+// geometrically).  Small requests, such as the chunks replenishing the pools
+// of a multipool, are forwarded to the (backing) allocator supplied at
+// construction, so that the large object allocator can serve as the sole
+// upstream allocator of such a pool.
+//
+///Block Layout
+///------------
+// A mapped block is the whole of its mapping: its address is the start of the
+// mapping, and so is aligned on a page boundary (and, for a huge mapping on
+// Linux, on a 'k_HUGE_PAGE_SIZE' boundary), and its mapping is the requested
+// size rounded up to a multiple of the page size, so that a request for a
+// power of two bytes (of at least a page) is mapped exactly.  The size of
+// each mapping in use is recorded out of band, in a hash table keyed by
+// address and held in a mapping of its own, rather than in a header preceding
+// the block.  Blocks smaller than 'minMappedSize' are forwarded to, and
+// returned to, the backing allocator unmodified.  To deallocate a block, the
+// table is consulted (under the lock) only if the block is aligned on a page
+// boundary, so returning a small block to the backing allocator involves no
+// lock in the common case.
+//
+///Huge Pages
+///----------
+// Accessing a large block sequentially or randomly (e.g., probing a hash
+// table) touches many pages, and is often bound by misses of the translation
+// lookaside buffer (TLB) rather than of the data caches.  On Linux, each
+// mapping of at least 'k_HUGE_PAGE_SIZE' bytes is aligned on a
+// 'k_HUGE_PAGE_SIZE' boundary and advised to be backed by transparent huge
+// pages ('madvise(MADV_HUGEPAGE)'), so that the kernel can map it using one
+// TLB entry per 2 MB instead of one per 4 KB page.  Whether huge pages are
+// actually used depends on the configuration of the host (see
+// '/sys/kernel/mm/transparent_hugepage/enabled'); the advice is ignored where
+// it is not supported.
+//
+///Caching of Mappings
+///-------------------
+// Creating and destroying a mapping requires system calls, and the pages of
+// a new mapping are zero-filled by the kernel on first access.  To amortize
+// this cost for workloads that repeatedly allocate and deallocate similarly
+// sized large buffers, a deallocated mapping is cached (up to
+// 'k_MAX_CACHED_MAPPINGS' mappings, whose total size is bounded by the
+// 'maxCachedBytes' supplied at construction), and reused by a subsequent
+// allocation requiring a mapping of at least half its size.  When the cache
+// is full, the least recently cached mapping is unmapped.  The 'release'
+// method unmaps all cached mappings, as does the destructor.
+//
+///Growth Without Copying
+///----------------------
+// A mapping is rounded up to a multiple of the page size, so a large block
+// usually has some slack beyond the size requested, and on Linux a mapping
+// can often be extended in place ('mremap').  'tryExpand' uses both, so that
+// 'bsl::vector', 'bsl::string', and the other containers that call
+// 'tryExpand' before reallocating grow a large buffer allocated from this
+// allocator without copying its elements.  In addition, the 'reallocate'
+// method grows (or shrinks) a block of trivially copyable data, moving the
+// mapping (rather than copying its pages) if it cannot be extended in place.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::LargeObjectAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary') provided that the backing allocator supplied at
+// construction is fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying the Large Blocks of a Multipool
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service builds, for each request, a large lookup table using
+// a 'bdlma::Multipool', whose small blocks are pooled, but whose large blocks
+// (here, the table itself) are obtained from its upstream allocator.
+//
+// First, we create a large object allocator mapping each block of at least 1
+// MB, and use it as the upstream allocator of the multipool:
+//..
+//  bdlma::LargeObjectAllocator largeObjectAllocator(1024 * 1024,
+//                                                   64 * 1024 * 1024);
+//  bdlma::Multipool            multipool(&largeObjectAllocator);
+//..
+// Then, we allocate the table, which, being larger than the largest pooled
+// block, is mapped directly from the operating system:
+//..
+//  const int   k_TABLE_SIZE = 4 * 1024 * 1024;
+//
+//  char *table = static_cast<char *>(multipool.allocate(k_TABLE_SIZE));
+//
+//  assert(k_TABLE_SIZE <= largeObjectAllocator.numBytesMapped());
+//  assert(0            == largeObjectAllocator.numBytesCached());
+//..
+// Next, we fill the table, and deallocate it when we are done, upon which the
+// mapping is cached rather than unmapped:
+//..
+//  for (int i = 0; i < k_TABLE_SIZE; ++i) {
+//      table[i] = static_cast<char>(i);
+//  }
+//
+//  multipool.deallocate(table);
+//
+//  assert(k_TABLE_SIZE <= largeObjectAllocator.numBytesCached());
+//..
+// Finally, we allocate the table of the next request, which reuses the cached
+// mapping:
+//..
+//  table = static_cast<char *>(multipool.allocate(k_TABLE_SIZE));
+//
+//  assert(0 == largeObjectAllocator.numBytesCached());
+//
+//  multipool.deallocate(table);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // ==========================
+                         // class LargeObjectAllocator
+                         // ==========================
+
+class LargeObjectAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete allocator mechanism that implements the
+    // 'bslma::Allocator' protocol, and supplies each block of at least
+    // 'minMappedSize' bytes from an anonymous memory mapping of its own
+    // (advised to be backed by huge pages where supported), caching
+    // deallocated mappings for reuse, and forwarding smaller requests to the
+    // allocator supplied at construction.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_HUGE_PAGE_SIZE           = 2 * 1024 * 1024,  // alignment of the
+                                                       // mappings advised to
+                                                       // use huge pages
+
+        k_MAX_CACHED_MAPPINGS      = 16,               // maximum number of
+                                                       // cached mappings
+
+        k_DEFAULT_MIN_MAPPED_SIZE  = 1024 * 1024,      // default size of the
+                                                       // smallest mapped block
+
+        k_DEFAULT_MAX_CACHED_BYTES = 64 * 1024 * 1024  // default bound on the
+                                                       // total size of the
+                                                       // cached mappings
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Mapping {
+        // This 'struct' describes a mapping, cached or in use.
+
+        void      *d_address_p;  // address of the mapping
+        size_type  d_size;       // size of the mapping (in bytes)
+    };
+
+    // DATA
+    mutable bsls::BslLock d_lock;             // guards the cache and the
+                                              // table of mappings in use
+
+    Mapping               d_cache[k_MAX_CACHED_MAPPINGS];
+                                              // cached mappings, least
+                                              // recently cached first
+
+    int                   d_numCached;        // number of cached mappings
+
+    Mapping              *d_table_p;          // mappings in use, keyed by
+                                              // address (open addressing,
+                                              // linear probing), or 0
+
+    size_type             d_tableCapacity;    // number of slots in
+                                              // 'd_table_p' (0 or a power
+                                              // of 2)
+
+    size_type             d_numInUse;         // number of mappings in use
+
+    bsls::AtomicInt64     d_numBytesCached;   // total size of the cached
+                                              // mappings
+
+    bsls::AtomicInt64     d_numBytesMapped;   // total size of all mappings,
+                                              // including the cached ones
+
+    size_type             d_minMappedSize;    // size of the smallest block
+                                              // supplied by a mapping
+
+    bsls::Types::Int64    d_maxCachedBytes;   // bound on 'd_numBytesCached'
+
+    bslma::Allocator     *d_allocator_p;      // backing allocator (held, not
+                                              // owned)
+
+  private:
+    // PRIVATE MANIPULATORS
+    bool growTable();
+        // Double the capacity of the table of mappings in use (or create it),
+        // moving the recorded mappings to the new table.  Return 'true' on
+        // success, and 'false' with no effect if the new table cannot be
+        // mapped.  The behavior is undefined unless 'd_lock' is held.
+
+    bool addMapping(void *address, size_type size);
+        // Record that the mapping at the specified 'address', having the
+        // specified 'size' (in bytes), is in use.  Return 'true' on success,
+        // and 'false' with no effect if the table of mappings in use must,
+        // but cannot, grow.  The behavior is undefined unless 'address' is
+        // not the address of a mapping in use.
+
+    void eraseSlot(Mapping *slot);
+        // Remove the mapping recorded in the specified 'slot' of 'd_table_p'
+        // from the table of mappings in use, moving the mappings following
+        // it (in probing order) to keep every mapping reachable from the slot
+        // its address hashes to.  The behavior is undefined unless 'd_lock'
+        // is held and 'slot' records a mapping.
+
+    void moveMapping(void *address, void *newAddress, size_type newSize);
+        // Record that the mapping in use at the specified 'address' is now
+        // at the specified 'newAddress' (which may be 'address'), and has
+        // the specified 'newSize' (in bytes).  The behavior is undefined
+        // unless 'address' is the address of a mapping in use.
+
+    size_type removeMapping(void *address);
+        // Remove the mapping at the specified 'address' from the table of
+        // mappings in use, and return its size, or return 0 if 'address' is
+        // not the address of a mapping in use.
+
+    void *map(size_type size);
+        // Return the address of a mapping of at least the specified 'size'
+        // (in bytes), taken from the cache if a mapping of at least 'size'
+        // (and at most twice 'size') bytes is cached, and created otherwise,
+        // and record it as in use.  Throw 'bsl::bad_alloc' if a mapping
+        // cannot be created or recorded.  The behavior is undefined unless
+        // 'size' is a multiple of the page size.
+
+    void unmap(void *mapping, size_type size);
+        // Cache the mapping at the specified 'mapping' address, having the
+        // specified 'size' (in bytes), or unmap it if it is larger than the
+        // bound on the cache.  If the cache is full, unmap the least recently
+        // cached mapping to make room for 'mapping'.
+
+    // PRIVATE ACCESSORS
+    Mapping *findSlot(const void *address) const;
+        // Return the address of the slot of 'd_table_p' recording the mapping
+        // at the specified 'address' or, if there is none, of the empty slot
+        // at which it would be recorded.  The behavior is undefined unless
+        // 'd_lock' is held and 'd_table_p' is not 0.
+
+    size_type mappingSize(const void *address) const;
+        // Return the size (in bytes) of the mapping at the specified
+        // 'address' if it is a mapping in use, and 0 otherwise.
+
+  private:
+    // NOT IMPLEMENTED
+    LargeObjectAllocator(const LargeObjectAllocator&);
+    LargeObjectAllocator& operator=(const LargeObjectAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    LargeObjectAllocator(bslma::Allocator *basicAllocator = 0);
+    LargeObjectAllocator(size_type           minMappedSize,
+                         bsls::Types::Int64  maxCachedBytes,
+                         bslma::Allocator   *basicAllocator = 0);
+        // Create a large object allocator.  Optionally specify
+        // 'minMappedSize', the size (in bytes) of the smallest block supplied
+        // from a mapping of its own, and 'maxCachedBytes', the bound on the
+        // total size (in bytes) of the mappings cached at any one time.  If
+        // 'minMappedSize' and 'maxCachedBytes' are not specified,
+        // 'k_DEFAULT_MIN_MAPPED_SIZE' and 'k_DEFAULT_MAX_CACHED_BYTES' are
+        // used, respectively.  Optionally specify a 'basicAllocator' used to
+        // supply the blocks smaller than 'minMappedSize'.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < minMappedSize' and
+        // '0 <= maxCachedBytes'.
+
+    virtual ~LargeObjectAllocator();
+        // Unmap all cached mappings, and destroy this allocator.  The
+        // behavior is undefined unless every block allocated from this
+        // allocator has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes).  If 'size' is at least
+        // 'minMappedSize', the block is a mapping of its own (taken from the
+        // cache if possible), aligned on a page boundary; otherwise, it is
+        // supplied by the backing allocator.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  Throw 'bsl::bad_alloc' if memory
+        // cannot be mapped.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If the block was supplied from a mapping, the mapping
+        // is cached (or unmapped if it does not fit in the cache); otherwise,
+        // the block is returned to the backing allocator.  If 'address' is 0,
+        // this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object and has not
+        // already been deallocated.
+
+    void *reallocate(void      *address,
+                     size_type  originalSize,
+                     size_type  newSize);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'newSize' (in bytes) holding the first
+        // 'min(originalSize, newSize)' bytes of the block at the specified
+        // 'address', having the specified 'originalSize' (in bytes), which is
+        // deallocated if it is not the block returned.  A mapped block is
+        // extended in place if possible and, on Linux, is otherwise moved by
+        // remapping its pages rather than by copying them.  If 'address' is
+        // 0, this method is equivalent to 'allocate(newSize)'; otherwise, if
+        // 'newSize' is 0, it is equivalent to 'deallocate(address)' and
+        // returns 0.  Throw 'bsl::bad_alloc' if memory cannot be allocated,
+        // in which case the block at 'address' is unaffected.  The behavior
+        // is undefined unless 'address' is 0 or was allocated using this
+        // allocator object, has not already been deallocated, and has a size
+        // of at least 'originalSize' bytes.  Note that the contents of the
+        // block are moved bitwise, so the block should hold only trivially
+        // copyable data.
+
+    void release();
+        // Unmap all cached mappings.  Note that blocks in use are not
+        // affected.
+
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' can now hold 'newSize' bytes, and
+        // 'false' with no effect otherwise.  A mapped block is expanded into
+        // the slack at the end of its mapping or, on Linux, by extending its
+        // mapping in place; a block supplied by the backing allocator is
+        // expanded if the backing allocator can do so.  The behavior is
+        // undefined unless 'address' was allocated by this allocator and has
+        // not already been deallocated, the size of the memory block at
+        // 'address' is 'originalSize', and '0 < originalSize <= newSize'.
+
+    // ACCESSORS
+    bsls::Types::Int64 maxCachedBytes() const;
+        // Return the bound on the total size (in bytes) of the mappings
+        // cached at any one time.
+
+    size_type minMappedSize() const;
+        // Return the size (in bytes) of the smallest block supplied from a
+        // mapping of its own.
+
+    bsls::Types::Int64 numBytesCached() const;
+        // Return the total size (in bytes) of the mappings currently cached.
+        // Note that, if other threads are allocating or deallocating
+        // concurrently, the value returned may be out of date.
+
+    bsls::Types::Int64 numBytesMapped() const;
+        // Return the total size (in bytes) of the mappings currently held by
+        // this allocator, including the cached mappings.  Note that, if other
+        // threads are allocating or deallocating concurrently, the value
+        // returned may be out of date.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class LargeObjectAllocator
+                         // --------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 LargeObjectAllocator::maxCachedBytes() const
+{
+    return d_maxCachedBytes;
+}
+
+inline
+LargeObjectAllocator::size_type LargeObjectAllocator::minMappedSize() const
+{
+    return d_minMappedSize;
+}
+
+inline
+bsls::Types::Int64 LargeObjectAllocator::numBytesCached() const
+{
+    return d_numBytesCached.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 LargeObjectAllocator::numBytesMapped() const
+{
+    return d_numBytesMapped.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
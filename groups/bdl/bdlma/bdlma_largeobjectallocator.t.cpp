@@ -0,0 +1,1135 @@
+// bdlma_largeobjectallocator.t.cpp                                   -*-C++-*-
+#include <bdlma_largeobjectallocator.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_multipool.h>
+#include <bdlma_sequentialpool.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::LargeObjectAllocator' supplies each block of at least
+// 'minMappedSize' bytes from a memory mapping of its own, caches deallocated
+// mappings for reuse, and forwards smaller requests to a backing allocator.
+// The primary concerns are that each request is served by the right source;
+// that mapped blocks are writable, aligned, and (on Linux, for huge mappings)
+// aligned on a huge-page boundary; that deallocated mappings are reused by
+// allocations of similar sizes, within the bounds on the number and total
+// size of the cached mappings, the least recently cached being unmapped
+// first; that 'tryExpand' and 'reallocate' grow blocks preserving their
+// contents; and that the allocator works as the upstream allocator of the
+// 'bdlma' pools and of growing containers.  A 'bslma::TestAllocator' is used
+// as the backing allocator throughout, to observe the calls to it, and
+// 'numBytesMapped' is used to observe the mappings.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] LargeObjectAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] LargeObjectAllocator(size_type, Int64, Allocator *ba = 0);
+// [ 2] ~LargeObjectAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 6] void *reallocate(void *, size_type oldSize, size_type newSize);
+// [ 4] void release();
+// [ 5] bool tryExpand(void *, size_type oldSize, size_type newSize);
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 maxCachedBytes() const;
+// [ 2] size_type minMappedSize() const;
+// [ 4] bsls::Types::Int64 numBytesCached() const;
+// [ 3] bsls::Types::Int64 numBytesMapped() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 4] CONCERN: Deallocated mappings are cached within bounds.
+// [ 7] CONCERN: The allocator can be the upstream allocator of pools.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::LargeObjectAllocator Obj;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum {
+    k_MAX_ALIGN  = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+    k_HUGE_PAGE  = Obj::k_HUGE_PAGE_SIZE,
+    k_MAX_CACHED = Obj::k_MAX_CACHED_MAPPINGS,
+    k_MIN_MAPPED = 64 * 1024   // 'minMappedSize' used by most tests
+};
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void fill(void *address, Int64 size, char seed)
+    // Write the specified 'size' bytes at the specified 'address' with a
+    // pattern determined by the specified 'seed'.
+{
+    char *p = static_cast<char *>(address);
+
+    for (Int64 i = 0; i < size; ++i) {
+        p[i] = static_cast<char>(seed + i % 251);
+    }
+}
+
+static
+bool verify(const void *address, Int64 size, char seed)
+    // Return 'true' if the specified 'size' bytes at the specified 'address'
+    // hold the pattern written by 'fill' for the specified 'seed', and
+    // 'false' otherwise.
+{
+    const char *p = static_cast<const char *>(address);
+
+    for (Int64 i = 0; i < size; ++i) {
+        if (static_cast<char>(seed + i % 251) != p[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying the Large Blocks of a Multipool
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service builds, for each request, a large lookup table using
+// a 'bdlma::Multipool', whose small blocks are pooled, but whose large blocks
+// (here, the table itself) are obtained from its upstream allocator.
+//
+// First, we create a large object allocator mapping each block of at least 1
+// MB, and use it as the upstream allocator of the multipool:
+//..
+    bdlma::LargeObjectAllocator largeObjectAllocator(1024 * 1024,
+                                                     64 * 1024 * 1024);
+    bdlma::Multipool            multipool(&largeObjectAllocator);
+//..
+// Then, we allocate the table, which, being larger than the largest pooled
+// block, is mapped directly from the operating system:
+//..
+    const int   k_TABLE_SIZE = 4 * 1024 * 1024;
+
+    char *table = static_cast<char *>(multipool.allocate(k_TABLE_SIZE));
+
+    ASSERT(k_TABLE_SIZE <= largeObjectAllocator.numBytesMapped());
+    ASSERT(0            == largeObjectAllocator.numBytesCached());
+//..
+// Next, we fill the table, and deallocate it when we are done, upon which the
+// mapping is cached rather than unmapped:
+//..
+    for (int i = 0; i < k_TABLE_SIZE; ++i) {
+        table[i] = static_cast<char>(i);
+    }
+
+    multipool.deallocate(table);
+
+    ASSERT(k_TABLE_SIZE <= largeObjectAllocator.numBytesCached());
+//..
+// Finally, we allocate the table of the next request, which reuses the cached
+// mapping:
+//..
+    table = static_cast<char *>(multipool.allocate(k_TABLE_SIZE));
+
+    ASSERT(0 == largeObjectAllocator.numBytesCached());
+
+    multipool.deallocate(table);
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: THE ALLOCATOR CAN BE THE UPSTREAM ALLOCATOR OF POOLS
+        //
+        // Concerns:
+        //: 1 A 'bdlma::Multipool' obtains its large blocks from mappings, and
+        //:   the chunks replenishing its pools from the backing allocator.
+        //:
+        //: 2 A 'bdlma::SequentialPool' obtains its large buffers from
+        //:   mappings, which are cached when the pool is released, and reused
+        //:   when it grows again.
+        //:
+        //: 3 A 'bsl::vector' using the allocator grows to many megabytes
+        //:   preserving its elements.
+        //
+        // Plan:
+        //: 1 Allocate small and large blocks from a multipool using the
+        //:   allocator, and verify the source of the memory.  (C-1)
+        //:
+        //: 2 Grow a sequential pool past 'minMappedSize', release it, grow it
+        //:   again, and verify that the mappings are reused.  (C-2)
+        //:
+        //: 3 Append 'int' values to a vector using the allocator, and verify
+        //:   its elements.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: The allocator can be the upstream allocator of pools.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: UPSTREAM ALLOCATOR OF POOLS" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'bdlma::Multipool'." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 24, &ta);  const Obj& X = mX;
+            {
+                bdlma::Multipool pool(&mX);
+
+                void *small = pool.allocate(100);
+                ASSERT(0 < ta.numBlocksInUse());
+                ASSERT(0 == X.numBytesMapped());
+
+                void *large = pool.allocate(1 << 20);
+                ASSERT((1 << 20) <= X.numBytesMapped());
+                ASSERT(0         == X.numBytesCached());
+
+                fill(large, 1 << 20, 'm');
+                ASSERT(verify(large, 1 << 20, 'm'));
+
+                pool.deallocate(large);
+                pool.deallocate(small);
+
+                ASSERT((1 << 20) <= X.numBytesCached());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'bdlma::SequentialPool'." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 26, &ta);  const Obj& X = mX;
+
+            bdlma::SequentialPool pool(&mX);
+
+            for (int i = 0; i < 1000; ++i) {
+                fill(pool.allocate(1000), 1000, static_cast<char>(i));
+            }
+
+            const Int64 MAPPED = X.numBytesMapped();
+            ASSERT(0 < MAPPED);
+            ASSERT(0 == X.numBytesCached());
+
+            pool.release();
+
+            ASSERTV(MAPPED, X.numBytesCached(), 0 < X.numBytesCached());
+            ASSERTV(MAPPED, X.numBytesMapped(), MAPPED == X.numBytesMapped());
+
+            for (int i = 0; i < 1000; ++i) {
+                fill(pool.allocate(1000), 1000, static_cast<char>(i));
+            }
+
+            ASSERTV(MAPPED, X.numBytesMapped(), MAPPED >= X.numBytesMapped());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'bsl::vector'." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 26, &ta);  const Obj& X = mX;
+            {
+                bsl::vector<int> v(&mX);
+
+                for (int i = 0; i < 1000000; ++i) {
+                    v.push_back(i);
+                }
+
+                ASSERT(4000000 <= X.numBytesMapped());
+
+                for (int i = 0; i < 1000000; ++i) {
+                    LOOP_ASSERT(i, i == v[i]);
+                    if (i != v[i]) break;
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'reallocate'
+        //
+        // Concerns:
+        //: 1 'reallocate' of a null address allocates, and 'reallocate' to a
+        //:   size of 0 deallocates.
+        //:
+        //: 2 Shrinking a block returns the same block.
+        //:
+        //: 3 Growing a block preserves its contents, whether the block is
+        //:   mapped or supplied by the backing allocator, and whether or not
+        //:   the new size requires a mapping.
+        //:
+        //: 4 The previous block is deallocated if it is not returned.
+        //
+        // Plan:
+        //: 1 Call 'reallocate' with a null address, and with a size of 0.
+        //:   (C-1)
+        //:
+        //: 2 For a table of original and new sizes, fill a block of the
+        //:   original size, reallocate it, and verify its contents and the
+        //:   memory held by the allocator and the backing allocator.  (C-2..4)
+        //
+        // Testing:
+        //   void *reallocate(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reallocate'" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting null address and zero size." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+            void *p = mX.reallocate(0, 0, 100);
+            ASSERT(p);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            ASSERT(0 == mX.reallocate(p, 100, 0));
+            ASSERT(0 == ta.numBlocksInUse());
+
+            p = mX.reallocate(0, 0, k_MIN_MAPPED);
+            ASSERT(p);
+            ASSERT(0 < X.numBytesMapped());
+
+            ASSERT(0 == mX.reallocate(p, k_MIN_MAPPED, 0));
+            ASSERT(0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting growth and shrinkage." << endl;
+        {
+            static const struct {
+                int   d_line;
+                Int64 d_originalSize;
+                Int64 d_newSize;
+            } DATA[] = {
+                //LINE  ORIGINAL                 NEW
+                //----  -----------------------  -----------------------
+                { L_,                       100,                      50 },
+                { L_,                       100,                    1000 },
+                { L_,                       100,            k_MIN_MAPPED },
+                { L_,              k_MIN_MAPPED,                     100 },
+                { L_,              k_MIN_MAPPED,        k_MIN_MAPPED + 1 },
+                { L_,              k_MIN_MAPPED,        4 * k_MIN_MAPPED },
+                { L_,              k_MIN_MAPPED,             k_HUGE_PAGE },
+                { L_,               k_HUGE_PAGE,         3 * k_HUGE_PAGE },
+                { L_,           3 * k_HUGE_PAGE,             k_HUGE_PAGE },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const Int64 ORIGINAL = DATA[ti].d_originalSize;
+                const Int64 NEW      = DATA[ti].d_newSize;
+                const Int64 KEPT     = ORIGINAL < NEW ? ORIGINAL : NEW;
+
+                Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+                void *p = mX.allocate(ORIGINAL);
+                fill(p, ORIGINAL, 'r');
+
+                void *q = mX.reallocate(p, ORIGINAL, NEW);
+
+                ASSERTV(LINE, q);
+                ASSERTV(LINE, 0 == UintPtr(q) % k_MAX_ALIGN);
+                ASSERTV(LINE, verify(q, KEPT, 'r'));
+
+                if (NEW <= ORIGINAL) {
+                    ASSERTV(LINE, p == q);
+                }
+
+                fill(q, NEW, 's');
+
+                // A block that is shrunk stays where it is.
+
+                const bool MAPPED = NEW <= ORIGINAL ? k_MIN_MAPPED <= ORIGINAL
+                                                    : k_MIN_MAPPED <= NEW;
+
+                ASSERTV(LINE, ta.numBlocksInUse(),
+                        !MAPPED == ta.numBlocksInUse());
+                ASSERTV(LINE, X.numBytesMapped(),
+                        MAPPED == (NEW <= X.numBytesMapped()));
+
+                mX.deallocate(q);
+
+                ASSERTV(LINE, 0 == ta.numBlocksInUse());
+                ASSERTV(LINE, 0 == X.numBytesMapped());
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'tryExpand'
+        //
+        // Concerns:
+        //: 1 A mapped block can be expanded in place into the slack at the end
+        //:   of its mapping.
+        //:
+        //: 2 A mapped block expanded beyond its mapping either succeeds, in
+        //:   which case its mapping (and 'numBytesMapped') grows and the new
+        //:   size is writable, or fails with no effect.
+        //:
+        //: 3 A block supplied by the backing allocator is expanded if, and
+        //:   only if, the backing allocator expands it.
+        //:
+        //: 4 An expanded block is deallocated (and cached) correctly.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate a mapped block whose size is not a multiple of the page
+        //:   size, and expand it to the end of its page.  (C-1)
+        //:
+        //: 2 Expand mapped blocks by one page, and by many, and verify the
+        //:   result.  (C-2, 4)
+        //:
+        //: 3 Expand blocks supplied by a 'bslma::TestAllocator' (which never
+        //:   expands) and by a 'bdlma::BufferedSequentialAllocator' (which
+        //:   expands its most recently allocated block).  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   bool tryExpand(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'tryExpand'" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting expansion into slack." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(k_MIN_MAPPED + 1);
+
+            const Int64 MAPPED = X.numBytesMapped();
+            const Int64 SLACK  = MAPPED - k_MIN_MAPPED - 1;
+            ASSERTV(MAPPED, 0 < SLACK);
+
+            ASSERT(mX.tryExpand(p, k_MIN_MAPPED + 1, k_MIN_MAPPED + 1));
+            ASSERT(mX.tryExpand(p,
+                                k_MIN_MAPPED + 1,
+                                k_MIN_MAPPED + 1 + SLACK));
+            ASSERT(MAPPED == X.numBytesMapped());
+
+            fill(p, k_MIN_MAPPED + 1 + SLACK, 'x');
+            ASSERT(verify(p, k_MIN_MAPPED + 1 + SLACK, 'x'));
+
+            mX.deallocate(p);
+            ASSERT(0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting expansion of the mapping." << endl;
+        {
+            static const Int64 GROWTH[] = {
+                1, 4096, k_MIN_MAPPED, k_HUGE_PAGE, 8 * k_HUGE_PAGE
+            };
+            const int NUM_GROWTH = sizeof GROWTH / sizeof *GROWTH;
+
+            for (int ti = 0; ti < NUM_GROWTH; ++ti) {
+                Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+                void *p = mX.allocate(k_HUGE_PAGE);
+                fill(p, k_HUGE_PAGE, 'e');
+
+                const Int64 MAPPED = X.numBytesMapped();
+                const Int64 NEW    = MAPPED + GROWTH[ti];
+
+                const bool  RESULT = mX.tryExpand(p, k_HUGE_PAGE, NEW);
+
+                if (veryVerbose) { T_ P_(GROWTH[ti]) P(RESULT) }
+
+                if (RESULT) {
+                    ASSERTV(ti, NEW <= X.numBytesMapped());
+                    fill(static_cast<char *>(p) + k_HUGE_PAGE,
+                         NEW - k_HUGE_PAGE,
+                         'f');
+                }
+                else {
+                    ASSERTV(ti, MAPPED == X.numBytesMapped());
+                }
+                ASSERTV(ti, verify(p, k_HUGE_PAGE, 'e'));
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                // The pages following a fresh mapping are usually free, so an
+                // expansion by a single page is expected to succeed.
+
+                if (0 == ti) {
+                    ASSERTV(ti, RESULT);
+                }
+#endif
+
+                mX.deallocate(p);
+                ASSERTV(ti, X.numBytesMapped(),
+                        X.numBytesMapped() == X.numBytesCached());
+            }
+        }
+
+        if (verbose) cout << "\nTesting blocks of the backing allocator."
+                          << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 0, &ta);
+
+            void *p = mX.allocate(100);
+            ASSERT(!mX.tryExpand(p, 100, 200));
+            mX.deallocate(p);
+
+            char                               buffer[1024];
+            bdlma::BufferedSequentialAllocator bufferAllocator(buffer,
+                                                               sizeof buffer,
+                                                               &ta);
+            Obj mY(k_MIN_MAPPED, 0, &bufferAllocator);
+
+            void *q = mY.allocate(100);
+            void *r = mY.allocate(100);
+
+            ASSERT(!mY.tryExpand(q, 100, 200));
+            ASSERT( mY.tryExpand(r, 100, 200));
+
+            fill(r, 200, 'b');
+            ASSERT(verify(r, 200, 'b'));
+
+            mY.deallocate(r);
+            mY.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(k_MIN_MAPPED, 0, &ta);
+
+            void *p = mX.allocate(k_MIN_MAPPED);
+
+            ASSERT_PASS(mX.tryExpand(p, 1, 1));
+            ASSERT_FAIL(mX.tryExpand(0, 1, 1));
+            ASSERT_FAIL(mX.tryExpand(p, 0, 1));
+            ASSERT_FAIL(mX.tryExpand(p, 2, 1));
+
+            mX.deallocate(p);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: DEALLOCATED MAPPINGS ARE CACHED WITHIN BOUNDS
+        //
+        // Concerns:
+        //: 1 A deallocated mapping is cached, and reused by an allocation
+        //:   requiring a mapping of at least half its size, the smallest
+        //:   suitable cached mapping being chosen.
+        //:
+        //: 2 At most 'k_MAX_CACHED_MAPPINGS' mappings are cached, and their
+        //:   total size does not exceed 'maxCachedBytes', the least recently
+        //:   cached mappings being unmapped to make room.
+        //:
+        //: 3 A mapping larger than 'maxCachedBytes' is unmapped.
+        //:
+        //: 4 'release' (and the destructor) unmaps every cached mapping, but
+        //:   does not affect the blocks in use.
+        //
+        // Plan:
+        //: 1 Deallocate mappings of various sizes, and verify which mapping
+        //:   (if any) subsequent allocations reuse.  (C-1)
+        //:
+        //: 2 Deallocate more mappings than fit in the cache, by number and by
+        //:   size, and verify 'numBytesCached', 'numBytesMapped', and which
+        //:   mappings remain cached.  (C-2..3)
+        //:
+        //: 3 Call 'release' with blocks both cached and in use.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   bsls::Types::Int64 numBytesCached() const;
+        //   CONCERN: Deallocated mappings are cached within bounds.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: MAPPINGS ARE CACHED" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        const Int64 SIZE = 4 * k_MIN_MAPPED;
+
+        if (verbose) cout << "\nTesting reuse." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 26, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(SIZE);
+            void *q = mX.allocate(2 * SIZE);
+
+            const Int64 MAPPED = X.numBytesMapped();
+
+            mX.deallocate(q);
+            mX.deallocate(p);
+            ASSERT(MAPPED == X.numBytesCached());
+
+            // Too small for either mapping to be reused.
+
+            void *r = mX.allocate(SIZE / 4);
+            ASSERT(r != p);
+            ASSERT(r != q);
+            ASSERT(MAPPED == X.numBytesCached());
+            mX.deallocate(r);
+            mX.release();
+            ASSERT(0 == X.numBytesMapped());
+
+            p = mX.allocate(SIZE);
+            q = mX.allocate(2 * SIZE);
+            mX.deallocate(q);
+            mX.deallocate(p);
+
+            // The smallest suitable mapping is reused.
+
+            ASSERT(p == mX.allocate(SIZE - 1));
+            ASSERT(q == mX.allocate(SIZE + 1));
+            ASSERT(0 == X.numBytesCached());
+            ASSERT(MAPPED == X.numBytesMapped());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+
+        if (verbose) cout << "\nTesting the bound on the number." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 30, &ta);  const Obj& X = mX;
+
+            void *blocks[k_MAX_CACHED + 4];
+
+            for (int i = 0; i < k_MAX_CACHED + 4; ++i) {
+                blocks[i] = mX.allocate(SIZE);
+            }
+            const Int64 MAPPED = X.numBytesMapped();
+            const Int64 EACH   = MAPPED / (k_MAX_CACHED + 4);
+
+            for (int i = 0; i < k_MAX_CACHED + 4; ++i) {
+                mX.deallocate(blocks[i]);
+
+                const Int64 NUM_CACHED = i < k_MAX_CACHED ? i + 1
+                                                          : k_MAX_CACHED;
+
+                ASSERTV(i, NUM_CACHED * EACH == X.numBytesCached());
+            }
+            ASSERT(k_MAX_CACHED * EACH == X.numBytesMapped());
+
+            // The mappings cached last remain cached (in some order).
+
+            for (int i = 0; i < k_MAX_CACHED; ++i) {
+                void *p = mX.allocate(SIZE);
+
+                bool found = false;
+                for (int j = 4; j < k_MAX_CACHED + 4; ++j) {
+                    found = found || p == blocks[j];
+                }
+                ASSERTV(i, found);
+            }
+            ASSERT(0 == X.numBytesCached());
+
+            for (int i = 4; i < k_MAX_CACHED + 4; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting the bound on the size." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 3 * SIZE, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(SIZE);
+            void *q = mX.allocate(SIZE);
+            void *r = mX.allocate(SIZE);
+            void *s = mX.allocate(4 * SIZE);
+
+            ASSERT(7 * SIZE == X.numBytesMapped());
+
+            mX.deallocate(s);      // too large to be cached
+            ASSERT(0        == X.numBytesCached());
+            ASSERT(3 * SIZE == X.numBytesMapped());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            mX.deallocate(r);
+            ASSERT(3 * SIZE == X.numBytesCached());
+
+            s = mX.allocate(2 * SIZE);
+            ASSERT(3 * SIZE == X.numBytesCached());
+            ASSERT(5 * SIZE == X.numBytesMapped());
+
+            mX.deallocate(s);      // evicts 'p' and 'q'
+            ASSERT(3 * SIZE == X.numBytesCached());
+            ASSERT(3 * SIZE == X.numBytesMapped());
+
+            ASSERT(r == mX.allocate(SIZE));
+            mX.deallocate(r);
+        }
+
+        if (verbose) cout << "\nTesting 'release'." << endl;
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 26, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(SIZE);
+            void *q = mX.allocate(SIZE);
+            void *r = mX.allocate(100);
+
+            mX.deallocate(q);
+            ASSERT(0 < X.numBytesCached());
+
+            mX.release();
+            ASSERT(0 == X.numBytesCached());
+            ASSERT(0 <  X.numBytesMapped());
+            ASSERT(1 == ta.numBlocksInUse());
+
+            fill(p, SIZE, 'p');
+            ASSERT(verify(p, SIZE, 'p'));
+
+            mX.deallocate(p);
+            mX.deallocate(r);
+            ASSERT(0 < X.numBytesCached());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, writable blocks of at least
+        //:   the requested size.
+        //:
+        //: 2 Blocks smaller than 'minMappedSize' are supplied by, and returned
+        //:   to, the backing allocator, with no overhead; larger blocks are
+        //:   mapped.
+        //:
+        //: 3 'numBytesMapped' is the total size of the mappings, which are
+        //:   the requested sizes rounded up to a multiple of the page size.
+        //:
+        //: 4 A mapped block is the start of its mapping, and so is aligned on
+        //:   a page boundary and, on Linux, for mappings of at least
+        //:   'k_HUGE_PAGE_SIZE' bytes, on a 'k_HUGE_PAGE_SIZE' boundary.
+        //:
+        //: 5 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //:
+        //: 6 Any number of mappings can be in use at once, and deallocated in
+        //:   any order.
+        //
+        // Plan:
+        //: 1 For a set of sizes around 'minMappedSize' and
+        //:   'k_HUGE_PAGE_SIZE', allocate a block, write every byte, and
+        //:   verify its alignment and source, and the value of
+        //:   'numBytesMapped', then deallocate it.  (C-1..4)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)'.  (C-5)
+        //:
+        //: 3 Allocate several hundred mapped blocks, and deallocate them in a
+        //:   scrambled order, verifying 'numBytesMapped' after each call.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        static const Int64 SIZES[] = {
+            1,
+            k_MAX_ALIGN,
+            k_MIN_MAPPED - 1,
+            k_MIN_MAPPED,
+            k_MIN_MAPPED + 1,
+            k_MIN_MAPPED + 4096 - 1,
+            k_MIN_MAPPED + 4096,
+            k_HUGE_PAGE - 1,
+            k_HUGE_PAGE,
+            3 * k_HUGE_PAGE + 1
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const Int64 SIZE   = SIZES[ti];
+            const bool  MAPPED = k_MIN_MAPPED <= SIZE;
+
+            Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+            char *p = static_cast<char *>(mX.allocate(SIZE));
+
+            ASSERTV(ti, p);
+            ASSERTV(ti, 0 == UintPtr(p) % k_MAX_ALIGN);
+
+            fill(p, SIZE, 'a');
+            ASSERTV(ti, verify(p, SIZE, 'a'));
+
+            if (MAPPED) {
+                const Int64 MAPPING = X.numBytesMapped();
+
+                ASSERTV(ti, 0 == ta.numBlocksInUse());
+                ASSERTV(ti, MAPPING, SIZE <= MAPPING);
+                ASSERTV(ti, MAPPING, 0 == MAPPING % 4096);
+                ASSERTV(ti, MAPPING, MAPPING < SIZE + 65536);
+                ASSERTV(ti, 0 == UintPtr(p) % 4096);
+
+                // A size that is a multiple of any page size is mapped
+                // exactly.
+
+                if (0 == SIZE % 65536) {
+                    ASSERTV(ti, MAPPING, SIZE == MAPPING);
+                }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                if (k_HUGE_PAGE <= MAPPING) {
+                    ASSERTV(ti, 0 == UintPtr(p) % k_HUGE_PAGE);
+                }
+#endif
+            }
+            else {
+                ASSERTV(ti, 1    == ta.numBlocksInUse());
+                ASSERTV(ti, SIZE == ta.numBytesInUse());
+                ASSERTV(ti, 0    == X.numBytesMapped());
+            }
+
+            mX.deallocate(p);
+
+            ASSERTV(ti, 0 == ta.numBlocksInUse());
+            ASSERTV(ti, 0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting 'allocate(0)' and 'deallocate(0)'."
+                          << endl;
+        {
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting many mappings in use." << endl;
+        {
+            enum { k_NUM_BLOCKS = 600 };
+
+            Obj mX(k_MIN_MAPPED, 0, &ta);  const Obj& X = mX;
+
+            void *blocks[k_NUM_BLOCKS];
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(k_MIN_MAPPED);
+                ASSERTV(i, (i + 1) * Int64(k_MIN_MAPPED)
+                                                       == X.numBytesMapped());
+            }
+
+            // Deallocate the blocks in the order 0, 7, 14, ..., which visits
+            // every index once since 7 and 'k_NUM_BLOCKS' are coprime.
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i * 7 % k_NUM_BLOCKS]);
+                ASSERTV(i, (k_NUM_BLOCKS - i - 1) * Int64(k_MIN_MAPPED)
+                                                       == X.numBytesMapped());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, DTOR, AND ATTRIBUTES
+        //
+        // Concerns:
+        //: 1 A default-constructed allocator uses the default allocator, and
+        //:   the default minimum mapped size and bound on cached bytes.
+        //:
+        //: 2 The attributes and allocator supplied at construction are used.
+        //:
+        //: 3 The destructor unmaps all cached mappings.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct allocators with and without each argument, allocate
+        //:   and deallocate a small and a large block, and verify which
+        //:   allocator supplied the small block, and the value of each
+        //:   attribute.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid attributes.  (C-4)
+        //
+        // Testing:
+        //   LargeObjectAllocator(bslma::Allocator *basicAllocator = 0);
+        //   LargeObjectAllocator(size_type, Int64, Allocator *ba = 0);
+        //   ~LargeObjectAllocator();
+        //   bsls::Types::Int64 maxCachedBytes() const;
+        //   size_type minMappedSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, DTOR, AND ATTRIBUTES" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+            Obj *objPtr = 0;
+            bslma::TestAllocator *backing = &ta;
+
+            switch (cfg) {
+              case 'a': {
+                objPtr  = new (globalAllocator) Obj();
+                backing = &da;
+              } break;
+              case 'b': {
+                objPtr = new (globalAllocator) Obj(&ta);
+              } break;
+              case 'c': {
+                objPtr = new (globalAllocator) Obj(k_MIN_MAPPED, 1 << 24, &ta);
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            const Int64 EXP_MIN = cfg <= 'b'
+                                ? Int64(Obj::k_DEFAULT_MIN_MAPPED_SIZE)
+                                : Int64(k_MIN_MAPPED);
+            const Int64 EXP_MAX = cfg <= 'b'
+                                ? Int64(Obj::k_DEFAULT_MAX_CACHED_BYTES)
+                                : 1 << 24;
+
+            ASSERTV(cfg, EXP_MIN == Int64(X.minMappedSize()));
+            ASSERTV(cfg, EXP_MAX == X.maxCachedBytes());
+            ASSERTV(cfg, 0       == X.numBytesCached());
+            ASSERTV(cfg, 0       == X.numBytesMapped());
+
+            void *p = mX.allocate(EXP_MIN - 1);
+            ASSERTV(cfg, 1 == backing->numBlocksInUse());
+            mX.deallocate(p);
+            ASSERTV(cfg, 0 == backing->numBlocksInUse());
+
+            mX.deallocate(mX.allocate(EXP_MIN));
+            ASSERTV(cfg, 0 < X.numBytesCached());
+            ASSERTV(cfg, X.numBytesCached() == X.numBytesMapped());
+
+            globalAllocator.deleteObject(objPtr);
+
+            ASSERTV(cfg, 0 == da.numBlocksInUse());
+            ASSERTV(cfg, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, 0, &ta));
+            ASSERT_FAIL(Obj(0, 0, &ta));
+            ASSERT_FAIL(Obj(1, -1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate small and large blocks, and verify that
+        //:   small blocks come from the backing allocator, and that large
+        //:   blocks are mapped and reused.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("backing", veryVeryVerbose);
+        {
+            Obj mX(k_MIN_MAPPED, 1 << 24, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(100);
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT(0 == X.numBytesMapped());
+
+            void *q = mX.allocate(1 << 20);
+            ASSERT(1 == ta.numBlocksInUse());
+            ASSERT((1 << 20) == X.numBytesMapped());
+
+            fill(q, 1 << 20, 'q');
+            ASSERT(verify(q, 1 << 20, 'q'));
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(X.numBytesMapped() == X.numBytesCached());
+
+            ASSERT(q == mX.allocate(1 << 20));
+            ASSERT(0 == X.numBytesCached());
+
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -6,10 +6,13 @@ BSLS_IDENT_RCSID(bdlma_multipool_cpp,"$Id$ $CSID$")
 
 #include <bdlma_bufferedsequentialallocator.h>  // for testing only
 
+#include <bslma_autodeallocator.h>
 #include <bslma_autodestructor.h>
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -25,7 +28,12 @@ enum {
 
     DEFAULT_MAX_CHUNK_SIZE = 32,  // default maximum number of blocks per chunk
 
-    MIN_BLOCK_SIZE         =  8   // minimum block size (in bytes)
+    MIN_BLOCK_SIZE         =  8,  // minimum block size (in bytes)
+
+    MIN_ALIGNMENT          = bsls::AlignmentFromType<void *>::VALUE
+                                  // alignment guaranteed for every block;
+                                  // pooled blocks are laid out at multiples
+                                  // of the 'bdlma::Pool' link alignment
 };
 
                       // ---------------
@@ -33,6 +41,50 @@ enum {
                       // ---------------
 
 // PRIVATE MANIPULATORS
+Pool *Multipool::createHintPools(int hint)
+{
+    BSLS_ASSERT(1 <= hint);
+    BSLS_ASSERT(hint < k_MAX_NUM_HINTS);
+    BSLS_ASSERT(!d_hintPools_p[hint]);
+
+    Pool *pools = static_cast<Pool *>(
+                          d_allocator_p->allocate(d_numPools * sizeof *pools));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                                pools,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Pool> autoDtor(pools, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (pools + i) Pool(d_pools_p[i].blockSize(),
+                             d_pools_p[i].growthStrategy(),
+                             d_pools_p[i].maxBlocksPerChunk(),
+                             d_allocator_p);
+    }
+
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+
+    d_hintPools_p[hint] = pools;
+    return pools;
+}
+
+Pool& Multipool::poolForIndex(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_MAX_NUM_HINTS * d_numPools);
+
+    const int hint = index / d_numPools;
+
+    if (0 == hint) {
+        return d_pools_p[index];                                      // RETURN
+    }
+
+    BSLS_ASSERT(d_hintPools_p[hint]);
+
+    return d_hintPools_p[hint][index - hint * d_numPools];
+}
+
 void Multipool::initialize(bsls::BlockGrowth::Strategy growthStrategy,
                            int                         maxBlocksPerChunk)
 {
@@ -40,6 +92,10 @@ void Multipool::initialize(bsls::BlockGrowth::Strategy growthStrategy,
 
     d_maxBlockSize = MIN_BLOCK_SIZE;
 
+    for (int i = 0; i < k_MAX_NUM_HINTS; ++i) {
+        d_hintPools_p[i] = 0;
+    }
+
     d_pools_p = static_cast<Pool *>(
                       d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
 
@@ -73,6 +129,10 @@ void Multipool::initialize(
 
     d_maxBlockSize = MIN_BLOCK_SIZE;
 
+    for (int i = 0; i < k_MAX_NUM_HINTS; ++i) {
+        d_hintPools_p[i] = 0;
+    }
+
     d_pools_p = static_cast<Pool *>(
                       d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
 
@@ -104,6 +164,10 @@ void Multipool::initialize(bsls::BlockGrowth::Strategy  growthStrategy,
 
     d_maxBlockSize = MIN_BLOCK_SIZE;
 
+    for (int i = 0; i < k_MAX_NUM_HINTS; ++i) {
+        d_hintPools_p[i] = 0;
+    }
+
     d_pools_p = static_cast<Pool *>(
                       d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
 
@@ -137,6 +201,10 @@ void Multipool::initialize(
 
     d_maxBlockSize = MIN_BLOCK_SIZE;
 
+    for (int i = 0; i < k_MAX_NUM_HINTS; ++i) {
+        d_hintPools_p[i] = 0;
+    }
+
     d_pools_p = static_cast<Pool *>(
                       d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
 
@@ -320,14 +388,152 @@ Multipool::~Multipool()
         d_pools_p[i].~Pool();
     }
     d_allocator_p->deallocate(d_pools_p);
+
+    for (int hint = 1; hint < k_MAX_NUM_HINTS; ++hint) {
+        Pool *pools = d_hintPools_p[hint];
+        if (pools) {
+            for (int i = 0; i < d_numPools; ++i) {
+                pools[i].~Pool();
+            }
+            d_allocator_p->deallocate(pools);
+        }
+    }
 }
 
 // MANIPULATORS
+void *Multipool::allocate(int size, int alignment)
+{
+    BSLS_ASSERT(1 <= size);
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+
+    if (alignment <= MIN_ALIGNMENT) {
+        return allocate(size);                                        // RETURN
+    }
+
+    // Every block is at least 'MIN_ALIGNMENT'-aligned, so at most
+    // 'alignment - MIN_ALIGNMENT' bytes are skipped to reach an aligned
+    // address.
+
+    char      *address = static_cast<char *>(
+                                  allocate(size + alignment - MIN_ALIGNMENT));
+    const int  offset  = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                                    address,
+                                                                    alignment);
+
+    if (0 != offset) {
+        // Record the offset in the header position preceding the aligned
+        // address.  Since 'MIN_ALIGNMENT <= offset', this does not overlap
+        // the pool index stored in the header of the original block.
+
+        Header *h = reinterpret_cast<Header *>(address + offset) - 1;
+        h->d_header.d_poolIdx = -1 - offset;
+    }
+
+    return address + offset;
+}
+
+void Multipool::allocateBatch(void **blocks, int numBlocks, int size)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(1 <= size);
+
+    if (size <= d_maxBlockSize) {
+        const int pool = findPool(size);
+
+        d_pools_p[pool].allocateBatch(blocks, numBlocks);
+
+        for (int i = 0; i < numBlocks; ++i) {
+            Header *p = static_cast<Header *>(blocks[i]);
+            p->d_header.d_poolIdx = pool;
+            blocks[i] = p + 1;
+        }
+        return;                                                       // RETURN
+    }
+
+    // The requested size is large and will not be pooled.
+
+    bslma::AutoDeallocator<Multipool> autoDeallocator(blocks, this);
+
+    for (int i = 0; i < numBlocks; ++i, ++autoDeallocator) {
+        blocks[i] = allocate(size);
+    }
+
+    autoDeallocator.release();
+}
+
+void Multipool::deallocateBatch(void *const *blocks, int numBlocks)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(0 <= numBlocks);
+
+    for (int i = 0; i < numBlocks; ++i) {
+        deallocate(blocks[i]);
+    }
+}
+
+void Multipool::deallocateBatch(void *const *blocks, int numBlocks, int size)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(1 <= size);
+
+    // The pool selected by 'size' is used only for the blocks whose header
+    // records it as their owner; any other block (e.g., one allocated by the
+    // aligned 'allocate', or with a nonzero hint) is returned to the owner
+    // recorded in its header.
+
+    if (size <= d_maxBlockSize) {
+        const int  index = findPool(size);
+        Pool&      pool  = d_pools_p[index];
+
+        for (int i = 0; i < numBlocks; ++i) {
+            BSLS_ASSERT_SAFE(blocks[i]);
+
+            Header *h = static_cast<Header *>(blocks[i]) - 1;
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                         index == h->d_header.d_poolIdx)) {
+                pool.deallocate(h);
+            }
+            else {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                deallocate(blocks[i]);
+            }
+        }
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < numBlocks; ++i) {
+        BSLS_ASSERT_SAFE(blocks[i]);
+
+        Header *h = static_cast<Header *>(blocks[i]) - 1;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(-1 == h->d_header.d_poolIdx)) {
+            d_blockList.deallocate(h);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            deallocate(blocks[i]);
+        }
+    }
+}
+
 void Multipool::release()
 {
     for (int i = 0; i < d_numPools; ++i) {
         d_pools_p[i].release();
     }
+    for (int hint = 1; hint < k_MAX_NUM_HINTS; ++hint) {
+        if (d_hintPools_p[hint]) {
+            for (int i = 0; i < d_numPools; ++i) {
+                d_hintPools_p[hint][i].release();
+            }
+        }
+    }
     d_blockList.release();
 }
 
@@ -341,6 +547,81 @@ void Multipool::reserveCapacity(int size, int numBlocks)
     d_pools_p[pool].reserveCapacity(numBlocks);
 }
 
+bsls::Types::size_type Multipool::trim()
+{
+    bsls::Types::size_type numBytes = 0;
+
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].trim();
+    }
+    for (int hint = 1; hint < k_MAX_NUM_HINTS; ++hint) {
+        if (d_hintPools_p[hint]) {
+            for (int i = 0; i < d_numPools; ++i) {
+                numBytes += d_hintPools_p[hint][i].trim();
+            }
+        }
+    }
+
+    return numBytes;
+}
+
+bool Multipool::tryExpand(void *address, int originalSize, int newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(1 <= originalSize);
+    BSLS_ASSERT(originalSize <= newSize);
+
+    if (newSize > d_maxBlockSize) {
+        return false;                                                 // RETURN
+    }
+
+    // A pooled block spans the whole block size of its pool, so it can hold
+    // any size served by that pool.  Large blocks, and blocks returned by the
+    // aligned 'allocate', record a negative index and never match.  The
+    // index of a block allocated with a hint is offset by a multiple of the
+    // number of pools.
+
+    const Header *h     = static_cast<Header *>(address) - 1;
+    const int     index = h->d_header.d_poolIdx;
+
+    return 0 <= index && findPool(newSize) == index % d_numPools;
+}
+
+// ACCESSORS
+void Multipool::loadPoolStatistics(PoolStatistics *result,
+                                   int             poolIndex,
+                                   int             hint) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(     poolIndex < d_numPools);
+    BSLS_ASSERT(0 <= hint);
+    BSLS_ASSERT(     hint < k_MAX_NUM_HINTS);
+
+    const Pool *pools = 0 == hint ? d_pools_p : d_hintPools_p[hint];
+
+    if (pools) {
+        pools[poolIndex].loadStatistics(result);
+        return;                                                       // RETURN
+    }
+
+    // The set of pools of 'hint' is not created yet, and so holds no memory;
+    // it would have the block size of the corresponding default pool.  The
+    // cumulative counters are left at -1 if they are not collected.
+
+    d_pools_p[poolIndex].loadStatistics(result);
+
+    if (0 <= result->d_numAllocations) {
+        result->d_numAllocations   = 0;
+        result->d_numDeallocations = 0;
+    }
+    result->d_numBlocks        = 0;
+    result->d_numBlocksInUse   = 0;
+    result->d_freeListLength   = 0;
+    result->d_numChunks        = 0;
+    result->d_numBytesObtained = 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -96,6 +96,64 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Over-Aligned Allocation
+///-----------------------
+// The 'allocate(size, alignment)' overload returns a block whose address is a
+// multiple of an explicitly requested (power-of-two) alignment, such as a
+// 64-byte cache line.  Requests whose alignment is already guaranteed by the
+// pools are forwarded to 'allocate(size)' at no extra cost.  Otherwise, the
+// request is served from the pool (or block list) for 'size' plus the
+// alignment slack, and a small redirection record stored immediately before
+// the returned address allows 'deallocate(address)' to recover the original
+// block.
+//
+///Batch Allocation
+///----------------
+// The 'allocateBatch' method obtains a number of blocks of the same size in a
+// single call, locating the pool that serves that size once for the whole
+// batch and taking the blocks from that pool's current chunk and free list
+// together (see 'bdlma::Pool::allocateBatch').  'deallocateBatch' returns a
+// number of blocks; if the (common) size of the blocks is supplied, the pool
+// is, again, located once for the whole batch, and the header of each block
+// is read only to confirm that the block is owned by that pool.  Node-based
+// containers (e.g., 'bsl::list') use these methods, through
+// 'bdlma::MultipoolAllocator', when inserting a range of elements or when
+// being cleared.
+//
+///Statistics
+///----------
+// The 'loadPoolStatistics' method loads a snapshot of the usage of the pool at
+// a given index (see {'bdlma_pool'|Statistics}): the number of blocks held,
+// in use, and on the free list, and the number of chunks and bytes obtained
+// from the underlying allocator.  Comparing these figures across pools, and
+// over time, helps in choosing the number of pools, the maximum number of
+// blocks per chunk, and the growth strategy of a multipool for a given
+// workload.  Note that the block size reported for each pool includes the
+// per-block header of the multipool, and that blocks larger than
+// 'maxPooledBlockSize()' are not accounted for.
+//
+///Lifetime Hints
+///--------------
+// A multipool segregates blocks only by size, so blocks of the same size but
+// of very different lifetimes (e.g., the nodes of a long-lived map and the
+// buffers of short-lived temporary strings) are interleaved in the same
+// chunks, and the chunks holding the long-lived blocks end up sparsely
+// occupied once the short-lived blocks are deallocated.  The
+// 'allocateWithHint' method takes, in addition to the size, a *hint* (an
+// integer in the range '[0 .. k_MAX_NUM_HINTS)', typically identifying a
+// lifetime class or a type) and serves each nonzero hint from a separate set
+// of pools, having the same block sizes, growth strategies, and maximum
+// numbers of blocks per chunk as the default set, and created on the first
+// allocation with that hint.  Hint 0 designates the default set, which serves
+// 'allocate'.  Blocks too large to be pooled are not segregated.
+//
+// A block allocated with a nonzero hint is deallocated by 'deallocate' (or
+// 'deallocateBatch'), which reads the pool owning the block from its header.
+// The 'loadPoolStatistics' method takes an optional
+// hint to report the usage of the pools of that hint.  See
+// 'bdlma::MultipoolHintAllocator' (in 'bdlma_multipoolallocator') for
+// supplying a hint to the allocations of a container.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -479,6 +537,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_blockgrowth.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -499,6 +565,13 @@ class Multipool {
     // a 'bdlma::Multipool' release all memory currently allocated via the
     // object.
 
+  public:
+    // TYPES
+    enum {
+        k_MAX_NUM_HINTS = 8  // number of hints (and of sets of pools)
+    };
+
+  private:
     // PRIVATE TYPES
     struct Header {
         // This 'struct' provides header information for each allocated memory
@@ -507,8 +580,14 @@ class Multipool {
 
         union {
             int                    d_poolIdx;  // index to pool used for this
-                                               // memory block, or -1 if from
-                                               // 'd_blockList'
+                                               // memory block (plus
+                                               // 'hint * d_numPools' for a
+                                               // nonzero hint), -1 if from
+                                               // 'd_blockList', or, for a
+                                               // block returned by the
+                                               // aligned 'allocate', '-1'
+                                               // minus the offset (in bytes)
+                                               // from the original block
 
             bsls::AlignmentUtil::MaxAlignedType
                                    d_dummy;    // force maximum alignment
@@ -530,8 +609,27 @@ class Multipool {
 
     bslma::Allocator *d_allocator_p;   // holds (but does not own) allocator
 
+    Pool             *d_hintPools_p[k_MAX_NUM_HINTS];
+                                       // array of memory pools of each
+                                       // nonzero hint, or 0 until the first
+                                       // allocation with that hint (element
+                                       // 0 is unused)
+
   private:
     // PRIVATE MANIPULATORS
+    Pool *createHintPools(int hint);
+        // Create the set of memory pools of the specified 'hint', having the
+        // same configuration as the default set, and return the address of
+        // its first pool.  The behavior is undefined unless
+        // '1 <= hint < k_MAX_NUM_HINTS' and the set has not been created yet.
+
+    Pool& poolForIndex(int index);
+        // Return a reference providing modifiable access to the memory pool
+        // at the specified 'index' recorded in the header of a pooled block,
+        // where an index 'hint * numPools() + i' designates the pool 'i' of
+        // the set of 'hint'.  The behavior is undefined unless 'index' was
+        // recorded by this multipool.
+
     void initialize(bsls::BlockGrowth::Strategy        growthStrategy,
                     int                                maxBlocksPerChunk);
     void initialize(const bsls::BlockGrowth::Strategy *growthStrategyArray,
@@ -673,11 +771,67 @@ class Multipool {
         // this object is destroyed.  The behavior is undefined unless
         // '1 <= size'.
 
+    void *allocateWithHint(int size, int hint);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), obtained from the set
+        // of pools of the specified 'hint' (see {Lifetime Hints}), which is
+        // created if this is the first allocation with 'hint'.  If
+        // '0 == hint', or 'size > maxPooledBlockSize()', this method has the
+        // same effect as 'allocate(size)'.  The behavior is undefined unless
+        // '1 <= size' and '0 <= hint < k_MAX_NUM_HINTS'.  Note that
+        // 'deallocate' returns a block allocated with a nonzero hint to the
+        // pool of that hint, which it reads from the header preceding the
+        // block.
+
+    void *allocate(int size, int alignment);
+        // Return the address of a contiguous block of memory of (at least) the
+        // specified 'size' (in bytes) whose address is a multiple of the
+        // specified 'alignment'.  If the alignment is not already guaranteed
+        // by 'allocate(size)', the block is obtained from the pool (or the
+        // block list) serving 'size' plus at most 'alignment' bytes of
+        // alignment slack.  The behavior is undefined unless '1 <= size' and
+        // 'alignment' is a positive power of two.  Note that 'deallocate'
+        // reads the owner of the returned block from the redirection record.
+
+    void allocateBatch(void **blocks, int numBlocks, int size);
+        // Load into the specified 'blocks' array the addresses of the
+        // specified 'numBlocks' contiguous blocks of maximally-aligned memory,
+        // each of (at least) the specified 'size' (in bytes), exactly as if
+        // by 'numBlocks' calls to 'allocate(size)'.  If an exception is
+        // thrown, every block allocated by this call is deallocated before
+        // the exception propagates.  The behavior is undefined unless
+        // '0 <= numBlocks', '1 <= size', and 'blocks' refers to an array
+        // having at least 'numBlocks' elements.
+
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
         // multipool object for reuse.  The behavior is undefined unless
         // 'address' is non-zero, was allocated by this multipool object, and
-        // has not already been deallocated.
+        // has not already been deallocated.  Note that 'address' may have been
+        // returned by either overload of 'allocate'.
+
+    void deallocateBatch(void *const *blocks, int numBlocks);
+        // Relinquish the specified 'numBlocks' memory blocks whose addresses
+        // are held in the specified 'blocks' array back to this multipool
+        // object for reuse, exactly as if by calling 'deallocate(address)'
+        // for each address.  The behavior is undefined unless
+        // '0 <= numBlocks', and each address in 'blocks' is non-zero, was
+        // allocated by this multipool object, and has not already been
+        // deallocated.
+
+    void deallocateBatch(void *const *blocks, int numBlocks, int size);
+        // Relinquish the specified 'numBlocks' memory blocks whose addresses
+        // are held in the specified 'blocks' array, each having the specified
+        // 'size' (in bytes), back to this multipool object for reuse, exactly
+        // as if by calling 'deallocate(address)' for each address.  The
+        // behavior is undefined unless '0 <= numBlocks', '1 <= size', and
+        // each address in 'blocks' is non-zero, was allocated by this
+        // multipool object with a requested size of 'size', and has not
+        // already been deallocated.  Note that the pool selected by 'size'
+        // is located once for the whole batch, and any block whose header
+        // does not record that pool as its owner (e.g., one allocated by the
+        // aligned 'allocate', or with a nonzero hint) is deallocated as if by
+        // 'deallocate(address)'.
 
     template <class TYPE>
     void deleteObject(const TYPE *object);
@@ -700,7 +854,8 @@ class Multipool {
         // deallocated.
 
     void release();
-        // Relinquish all memory currently allocated via this multipool object.
+        // Relinquish all memory currently allocated via this multipool object
+        // (with any hint).
 
     void reserveCapacity(int size, int numBlocks);
         // Reserve memory from this multipool to satisfy memory requests for at
@@ -708,6 +863,29 @@ class Multipool {
         // bytes) before the pool replenishes.  The behavior is undefined
         // unless '1 <= size <= maxPooledBlockSize()' and '0 <= numBlocks'.
 
+    bsls::Types::size_type trim();
+        // Return every chunk of every internal pool (of every hint) none of
+        // whose memory blocks is currently allocated from this multipool to
+        // the underlying allocator, and return the number of bytes so
+        // released.
+        // Note that blocks larger than 'maxPooledBlockSize()' are returned
+        // to the underlying allocator as soon as they are deallocated, and
+        // are therefore unaffected.  See 'bdlma::Pool::trim'.
+
+    bool tryExpand(void *address, int originalSize, int newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' can now hold 'newSize' bytes, and
+        // 'false' with no effect otherwise.  A block can be expanded only if
+        // it was obtained from an internal pool and 'newSize' is served by
+        // that same pool (i.e., if the block size of the pool already
+        // accommodates 'newSize'); blocks larger than 'maxPooledBlockSize()'
+        // are never expanded.  The behavior is undefined unless 'address' is
+        // non-zero, was allocated by this multipool object, and has not
+        // already been deallocated, the size of the memory block at 'address'
+        // is 'originalSize', and '1 <= originalSize <= newSize'.
+
     // ACCESSORS
     int numPools() const;
         // Return the number of pools managed by this multipool object.
@@ -720,6 +898,19 @@ class Multipool {
         //..
         // where 'numPools' is either specified at construction, or an
         // implementation-defined value.
+
+    void loadPoolStatistics(PoolStatistics *result,
+                            int             poolIndex,
+                            int             hint = 0) const;
+        // Load into the specified 'result' a snapshot of the usage of the pool
+        // at the specified 'poolIndex' (see {Statistics}) in the set of pools
+        // of the optionally specified 'hint' (see {Lifetime Hints}).  If
+        // 'hint' is not specified, the default set of pools is used.  If the
+        // set of pools of 'hint' has not been created, the block size of the
+        // corresponding default pool is loaded, with no block, chunk, or
+        // byte, and no allocation or deallocation (if collected).  The
+        // behavior is undefined unless '0 <= poolIndex < numPools()' and
+        // '0 <= hint < k_MAX_NUM_HINTS'.
 };
 
 // ============================================================================
@@ -778,6 +969,30 @@ void *Multipool::allocate(int size)
     return p + 1;
 }
 
+inline
+void *Multipool::allocateWithHint(int size, int hint)
+{
+    BSLS_ASSERT(1 <= size);
+    BSLS_ASSERT(0 <= hint);
+    BSLS_ASSERT(hint < k_MAX_NUM_HINTS);
+
+    if (0 == hint || size > d_maxBlockSize) {
+        return allocate(size);                                        // RETURN
+    }
+
+    Pool *pools = d_hintPools_p[hint];
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!pools)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        pools = createHintPools(hint);
+    }
+
+    const int pool = findPool(size);
+    Header *p = static_cast<Header *>(pools[pool].allocate());
+    p->d_header.d_poolIdx = hint * d_numPools + pool;
+    return p + 1;
+}
+
 inline
 void Multipool::deallocate(void *address)
 {
@@ -785,16 +1000,31 @@ void Multipool::deallocate(void *address)
 
     Header *h = static_cast<Header *>(address) - 1;
 
-    const int pool = h->d_header.d_poolIdx;
+    int pool = h->d_header.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 > pool)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // 'address' was returned by the aligned 'allocate'; locate the header
+        // of the block from which it was carved.
+
+        h    = reinterpret_cast<Header *>(
+                             reinterpret_cast<char *>(h) - (-1 - pool));
+        pool = h->d_header.d_poolIdx;
+    }
 
     if (-1 == pool) {
         d_blockList.deallocate(h);
     }
-    else {
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(pool < d_numPools)) {
         d_pools_p[pool].deallocate(h);
     }
-}
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
+        poolForIndex(pool).deallocate(h);
+    }
+}
 
 }  // close package namespace
 }  // close enterprise namespace
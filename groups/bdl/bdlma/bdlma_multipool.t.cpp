@@ -56,16 +56,25 @@ using namespace bsl;
 // [ 7] bdlma::Multipool(numPools, *gs, *mbpc, Allocator *ba = 0);
 // [ 2] ~bdlma::Multipool();
 // [ 3] void *allocate(int size);
+// [15] void *allocateWithHint(int size, int hint);
+// [10] void *allocate(int size, int alignment);
+// [12] void allocateBatch(void **blocks, int numBlocks, int size);
 // [ 4] void deallocate(void *address);
+// [12] void deallocateBatch(void *const *blocks, int numBlocks);
+// [12] void deallocateBatch(void *const *blocks, int numBlocks, int size);
 // [ 8] template <class TYPE> void deleteObject(const TYPE *object);
 // [ 8] template <class TYPE> void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(int size, int numBlocks);
+// [11] size_type trim();
+// [14] bool tryExpand(void *address, int originalSize, int newSize);
 // [ 9] int numPools() const;
 // [ 9] int maxPooledBlockSize() const;
+// [13] void loadPoolStatistics(PoolStatistics *result, int index) const;
+// [13] void loadPoolStatistics(PoolStatistics *, int index, int hint) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -620,7 +629,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 10: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -669,6 +678,872 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocateWithHint'
+        //
+        // Concerns:
+        //: 1 Blocks allocated with distinct hints are never obtained from the
+        //:   same chunk, and a hint of 0 is equivalent to 'allocate'.
+        //:
+        //: 2 The pools of a nonzero hint are created on the first allocation
+        //:   with that hint, and are configured like the default pools.
+        //:
+        //: 3 A block allocated with a hint is returned to the pool of that
+        //:   hint by 'deallocate' and by both overloads of 'deallocateBatch',
+        //:   and is reused by the next allocation with that hint.
+        //:
+        //: 4 Blocks larger than 'maxPooledBlockSize()' are served regardless
+        //:   of the hint.
+        //:
+        //: 5 'tryExpand' operates on blocks allocated with a hint.
+        //:
+        //: 6 'release' and 'trim' return the memory of the pools of every
+        //:   hint, and the destructor releases all memory.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a multipool with a constant growth strategy of one block
+        //:   per chunk, allocate a block of each pooled size with each hint,
+        //:   and verify that the chunks (i.e., the blocks of the underlying
+        //:   allocator) are distinct, that the first allocation with a
+        //:   nonzero hint creates the pools of the hint, and that a hint of 0
+        //:   allocates no more memory than 'allocate'.  (C-1..2)
+        //:
+        //: 2 Deallocate a block allocated with a hint, and verify that the
+        //:   next allocation of the same size with the same hint returns the
+        //:   same address without allocating.  Repeat using both overloads of
+        //:   'deallocateBatch'.  (C-3)
+        //:
+        //: 3 Allocate a block larger than 'maxPooledBlockSize()' with a
+        //:   nonzero hint, and return it.  (C-4)
+        //:
+        //: 4 Expand a block allocated with a hint within, and beyond, the
+        //:   block size of its pool.  (C-5)
+        //:
+        //: 5 Invoke 'trim' and 'release', and verify the memory in use of the
+        //:   underlying allocator.  (C-6)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void *allocateWithHint(int size, int hint);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'allocateWithHint'" << endl
+                                  << "==========================" << endl;
+
+        enum { NUM_POOLS = 4, NUM_HINTS = Obj::k_MAX_NUM_HINTS };
+
+        if (verbose) cout << "\nTesting segregation." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, bsls::BlockGrowth::BSLS_CONSTANT, 1, &ta);
+            const Obj& X = mX;
+
+            const int MAX = X.maxPooledBlockSize();
+
+            bsl::vector<void *> blocks;
+            for (int hint = 0; hint < NUM_HINTS; ++hint) {
+                // Allocate a block of each pool, and verify that the pools
+                // of a nonzero hint are allocated by its first allocation.
+
+                for (int size = 8; size <= MAX; size *= 2) {
+                    const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                    void *p = mX.allocateWithHint(size, hint);
+
+                    const bsls::Types::Int64 EXP =
+                                 NUM_BLOCKS + (0 != hint && 8 == size ? 2 : 1);
+
+                    LOOP2_ASSERT(hint, size, EXP == ta.numBlocksInUse());
+
+                    bsl::memset(p, 'x', size);
+                    blocks.push_back(p);
+                }
+            }
+
+            // With one block per chunk, blocks from distinct chunks are at
+            // least one block size apart.
+
+            bsl::vector<void *> sorted(blocks);
+            bsl::sort(sorted.begin(), sorted.end());
+            for (bsl::size_t i = 1; i < sorted.size(); ++i) {
+                LOOP_ASSERT(i, static_cast<char *>(sorted[i - 1]) + 8
+                                            <= static_cast<char *>(sorted[i]));
+            }
+
+            // Return the blocks, and verify that they are reused by the
+            // allocations with the same hint.
+
+            for (int hint = 0; hint < NUM_HINTS; ++hint) {
+                for (int i = 0; i < NUM_POOLS; ++i) {
+                    mX.deallocate(blocks[hint * NUM_POOLS + i]);
+                }
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            for (int hint = NUM_HINTS - 1; 0 <= hint; --hint) {
+                int i = 0;
+                for (int size = 8; size <= MAX; size *= 2, ++i) {
+                    void *p = mX.allocateWithHint(size, hint);
+
+                    LOOP2_ASSERT(hint, size, blocks[hint * NUM_POOLS + i]
+                                                                        == p);
+                }
+            }
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.deallocateBatch(blocks.data(),
+                               static_cast<int>(blocks.size()));
+
+            for (int hint = 0; hint < NUM_HINTS; ++hint) {
+                void *p = mX.allocateWithHint(8, hint);
+
+                LOOP_ASSERT(hint, blocks[hint * NUM_POOLS] == p);
+
+                mX.deallocate(p);
+            }
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting sized 'deallocateBatch'."
+                              << endl;
+
+            // The sized 'deallocateBatch' locates the default pool from the
+            // size, but returns a block allocated with a nonzero hint to the
+            // pool of its hint.
+
+            void *hinted[NUM_HINTS];
+            for (int hint = 0; hint < NUM_HINTS; ++hint) {
+                hinted[hint] = mX.allocateWithHint(8, hint);
+            }
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.deallocateBatch(hinted, NUM_HINTS, 8);
+
+            for (int hint = NUM_HINTS - 1; 0 <= hint; --hint) {
+                void *p = mX.allocateWithHint(8, hint);
+
+                LOOP_ASSERT(hint, hinted[hint] == p);
+
+                mX.deallocate(p);
+            }
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting non-pooled blocks." << endl;
+
+            void *p = mX.allocateWithHint(MAX + 1, NUM_HINTS - 1);
+            bsl::memset(p, 'x', MAX + 1);
+
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting 'tryExpand'." << endl;
+
+            p = mX.allocateWithHint(9, 1);
+
+            ASSERT(true  == mX.tryExpand(p,  9, 16));
+            ASSERT(false == mX.tryExpand(p, 16, 17));
+
+            bsl::memset(p, 'x', 16);
+            mX.deallocate(p);
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting 'trim' and 'release'." << endl;
+
+            p = mX.allocateWithHint(8, 1);
+
+            ASSERT(0 < mX.trim());
+
+            // Only the chunk of 'p' remains, besides the arrays of pools.
+
+            ASSERT(NUM_HINTS + 1 == ta.numBlocksInUse());
+
+            bsl::memset(p, 'x', 8);
+            mX.deallocate(p);
+
+            ASSERT(0 < mX.trim());
+            ASSERT(NUM_HINTS == ta.numBlocksInUse());
+
+            p = mX.allocateWithHint(8, 1);
+
+            mX.release();
+
+            // Only the arrays of pools remain allocated.
+
+            ASSERT(NUM_HINTS == ta.numBlocksInUse());
+
+            p = mX.allocateWithHint(8, 2);
+            bsl::memset(p, 'x', 8);
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting hint 0." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, &ta);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *p = mX.allocateWithHint(8, 0);
+
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+
+            ASSERT(p == mX.allocate(8));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, &ta);
+
+            void *p = 0;
+
+            ASSERT_PASS(p = mX.allocateWithHint(8, NUM_HINTS - 1));
+            ASSERT_FAIL(mX.allocateWithHint(8, NUM_HINTS));
+            ASSERT_FAIL(mX.allocateWithHint(8, -1));
+            ASSERT_FAIL(mX.allocateWithHint(0, 1));
+
+            mX.deallocate(p);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'tryExpand'
+        //
+        // Concerns:
+        //: 1 'tryExpand' succeeds for a pooled block if, and only if, the new
+        //:   size is served by the pool that dispensed the block.
+        //:
+        //: 2 An expanded block is returned by 'deallocate' to the pool that
+        //:   dispensed it.
+        //:
+        //: 3 'tryExpand' fails for blocks larger than 'maxPooledBlockSize()'.
+        //:
+        //: 4 'tryExpand' never allocates memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each pooled size, allocate a block, attempt to expand it to
+        //:   every larger size up to twice the maximum pooled block size, and
+        //:   verify the result against the pool serving each size.  Fill the
+        //:   expanded block and return it.  (C-1..2, 4)
+        //:
+        //: 2 Attempt to expand a non-pooled block.  (C-3, 4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   bool tryExpand(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'tryExpand'" << endl
+                                  << "===================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        enum { NUM_POOLS = 5 };
+
+        Obj mX(NUM_POOLS, &ta);  const Obj& X = mX;
+
+        const int MAX = X.maxPooledBlockSize();
+
+        if (verbose) cout << "\nTesting pooled blocks." << endl;
+        {
+            for (int size = 1; size <= MAX; ++size) {
+                // Determine the block size of the pool serving 'size'.
+
+                int blockSize = 8;
+                while (blockSize < size) {
+                    blockSize *= 2;
+                }
+
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                int newSize = size;
+                for (int n = size; n <= 2 * MAX; ++n) {
+                    const bool EXP    = n <= blockSize;
+                    const bool RESULT = mX.tryExpand(p, newSize, n);
+
+                    LOOP3_ASSERT(size, n, EXP, EXP == RESULT);
+
+                    if (RESULT) {
+                        newSize = n;
+                    }
+                }
+                LOOP_ASSERT(size, blockSize  == newSize);
+                LOOP_ASSERT(size, NUM_BLOCKS == ta.numBlocksInUse());
+
+                bsl::memset(p, 'x', newSize);
+                mX.deallocate(p);
+
+                LOOP_ASSERT(size, p == mX.allocate(blockSize));
+                mX.deallocate(p);
+            }
+        }
+
+        if (verbose) cout << "\nTesting non-pooled blocks." << endl;
+        {
+            void *p = mX.allocate(MAX + 1);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(false == mX.tryExpand(p, MAX + 1, MAX + 1));
+            ASSERT(false == mX.tryExpand(p, MAX + 1, 2 * MAX));
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            void *p = mX.allocate(8);
+
+            ASSERT_PASS(mX.tryExpand(p, 8, 8));
+            ASSERT_FAIL(mX.tryExpand(0, 8, 8));
+            ASSERT_FAIL(mX.tryExpand(p, 0, 8));
+            ASSERT_FAIL(mX.tryExpand(p, 8, 7));
+
+            mX.deallocate(p);
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadPoolStatistics'
+        //
+        // Concerns:
+        //: 1 The statistics of each pool report its block size, the blocks
+        //:   allocated from it and in use, and the memory it obtained from
+        //:   the underlying allocator.
+        //:
+        //: 2 Blocks larger than 'maxPooledBlockSize()' are not accounted for
+        //:   in any pool.
+        //:
+        //: 3 The statistics of the pools of a hint account for the blocks
+        //:   allocated with that hint only, and the pools of a hint with which
+        //:   no block was allocated report the block sizes of the default
+        //:   pools and no memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks of several pooled sizes and one non-pooled block,
+        //:   and verify that the block sizes of the pools are increasing, that
+        //:   the blocks in use summed over the pools match the pooled blocks
+        //:   allocated, and that the bytes obtained by the pools account for
+        //:   the memory in use from the test allocator, except for the
+        //:   non-pooled block and the array of pools.  (C-1..2)
+        //:
+        //: 2 Deallocate all blocks, and verify that no block remains in use
+        //:   and that the freed blocks are on the free lists.  (C-1)
+        //:
+        //: 3 Allocate blocks with a nonzero hint, and verify the statistics of
+        //:   the pools of that hint, of the default pools, and of the pools
+        //:   of another hint.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void loadPoolStatistics(PoolStatistics *result, int index) const;
+        //   void loadPoolStatistics(PoolStatistics *, int, int hint) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'loadPoolStatistics'" << endl
+                                  << "============================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        enum { NUM_POOLS = 5, NUM_SIZES = 4, NUM_BLOCKS = 50 };
+        const int SIZES[NUM_SIZES] = { 1, 8, 30, 60 };
+
+        Obj mX(NUM_POOLS, &ta);  const Obj& X = mX;
+
+        const bsls::Types::Int64 OVERHEAD = ta.numBytesInUse();
+
+        bdlma::PoolStatistics stats;
+
+        int prevBlockSize = 0;
+        for (int k = 0; k < NUM_POOLS; ++k) {
+            X.loadPoolStatistics(&stats, k);
+
+            LOOP_ASSERT(k, prevBlockSize <  stats.d_blockSize);
+            LOOP_ASSERT(k, 0             == stats.d_numBlocks);
+            LOOP_ASSERT(k, 0             == stats.d_numBytesObtained);
+
+            prevBlockSize = stats.d_blockSize;
+        }
+
+        void *p[NUM_SIZES][NUM_BLOCKS];
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                p[i][j] = mX.allocate(SIZES[i]);
+            }
+        }
+
+        const int LARGE = X.maxPooledBlockSize() + 1;
+        void *large = mX.allocate(LARGE);
+
+        const bsls::Types::Int64 LARGE_BYTES = ta.lastAllocatedNumBytes();
+
+        int                numBlocksInUse = 0;
+        bsls::Types::Int64 numBytes       = 0;
+        for (int k = 0; k < NUM_POOLS; ++k) {
+            X.loadPoolStatistics(&stats, k);
+
+            LOOP_ASSERT(k, stats.d_numBlocksInUse + stats.d_freeListLength
+                                                     <= stats.d_numBlocks);
+
+            numBlocksInUse += stats.d_numBlocksInUse;
+            numBytes       += stats.d_numBytesObtained;
+        }
+        ASSERT(NUM_SIZES * NUM_BLOCKS == numBlocksInUse);
+        ASSERT(ta.numBytesInUse() == OVERHEAD + LARGE_BYTES + numBytes);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                mX.deallocate(p[i][j]);
+            }
+        }
+        mX.deallocate(large);
+
+        int freeListLength = 0;
+        for (int k = 0; k < NUM_POOLS; ++k) {
+            X.loadPoolStatistics(&stats, k);
+
+            LOOP_ASSERT(k, 0 == stats.d_numBlocksInUse);
+
+            freeListLength += stats.d_freeListLength;
+        }
+        ASSERT(NUM_SIZES * NUM_BLOCKS == freeListLength);
+
+        if (verbose) cout << "\nTesting hints." << endl;
+        {
+            enum { HINT = 1, OTHER_HINT = 2 };
+
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                p[0][j] = mX.allocateWithHint(SIZES[0], HINT);
+            }
+
+            bdlma::PoolStatistics defaultStats;
+
+            int numHintBlocksInUse = 0;
+            for (int k = 0; k < NUM_POOLS; ++k) {
+                X.loadPoolStatistics(&defaultStats, k);
+                X.loadPoolStatistics(&stats, k, HINT);
+
+                LOOP_ASSERT(k, defaultStats.d_blockSize == stats.d_blockSize);
+                LOOP_ASSERT(k, 0 == defaultStats.d_numBlocksInUse);
+
+                numHintBlocksInUse += stats.d_numBlocksInUse;
+
+                X.loadPoolStatistics(&stats, k, OTHER_HINT);
+
+                LOOP_ASSERT(k, defaultStats.d_blockSize == stats.d_blockSize);
+                LOOP_ASSERT(k, 0 == stats.d_numBlocks);
+                LOOP_ASSERT(k, 0 == stats.d_numBlocksInUse);
+                LOOP_ASSERT(k, 0 == stats.d_freeListLength);
+                LOOP_ASSERT(k, 0 == stats.d_numChunks);
+                LOOP_ASSERT(k, 0 == stats.d_numBytesObtained);
+                LOOP_ASSERT(k, 0 >= stats.d_numAllocations);
+            }
+            ASSERT(NUM_BLOCKS == numHintBlocksInUse);
+
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                mX.deallocate(p[0][j]);
+            }
+
+            X.loadPoolStatistics(&stats, 0, HINT);
+
+            ASSERT(0          == stats.d_numBlocksInUse);
+            ASSERT(NUM_BLOCKS == stats.d_freeListLength);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(X.loadPoolStatistics(&stats, 0));
+            ASSERT_PASS(X.loadPoolStatistics(&stats, NUM_POOLS - 1));
+            ASSERT_FAIL(X.loadPoolStatistics(&stats, -1));
+            ASSERT_FAIL(X.loadPoolStatistics(&stats, NUM_POOLS));
+            ASSERT_FAIL(X.loadPoolStatistics(0, 0));
+
+            ASSERT_PASS(X.loadPoolStatistics(&stats, 0, 0));
+            ASSERT_PASS(X.loadPoolStatistics(&stats, 0,
+                                             Obj::k_MAX_NUM_HINTS - 1));
+            ASSERT_FAIL(X.loadPoolStatistics(&stats, 0, -1));
+            ASSERT_FAIL(X.loadPoolStatistics(&stats, 0,
+                                             Obj::k_MAX_NUM_HINTS));
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH ALLOCATION
+        //
+        // Concerns:
+        //: 1 'allocateBatch' loads the requested number of distinct blocks of
+        //:   (at least) the requested size, for pooled and non-pooled sizes.
+        //:
+        //: 2 Pooled blocks are taken from the internal pool serving the size,
+        //:   and can be returned by 'deallocate', 'deallocateBatch', or the
+        //:   sized 'deallocateBatch', after which they are reused.
+        //:
+        //: 3 Non-pooled blocks are returned to the underlying allocator by
+        //:   either 'deallocateBatch' overload.
+        //:
+        //: 4 If the underlying allocator throws, no block remains allocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of sizes spanning every pool and the non-pooled range,
+        //:   allocate batches, write to every byte of every block, and
+        //:   return them using each of the deallocation methods in turn;
+        //:   verify that a second batch reuses the pooled blocks without
+        //:   allocating, and that no memory remains in use after non-pooled
+        //:   blocks are returned.  (C-1..3)
+        //:
+        //: 2 Allocate batches of non-pooled blocks within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify that
+        //:   no memory remains in use when an exception propagates.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void allocateBatch(void **blocks, int numBlocks, int size);
+        //   void deallocateBatch(void *const *blocks, int numBlocks);
+        //   void deallocateBatch(void *const *blocks, int numBlocks, int sz);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING BATCH ALLOCATION" << endl
+                                  << "========================" << endl;
+
+        enum { NUM_BLOCKS = 50 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        const bslma::TestAllocator& TA = ta;
+
+        const int SIZES[] = { 1, 7, 8, 9, 31, 64, 100, 511, 1024, 1025, 5000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            for (int method = 0; method < 3; ++method) {
+                Obj mX(&ta);
+
+                const bool POOLED = SIZE <= mX.maxPooledBlockSize();
+
+                const bsls::Types::Int64 NB = TA.numBytesInUse();
+
+                void *blocks[NUM_BLOCKS];
+                mX.allocateBatch(blocks, NUM_BLOCKS, SIZE);
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    LOOP3_ASSERT(SIZE, method, i, blocks[i]);
+                    for (int j = 0; j < i; ++j) {
+                        LOOP3_ASSERT(SIZE, method, i, blocks[i] != blocks[j]);
+                    }
+                    bsl::memset(blocks[i], i, SIZE);
+                }
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    const char *p = static_cast<char *>(blocks[i]);
+                    for (int k = 0; k < SIZE; ++k) {
+                        LOOP3_ASSERT(SIZE, method, i,
+                                     static_cast<char>(i) == p[k]);
+                    }
+                }
+
+                switch (method) {
+                  case 0: {
+                    for (int i = 0; i < NUM_BLOCKS; ++i) {
+                        mX.deallocate(blocks[i]);
+                    }
+                  } break;
+                  case 1: {
+                    mX.deallocateBatch(blocks, NUM_BLOCKS);
+                  } break;
+                  default: {
+                    mX.deallocateBatch(blocks, NUM_BLOCKS, SIZE);
+                  } break;
+                }
+
+                if (!POOLED) {
+                    LOOP2_ASSERT(SIZE, method, NB == TA.numBytesInUse());
+                    continue;
+                }
+
+                // The pooled blocks are reused by a second batch.
+
+                const bsls::Types::Int64 NA = TA.numAllocations();
+
+                void *again[NUM_BLOCKS];
+                mX.allocateBatch(again, NUM_BLOCKS, SIZE);
+                LOOP2_ASSERT(SIZE, method, NA == TA.numAllocations());
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    bool found = false;
+                    for (int j = 0; j < NUM_BLOCKS; ++j) {
+                        found = found || again[i] == blocks[j];
+                    }
+                    LOOP3_ASSERT(SIZE, method, i, found);
+                }
+
+                mX.deallocateBatch(again, NUM_BLOCKS, SIZE);
+            }
+            LOOP_ASSERT(SIZE, 0 == TA.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting exception safety." << endl;
+        {
+            Obj mX(&ta);
+
+            const int                LARGE = mX.maxPooledBlockSize() + 1;
+            const bsls::Types::Int64 NB    = TA.numBytesInUse();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                // A failed attempt leaves no block allocated.
+
+                ASSERT(NB == TA.numBytesInUse());
+
+                void *blocks[NUM_BLOCKS];
+                mX.allocateBatch(blocks, NUM_BLOCKS, LARGE);
+                mX.deallocateBatch(blocks, NUM_BLOCKS, LARGE);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(NB == TA.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);
+
+            void *blocks[1];
+
+            ASSERT_PASS(mX.allocateBatch(0, 0, 8));
+            ASSERT_FAIL(mX.allocateBatch(0, 1, 8));
+            ASSERT_FAIL(mX.allocateBatch(blocks, -1, 8));
+            ASSERT_FAIL(mX.allocateBatch(blocks, 1, 0));
+            ASSERT_PASS(mX.allocateBatch(blocks, 1, 8));
+            ASSERT_PASS(mX.deallocateBatch(blocks, 1, 8));
+
+            ASSERT_PASS(mX.deallocateBatch(0, 0));
+            ASSERT_FAIL(mX.deallocateBatch(0, 1));
+            ASSERT_FAIL(mX.deallocateBatch(blocks, -1));
+
+            ASSERT_PASS(mX.deallocateBatch(0, 0, 8));
+            ASSERT_FAIL(mX.deallocateBatch(0, 1, 8));
+            ASSERT_FAIL(mX.deallocateBatch(blocks, -1, 8));
+            ASSERT_FAIL(mX.deallocateBatch(blocks, 1, 0));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'trim'
+        //
+        // Concerns:
+        //: 1 'trim' returns to the allocator the fully free chunks of every
+        //:   internal pool, and returns the number of bytes so released.
+        //:
+        //: 2 Blocks still in use, pooled or not, are unaffected.
+        //
+        // Plan:
+        //: 1 Allocate many blocks of several pooled sizes and one non-pooled
+        //:   block, free all but a few of them, and verify that 'trim'
+        //:   reduces the memory in use by the reported amount, and that the
+        //:   remaining blocks retain their contents.  (C-1..2)
+        //
+        // Testing:
+        //   size_type trim();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'trim'" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        enum { NUM_SIZES = 3, NUM_BLOCKS = 500 };
+        const int SIZES[NUM_SIZES] = { 8, 24, 100 };
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.trim());
+
+        char *p[NUM_SIZES][NUM_BLOCKS];
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                p[i][j] = static_cast<char *>(mX.allocate(SIZES[i]));
+                bsl::memset(p[i][j], j, SIZES[i]);
+            }
+        }
+        const int LARGE = mX.maxPooledBlockSize() + 1;
+        void *large = mX.allocate(LARGE);
+
+        ASSERT(0 == mX.trim());
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (0 != j % 100) {
+                    mX.deallocate(p[i][j]);
+                    p[i][j] = 0;
+                }
+            }
+        }
+
+        const bsls::Types::Int64 numBytesInUse = ta.numBytesInUse();
+        const bsls::Types::size_type numTrimmed = mX.trim();
+        ASSERT(0 < numTrimmed);
+        ASSERT(numBytesInUse - static_cast<bsls::Types::Int64>(numTrimmed)
+                                                       == ta.numBytesInUse());
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (p[i][j]) {
+                    for (int k = 0; k < SIZES[i]; ++k) {
+                        LOOP3_ASSERT(i, j, k,
+                                     static_cast<char>(j) == p[i][j][k]);
+                    }
+                }
+            }
+        }
+
+        mX.deallocate(large);
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING ALIGNED 'allocate'
+        //
+        // Concerns:
+        //: 1 The returned address is a multiple of the requested alignment,
+        //:   for alignments both below and above the maximal alignment, and
+        //:   for both pooled and non-pooled sizes.
+        //:
+        //: 2 The returned block is usable in its entirety.
+        //:
+        //: 3 'deallocate' returns an aligned block to the pool (or block
+        //:   list) from which it was obtained, so that a subsequent
+        //:   identical sequence of requests is satisfied without allocating
+        //:   additional pooled memory and all non-pooled memory is freed.
+        //:
+        //: 4 Blocks obtained from both overloads of 'allocate' can be
+        //:   interleaved.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of sizes and alignments, allocate a block
+        //:   using the aligned 'allocate' and a block using the unaligned
+        //:   'allocate', verify the alignment of the former, and fill both
+        //:   blocks entirely.  Then deallocate all blocks, in reverse order,
+        //:   using 'deallocate'.  (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 and verify that the memory in use from the test
+        //:   allocator is the same as after the first pass.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(int size, int alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING ALIGNED 'allocate'" << endl
+                                  << "==========================" << endl;
+
+        typedef bsls::Types::IntPtr IntPtr;
+
+        const int SIZES[]    = { 1, 8, 13, 60, 100, 500, 1024, 2000, 5000 };
+        const int NUM_SIZES  = sizeof SIZES / sizeof *SIZES;
+
+        const int ALIGNS[]   = { 1, 4, 8, 16, 32, 64, 128, 256, 4096 };
+        const int NUM_ALIGNS = sizeof ALIGNS / sizeof *ALIGNS;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        bsls::Types::Int64 bytesInUse = 0;
+
+        for (int pass = 0; pass < 2; ++pass) {
+            bsl::vector<void *> blocks;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < NUM_ALIGNS; ++j) {
+                    const int SIZE  = SIZES[i];
+                    const int ALIGN = ALIGNS[j];
+
+                    if (veryVerbose) { T_ P_(pass) P_(SIZE) P(ALIGN) }
+
+                    void *p = mX.allocate(SIZE, ALIGN);
+                    ASSERTV(SIZE, ALIGN,
+                            0 == reinterpret_cast<IntPtr>(p) % ALIGN);
+                    memset(p, 0xa5, SIZE);
+                    blocks.push_back(p);
+
+                    void *q = mX.allocate(SIZE);
+                    memset(q, 0x5a, SIZE);
+                    blocks.push_back(q);
+                }
+            }
+
+            while (!blocks.empty()) {
+                mX.deallocate(blocks.back());
+                blocks.pop_back();
+            }
+
+            if (0 == pass) {
+                bytesInUse = ta.numBytesInUse();
+            }
+            else {
+                ASSERTV(bytesInUse, ta.numBytesInUse(),
+                        bytesInUse == ta.numBytesInUse());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mY(&ta);
+
+            void *p = 0;
+
+            ASSERT_PASS(p = mY.allocate(1, 64));
+            ASSERT_FAIL(mY.allocate(0, 64));
+            ASSERT_FAIL(mY.allocate(1,  0));
+            ASSERT_FAIL(mY.allocate(1, 48));
+
+            mY.deallocate(p);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING 'numPools' and 'maxPooledBlockSize'
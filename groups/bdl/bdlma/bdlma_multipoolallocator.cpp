@@ -21,6 +21,38 @@ MultipoolAllocator::~MultipoolAllocator()
 }
 
 // MANIPULATORS
+void MultipoolAllocator::allocateBatch(void      **blocks,
+                                       size_type   numBlocks,
+                                       size_type   size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        for (size_type i = 0; i < numBlocks; ++i) {
+            blocks[i] = 0;
+        }
+        return;                                                       // RETURN
+    }
+
+    d_multipool.allocateBatch(blocks,
+                              static_cast<int>(numBlocks),
+                              static_cast<int>(size));
+}
+
+void MultipoolAllocator::deallocateBatch(void *const *blocks,
+                                         size_type    numBlocks,
+                                         size_type    size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    d_multipool.deallocateBatch(blocks,
+                                static_cast<int>(numBlocks),
+                                static_cast<int>(size));
+}
+
 void MultipoolAllocator::reserveCapacity(size_type size, size_type numObjects)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
@@ -31,6 +63,15 @@ void MultipoolAllocator::reserveCapacity(size_type size, size_type numObjects)
     d_multipool.reserveCapacity(size, numObjects);
 }
 
+                     // ----------------------------
+                     // class MultipoolHintAllocator
+                     // ----------------------------
+
+// CREATORS
+MultipoolHintAllocator::~MultipoolHintAllocator()
+{
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlma::MultipoolAllocator: allocator managing varying-size memory pools
+//  bdlma::MultipoolHintAllocator: allocator binding a hint to a multipool
 //
 //@SEE_ALSO: bdlma_pool, bdlma_multipool
 //
@@ -35,6 +36,8 @@ BSLS_IDENT("$Id: $")
 //                |         maxPooledBlockSize
 //                |         numPools
 //                |         reserveCapacity
+//                |         trim
+//                |         tryExpand
 //                V
 //    ,-----------------------.
 //   ( bdlma::ManagedAllocator )
@@ -55,6 +58,14 @@ BSLS_IDENT("$Id: $")
 // However, since 'bslma::Allocator *' is widely used across BDE interfaces,
 // 'bdlma::MultipoolAllocator' is more general purpose than 'bdlma::Multipool'.
 //
+// Note that 'bdlma::MultipoolAllocator' is declared 'final' (on platforms
+// supporting C++11), and its 'allocate' and 'deallocate' methods are defined
+// inline.  A call made through a 'bdlma::MultipoolAllocator' pointer or
+// reference (rather than through a 'bslma::Allocator' one) can therefore be
+// bound statically and inlined by the compiler.  Containers can take
+// advantage of this by using 'bslma::StaticAllocator', which retains the
+// concrete allocator type.
+//
 ///Configuration at Construction
 ///-----------------------------
 // When creating a 'bdlma::MultipoolAllocator', clients can optionally
@@ -104,6 +115,33 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Lifetime Hints
+///--------------
+// The 'allocateWithHint' method serves a request from a separate set of
+// pools for each nonzero hint (see {'bdlma_multipool'|Lifetime Hints}), so
+// that, e.g., long-lived and short-lived blocks of the same size are not
+// interleaved in the same chunks.  A 'bdlma::MultipoolHintAllocator' binds a
+// hint to a multipool allocator and implements the 'bslma::Allocator'
+// protocol, so the hint can be supplied, per container, through the allocator
+// argument of the container (which 'bsl::allocator' forwards unchanged to
+// every allocation of the container):
+//..
+//  enum { e_LONG_LIVED = 1, e_TEMPORARY = 2 };
+//
+//  bdlma::MultipoolAllocator     multipool;
+//  bdlma::MultipoolHintAllocator longLived(&multipool, e_LONG_LIVED);
+//  bdlma::MultipoolHintAllocator temporary(&multipool, e_TEMPORARY);
+//
+//  bsl::map<int, int> index(&longLived);     // nodes kept dense
+//  bsl::list<int>     scratch(&temporary);   // nodes of the same size class
+//                                            // in other chunks
+//..
+// A hint allocator deallocates every block with the 'deallocate' of the
+// multipool allocator, which reads the pool owning the block from its header.
+// Note that containers using hint allocators bound to different hints (or a
+// hint allocator and the multipool allocator itself) do not compare their
+// allocators equal, so that, e.g., swapping them copies their elements.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -613,6 +651,14 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -620,7 +666,7 @@ namespace bdlma {
                      // class MultipoolAllocator
                      // ========================
 
-class MultipoolAllocator : public ManagedAllocator {
+class MultipoolAllocator BSLS_CPP11_FINAL : public ManagedAllocator {
     // This class implements the 'bdlma::ManagedAllocator' protocol to provide
     // an allocator that maintains a configurable number of 'bdlma::Pool'
     // objects, each dispensing memory blocks of a unique size.  The
@@ -762,6 +808,21 @@ class MultipoolAllocator : public ManagedAllocator {
         // is 0, this method has no effect.  The behavior is undefined unless
         // 'size <= maxPooledBlockSize()'.
 
+    size_type trim();
+        // Return every chunk of every internal pool none of whose memory
+        // blocks is currently allocated from this multipool allocator to the
+        // underlying allocator, and return the number of bytes so released.
+        // See 'bdlma::Multipool::trim'.
+
+    void *allocateWithHint(size_type size, int hint);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), obtained from the set
+        // of pools of the specified 'hint' (see {Lifetime Hints}).  If 'size'
+        // is 0, no memory is allocated and 0 is returned.  The behavior is
+        // undefined unless '0 <= hint < Multipool::k_MAX_NUM_HINTS'.  Note
+        // that 'deallocate' returns a block allocated with a nonzero hint to
+        // the pool of that hint.
+
                                 // Virtual Functions
 
     virtual void *allocate(size_type size);
@@ -771,16 +832,62 @@ class MultipoolAllocator : public ManagedAllocator {
         // 'size > maxPooledBlockSize()', the memory allocation is managed
         // directly by the underlying allocator, but will not be pooled .
 
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return the address of a contiguous block of memory of (at least) the
+        // specified 'size' (in bytes) whose address is a multiple of the
+        // specified 'alignment'.  If 'size' is 0, no memory is allocated and 0
+        // is returned.  The behavior is undefined unless 'alignment' is a
+        // positive power of two.
+
+    virtual void allocateBatch(void      **blocks,
+                               size_type   numBlocks,
+                               size_type   size);
+        // Load into the specified 'blocks' array the addresses of the
+        // specified 'numBlocks' contiguous blocks of maximally-aligned memory,
+        // each of (at least) the specified 'size' (in bytes).  If 'size' is 0,
+        // no memory is allocated and 'numBlocks' null pointers are loaded.
+        // If an exception is thrown, every block allocated by this call is
+        // deallocated before the exception propagates.  The behavior is
+        // undefined unless '0 <= numBlocks' and 'blocks' refers to an array
+        // having at least 'numBlocks' elements.  See
+        // 'bdlma::Multipool::allocateBatch'.
+
     virtual void deallocate(void *address);
         // Return the memory block at the specified 'address' back to this
         // allocator for reuse.  If 'address' is 0, this method has no effect.
         // The behavior is undefined unless 'address' was allocated by this
         // allocator, and has not already been deallocated.
 
+    virtual void deallocateBatch(void *const *blocks,
+                                 size_type    numBlocks,
+                                 size_type    size);
+        // Return the specified 'numBlocks' memory blocks whose addresses are
+        // held in the specified 'blocks' array, each having the specified
+        // 'size' (in bytes), back to this allocator for reuse.  If 'size' is
+        // 0, this method has no effect.  The behavior is undefined unless
+        // '0 <= numBlocks', and each address in 'blocks' was allocated by
+        // this allocator with a requested size of 'size', and has not already
+        // been deallocated.  Note that the internal pool selected by 'size' is
+        // located once for the whole batch (see
+        // 'bdlma::Multipool::deallocateBatch').
+
     virtual void release();
         // Release all memory currently allocated through this multipool
         // allocator.
 
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' can now hold 'newSize' bytes, and
+        // 'false' with no effect otherwise.  The behavior is undefined unless
+        // 'address' was allocated by this allocator and has not already been
+        // deallocated, the size of the memory block at 'address' is
+        // 'originalSize', and '0 < originalSize <= newSize'.  See
+        // 'bdlma::Multipool::tryExpand'.
+
     // ACCESSORS
     int numPools() const;
         // Return the number of pools managed by this multipool allocator.
@@ -793,6 +900,81 @@ class MultipoolAllocator : public ManagedAllocator {
         //..
         // where 'numPools' is either specified at construction, or an
         // implementation-defined value.
+
+    void loadPoolStatistics(PoolStatistics *result,
+                            int             poolIndex,
+                            int             hint = 0) const;
+        // Load into the specified 'result' a snapshot of the usage of the pool
+        // at the specified 'poolIndex' of the underlying multipool (see
+        // {'bdlma_multipool'|Statistics}) in the set of pools of the
+        // optionally specified 'hint' (see {Lifetime Hints}).  If 'hint' is
+        // not specified, the default set of pools is used.  The behavior is
+        // undefined unless '0 <= poolIndex < numPools()' and
+        // '0 <= hint < Multipool::k_MAX_NUM_HINTS'.  See
+        // 'bdlma::Multipool::loadPoolStatistics'.
+};
+
+                     // ============================
+                     // class MultipoolHintAllocator
+                     // ============================
+
+class MultipoolHintAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide an
+    // allocator that obtains every block from a 'MultipoolAllocator' with a
+    // hint fixed at construction, and returns every block to it.
+
+    // DATA
+    MultipoolAllocator *d_multipool_p;  // allocator supplying the memory
+                                        // (held, not owned)
+
+    int                 d_hint;         // hint of every allocation
+
+  private:
+    // NOT IMPLEMENTED
+    MultipoolHintAllocator(const MultipoolHintAllocator&);
+    MultipoolHintAllocator& operator=(const MultipoolHintAllocator&);
+
+  public:
+    // CREATORS
+    MultipoolHintAllocator(MultipoolAllocator *multipoolAllocator, int hint);
+        // Create an allocator obtaining memory from the specified
+        // 'multipoolAllocator' with the specified 'hint'.  The behavior is
+        // undefined unless '0 <= hint < bdlma::Multipool::k_MAX_NUM_HINTS'.
+
+    virtual ~MultipoolHintAllocator();
+        // Destroy this allocator.  Note that the blocks allocated through
+        // this allocator are not released.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), obtained from the
+        // multipool allocator of this object with the hint of this object.
+        // If 'size' is 0, no memory is allocated and 0 is returned.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // multipool allocator of this object.  If 'address' is 0, this method
+        // has no effect.  The behavior is undefined unless 'address' was
+        // allocated by this allocator, and has not already been deallocated.
+
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' can now hold 'newSize' bytes, and
+        // 'false' with no effect otherwise.  See
+        // 'bdlma::MultipoolAllocator::tryExpand'.
+
+    // ACCESSORS
+    int hint() const;
+        // Return the hint of the allocations of this allocator.
+
+    MultipoolAllocator *multipoolAllocator() const;
+        // Return the multipool allocator supplying the memory of this
+        // allocator.
 };
 
 // ============================================================================
@@ -889,6 +1071,23 @@ MultipoolAllocator::MultipoolAllocator(
 }
 
 // MANIPULATORS
+inline
+MultipoolAllocator::size_type MultipoolAllocator::trim()
+{
+    return d_multipool.trim();
+}
+
+inline
+void *MultipoolAllocator::allocateWithHint(size_type size, int hint)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_multipool.allocateWithHint(static_cast<int>(size), hint);
+}
+
 inline
 void MultipoolAllocator::release()
 {
@@ -908,6 +1107,14 @@ int MultipoolAllocator::maxPooledBlockSize() const
     return d_multipool.maxPooledBlockSize();
 }
 
+inline
+void MultipoolAllocator::loadPoolStatistics(PoolStatistics *result,
+                                            int             poolIndex,
+                                            int             hint) const
+{
+    d_multipool.loadPoolStatistics(result, poolIndex, hint);
+}
+
 inline
 void *MultipoolAllocator::allocate(size_type size)
 {
@@ -919,6 +1126,19 @@ void *MultipoolAllocator::allocate(size_type size)
     return d_multipool.allocate(size);
 }
 
+inline
+void *MultipoolAllocator::allocateAligned(size_type size,
+                                          size_type alignment)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_multipool.allocate(static_cast<int>(size),
+                                static_cast<int>(alignment));
+}
+
 inline
 void MultipoolAllocator::deallocate(void *address)
 {
@@ -928,6 +1148,74 @@ void MultipoolAllocator::deallocate(void *address)
     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 }
 
+inline
+bool MultipoolAllocator::tryExpand(void      *address,
+                                   size_type  originalSize,
+                                   size_type  newSize)
+{
+    // Only pooled blocks can be expanded, so a 'newSize' too large to be
+    // pooled is rejected before narrowing the sizes to 'int'.
+
+    if (newSize > static_cast<size_type>(d_multipool.maxPooledBlockSize())) {
+        return false;                                                 // RETURN
+    }
+
+    return d_multipool.tryExpand(address,
+                                 static_cast<int>(originalSize),
+                                 static_cast<int>(newSize));
+}
+
+                     // ----------------------------
+                     // class MultipoolHintAllocator
+                     // ----------------------------
+
+// CREATORS
+inline
+MultipoolHintAllocator::MultipoolHintAllocator(
+                                        MultipoolAllocator *multipoolAllocator,
+                                        int                 hint)
+: d_multipool_p(multipoolAllocator)
+, d_hint(hint)
+{
+    BSLS_ASSERT(multipoolAllocator);
+    BSLS_ASSERT(0 <= hint);
+    BSLS_ASSERT(hint < Multipool::k_MAX_NUM_HINTS);
+}
+
+// MANIPULATORS
+inline
+void *MultipoolHintAllocator::allocate(size_type size)
+{
+    return d_multipool_p->allocateWithHint(size, d_hint);
+}
+
+inline
+void MultipoolHintAllocator::deallocate(void *address)
+{
+    d_multipool_p->deallocate(address);
+}
+
+inline
+bool MultipoolHintAllocator::tryExpand(void      *address,
+                                       size_type  originalSize,
+                                       size_type  newSize)
+{
+    return d_multipool_p->tryExpand(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+int MultipoolHintAllocator::hint() const
+{
+    return d_hint;
+}
+
+inline
+MultipoolAllocator *MultipoolHintAllocator::multipoolAllocator() const
+{
+    return d_multipool_p;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -18,6 +18,7 @@
 #include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -26,6 +27,7 @@
 #include <bsl_map.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -55,14 +57,31 @@ using namespace bsl;
 // [ 3] MultipoolAllocator(numPools, *gs, *mbpc, Allocator *ba = 0);
 // [ 2] ~MultipoolAllocator();
 // [ 6] void reserveCapacity(size_type size, size_type numObjects);
+// [ 9] size_type trim();
+// [11] bool tryExpand(address, originalSize, newSize);
+// [12] void *allocateWithHint(size, hint);
 // [ 2] void *allocate(size);
+// [ 8] void *allocateAligned(size, alignment);
+// [10] void allocateBatch(blocks, numBlocks, size);
 // [ 4] void deallocate(address);
+// [10] void deallocateBatch(blocks, numBlocks, size);
 // [ 5] void release();
 // [ 7] int numPools() const;
 // [ 7] int maxPooledBlockSize() const;
+// [ 7] void loadPoolStatistics(PoolStatistics *result, int index) const;
+// [ 7] void loadPoolStatistics(PoolStatistics *, int index, int hint) const;
+//
+// MultipoolHintAllocator
+// [12] MultipoolHintAllocator(multipoolAllocator, hint);
+// [12] ~MultipoolHintAllocator();
+// [12] void *allocate(size);
+// [12] void deallocate(address);
+// [12] bool tryExpand(address, originalSize, newSize);
+// [12] int hint() const;
+// [12] MultipoolAllocator *multipoolAllocator() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -121,6 +140,7 @@ void aSsErT(int c, const char *s, int i)
 //-----------------------------------------------------------------------------
 
 typedef bdlma::MultipoolAllocator   Obj;
+typedef bdlma::MultipoolHintAllocator HintObj;
 
 typedef bdlma::Multipool            MPool;
 typedef bsls::BlockGrowth::Strategy Strategy;
@@ -715,7 +735,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 8: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -758,6 +778,491 @@ int main(int argc, char *argv[])
 //  }
 //..
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING HINTS
+        //
+        // Concerns:
+        //: 1 'allocateWithHint' returns 0 for a size of 0, and otherwise
+        //:   obtains the block from the pools of the hint.
+        //:
+        //: 2 A 'MultipoolHintAllocator' reports the multipool allocator and
+        //:   the hint supplied at construction.
+        //:
+        //: 3 A 'MultipoolHintAllocator' allocates every block with its hint,
+        //:   and returns every block to the pool of the hint.
+        //:
+        //: 4 A container using a 'MultipoolHintAllocator' (through
+        //:   'bsl::allocator') obtains its memory from the pools of the hint,
+        //:   apart from the memory of a container using the multipool
+        //:   allocator directly, and returns it on destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks with 'allocateWithHint' for several sizes and
+        //:   hints, and verify that the first allocation with a nonzero hint
+        //:   creates the pools of the hint.  (C-1)
+        //:
+        //: 2 Create a 'MultipoolHintAllocator' and verify its accessors.
+        //:   (C-2)
+        //:
+        //: 3 Allocate blocks through the hint allocator, return them, and
+        //:   verify that the next allocation reuses the block without
+        //:   allocating.  (C-3)
+        //:
+        //: 4 Populate a 'bsl::vector' of (non-short) strings using the
+        //:   multipool allocator and one using a hint allocator in
+        //:   alternation, and verify that only the strings of the former are
+        //:   obtained from the default pools.
+        //:   Destroy the maps, and verify that 'trim' returns all chunks to
+        //:   the underlying allocator.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void *allocateWithHint(size, hint);
+        //   MultipoolHintAllocator(multipoolAllocator, hint);
+        //   ~MultipoolHintAllocator();
+        //   void *allocate(size);
+        //   void deallocate(address);
+        //   bool tryExpand(address, originalSize, newSize);
+        //   int hint() const;
+        //   MultipoolAllocator *multipoolAllocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HINTS" << endl
+                                  << "=============" << endl;
+
+        enum { NUM_POOLS = 5 };
+
+        if (verbose) cout << "\nTesting 'allocateWithHint'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, bsls::BlockGrowth::BSLS_CONSTANT, 4, &ta);
+
+            ASSERT(0 == mX.allocateWithHint(0, 1));
+
+            bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+            void *p = mX.allocateWithHint(8, 1);
+
+            // The array of pools of the hint, and a chunk.
+
+            ASSERT(numBlocks + 2 == ta.numBlocksInUse());
+
+            numBlocks = ta.numBlocksInUse();
+
+            void *q = mX.allocateWithHint(8, 1);
+
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            void *r = mX.allocateWithHint(8, 0);
+
+            ASSERT(numBlocks + 1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            mX.deallocate(r);
+        }
+
+        if (verbose) cout << "\nTesting 'MultipoolHintAllocator'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, &ta);
+
+            HintObj mH(&mX, 3);  const HintObj& H = mH;
+
+            ASSERT(&mX == H.multipoolAllocator());
+            ASSERT(3   == H.hint());
+
+            bslma::Allocator *hintAllocator = &mH;
+
+            ASSERT(0 == hintAllocator->allocate(0));
+
+            void *p = hintAllocator->allocate(20);
+            bsl::memset(p, 'x', 20);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(true  == hintAllocator->tryExpand(p, 20, 32));
+            ASSERT(false == hintAllocator->tryExpand(p, 32, 33));
+
+            hintAllocator->deallocate(p);
+
+            void *q = hintAllocator->allocate(32);
+
+            ASSERT(p          == q);
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            hintAllocator->deallocate(q);
+
+            ASSERT(p          == hintAllocator->allocate(17));
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            hintAllocator->deallocate(p);
+            hintAllocator->deallocate(0);
+
+            p = hintAllocator->allocate(1024);
+            bsl::memset(p, 'x', 1024);
+            hintAllocator->deallocate(p);
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting with a container." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj     mX(NUM_POOLS, &ta);
+            HintObj mH(&mX, 1);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            {
+                typedef bsl::vector<bsl::string> Strings;
+
+                enum { NUM_ELEMENTS = 100 };
+
+                // Reserve the capacity of the vectors, whose arrays are not
+                // pooled, so that only the strings are allocated below.
+
+                Strings longLived(&mH);
+                Strings temporary(&mX);
+
+                longLived.reserve(NUM_ELEMENTS);
+                temporary.reserve(NUM_ELEMENTS);
+
+                const bsl::string VALUE(40, 'x');  // not a short string
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    longLived.push_back(VALUE);
+                    temporary.push_back(VALUE);
+                }
+
+                // Only the strings of 'temporary' are obtained from the
+                // default pools.
+
+                int numBlocksInUse = 0;
+                for (int i = 0; i < mX.numPools(); ++i) {
+                    bdlma::PoolStatistics stats;
+                    mX.loadPoolStatistics(&stats, i);
+
+                    numBlocksInUse += stats.d_numBlocksInUse;
+                }
+                LOOP_ASSERT(numBlocksInUse, NUM_ELEMENTS == numBlocksInUse);
+
+                longLived.pop_back();
+                ASSERT(NUM_ELEMENTS - 1 == static_cast<int>(longLived.size()));
+            }
+
+            // The vectors returned all strings, so 'trim' returns every
+            // chunk.
+
+            mX.trim();
+
+            // Besides the memory allocated at construction, only the array of
+            // the pools of the hint remains.
+
+            LOOP2_ASSERT(NUM_BLOCKS, ta.numBlocksInUse(),
+                         NUM_BLOCKS + 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS, &ta);
+
+            void *p = 0;
+
+            const int MAX_HINT = MPool::k_MAX_NUM_HINTS - 1;
+
+            ASSERT_PASS_RAW(p = mX.allocateWithHint(8, MAX_HINT));
+            ASSERT_FAIL_RAW(mX.allocateWithHint(8, MAX_HINT + 1));
+            ASSERT_FAIL_RAW(mX.allocateWithHint(8, -1));
+
+            mX.deallocate(p);
+
+            ASSERT_PASS_RAW(HintObj(&mX, 0));
+            ASSERT_PASS_RAW(HintObj(&mX, MAX_HINT));
+            ASSERT_FAIL_RAW(HintObj(&mX, MAX_HINT + 1));
+            ASSERT_FAIL_RAW(HintObj(&mX, -1));
+            ASSERT_FAIL_RAW(HintObj(0, 1));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'tryExpand'
+        //
+        // Concerns:
+        //: 1 'tryExpand', invoked through the 'bslma::Allocator' protocol,
+        //:   forwards to the underlying multipool.
+        //:
+        //: 2 'tryExpand' fails for any size exceeding 'maxPooledBlockSize()',
+        //:   including sizes not representable as 'int'.
+        //
+        // Plan:
+        //: 1 Through a 'bslma::Allocator' reference, allocate a pooled block,
+        //:   expand it to the block size of its pool, fail to expand it
+        //:   further, and return it.  (C-1)
+        //:
+        //: 2 Attempt to expand a pooled block and a non-pooled block to sizes
+        //:   exceeding 'maxPooledBlockSize()' and 'INT_MAX'.  (C-2)
+        //
+        // Testing:
+        //   bool tryExpand(address, originalSize, newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'tryExpand'" << endl
+                                  << "===================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj               mX(&ta);  const Obj& X = mX;
+        bslma::Allocator& a = mX;
+
+        const int MAX = X.maxPooledBlockSize();
+
+        const bslma::Allocator::size_type HUGE =
+                       static_cast<bslma::Allocator::size_type>(INT_MAX) + 9;
+
+        {
+            char *p = static_cast<char *>(a.allocate(20));
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(true  == a.tryExpand(p, 20, 32));
+            ASSERT(false == a.tryExpand(p, 32, 33));
+            ASSERT(false == a.tryExpand(p, 32, MAX + 1));
+            ASSERT(false == a.tryExpand(p, 32, HUGE));
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+            bsl::memset(p, 'x', 32);
+            a.deallocate(p);
+        }
+
+        {
+            void *p = a.allocate(MAX + 1);
+
+            ASSERT(false == a.tryExpand(p, MAX + 1, MAX + 2));
+            ASSERT(false == a.tryExpand(p, MAX + 1, HUGE));
+
+            a.deallocate(p);
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH ALLOCATION
+        //
+        // Concerns:
+        //: 1 'allocateBatch' and 'deallocateBatch', invoked through the
+        //:   'bslma::Allocator' protocol, forward to the underlying multipool.
+        //:
+        //: 2 A batch of size 0 loads null pointers and allocates no memory,
+        //:   and returning it has no effect.
+        //
+        // Plan:
+        //: 1 Through a 'bslma::Allocator' reference, allocate batches of
+        //:   pooled and non-pooled sizes, return them, and verify that a
+        //:   second batch of the pooled size reuses the blocks without
+        //:   allocating, and that no memory remains in use after the
+        //:   non-pooled blocks are returned.  (C-1)
+        //:
+        //: 2 Allocate and return a batch of size 0.  (C-2)
+        //
+        // Testing:
+        //   void allocateBatch(blocks, numBlocks, size);
+        //   void deallocateBatch(blocks, numBlocks, size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING BATCH ALLOCATION" << endl
+                                  << "========================" << endl;
+
+        enum { NUM_BLOCKS = 40 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj               mX(&ta);
+        bslma::Allocator& a = mX;
+
+        void *blocks[NUM_BLOCKS];
+        void *again[NUM_BLOCKS];
+
+        if (verbose) cout << "\nPooled blocks." << endl;
+        {
+            a.allocateBatch(blocks, NUM_BLOCKS, 48);
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                LOOP_ASSERT(i, blocks[i]);
+                bsl::memset(blocks[i], i, 48);
+            }
+            a.deallocateBatch(blocks, NUM_BLOCKS, 48);
+
+            const bsls::Types::Int64 NA = ta.numAllocations();
+            a.allocateBatch(again, NUM_BLOCKS, 48);
+            ASSERT(NA == ta.numAllocations());
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                bool found = false;
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    found = found || again[i] == blocks[j];
+                }
+                LOOP_ASSERT(i, found);
+            }
+            a.deallocateBatch(again, NUM_BLOCKS, 48);
+        }
+
+        if (verbose) cout << "\nNon-pooled blocks." << endl;
+        {
+            const bsls::Types::Int64 NB = ta.numBytesInUse();
+
+            const Obj::size_type LARGE = mX.maxPooledBlockSize() + 1;
+
+            a.allocateBatch(blocks, NUM_BLOCKS, LARGE);
+            ASSERT(NB < ta.numBytesInUse());
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                LOOP_ASSERT(i, blocks[i]);
+                bsl::memset(blocks[i], i, LARGE);
+            }
+            a.deallocateBatch(blocks, NUM_BLOCKS, LARGE);
+            ASSERT(NB == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nBlocks of size 0." << endl;
+        {
+            const bsls::Types::Int64 NA = ta.numAllocations();
+
+            blocks[0] = blocks;
+            a.allocateBatch(blocks, NUM_BLOCKS, 0);
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                LOOP_ASSERT(i, 0 == blocks[i]);
+            }
+            a.deallocateBatch(blocks, NUM_BLOCKS, 0);
+            ASSERT(NA == ta.numAllocations());
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'trim'
+        //
+        // Concerns:
+        //: 1 'trim' forwards to the underlying multipool, returning fully free
+        //:   chunks to the allocator and the number of bytes so released.
+        //
+        // Plan:
+        //: 1 Allocate and free a number of pooled blocks, and verify that
+        //:   'trim' reduces the memory in use by the reported amount, and
+        //:   that a second 'trim' has no effect.  (C-1)
+        //
+        // Testing:
+        //   size_type trim();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'trim'" << endl
+                                  << "==============" << endl;
+
+        enum { NUM_BLOCKS = 200 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.trim());
+
+        void *p[NUM_BLOCKS];
+        for (int i = 0; i < NUM_BLOCKS; ++i) {
+            p[i] = mX.allocate(32);
+        }
+        for (int i = 0; i < NUM_BLOCKS; ++i) {
+            mX.deallocate(p[i]);
+        }
+
+        const bsls::Types::Int64 numBytesInUse = ta.numBytesInUse();
+        const Obj::size_type numTrimmed = mX.trim();
+        ASSERT(0 < numTrimmed);
+        ASSERT(numBytesInUse - static_cast<bsls::Types::Int64>(numTrimmed)
+                                                       == ta.numBytesInUse());
+        ASSERT(0 == mX.trim());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocateAligned'
+        //
+        // Concerns:
+        //: 1 'allocateAligned', invoked through the 'bslma::Allocator'
+        //:   protocol, returns memory whose address is a multiple of the
+        //:   requested alignment.
+        //:
+        //: 2 Requesting 0 bytes returns 0 with no effect.
+        //:
+        //: 3 'deallocate' accepts blocks returned by 'allocateAligned',
+        //:   returning non-pooled memory to the underlying allocator.
+        //
+        // Plan:
+        //: 1 Using a multipool allocator supplied with a test allocator,
+        //:   request pooled and non-pooled blocks with various alignments
+        //:   through a base-class reference, verify the alignment of each
+        //:   address, fill each block entirely, and then deallocate them.
+        //:   Verify that the memory in use returns to its level prior to the
+        //:   non-pooled requests.  (C-1, 3)
+        //:
+        //: 2 Verify that a request for 0 bytes returns 0 without allocating.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void *allocateAligned(size, alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'allocateAligned'" << endl
+                                  << "=========================" << endl;
+
+        typedef bsls::Types::IntPtr IntPtr;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(&ta);  bslma::Allocator& a = mX;
+
+        const int SIZES[]    = { 1, 24, 64, 200, 4000, 10000 };
+        const int NUM_SIZES  = sizeof SIZES / sizeof *SIZES;
+
+        const int ALIGNS[]   = { 2, 16, 64, 4096 };
+        const int NUM_ALIGNS = sizeof ALIGNS / sizeof *ALIGNS;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_ALIGNS; ++j) {
+                const int SIZE  = SIZES[i];
+                const int ALIGN = ALIGNS[j];
+
+                if (veryVerbose) { T_ P_(SIZE) P(ALIGN) }
+
+                void *p = a.allocateAligned(SIZE, ALIGN);
+                ASSERTV(SIZE, ALIGN,
+                        0 == reinterpret_cast<IntPtr>(p) % ALIGN);
+                memset(p, 0xa5, SIZE);
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                a.deallocate(p);
+
+                if (SIZE > mX.maxPooledBlockSize()) {
+                    ASSERTV(SIZE, ALIGN,
+                            NUM_BLOCKS - 1 == ta.numBlocksInUse());
+                }
+            }
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+        ASSERT(0 == a.allocateAligned(0, 64));
+        ASSERT(NUM_BLOCKS == ta.numBlocksTotal());
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -771,15 +1276,26 @@ int main(int argc, char *argv[])
         //      size managed by the multipool allocator given the specified
         //      'numPools'.
         //
+        //   3) That 'loadPoolStatistics' reports the statistics of the pool
+        //      at the specified index, and in the set of pools of the
+        //      specified hint, of the underlying multipool.
+        //
         // Plan:
         //   Since the constructors are thoroughly tested at this point, simply
         //   construct a multipool allocator passing in different 'numPools'
         //   arguments specified in a test array, and verify that 'numPools'
-        //   and 'maxPooledBlockSize' return the expected values.
+        //   and 'maxPooledBlockSize' return the expected values.  Then
+        //   allocate a block of the smallest size, and verify that it is
+        //   reported in use by the first pool, and by no other pool.  Repeat
+        //   with a nonzero hint, and verify that the block is reported in use
+        //   by the first pool of that hint only, and, after it is returned,
+        //   by no pool of that hint.
         //
         // Testing:
         //   int numPools() const;
         //   int maxPooledBlockSize() const;
+        //   void loadPoolStatistics(PoolStatistics *result, int index) const;
+        //   void loadPoolStatistics(PoolStatistics *, int, int hint) const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -817,6 +1333,42 @@ int main(int argc, char *argv[])
 
             LOOP2_ASSERT(MAXBLOCKSIZE, X.maxPooledBlockSize(),
                          MAXBLOCKSIZE == X.maxPooledBlockSize());
+
+            void *p = mX.allocate(1);
+            void *q = mX.allocateWithHint(1, 1);
+
+            for (int j = 0; j < NUMPOOLS; ++j) {
+                bdlma::PoolStatistics stats;
+                X.loadPoolStatistics(&stats, j);
+
+                LOOP2_ASSERT(NUMPOOLS, j,
+                             (0 == j ? 1 : 0) == stats.d_numBlocksInUse);
+
+                X.loadPoolStatistics(&stats, j, 1);
+
+                LOOP2_ASSERT(NUMPOOLS, j,
+                             (0 == j ? 1 : 0) == stats.d_numBlocksInUse);
+
+                X.loadPoolStatistics(&stats, j, 2);
+
+                LOOP2_ASSERT(NUMPOOLS, j, 0 == stats.d_numBlocks);
+            }
+
+            mX.deallocate(q);
+
+            for (int j = 0; j < NUMPOOLS; ++j) {
+                bdlma::PoolStatistics stats;
+                X.loadPoolStatistics(&stats, j);
+
+                LOOP2_ASSERT(NUMPOOLS, j,
+                             (0 == j ? 1 : 0) == stats.d_numBlocksInUse);
+
+                X.loadPoolStatistics(&stats, j, 1);
+
+                LOOP2_ASSERT(NUMPOOLS, j, 0 == stats.d_numBlocksInUse);
+            }
+
+            mX.deallocate(p);
         }
 
       } break;
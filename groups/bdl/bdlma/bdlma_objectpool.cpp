@@ -0,0 +1,362 @@
+// bdlma_objectpool.cpp                                               -*-C++-*-
+#include <bdlma_objectpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_objectpool_cpp,"$Id$ $CSID$")
+
+#include <bdlma_threadshardutil.h>
+
+#include <new>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bsls::Types::Int64 k_INDEX_MASK = 0xffffffffLL;
+    // mask of the index of the first idle object in the head of a free stack
+
+const bsls::Types::Int64 k_COUNTER_INCREMENT = 0x100000000LL;
+    // increment of the ABA counter in the head of a free stack
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class ObjectPool_Base
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+int ObjectPool_Base::shardIndex()
+{
+    return ThreadShardUtil::shardIndex(k_NUM_SHARDS);
+}
+
+unsigned int ObjectPool_Base::detachIndices(bsls::AtomicInt64 *stack)
+{
+    bsls::Types::Int64 head = stack->loadRelaxed();
+    for (;;) {
+        if (0 == (head & k_INDEX_MASK)) {
+            return 0;                                                 // RETURN
+        }
+
+        const bsls::Types::Int64 newHead =
+                                 (head & ~k_INDEX_MASK) + k_COUNTER_INCREMENT;
+        const bsls::Types::Int64 oldHead =
+                                        stack->testAndSwapAcqRel(head,
+                                                                 newHead);
+        if (oldHead == head) {
+            return static_cast<unsigned int>(head & k_INDEX_MASK);   // RETURN
+        }
+        head = oldHead;
+    }
+}
+
+// PRIVATE MANIPULATORS
+unsigned int ObjectPool_Base::popIndex(bsls::AtomicInt64 *stack, Link link)
+{
+    bsls::Types::Int64 head = stack->loadAcquire();
+    for (;;) {
+        const unsigned int index =
+                             static_cast<unsigned int>(head & k_INDEX_MASK);
+        if (0 == index) {
+            return 0;                                                 // RETURN
+        }
+
+        // The footprint of 'index' is never released while the pool exists,
+        // so reading its link is safe even if another thread pops it first,
+        // in which case the exchange below fails (the counter in the head
+        // protecting against the ABA problem).
+
+        Header *node = reinterpret_cast<Header *>(this->node(index));
+
+        const unsigned int next =
+                        static_cast<unsigned int>((node->*link).loadRelaxed());
+
+        const bsls::Types::Int64 newHead =
+                                 (head & ~k_INDEX_MASK) + k_COUNTER_INCREMENT
+                                                                        + next;
+        const bsls::Types::Int64 oldHead =
+                                        stack->testAndSwapAcqRel(head,
+                                                                 newHead);
+        if (oldHead == head) {
+            return index;                                             // RETURN
+        }
+        head = oldHead;
+    }
+}
+
+void ObjectPool_Base::pushIndices(bsls::AtomicInt64 *stack,
+                                  unsigned int       first,
+                                  unsigned int       last,
+                                  Link               link)
+{
+    Header *node = reinterpret_cast<Header *>(this->node(last));
+
+    bsls::Types::Int64 head = stack->loadRelaxed();
+    for (;;) {
+        (node->*link).storeRelaxed(static_cast<int>(head & k_INDEX_MASK));
+
+        const bsls::Types::Int64 newHead =
+                                (head & ~k_INDEX_MASK) + k_COUNTER_INCREMENT
+                                                                       + first;
+        const bsls::Types::Int64 oldHead =
+                                        stack->testAndSwapAcqRel(head,
+                                                                 newHead);
+        if (oldHead == head) {
+            return;                                                   // RETURN
+        }
+        head = oldHead;
+    }
+}
+
+// PRIVATE ACCESSORS
+unsigned int ObjectPool_Base::lastIndex(unsigned int  first,
+                                        int          *length) const
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(length);
+
+    unsigned int index = first;
+    int          count = 1;
+    for (;;) {
+        const unsigned int next = static_cast<unsigned int>(
+                    reinterpret_cast<const Header *>(node(index))->d_next
+                                                               .loadRelaxed());
+        if (0 == next) {
+            break;
+        }
+        index = next;
+        ++count;
+    }
+
+    *length = count;
+    return index;
+}
+
+// CREATORS
+ObjectPool_Base::ObjectPool_Base(int               objectSize,
+                                 bool              useThreadCaches,
+                                 bslma::Allocator *basicAllocator)
+: d_head(0)
+, d_numAvailable(0)
+, d_numObjects(0)
+, d_shards_p(0)
+, d_numNodes(0)
+, d_abandoned(0)
+, d_nodePool(static_cast<int>(sizeof(PaddedHeader))
+             + static_cast<int>(bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                                  objectSize)),
+             basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(0 < objectSize);
+    BSLS_ASSERT(basicAllocator);
+
+    for (int i = 0; i < k_MAX_NUM_SEGMENTS; ++i) {
+        d_segments[i] = 0;
+    }
+
+    if (useThreadCaches) {
+        d_shards_p = static_cast<Shard *>(
+                      d_allocator_p->allocate(k_NUM_SHARDS * sizeof(Shard)));
+
+        for (int i = 0; i < k_NUM_SHARDS; ++i) {
+            new (&d_shards_p[i]) Shard();
+        }
+    }
+}
+
+ObjectPool_Base::~ObjectPool_Base()
+{
+    if (d_shards_p) {
+        d_allocator_p->deallocate(d_shards_p);
+    }
+
+    for (int i = 0; i < k_MAX_NUM_SEGMENTS; ++i) {
+        if (d_segments[i]) {
+            d_allocator_p->deallocate(d_segments[i]);
+        }
+    }
+
+    // The footprints are released by the destructor of 'd_nodePool'.
+}
+
+// MANIPULATORS
+void ObjectPool_Base::abandonStorage(void *object)
+{
+    BSLS_ASSERT(object);
+
+    Header *node = header(object);
+
+    BSLS_ASSERT(!node->d_isConstructed);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    node->d_next.storeRelaxed(static_cast<int>(d_abandoned));
+    d_abandoned = node->d_index;
+}
+
+void ObjectPool_Base::destroyed(void *object)
+{
+    BSLS_ASSERT(object);
+
+    header(object)->d_isConstructed = false;
+    d_numObjects.addRelaxed(-1);
+}
+
+void *ObjectPool_Base::newStorage()
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    if (d_abandoned) {
+        char *address = node(d_abandoned);
+
+        d_abandoned = static_cast<unsigned int>(
+                  reinterpret_cast<Header *>(address)->d_next.loadRelaxed());
+        return address + sizeof(PaddedHeader);                        // RETURN
+    }
+
+    const unsigned int index = d_numNodes + 1;
+    const unsigned int value = index + (1u << k_MIN_SEGMENT_SHIFT) - 1;
+
+    int segment = 0;
+    while (value >> (segment + k_MIN_SEGMENT_SHIFT + 1)) {
+        ++segment;
+    }
+
+    BSLS_ASSERT(segment < k_MAX_NUM_SEGMENTS);
+
+    if (!d_segments[segment]) {
+        const bsls::Types::size_type numEntries =
+                          bsls::Types::size_type(1)
+                                           << (segment + k_MIN_SEGMENT_SHIFT);
+
+        d_segments[segment] = static_cast<char **>(
+                         d_allocator_p->allocate(numEntries * sizeof(char *)));
+    }
+
+    char   *address = static_cast<char *>(d_nodePool.allocate());
+    Header *node    = new (address) Header;
+
+    node->d_next.storeRelaxed(0);
+    node->d_nextBatch.storeRelaxed(0);
+    node->d_index         = index;
+    node->d_isConstructed = false;
+
+    d_segments[segment][value - (1u << (segment + k_MIN_SEGMENT_SHIFT))] =
+                                                                       address;
+    d_numNodes = index;
+
+    return address + sizeof(PaddedHeader);
+}
+
+void ObjectPool_Base::constructed(void *object)
+{
+    BSLS_ASSERT(object);
+
+    header(object)->d_isConstructed = true;
+    d_numObjects.addRelaxed(1);
+}
+
+void *ObjectPool_Base::pop()
+{
+    if (d_shards_p) {
+        Shard& shard = d_shards_p[shardIndex()];
+
+        const unsigned int index = popIndex(&shard.d_head, &Header::d_next);
+        if (index) {
+            shard.d_numIndices.addRelaxed(-1);
+            d_numAvailable.addRelaxed(-1);
+            return node(index) + sizeof(PaddedHeader);                // RETURN
+        }
+    }
+
+    const unsigned int index = popIndex(&d_head, &Header::d_nextBatch);
+    if (0 == index) {
+        return 0;                                                     // RETURN
+    }
+    d_numAvailable.addRelaxed(-1);
+
+    char *address = node(index);
+
+    // The whole batch now belongs to this thread.  Keep its first object, and
+    // move the others (only batches spilled by a thread cache have any) into
+    // the cache of this thread.
+
+    const unsigned int rest = static_cast<unsigned int>(
+                  reinterpret_cast<Header *>(address)->d_next.loadRelaxed());
+    if (rest) {
+        BSLS_ASSERT(d_shards_p);
+
+        Shard& shard = d_shards_p[shardIndex()];
+
+        int                length;
+        const unsigned int last = lastIndex(rest, &length);
+
+        shard.d_numIndices.addRelaxed(length);
+        pushIndices(&shard.d_head, rest, last, &Header::d_next);
+    }
+
+    return address + sizeof(PaddedHeader);
+}
+
+void ObjectPool_Base::push(void *object)
+{
+    BSLS_ASSERT(object);
+
+    Header *node = header(object);
+
+    BSLS_ASSERT(node->d_isConstructed);
+
+    // Count the object as idle before publishing it, so that a concurrent
+    // 'pop' never makes the count negative.
+
+    d_numAvailable.addRelaxed(1);
+
+    unsigned int next = 0;
+
+    if (d_shards_p) {
+        Shard& shard = d_shards_p[shardIndex()];
+
+        if (shard.d_numIndices.loadRelaxed() < k_SHARD_CAPACITY) {
+            shard.d_numIndices.addRelaxed(1);
+            pushIndices(&shard.d_head,
+                        node->d_index,
+                        node->d_index,
+                        &Header::d_next);
+            return;                                                   // RETURN
+        }
+
+        // The cache is full: spill it, preceded by 'object', onto the shared
+        // stack as a single batch.
+
+        next = detachIndices(&shard.d_head);
+        if (next) {
+            int length;
+            lastIndex(next, &length);
+            shard.d_numIndices.addRelaxed(-length);
+        }
+    }
+
+    node->d_next.storeRelaxed(static_cast<int>(next));
+    pushIndices(&d_head, node->d_index, node->d_index, &Header::d_nextBatch);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,868 @@
+// bdlma_objectpool.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLMA_OBJECTPOOL
+#define INCLUDED_BDLMA_OBJECTPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool of reusable objects of a single type.
+//
+//@CLASSES:
+//  bdlma::ObjectPool: thread-safe pool of reusable objects
+//  bdlma::ObjectPoolFunctors: namespace for the reset policies of a pool
+//
+//@SEE_ALSO: bdlma_pool
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlma::ObjectPool',
+// that manages a pool of objects of a (template parameter) 'TYPE' using the
+// acquire-release idiom: 'getObject' returns an idle object from the pool
+// (creating one only if no object is idle), and 'releaseObject' returns an
+// object to the pool, where it remains constructed, for reuse by a later
+// 'getObject'.  Reusing an object avoids not only the allocation of its
+// footprint, but also (unlike allocating it from a 'bdlma::Pool') its
+// construction and destruction, and, for an object owning internal buffers
+// (e.g., a message holding a 'bsl::string' or a 'bsl::vector'), the
+// allocation and re-growth of those buffers.
+//
+///Reset Policies
+///--------------
+// An object released to a pool is restored to a state suitable for reuse by
+// the reset policy supplied as the (template parameter) 'RESETTER' type,
+// which is one of the following 'bdlma::ObjectPoolFunctors' (or any type
+// providing a function-call operator taking a 'TYPE *'):
+//..
+//  Policy                    Effect on release
+//  ------------------------  ------------------------------------------------
+//  Reset<TYPE> (default)     'object->reset()' is called
+//
+//  Clear<TYPE>               'object->clear()' is called (e.g., for standard
+//                            containers, which keep their capacity)
+//
+//  Nil<TYPE>                 the object is reused as is
+//
+//  Reconstruct<TYPE>         the object is destroyed and default-constructed
+//                            again (in place, without allocating its
+//                            footprint)
+//..
+// If 'TYPE' uses 'bslma::Allocator' to supply memory (see
+// 'bslma_usesbslmaallocator'), each object is constructed (and
+// reconstructed) passing the allocator of the pool, which therefore supplies
+// both the footprints of the objects and their internal buffers.
+//
+///Lock-Free Free Stack and Thread Caches
+///--------------------------------------
+// The footprint of each object is allocated, together with a small header,
+// from a 'bdlma::Pool', and is never returned to it until the object pool is
+// destroyed.  The idle objects are kept on an intrusive free stack, linked
+// through their headers, from which 'getObject' pops (and onto which
+// 'releaseObject' pushes) an object with a single compare-and-swap of the
+// head of the stack.  The head records the index of the first idle object
+// together with a counter protecting against the ABA problem, so neither
+// operation takes a lock or allocates memory.  Only the creation of a new
+// object, when no object is idle, takes a lock.
+//
+// Optionally, a pool can be created with *thread* *caches*: a small stack of
+// idle objects in each of several shards, each thread being assigned a shard
+// (in round-robin order) the first time it uses such a pool, so that, with no
+// more threads than shards, the objects released by a thread are reused by
+// that same thread (whose caches are likely to still hold them) without
+// touching the shared stack.  Each cache is itself a lock-free stack, on its
+// own cache line, so that the threads of a shard never block each other.
+//
+// The shared stack holds *batches* of idle objects: a thread releasing an
+// object when its cache is full pushes the object, followed by the whole
+// content of its cache, onto the shared stack as a single batch, and a thread
+// getting an object when its cache is empty pops a whole batch, keeping its
+// first object and moving the others into its cache.  Either exchange takes a
+// single compare-and-swap of the head of the shared stack, however many
+// objects are moved.  Without thread caches, each batch holds one object.
+//
+///Object Lifetime
+///---------------
+// The destructor of a pool destroys every object created by the pool,
+// including objects that have not been released, and releases their memory.
+// An object must therefore not be used after its pool is destroyed.
+//
+///Thread Safety
+///-------------
+// 'getObject' and 'releaseObject' (and the accessors) may be called
+// concurrently from any number of threads, provided that the allocator
+// supplied at construction is fully thread-safe.  The constructor,
+// destructor, and reset policy of 'TYPE' are invoked without synchronization
+// on the object being created, reset, or destroyed, which is not otherwise
+// shared at that time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Message Objects
+///- - - - - - - - - - - - - - - - -
+// Suppose that a server decodes each incoming message into a 'Message'
+// object, whose payload is held in a 'bsl::string' that typically grows to
+// several kilobytes.
+//
+// First, we define the 'Message' class, which uses a 'bslma::Allocator' to
+// supply memory, and provides a 'reset' method that empties the payload
+// without releasing its buffer:
+//..
+//  class Message {
+//      // This class represents a message decoded from the network.
+//
+//      // DATA
+//      int         d_type;     // type of the message
+//      bsl::string d_payload;  // body of the message
+//
+//    public:
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(Message, bslma::UsesBslmaAllocator);
+//
+//      // CREATORS
+//      explicit Message(bslma::Allocator *basicAllocator = 0)
+//      : d_type(0)
+//      , d_payload(basicAllocator)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void reset()
+//      {
+//          d_type = 0;
+//          d_payload.clear();
+//      }
+//
+//      void decode(int type, const char *data, int length)
+//      {
+//          d_type = type;
+//          d_payload.assign(data, length);
+//      }
+//
+//      // ACCESSORS
+//      const bsl::string& payload() const
+//      {
+//          return d_payload;
+//      }
+//  };
+//..
+// Then, we create a pool of messages supplied by a test allocator, so that we
+// can observe its use:
+//..
+//  bslma::TestAllocator            ta;
+//  bdlma::ObjectPool<Message>      pool(&ta);
+//..
+// Next, we handle a first message, whose decoding grows the payload of a new
+// message object:
+//..
+//  const bsl::string data(4096, 'x');
+//
+//  Message *message = pool.getObject();
+//  message->decode(1, data.c_str(), static_cast<int>(data.length()));
+//
+//  // ... handle 'message' ...
+//
+//  pool.releaseObject(message);
+//
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//  assert(1 == pool.numObjects());
+//..
+// Finally, we handle more messages, and observe that they reuse the same
+// object, and its payload buffer, without allocating any memory:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      message = pool.getObject();
+//      assert(message->payload().empty());
+//
+//      message->decode(2, data.c_str(), static_cast<int>(data.length()));
+//
+//      pool.releaseObject(message);
+//  }
+//
+//  assert(numAllocations == ta.numAllocations());
+//  assert(1              == pool.numObjects());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_POOL
+#include <bdlma_pool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // =========================
+                        // struct ObjectPoolFunctors
+                        // =========================
+
+struct ObjectPoolFunctors {
+    // This 'struct' provides a namespace for the reset policies of an
+    // 'ObjectPool', which restore a released object to a state suitable for
+    // reuse.
+
+    template <class TYPE>
+    struct Nil {
+        // This policy reuses a released object as is.
+
+        void operator()(TYPE *) const
+            // Do nothing.
+        {
+        }
+    };
+
+    template <class TYPE>
+    struct Reset {
+        // This policy calls the 'reset' method of a released object.
+
+        void operator()(TYPE *object) const
+            // Call 'reset' on the specified 'object'.
+        {
+            object->reset();
+        }
+    };
+
+    template <class TYPE>
+    struct Clear {
+        // This policy calls the 'clear' method of a released object.
+
+        void operator()(TYPE *object) const
+            // Call 'clear' on the specified 'object'.
+        {
+            object->clear();
+        }
+    };
+
+    template <class TYPE>
+    struct Reconstruct {
+        // This policy destroys a released object and default-constructs it
+        // again in place.  Note that this policy is implemented by the pool,
+        // which supplies the allocator to the new object; the function-call
+        // operator is never called.
+
+        void operator()(TYPE *) const
+            // Do nothing.
+        {
+        }
+    };
+};
+
+                           // =====================
+                           // class ObjectPool_Base
+                           // =====================
+
+class ObjectPool_Base {
+    // This component-private class manages, independently of the type of
+    // the pooled objects, the footprints of the objects of an 'ObjectPool',
+    // the lock-free free stack and thread caches of its idle objects, and the
+    // directory mapping the index of each object to its address.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_NUM_SHARDS     = 16,   // number of thread caches
+
+        k_SHARD_CAPACITY = 16    // maximum number of idle objects in each
+                                 // thread cache
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_SIZE = 128  // bytes per shard: a cache line (or a pair of
+                            // adjacent lines)
+    };
+
+    struct Header {
+        // This 'struct' precedes the footprint of each object.
+
+        bsls::AtomicInt d_next;        // index of the next idle object in
+                                       // the same thread cache or batch, or
+                                       // 0
+
+        bsls::AtomicInt d_nextBatch;   // index of the first idle object of
+                                       // the next batch on the shared stack,
+                                       // or 0 (meaningful only for the first
+                                       // object of a batch)
+
+        unsigned int    d_index;       // index of this object
+
+        bool            d_isConstructed;
+                                       // 'true' if the object is constructed
+    };
+
+    typedef bsls::AtomicInt Header::*Link;
+        // 'Link' is an alias for the member of a 'Header' linking it to the
+        // next object on a lock-free stack.
+
+    union PaddedHeader {
+        // This 'union' pads a 'Header' to maximal alignment.
+
+        char                                d_header[sizeof(Header)];
+        bsls::AlignmentUtil::MaxAlignedType d_align;
+    };
+
+    struct Shard {
+        // This 'struct' holds the thread cache of a shard, padded to
+        // 'k_SHARD_SIZE' bytes.
+
+        bsls::AtomicInt64 d_head;          // index of the first idle object
+                                           // in the cache (low 32 bits) and
+                                           // ABA counter (high 32 bits)
+
+        bsls::AtomicInt   d_numIndices;    // number of idle objects in the
+                                           // cache (possibly exceeding
+                                           // 'k_SHARD_CAPACITY' briefly)
+
+        char              d_padding[k_SHARD_SIZE
+                                    - sizeof(bsls::AtomicInt64)
+                                    - sizeof(bsls::AtomicInt)];
+    };
+
+    enum {
+        k_MIN_SEGMENT_SHIFT = 4,   // base-2 logarithm of the size of the
+                                   // first segment of the directory
+
+        k_MAX_NUM_SEGMENTS  = 28   // number of segments of the directory
+    };
+
+    // DATA
+    bsls::AtomicInt64    d_head;              // index of the first idle
+                                              // object of the first batch on
+                                              // the shared stack (low 32
+                                              // bits) and ABA counter (high
+                                              // 32 bits)
+
+    bsls::AtomicInt      d_numAvailable;      // number of idle objects
+
+    bsls::AtomicInt      d_numObjects;        // number of constructed
+                                              // objects
+
+    Shard               *d_shards_p;          // thread caches, or 0
+
+    bsls::BslLock        d_lock;              // guards the creation of
+                                              // objects
+
+    unsigned int         d_numNodes;          // number of footprints
+                                              // allocated
+
+    char               **d_segments[k_MAX_NUM_SEGMENTS];
+                                              // directory of the footprints,
+                                              // by index
+
+    unsigned int         d_abandoned;         // index of the first
+                                              // footprint whose object could
+                                              // not be constructed (linked
+                                              // through 'd_next'), or 0
+
+    Pool                 d_nodePool;          // supplies the footprints
+
+    bslma::Allocator    *d_allocator_p;       // memory allocator (held, not
+                                              // owned)
+
+  private:
+    // PRIVATE CLASS METHODS
+    static Header *header(void *object);
+        // Return the address of the header of the specified 'object'.
+
+    static int shardIndex();
+        // Return the index of the shard assigned to the calling thread,
+        // assigning one on the first call from that thread.
+
+    static unsigned int detachIndices(bsls::AtomicInt64 *stack);
+        // Empty the specified lock-free 'stack', and return the index of the
+        // object that was first on it, or 0 if it was empty.
+
+    // PRIVATE MANIPULATORS
+    unsigned int popIndex(bsls::AtomicInt64 *stack, Link link);
+        // Pop the first object from the specified lock-free 'stack', whose
+        // objects are linked through the specified 'link' member of their
+        // headers, and return its index, or 0 if 'stack' is empty.
+
+    void pushIndices(bsls::AtomicInt64 *stack,
+                     unsigned int       first,
+                     unsigned int       last,
+                     Link               link);
+        // Push the objects from the specified 'first' to the specified 'last'
+        // index, already linked through 'd_next', onto the specified
+        // lock-free 'stack', whose objects are linked through the specified
+        // 'link' member of their headers.  If 'link' is '&Header::d_next',
+        // 'last' must be the end of the chain starting at 'first';
+        // otherwise, 'last' must be 'first'.
+
+    // PRIVATE ACCESSORS
+    char *node(unsigned int index) const;
+        // Return the address of the footprint having the specified 'index'.
+
+    unsigned int lastIndex(unsigned int first, int *length) const;
+        // Return the index of the last object of the chain, linked through
+        // 'd_next', starting at the specified 'first' index, and load the
+        // number of objects of the chain into the specified 'length'.
+
+  private:
+    // NOT IMPLEMENTED
+    ObjectPool_Base(const ObjectPool_Base&);
+    ObjectPool_Base& operator=(const ObjectPool_Base&);
+
+  public:
+    // CREATORS
+    ObjectPool_Base(int               objectSize,
+                    bool              useThreadCaches,
+                    bslma::Allocator *basicAllocator);
+        // Create a pool of footprints of the specified 'objectSize' (in
+        // bytes), having thread caches if the specified 'useThreadCaches' is
+        // 'true', using the specified 'basicAllocator' to supply memory.  The
+        // behavior is undefined unless '0 < objectSize' and 'basicAllocator'
+        // is not 0.
+
+    ~ObjectPool_Base();
+        // Release the memory of every footprint.  Note that the objects must
+        // have been destroyed.
+
+    // MANIPULATORS
+    void abandonStorage(void *object);
+        // Make the footprint of the specified 'object', which is not
+        // constructed, available to a subsequent 'newStorage'.
+
+    void destroyed(void *object);
+        // Record that the specified 'object' is no longer constructed.
+
+    void *newStorage();
+        // Return the address of a footprint whose object is not constructed
+        // and is not in use.
+
+    void constructed(void *object);
+        // Record that the specified 'object' is constructed.
+
+    void *pop();
+        // Remove an idle object from the thread cache of the calling thread
+        // (if any) or the shared free stack, and return its address, or
+        // return 0 if no object is idle.
+
+    void push(void *object);
+        // Make the specified constructed 'object' idle, adding it to the
+        // thread cache of the calling thread (if any, and if it is not full),
+        // or to the shared free stack.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator supplying the memory of the pool.
+
+    bool isConstructed(int index) const;
+        // Return 'true' if the object of the footprint having the specified
+        // 'index' is constructed, and 'false' otherwise.  The behavior is
+        // undefined unless '0 <= index < numNodes()'.
+
+    void *object(int index) const;
+        // Return the address of the object of the footprint having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < numNodes()'.
+
+    int numAvailableObjects() const;
+        // Return the number of idle objects.
+
+    int numNodes() const;
+        // Return the number of footprints allocated.
+
+    int numObjects() const;
+        // Return the number of constructed objects.
+};
+
+                              // ================
+                              // class ObjectPool
+                              // ================
+
+template <class TYPE, class RESETTER = ObjectPoolFunctors::Reset<TYPE> >
+class ObjectPool {
+    // This class provides a thread-safe pool of reusable objects of the
+    // (template parameter) 'TYPE', which must be default-constructible (or
+    // constructible from a 'bslma::Allocator *' if it uses 'bslma::Allocator'
+    // to supply memory).  A released object is restored by the (template
+    // parameter) 'RESETTER' policy (see 'ObjectPoolFunctors').
+
+    // PRIVATE TYPES
+    typedef typename bsl::is_same<RESETTER,
+                                  ObjectPoolFunctors::Reconstruct<TYPE> >::type
+                                                              IsReconstructing;
+
+    // DATA
+    ObjectPool_Base d_base;  // footprints and idle objects
+
+  private:
+    // PRIVATE MANIPULATORS
+    void construct(void *address, bsl::false_type);
+    void construct(void *address, bsl::true_type);
+        // Default-construct an object of 'TYPE' at the specified 'address',
+        // passing the allocator of this pool if 'TYPE' uses
+        // 'bslma::Allocator'.
+
+    TYPE *createObject();
+        // Create an object in a new footprint, and return its address.
+
+    void resetObject(TYPE *object, bsl::false_type);
+    void resetObject(TYPE *object, bsl::true_type);
+        // Restore the specified 'object' using the reset policy.
+
+  private:
+    // NOT IMPLEMENTED
+    ObjectPool(const ObjectPool&);
+    ObjectPool& operator=(const ObjectPool&);
+
+  public:
+    // TYPES
+    enum ThreadCaching {
+        e_NO_THREAD_CACHES,  // idle objects are shared by all threads
+        e_THREAD_CACHES      // each thread first reuses the objects it
+                             // released
+    };
+
+    // CREATORS
+    explicit
+    ObjectPool(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ObjectPool(ThreadCaching     threadCaching,
+               bslma::Allocator *basicAllocator = 0);
+        // Create an empty object pool.  Optionally specify 'threadCaching',
+        // indicating whether the pool has thread caches.  If
+        // 'threadCaching' is not specified, 'e_NO_THREAD_CACHES' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory (to the
+        // pool, and to the objects if 'TYPE' uses 'bslma::Allocator').  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~ObjectPool();
+        // Destroy this object pool, and every object created by it (even if
+        // it has not been released), and release their memory.
+
+    // MANIPULATORS
+    TYPE *getObject();
+        // Return the address of an idle object from this pool, creating one
+        // if no object is idle.  If an exception is thrown by the constructor
+        // of 'TYPE', this pool is unaffected.
+
+    void releaseObject(TYPE *object);
+        // Restore the specified 'object' using the reset policy of this pool,
+        // and return it to this pool for reuse.  If an exception is thrown
+        // while restoring 'object', 'object' is destroyed (if it was not
+        // already) and its footprint is retained by this pool.  The behavior
+        // is undefined unless 'object' was obtained from this pool and has
+        // not already been released.
+
+    void reserveCapacity(int numObjects);
+        // Create the specified 'numObjects' idle objects in this pool.  The
+        // behavior is undefined unless '0 <= numObjects'.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator supplying the memory of this pool.
+
+    int numAvailableObjects() const;
+        // Return the number of idle objects in this pool.  Note that, if
+        // other threads are using this pool concurrently, the value returned
+        // may be out of date.
+
+    int numObjects() const;
+        // Return the number of objects created by this pool (and not
+        // destroyed).  Note that, if other threads are using this pool
+        // concurrently, the value returned may be out of date.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class ObjectPool_Base
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+inline
+ObjectPool_Base::Header *ObjectPool_Base::header(void *object)
+{
+    return reinterpret_cast<Header *>(static_cast<char *>(object)
+                                                      - sizeof(PaddedHeader));
+}
+
+// PRIVATE ACCESSORS
+inline
+char *ObjectPool_Base::node(unsigned int index) const
+{
+    // With 'k == k_MIN_SEGMENT_SHIFT', the segment 's' holds the '1 << (s+k)'
+    // footprints whose 'index + (1 << k) - 1' has its highest bit at 's + k'.
+
+    const unsigned int value   = index + (1u << k_MIN_SEGMENT_SHIFT) - 1;
+    int                segment = 0;
+
+    while (value >> (segment + k_MIN_SEGMENT_SHIFT + 1)) {
+        ++segment;
+    }
+
+    return d_segments[segment][value
+                               - (1u << (segment + k_MIN_SEGMENT_SHIFT))];
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *ObjectPool_Base::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bool ObjectPool_Base::isConstructed(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numNodes());
+
+    return reinterpret_cast<const Header *>(
+                         node(static_cast<unsigned int>(index) + 1))
+                                                            ->d_isConstructed;
+}
+
+inline
+void *ObjectPool_Base::object(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numNodes());
+
+    return node(static_cast<unsigned int>(index) + 1) + sizeof(PaddedHeader);
+}
+
+inline
+int ObjectPool_Base::numAvailableObjects() const
+{
+    return d_numAvailable.loadRelaxed();
+}
+
+inline
+int ObjectPool_Base::numNodes() const
+{
+    return static_cast<int>(d_numNodes);
+}
+
+inline
+int ObjectPool_Base::numObjects() const
+{
+    return d_numObjects.loadRelaxed();
+}
+
+                              // ----------------
+                              // class ObjectPool
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, class RESETTER>
+inline
+void ObjectPool<TYPE, RESETTER>::construct(void *address, bsl::false_type)
+{
+    new (address) TYPE();
+}
+
+template <class TYPE, class RESETTER>
+inline
+void ObjectPool<TYPE, RESETTER>::construct(void *address, bsl::true_type)
+{
+    new (address) TYPE(d_base.allocator());
+}
+
+template <class TYPE, class RESETTER>
+TYPE *ObjectPool<TYPE, RESETTER>::createObject()
+{
+    void *address = d_base.newStorage();
+
+    BSLS_TRY {
+        construct(address,
+                  typename bslma::UsesBslmaAllocator<TYPE>::type());
+    }
+    BSLS_CATCH(...) {
+        d_base.abandonStorage(address);
+        BSLS_RETHROW;
+    }
+
+    d_base.constructed(address);
+    return static_cast<TYPE *>(address);
+}
+
+template <class TYPE, class RESETTER>
+inline
+void ObjectPool<TYPE, RESETTER>::resetObject(TYPE *object, bsl::false_type)
+{
+    RESETTER()(object);
+}
+
+template <class TYPE, class RESETTER>
+inline
+void ObjectPool<TYPE, RESETTER>::resetObject(TYPE *object, bsl::true_type)
+{
+    object->~TYPE();
+    d_base.destroyed(object);
+
+    construct(object, typename bslma::UsesBslmaAllocator<TYPE>::type());
+    d_base.constructed(object);
+}
+
+// CREATORS
+template <class TYPE, class RESETTER>
+inline
+ObjectPool<TYPE, RESETTER>::ObjectPool(bslma::Allocator *basicAllocator)
+: d_base(static_cast<int>(sizeof(TYPE)),
+         false,
+         bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, class RESETTER>
+inline
+ObjectPool<TYPE, RESETTER>::ObjectPool(ThreadCaching     threadCaching,
+                                       bslma::Allocator *basicAllocator)
+: d_base(static_cast<int>(sizeof(TYPE)),
+         e_THREAD_CACHES == threadCaching,
+         bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, class RESETTER>
+ObjectPool<TYPE, RESETTER>::~ObjectPool()
+{
+    const int numNodes = d_base.numNodes();
+
+    for (int i = 0; i < numNodes; ++i) {
+        if (d_base.isConstructed(i)) {
+            static_cast<TYPE *>(d_base.object(i))->~TYPE();
+            d_base.destroyed(d_base.object(i));
+        }
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class RESETTER>
+inline
+TYPE *ObjectPool<TYPE, RESETTER>::getObject()
+{
+    void *object = d_base.pop();
+
+    return object ? static_cast<TYPE *>(object) : createObject();
+}
+
+template <class TYPE, class RESETTER>
+void ObjectPool<TYPE, RESETTER>::releaseObject(TYPE *object)
+{
+    BSLS_ASSERT(object);
+
+    BSLS_TRY {
+        resetObject(object, IsReconstructing());
+    }
+    BSLS_CATCH(...) {
+        // Retain the footprint, but not the object, whose state is unknown.
+        // Note that a 'Reconstruct' policy has already destroyed 'object' if
+        // its constructor throws.
+
+        if (!IsReconstructing::value) {
+            object->~TYPE();
+            d_base.destroyed(object);
+        }
+        d_base.abandonStorage(object);
+        BSLS_RETHROW;
+    }
+
+    d_base.push(object);
+}
+
+template <class TYPE, class RESETTER>
+void ObjectPool<TYPE, RESETTER>::reserveCapacity(int numObjects)
+{
+    BSLS_ASSERT(0 <= numObjects);
+
+    for (int i = 0; i < numObjects; ++i) {
+        d_base.push(createObject());
+    }
+}
+
+// ACCESSORS
+template <class TYPE, class RESETTER>
+inline
+bslma::Allocator *ObjectPool<TYPE, RESETTER>::allocator() const
+{
+    return d_base.allocator();
+}
+
+template <class TYPE, class RESETTER>
+inline
+int ObjectPool<TYPE, RESETTER>::numAvailableObjects() const
+{
+    return d_base.numAvailableObjects();
+}
+
+template <class TYPE, class RESETTER>
+inline
+int ObjectPool<TYPE, RESETTER>::numObjects() const
+{
+    return d_base.numObjects();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1133 @@
+// bdlma_objectpool.t.cpp                                             -*-C++-*-
+#include <bdlma_objectpool.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ObjectPool' keeps released objects constructed, and supplies them
+// again to later calls to 'getObject'.  The primary concerns are that an
+// object is created only when no object is idle, and is restored on release
+// by the reset policy of the pool; that objects using 'bslma::Allocator' are
+// supplied the allocator of the pool; that an exception thrown while creating
+// or restoring an object leaves the pool consistent; that objects released by
+// a thread are reused by that thread when the pool has thread caches; that
+// concurrent calls never hand out an object that is in use; and that the
+// destructor destroys every object, including objects that are in use.  A
+// counting test type, whose constructor can be made to throw, is used
+// throughout to observe the construction and destruction of objects.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ObjectPool(bslma::Allocator *basicAllocator = 0);
+// [ 2] ObjectPool(ThreadCaching threadCaching, Allocator *ba = 0);
+// [ 2] ~ObjectPool();
+//
+// MANIPULATORS
+// [ 2] TYPE *getObject();
+// [ 2] void releaseObject(TYPE *object);
+// [ 5] void reserveCapacity(int numObjects);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] int numAvailableObjects() const;
+// [ 2] int numObjects() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 3] CONCERN: Released objects are restored by the reset policy.
+// [ 4] CONCERN: Exceptions leave the pool consistent.
+// [ 5] CONCERN: Thread caches reuse the objects released by a thread.
+// [ 6] CONCERN: The pool is thread-safe.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum {
+    k_MAX_ALIGN      = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+    k_SHARD_CAPACITY = bdlma::ObjectPool_Base::k_SHARD_CAPACITY
+};
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                              // ===============
+                              // class TestValue
+                              // ===============
+
+class TestValue {
+    // This class counts its constructions, destructions, and resets, and
+    // can be made to throw from its constructor or 'reset' method.
+
+  public:
+    // CLASS DATA
+    static int s_numConstructed;   // number of constructions
+    static int s_numDestroyed;     // number of destructions
+    static int s_numResets;        // number of calls to 'reset'
+    static int s_throwCountdown;   // if positive, decremented by each
+                                   // construction and 'reset', which throws
+                                   // when it reaches 0
+
+  private:
+    // DATA
+    bsl::string d_string;     // uses the allocator of the pool
+    int         d_value;      // set by the user, cleared by 'reset'
+
+    // PRIVATE CLASS METHODS
+    static void maybeThrow()
+        // Throw an 'int' if the countdown reaches 0.
+    {
+        if (0 < s_throwCountdown && 0 == --s_throwCountdown) {
+            BSLS_THROW(0);
+        }
+    }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TestValue, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TestValue(bslma::Allocator *basicAllocator = 0)
+    : d_string(basicAllocator)
+    , d_value(0)
+    {
+        maybeThrow();
+        ++s_numConstructed;
+    }
+
+    ~TestValue()
+    {
+        ++s_numDestroyed;
+    }
+
+    // MANIPULATORS
+    void reset()
+    {
+        maybeThrow();
+        ++s_numResets;
+        d_value = 0;
+    }
+
+    void setValue(int value)
+    {
+        d_value = value;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const
+    {
+        return d_string.get_allocator().mechanism();
+    }
+
+    int value() const
+    {
+        return d_value;
+    }
+
+    // CLASS METHODS
+    static void resetCounts()
+    {
+        s_numConstructed = 0;
+        s_numDestroyed   = 0;
+        s_numResets      = 0;
+        s_throwCountdown = 0;
+    }
+};
+
+int TestValue::s_numConstructed = 0;
+int TestValue::s_numDestroyed   = 0;
+int TestValue::s_numResets      = 0;
+int TestValue::s_throwCountdown = 0;
+
+struct PlainValue {
+    // This 'struct' is a type not using 'bslma::Allocator', having a 'clear'
+    // method.
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    PlainValue()
+    : d_value(-1)
+    {
+    }
+
+    // MANIPULATORS
+    void clear()
+    {
+        d_value = -1;
+    }
+};
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase6 {
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_ITERATIONS = 2000,
+    k_NUM_OBJECTS    = 20
+};
+
+typedef bdlma::ObjectPool<PlainValue, bdlma::ObjectPoolFunctors::Clear<
+                                                        PlainValue> > Obj;
+
+struct ThreadInfo {
+    int   d_id;
+    Obj  *d_obj_p;
+    int   d_numErrors;
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    PlainValue *objects[k_NUM_OBJECTS];
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const int numObjects = 1 + i % k_NUM_OBJECTS;
+
+        for (int j = 0; j < numObjects; ++j) {
+            objects[j] = info->d_obj_p->getObject();
+            if (-1 != objects[j]->d_value) {
+                ++info->d_numErrors;
+            }
+            objects[j]->d_value = info->d_id;
+        }
+        for (int j = 0; j < numObjects; ++j) {
+            if (info->d_id != objects[j]->d_value) {
+                ++info->d_numErrors;
+            }
+            info->d_obj_p->releaseObject(objects[j]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase6
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Message Objects
+///- - - - - - - - - - - - - - - - -
+// Suppose that a server decodes each incoming message into a 'Message'
+// object, whose payload is held in a 'bsl::string' that typically grows to
+// several kilobytes.
+//
+// First, we define the 'Message' class, which uses a 'bslma::Allocator' to
+// supply memory, and provides a 'reset' method that empties the payload
+// without releasing its buffer:
+//..
+    class Message {
+        // This class represents a message decoded from the network.
+
+        // DATA
+        int         d_type;     // type of the message
+        bsl::string d_payload;  // body of the message
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Message, bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        explicit Message(bslma::Allocator *basicAllocator = 0)
+        : d_type(0)
+        , d_payload(basicAllocator)
+        {
+        }
+
+        // MANIPULATORS
+        void reset()
+        {
+            d_type = 0;
+            d_payload.clear();
+        }
+
+        void decode(int type, const char *data, int length)
+        {
+            d_type = type;
+            d_payload.assign(data, length);
+        }
+
+        // ACCESSORS
+        const bsl::string& payload() const
+        {
+            return d_payload;
+        }
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a pool of messages supplied by a test allocator, so that we
+// can observe its use:
+//..
+    bslma::TestAllocator            ta("test", veryVeryVerbose);
+    bdlma::ObjectPool<Message>      pool(&ta);
+//..
+// Next, we handle a first message, whose decoding grows the payload of a new
+// message object:
+//..
+    const bsl::string data(4096, 'x', &ta);
+
+    Message *message = pool.getObject();
+    message->decode(1, data.c_str(), static_cast<int>(data.length()));
+
+    // ... handle 'message' ...
+
+    pool.releaseObject(message);
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+    ASSERT(1 == pool.numObjects());
+//..
+// Finally, we handle more messages, and observe that they reuse the same
+// object, and its payload buffer, without allocating any memory:
+//..
+    for (int i = 0; i < 100; ++i) {
+        message = pool.getObject();
+        ASSERT(message->payload().empty());
+
+        message->decode(2, data.c_str(), static_cast<int>(data.length()));
+
+        pool.releaseObject(message);
+    }
+
+    ASSERT(numAllocations == ta.numAllocations());
+    ASSERT(1              == pool.numObjects());
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'getObject' and 'releaseObject' never hand
+        //:   out an object that is in use, and every object handed out has
+        //:   been restored by the reset policy.
+        //:
+        //: 2 The pool does not create more objects than are ever in use at
+        //:   once, plus the objects held in thread caches.
+        //:
+        //: 3 Concerns 1 and 2 hold with and without thread caches.
+        //
+        // Plan:
+        //: 1 For each configuration, with and without thread caches, run
+        //:   several threads that repeatedly get a varying number of objects
+        //:   from a shared pool, verify that each object is cleared, mark
+        //:   each with the identity of the thread, verify the marks, and
+        //:   release the objects.  (C-1, 3)
+        //:
+        //: 2 Verify that the number of objects created is bounded.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The pool is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace TestCase6;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            {
+                Obj mX(0 == cfg ? Obj::e_NO_THREAD_CACHES
+                                : Obj::e_THREAD_CACHES,
+                       &ta);
+                const Obj& X = mX;
+
+                ThreadInfo info[k_NUM_THREADS];
+                ThreadId   ids[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    info[i].d_id        = i;
+                    info[i].d_obj_p     = &mX;
+                    info[i].d_numErrors = 0;
+                    ids[i] = createThread(&threadFunction, &info[i]);
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    joinThread(ids[i]);
+                    ASSERTV(cfg, i, info[i].d_numErrors,
+                            0 == info[i].d_numErrors);
+                }
+
+                if (veryVerbose) {
+                    T_ P_(cfg) P(X.numObjects())
+                }
+
+                ASSERTV(cfg, X.numObjects(), X.numAvailableObjects(),
+                        X.numObjects() == X.numAvailableObjects());
+                ASSERTV(cfg, X.numObjects(),
+                        X.numObjects() <= k_NUM_THREADS
+                                        * (k_NUM_OBJECTS + k_SHARD_CAPACITY));
+            }
+            ASSERTV(cfg, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD CACHES AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'reserveCapacity' creates the specified number of idle objects.
+        //:
+        //: 2 With thread caches, the objects released by a thread are reused
+        //:   by that thread, most recently released first, including objects
+        //:   released beyond the capacity of its cache.
+        //
+        // Plan:
+        //: 1 Reserve objects, and verify the counts, and that getting them
+        //:   creates no objects.  (C-1)
+        //:
+        //: 2 In a pool with thread caches, get and release more objects than
+        //:   the capacity of a cache, and verify that getting them again
+        //:   supplies the same objects without creating any.  (C-2)
+        //
+        // Testing:
+        //   void reserveCapacity(int numObjects);
+        //   CONCERN: Thread caches reuse the objects released by a thread.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD CACHES AND 'reserveCapacity'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        typedef bdlma::ObjectPool<TestValue> Obj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            TestValue::resetCounts();
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.reserveCapacity(0);
+            ASSERT(0 == X.numObjects());
+
+            mX.reserveCapacity(10);
+            ASSERT(10 == X.numObjects());
+            ASSERT(10 == X.numAvailableObjects());
+            ASSERT(10 == TestValue::s_numConstructed);
+
+            TestValue *objects[10];
+            for (int i = 0; i < 10; ++i) {
+                objects[i] = mX.getObject();
+            }
+            ASSERT(10 == TestValue::s_numConstructed);
+            ASSERT( 0 == X.numAvailableObjects());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.releaseObject(objects[i]);
+            }
+            ASSERT(10 == X.numAvailableObjects());
+        }
+        ASSERT(10 == TestValue::s_numDestroyed);
+        ASSERT(0  == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting thread caches." << endl;
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            TestValue::resetCounts();
+            {
+                Obj mX(0 == cfg ? Obj::e_NO_THREAD_CACHES
+                                : Obj::e_THREAD_CACHES,
+                       &ta);
+                const Obj& X = mX;
+
+                enum { k_NUM_OBJECTS = 2 * k_SHARD_CAPACITY + 3 };
+
+                TestValue *objects[k_NUM_OBJECTS];
+                for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                    objects[i] = mX.getObject();
+                    for (int j = 0; j < i; ++j) {
+                        ASSERTV(cfg, i, j, objects[i] != objects[j]);
+                    }
+                }
+                for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                    mX.releaseObject(objects[i]);
+                }
+                ASSERTV(cfg, k_NUM_OBJECTS == X.numAvailableObjects());
+
+                // The objects are reused in LIFO order.  With thread caches,
+                // the cache of this thread was spilled, preceded by the
+                // object released, as a batch onto the shared stack each
+                // time it was full, and each batch popped from the shared
+                // stack refills the cache in the same order.
+
+                for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                    const int  expected = k_NUM_OBJECTS - 1 - i;
+                    TestValue *object   = mX.getObject();
+                    ASSERTV(cfg, i, objects[expected] == object);
+                }
+                ASSERTV(cfg, 0 == X.numAvailableObjects());
+                ASSERTV(cfg, k_NUM_OBJECTS == TestValue::s_numConstructed);
+            }
+            ASSERTV(cfg, TestValue::s_numConstructed
+                                               == TestValue::s_numDestroyed);
+            ASSERTV(cfg, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_PASS(mX.reserveCapacity(0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the constructor of 'TYPE' throws in 'getObject', the exception
+        //:   propagates, and the pool is unaffected.
+        //:
+        //: 2 The footprint of an object whose construction threw is reused by
+        //:   the next object created.
+        //:
+        //: 3 If the reset policy throws in 'releaseObject', the exception
+        //:   propagates, the object is destroyed, and its footprint is reused
+        //:   by the next object created.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Make the constructor of the test type throw, and verify the
+        //:   counts of the pool, and that the next object created occupies the
+        //:   same footprint.  (C-1..2, 4)
+        //:
+        //: 2 Make the 'reset' method of the test type throw, and the
+        //:   constructor of the test type throw in a 'Reconstruct' pool, and
+        //:   verify that the object is destroyed, and that the next object
+        //:   created occupies the same footprint.  (C-3..4)
+        //
+        // Testing:
+        //   CONCERN: Exceptions leave the pool consistent.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: EXCEPTION SAFETY" << endl
+                          << "=========================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nThrowing from the constructor." << endl;
+        {
+            TestValue::resetCounts();
+
+            typedef bdlma::ObjectPool<TestValue> Obj;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            TestValue *p = mX.getObject();
+            mX.releaseObject(p);
+            p = mX.getObject();
+
+            TestValue::s_throwCountdown = 1;
+
+            bool caught = false;
+            try {
+                mX.getObject();
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == X.numObjects());
+            ASSERT(0 == X.numAvailableObjects());
+            ASSERT(1 == TestValue::s_numConstructed);
+
+            const Int64 numAllocations = ta.numAllocations();
+
+            TestValue *q = mX.getObject();
+            ASSERT(p != q);
+            ASSERT(2 == X.numObjects());
+            ASSERT(numAllocations == ta.numAllocations());
+
+            mX.releaseObject(q);
+        }
+        ASSERT(TestValue::s_numConstructed == TestValue::s_numDestroyed);
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nThrowing from 'reset'." << endl;
+        {
+            TestValue::resetCounts();
+
+            typedef bdlma::ObjectPool<TestValue> Obj;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            TestValue *p = mX.getObject();
+
+            TestValue::s_throwCountdown = 1;
+
+            bool caught = false;
+            try {
+                mX.releaseObject(p);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == X.numObjects());
+            ASSERT(0 == X.numAvailableObjects());
+            ASSERT(1 == TestValue::s_numDestroyed);
+
+            const Int64 numAllocations = ta.numAllocations();
+
+            ASSERT(p == mX.getObject());
+            ASSERT(1 == X.numObjects());
+            ASSERT(numAllocations == ta.numAllocations());
+        }
+        ASSERT(TestValue::s_numConstructed == TestValue::s_numDestroyed);
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nThrowing while reconstructing." << endl;
+        {
+            TestValue::resetCounts();
+
+            typedef bdlma::ObjectPool<
+                      TestValue,
+                      bdlma::ObjectPoolFunctors::Reconstruct<TestValue> > Obj;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            TestValue *p = mX.getObject();
+
+            TestValue::s_throwCountdown = 1;
+
+            bool caught = false;
+            try {
+                mX.releaseObject(p);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == X.numObjects());
+            ASSERT(0 == X.numAvailableObjects());
+            ASSERT(1 == TestValue::s_numDestroyed);
+
+            ASSERT(p == mX.getObject());
+            ASSERT(1 == X.numObjects());
+        }
+        ASSERT(TestValue::s_numConstructed == TestValue::s_numDestroyed);
+        ASSERT(0 == ta.numBlocksInUse());
+#else
+        if (verbose) cout << "\nSkipped: exceptions are disabled." << endl;
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: RESET POLICIES
+        //
+        // Concerns:
+        //: 1 'Reset' calls 'reset' on a released object, and does not
+        //:   construct or destroy it.
+        //:
+        //: 2 'Clear' calls 'clear' on a released object, so that a standard
+        //:   container keeps its capacity.
+        //:
+        //: 3 'Nil' leaves a released object unchanged.
+        //:
+        //: 4 'Reconstruct' destroys a released object and constructs it again
+        //:   in place, with the allocator of the pool, without allocating its
+        //:   footprint.
+        //
+        // Plan:
+        //: 1 For each policy, get an object, modify it, release it, get it
+        //:   again, and verify its state and the counts of constructions and
+        //:   destructions.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: Released objects are restored by the reset policy.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: RESET POLICIES" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'Reset'." << endl;
+        {
+            TestValue::resetCounts();
+
+            bdlma::ObjectPool<TestValue> mX(&ta);
+
+            TestValue *p = mX.getObject();
+            p->setValue(5);
+            mX.releaseObject(p);
+
+            ASSERT(p == mX.getObject());
+            ASSERT(0 == p->value());
+            ASSERT(1 == TestValue::s_numResets);
+            ASSERT(1 == TestValue::s_numConstructed);
+            ASSERT(0 == TestValue::s_numDestroyed);
+        }
+        ASSERT(1 == TestValue::s_numDestroyed);
+
+        if (verbose) cout << "\nTesting 'Clear'." << endl;
+        {
+            typedef bsl::vector<int> Vector;
+
+            bdlma::ObjectPool<Vector,
+                              bdlma::ObjectPoolFunctors::Clear<Vector> >
+                                                                    mX(&ta);
+
+            Vector *p = mX.getObject();
+            ASSERT(&ta == p->get_allocator().mechanism());
+
+            p->resize(100);
+            const Vector::size_type capacity = p->capacity();
+            mX.releaseObject(p);
+
+            ASSERT(p == mX.getObject());
+            ASSERT(p->empty());
+            ASSERT(capacity == p->capacity());
+
+            PlainValue *q;
+            bdlma::ObjectPool<PlainValue,
+                              bdlma::ObjectPoolFunctors::Clear<PlainValue> >
+                                                                    mY(&ta);
+            q = mY.getObject();
+            q->d_value = 3;
+            mY.releaseObject(q);
+            ASSERT(q == mY.getObject());
+            ASSERT(-1 == q->d_value);
+        }
+
+        if (verbose) cout << "\nTesting 'Nil'." << endl;
+        {
+            bdlma::ObjectPool<PlainValue,
+                              bdlma::ObjectPoolFunctors::Nil<PlainValue> >
+                                                                    mX(&ta);
+
+            PlainValue *p = mX.getObject();
+            p->d_value = 3;
+            mX.releaseObject(p);
+
+            ASSERT(p == mX.getObject());
+            ASSERT(3 == p->d_value);
+        }
+
+        if (verbose) cout << "\nTesting 'Reconstruct'." << endl;
+        {
+            TestValue::resetCounts();
+
+            typedef bdlma::ObjectPool<
+                      TestValue,
+                      bdlma::ObjectPoolFunctors::Reconstruct<TestValue> > Obj;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            TestValue *p = mX.getObject();
+            p->setValue(5);
+
+            const Int64 numAllocations = ta.numAllocations();
+
+            mX.releaseObject(p);
+            ASSERT(1 == X.numObjects());
+            ASSERT(1 == X.numAvailableObjects());
+            ASSERT(numAllocations == ta.numAllocations());
+
+            ASSERT(p == mX.getObject());
+            ASSERT(0 == p->value());
+            ASSERT(&ta == p->allocator());
+            ASSERT(0 == TestValue::s_numResets);
+            ASSERT(2 == TestValue::s_numConstructed);
+            ASSERT(1 == TestValue::s_numDestroyed);
+        }
+        ASSERT(2 == TestValue::s_numDestroyed);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, 'getObject', 'releaseObject', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A pool is created empty, and uses the specified allocator, or the
+        //:   default allocator if none is specified.
+        //:
+        //: 2 'getObject' creates an object only if no object is idle, and
+        //:   supplies the allocator of the pool to objects that use
+        //:   'bslma::Allocator'.
+        //:
+        //: 3 'releaseObject' makes an object idle without destroying it.
+        //:
+        //: 4 The accessors report the numbers of objects created and idle.
+        //:
+        //: 5 The destructor destroys every object, including objects that are
+        //:   in use, and releases all memory.
+        //:
+        //: 6 Objects are maximally aligned.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create pools with and without an allocator, and with and without
+        //:   thread caches, and verify the allocator and the counts.  (C-1)
+        //:
+        //: 2 Get and release many objects, in several rounds, verifying the
+        //:   counts of the pool and of the test type, and the allocator and
+        //:   alignment of each object.  (C-2..4, 6)
+        //:
+        //: 3 Destroy a pool while some objects are in use, and verify that
+        //:   every object is destroyed and no memory is in use.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   ObjectPool(bslma::Allocator *basicAllocator = 0);
+        //   ObjectPool(ThreadCaching threadCaching, Allocator *ba = 0);
+        //   ~ObjectPool();
+        //   TYPE *getObject();
+        //   void releaseObject(TYPE *object);
+        //   bslma::Allocator *allocator() const;
+        //   int numAvailableObjects() const;
+        //   int numObjects() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, 'getObject', 'releaseObject', AND "
+                          << "ACCESSORS" << endl
+                          << "========================================="
+                          << "=========" << endl;
+
+        typedef bdlma::ObjectPool<TestValue> Obj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == X.numObjects());
+            ASSERT(0   == X.numAvailableObjects());
+
+            Obj mY(&ta);  const Obj& Y = mY;
+            ASSERT(&ta == Y.allocator());
+
+            Obj mZ(Obj::e_THREAD_CACHES);  const Obj& Z = mZ;
+            ASSERT(&da == Z.allocator());
+
+            Obj mW(Obj::e_NO_THREAD_CACHES, &ta);  const Obj& W = mW;
+            ASSERT(&ta == W.allocator());
+            ASSERT(0   == W.numObjects());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'getObject' and 'releaseObject'."
+                          << endl;
+
+        for (int cfg = 0; cfg < 2; ++cfg) {
+            TestValue::resetCounts();
+
+            const Int64 numDefaultAllocations = da.numAllocations();
+            {
+                Obj mX(0 == cfg ? Obj::e_NO_THREAD_CACHES
+                                : Obj::e_THREAD_CACHES,
+                       &ta);
+                const Obj& X = mX;
+
+                enum { k_NUM_OBJECTS = 100 };
+
+                TestValue *objects[k_NUM_OBJECTS];
+
+                for (int round = 1; round <= 3; ++round) {
+                    for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                        objects[i] = mX.getObject();
+                        ASSERTV(cfg, round, i, &ta == objects[i]->allocator());
+                        ASSERTV(cfg, round, i,
+                                0 == reinterpret_cast<UintPtr>(objects[i])
+                                                             % k_MAX_ALIGN);
+                        ASSERTV(cfg, round, i, 0 == objects[i]->value());
+                        objects[i]->setValue(i + 1);
+                    }
+                    ASSERTV(cfg, round, k_NUM_OBJECTS == X.numObjects());
+                    ASSERTV(cfg, round, 0 == X.numAvailableObjects());
+                    ASSERTV(cfg, round,
+                            k_NUM_OBJECTS == TestValue::s_numConstructed);
+
+                    for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                        ASSERTV(cfg, round, i,
+                                i + 1 == objects[i]->value());
+                        mX.releaseObject(objects[i]);
+                        ASSERTV(cfg, round, i,
+                                i + 1 == X.numAvailableObjects());
+                    }
+                    ASSERTV(cfg, round, 0 == TestValue::s_numDestroyed);
+                    ASSERTV(cfg, round,
+                            round * k_NUM_OBJECTS == TestValue::s_numResets);
+                }
+
+                // Leave some objects in use.
+
+                for (int i = 0; i < k_NUM_OBJECTS / 2; ++i) {
+                    mX.getObject();
+                }
+                ASSERTV(cfg, k_NUM_OBJECTS / 2 == X.numAvailableObjects());
+            }
+            ASSERTV(cfg, 100 == TestValue::s_numDestroyed);
+            ASSERTV(cfg, 0   == ta.numBlocksInUse());
+            ASSERTV(cfg, numDefaultAllocations == da.numAllocations());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_FAIL(mX.releaseObject(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Get and release objects, and verify that released objects are
+        //:   reused without being constructed again.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TestValue::resetCounts();
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            bdlma::ObjectPool<TestValue> mX(&ta);
+
+            TestValue *p = mX.getObject();
+            TestValue *q = mX.getObject();
+            ASSERT(p != q);
+            ASSERT(2 == TestValue::s_numConstructed);
+
+            mX.releaseObject(p);
+            mX.releaseObject(q);
+            ASSERT(0 == TestValue::s_numDestroyed);
+            ASSERT(2 == mX.numAvailableObjects());
+
+            ASSERT(q == mX.getObject());
+            ASSERT(p == mX.getObject());
+            ASSERT(2 == TestValue::s_numConstructed);
+
+            mX.releaseObject(p);
+            mX.releaseObject(q);
+        }
+        ASSERT(2 == TestValue::s_numDestroyed);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
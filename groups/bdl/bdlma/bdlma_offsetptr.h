@@ -0,0 +1,375 @@
+// bdlma_offsetptr.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLMA_OFFSETPTR
+#define INCLUDED_BDLMA_OFFSETPTR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pointer that remains valid when its memory is remapped.
+//
+//@CLASSES:
+//  bdlma::OffsetPtr: self-relative pointer to a 'TYPE' object
+//
+//@SEE_ALSO: bdlma_persistentarena, bdlma_sharedmemorypool
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlma::OffsetPtr', that refers to an object of (template parameter) type
+// 'TYPE' by storing the distance (in bytes) from the 'OffsetPtr' itself to
+// the object, rather than the address of the object.  A data structure whose
+// internal links are all 'OffsetPtr' objects is *position* *independent*: it
+// remains valid when the memory holding it is mapped at a different address,
+// e.g., when a file holding the data structure is mapped by a process other
+// than (or restarted after) the one that built it (see
+// 'bdlma_persistentarena'), or when a shared-memory segment is mapped by
+// several processes at different addresses.
+//
+// An 'OffsetPtr' and the object it refers to must lie in the same mapping.
+// An 'OffsetPtr' referring to an object outside of its own mapping (e.g., to
+// an object on the stack of a process) remains valid only as long as the
+// mapping is not moved, and is of no use in another process.
+//
+///Copy Semantics
+///--------------
+// Copying an 'OffsetPtr' recomputes the stored offset relative to the
+// address of the copy, so that the copy refers to the same object as the
+// original.  Copying the *bytes* of an 'OffsetPtr' (e.g., using 'memcpy')
+// preserves the offset instead, so that the copy refers to the object at the
+// same distance from the copy; this is what happens when a whole mapping is
+// moved, and is what makes an 'OffsetPtr' position independent.
+//
+///Null Value
+///----------
+// A null 'OffsetPtr' is represented by an offset of 1, which cannot refer to
+// an object of any type whose alignment exceeds 1.  (An offset of 0 refers to
+// the 'OffsetPtr' itself, which is a valid, if unusual, target.)  The
+// behavior is undefined if an 'OffsetPtr<char>' (or a pointer to another
+// type having an alignment of 1) is set to refer to the byte immediately
+// following it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Position-Independent Linked List
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to build a linked list in a buffer that can later be
+// copied (or mapped) at a different address.
+//
+// First, we define the node type, whose link is an 'OffsetPtr':
+//..
+//  struct Node {
+//      int                     d_value;
+//      bdlma::OffsetPtr<Node>  d_next;
+//  };
+//..
+// Then, we build a list of three nodes in a buffer:
+//..
+//  bsls::AlignedBuffer<3 * sizeof(Node)> buffer;
+//  Node *nodes = reinterpret_cast<Node *>(buffer.buffer());
+//
+//  for (int i = 0; i < 3; ++i) {
+//      nodes[i].d_value = i * 10;
+//      nodes[i].d_next  = i < 2 ? &nodes[i + 1] : 0;
+//  }
+//..
+// Next, we copy the bytes of the buffer to another location, as would happen
+// were the buffer a mapped file re-mapped at a different address:
+//..
+//  bsls::AlignedBuffer<3 * sizeof(Node)> copy;
+//  bsl::memcpy(copy.buffer(), buffer.buffer(), sizeof buffer);
+//..
+// Finally, we traverse the copied list, and observe that its links refer to
+// the copied nodes:
+//..
+//  const Node *head = reinterpret_cast<const Node *>(copy.buffer());
+//
+//  int sum = 0;
+//  for (const Node *node = head; node; node = node->d_next.get()) {
+//      assert(copy.buffer() <= reinterpret_cast<const char *>(node));
+//      sum += node->d_value;
+//  }
+//  assert(30 == sum);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                              // ===============
+                              // class OffsetPtr
+                              // ===============
+
+template <class TYPE>
+class OffsetPtr {
+    // This class template provides a pointer to an object of (template
+    // parameter) type 'TYPE', stored as the offset (in bytes) of the object
+    // from this 'OffsetPtr', so that a data structure linked by 'OffsetPtr'
+    // objects remains valid when moved as a whole.
+
+    // PRIVATE TYPES
+    enum { k_NULL_OFFSET = 1 };  // offset representing the null pointer
+
+    // DATA
+    bsls::Types::IntPtr d_offset;  // offset of the object from 'this', or
+                                   // 'k_NULL_OFFSET'
+
+    // PRIVATE MANIPULATORS
+    void setAddress(const TYPE *address);
+        // Set this pointer to refer to the object at the specified 'address',
+        // or to be null if 'address' is 0.
+
+  public:
+    // TYPES
+    typedef TYPE element_type;
+
+    // CREATORS
+    OffsetPtr();
+        // Create a null offset pointer.
+
+    OffsetPtr(TYPE *address);                                       // IMPLICIT
+        // Create an offset pointer referring to the object at the specified
+        // 'address', or a null offset pointer if 'address' is 0.
+
+    OffsetPtr(const OffsetPtr& original);
+        // Create an offset pointer referring to the same object as the
+        // specified 'original' offset pointer.
+
+    // ~OffsetPtr() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    OffsetPtr& operator=(const OffsetPtr& rhs);
+        // Make this offset pointer refer to the same object as the specified
+        // 'rhs' offset pointer, and return a reference providing modifiable
+        // access to this object.
+
+    OffsetPtr& operator=(TYPE *address);
+        // Make this offset pointer refer to the object at the specified
+        // 'address', or be null if 'address' is 0, and return a reference
+        // providing modifiable access to this object.
+
+    void reset();
+        // Make this offset pointer null.
+
+    // ACCESSORS
+    TYPE *get() const;
+        // Return the address of the object referred to by this offset
+        // pointer, or 0 if this offset pointer is null.
+
+    bool isNull() const;
+        // Return 'true' if this offset pointer is null, and 'false'
+        // otherwise.
+
+    bsls::Types::IntPtr offset() const;
+        // Return the offset (in bytes) of the object referred to by this
+        // offset pointer from the address of this offset pointer.  The
+        // behavior is undefined if this offset pointer is null.
+
+    TYPE& operator*() const;
+        // Return a reference to the object referred to by this offset
+        // pointer.  The behavior is undefined if this offset pointer is null.
+
+    TYPE *operator->() const;
+        // Return the address of the object referred to by this offset
+        // pointer.  The behavior is undefined if this offset pointer is null.
+
+    TYPE& operator[](bsls::Types::IntPtr index) const;
+        // Return a reference to the object at the specified 'index' (in units
+        // of 'TYPE' objects) from the object referred to by this offset
+        // pointer.  The behavior is undefined if this offset pointer is null.
+};
+
+// FREE OPERATORS
+template <class TYPE>
+bool operator==(const OffsetPtr<TYPE>& lhs, const OffsetPtr<TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' offset pointers refer to
+    // the same object (or are both null), and 'false' otherwise.
+
+template <class TYPE>
+bool operator!=(const OffsetPtr<TYPE>& lhs, const OffsetPtr<TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' offset pointers do not
+    // refer to the same object (and are not both null), and 'false'
+    // otherwise.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class OffsetPtr
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void OffsetPtr<TYPE>::setAddress(const TYPE *address)
+{
+    if (0 == address) {
+        d_offset = k_NULL_OFFSET;
+        return;                                                       // RETURN
+    }
+
+    d_offset = static_cast<bsls::Types::IntPtr>(
+                                reinterpret_cast<bsls::Types::UintPtr>(address)
+                              - reinterpret_cast<bsls::Types::UintPtr>(this));
+
+    BSLS_ASSERT_SAFE(k_NULL_OFFSET != d_offset);
+}
+
+// CREATORS
+template <class TYPE>
+inline
+OffsetPtr<TYPE>::OffsetPtr()
+: d_offset(k_NULL_OFFSET)
+{
+}
+
+template <class TYPE>
+inline
+OffsetPtr<TYPE>::OffsetPtr(TYPE *address)
+{
+    setAddress(address);
+}
+
+template <class TYPE>
+inline
+OffsetPtr<TYPE>::OffsetPtr(const OffsetPtr& original)
+{
+    setAddress(original.get());
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+OffsetPtr<TYPE>& OffsetPtr<TYPE>::operator=(const OffsetPtr& rhs)
+{
+    setAddress(rhs.get());
+    return *this;
+}
+
+template <class TYPE>
+inline
+OffsetPtr<TYPE>& OffsetPtr<TYPE>::operator=(TYPE *address)
+{
+    setAddress(address);
+    return *this;
+}
+
+template <class TYPE>
+inline
+void OffsetPtr<TYPE>::reset()
+{
+    d_offset = k_NULL_OFFSET;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+TYPE *OffsetPtr<TYPE>::get() const
+{
+    if (k_NULL_OFFSET == d_offset) {
+        return 0;                                                     // RETURN
+    }
+
+    // Compute the address as an integer: the object referred to is, in
+    // general, not part of the same C++ object as 'this', so that deriving
+    // its address from 'this' by pointer arithmetic would let the compiler
+    // assume (wrongly) that the two are unrelated.
+
+    return reinterpret_cast<TYPE *>(
+                                  reinterpret_cast<bsls::Types::UintPtr>(this)
+                                + d_offset);
+}
+
+template <class TYPE>
+inline
+bool OffsetPtr<TYPE>::isNull() const
+{
+    return k_NULL_OFFSET == d_offset;
+}
+
+template <class TYPE>
+inline
+bsls::Types::IntPtr OffsetPtr<TYPE>::offset() const
+{
+    BSLS_ASSERT_SAFE(!isNull());
+
+    return d_offset;
+}
+
+template <class TYPE>
+inline
+TYPE& OffsetPtr<TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(!isNull());
+
+    return *get();
+}
+
+template <class TYPE>
+inline
+TYPE *OffsetPtr<TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(!isNull());
+
+    return get();
+}
+
+template <class TYPE>
+inline
+TYPE& OffsetPtr<TYPE>::operator[](bsls::Types::IntPtr index) const
+{
+    BSLS_ASSERT_SAFE(!isNull());
+
+    return get()[index];
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE>
+inline
+bool bdlma::operator==(const OffsetPtr<TYPE>& lhs, const OffsetPtr<TYPE>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class TYPE>
+inline
+bool bdlma::operator!=(const OffsetPtr<TYPE>& lhs, const OffsetPtr<TYPE>& rhs)
+{
+    return lhs.get() != rhs.get();
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
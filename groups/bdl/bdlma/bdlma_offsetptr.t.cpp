@@ -0,0 +1,538 @@
+// bdlma_offsetptr.t.cpp                                              -*-C++-*-
+#include <bdlma_offsetptr.h>
+
+#include <bdls_testutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::OffsetPtr' is a value-semantic-like pointer type that stores the
+// offset of the object it refers to from itself.  The primary concerns are
+// that an offset pointer refers to the object it was set to, that copying an
+// offset pointer (by copy construction or assignment) preserves the object
+// referred to, and that copying the *bytes* of an offset pointer together
+// with its target preserves the distance between them.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] OffsetPtr();
+// [ 2] OffsetPtr(TYPE *address);
+// [ 3] OffsetPtr(const OffsetPtr& original);
+//
+// MANIPULATORS
+// [ 3] OffsetPtr& operator=(const OffsetPtr& rhs);
+// [ 2] OffsetPtr& operator=(TYPE *address);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] TYPE *get() const;
+// [ 2] bool isNull() const;
+// [ 4] bsls::Types::IntPtr offset() const;
+// [ 4] TYPE& operator*() const;
+// [ 4] TYPE *operator->() const;
+// [ 4] TYPE& operator[](bsls::Types::IntPtr index) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const OffsetPtr& lhs, const OffsetPtr& rhs);
+// [ 4] bool operator!=(const OffsetPtr& lhs, const OffsetPtr& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: Copying the bytes of a structure preserves its links.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::OffsetPtr<int> Obj;
+
+struct Pair {
+    // This 'struct' holds an offset pointer and a value it may refer to.
+
+    Obj d_ptr;
+    int d_value[4];
+};
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Position-Independent Linked List
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to build a linked list in a buffer that can later be
+// copied (or mapped) at a different address.
+//
+// First, we define the node type, whose link is an 'OffsetPtr':
+//..
+    struct Node {
+        int                     d_value;
+        bdlma::OffsetPtr<Node>  d_next;
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we build a list of three nodes in a buffer:
+//..
+    bsls::AlignedBuffer<3 * sizeof(Node)> buffer;
+    Node *nodes = reinterpret_cast<Node *>(buffer.buffer());
+
+    for (int i = 0; i < 3; ++i) {
+        nodes[i].d_value = i * 10;
+        nodes[i].d_next  = i < 2 ? &nodes[i + 1] : 0;
+    }
+//..
+// Next, we copy the bytes of the buffer to another location, as would happen
+// were the buffer a mapped file re-mapped at a different address:
+//..
+    bsls::AlignedBuffer<3 * sizeof(Node)> copy;
+    bsl::memcpy(copy.buffer(), buffer.buffer(), sizeof buffer);
+//..
+// Finally, we traverse the copied list, and observe that its links refer to
+// the copied nodes:
+//..
+    const Node *head = reinterpret_cast<const Node *>(copy.buffer());
+
+    int sum = 0;
+    for (const Node *node = head; node; node = node->d_next.get()) {
+        ASSERT(copy.buffer() <= reinterpret_cast<const char *>(node));
+        sum += node->d_value;
+    }
+    ASSERT(30 == sum);
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DEREFERENCING, COMPARISON, AND POSITION INDEPENDENCE
+        //
+        // Concerns:
+        //: 1 'operator*', 'operator->', and 'operator[]' provide access to the
+        //:   object (or array element) referred to.
+        //:
+        //: 2 'offset' returns the distance from the offset pointer to the
+        //:   object referred to, which may be negative.
+        //:
+        //: 3 Two offset pointers compare equal if and only if they refer to
+        //:   the same object or are both null, wherever they are located.
+        //:
+        //: 4 Copying the bytes of an offset pointer together with its target
+        //:   yields an offset pointer referring to the copy of the target.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Set offset pointers to refer to objects before and after them,
+        //:   and verify the values returned by the accessors.  (C-1..2)
+        //:
+        //: 2 Compare offset pointers at different locations referring to the
+        //:   same and different objects, and null offset pointers.  (C-3)
+        //:
+        //: 3 'memcpy' a structure holding an offset pointer and its target,
+        //:   and verify that the copied pointer refers to the copied target.
+        //:   (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered when dereferencing a null offset pointer.  (C-5)
+        //
+        // Testing:
+        //   bsls::Types::IntPtr offset() const;
+        //   TYPE& operator*() const;
+        //   TYPE *operator->() const;
+        //   TYPE& operator[](bsls::Types::IntPtr index) const;
+        //   bool operator==(const OffsetPtr& lhs, const OffsetPtr& rhs);
+        //   bool operator!=(const OffsetPtr& lhs, const OffsetPtr& rhs);
+        //   CONCERN: Copying the bytes of a structure preserves its links.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "DEREFERENCING, COMPARISON, AND POSITION INDEPENDENCE"
+                      << endl
+                      << "===================================================="
+                      << endl;
+
+        if (verbose) cout << "\nTesting dereferencing and 'offset'." << endl;
+        {
+            struct Holder {
+                int d_before[2];
+                Obj d_ptr;
+                int d_after[2];
+            } h;
+
+            h.d_before[0] = 1;  h.d_before[1] = 2;
+            h.d_after[0]  = 3;  h.d_after[1]  = 4;
+
+            Obj& mX = h.d_ptr;  const Obj& X = mX;
+
+            mX = &h.d_after[0];
+
+            ASSERT(3 == *X);
+            ASSERT(4 == X[1]);
+            ASSERT(reinterpret_cast<char *>(&h.d_after[0])
+                                - reinterpret_cast<char *>(&mX) == X.offset());
+            ASSERT(0 < X.offset());
+
+            *X = 30;
+            ASSERT(30 == h.d_after[0]);
+
+            mX = &h.d_before[0];
+
+            ASSERT(1 == *X);
+            ASSERT(2 == X[1]);
+            ASSERT(0 > X.offset());
+
+            bdlma::OffsetPtr<Pair> mP;  const bdlma::OffsetPtr<Pair>& P = mP;
+            Pair                   pair;
+
+            mP = &pair;
+            P->d_value[2] = 7;
+            ASSERT(7 == pair.d_value[2]);
+        }
+
+        if (verbose) cout << "\nTesting comparison." << endl;
+        {
+            int a = 0, b = 0;
+
+            Obj x1(&a), x2(&a), y(&b), n1, n2;
+
+            ASSERT(  x1 == x2 );
+            ASSERT(!(x1 != x2));
+            ASSERT(  x1 != y  );
+            ASSERT(!(x1 == y) );
+            ASSERT(  n1 == n2 );
+            ASSERT(  x1 != n1 );
+            ASSERT(!(n1 == x1));
+        }
+
+        if (verbose) cout << "\nTesting position independence." << endl;
+        {
+            Pair original;
+
+            original.d_ptr = &original.d_value[1];
+            original.d_value[1] = 42;
+
+            Pair copy;
+            bsl::memcpy(static_cast<void *>(&copy),
+                        &original,
+                        sizeof original);
+
+            ASSERT(&copy.d_value[1] == copy.d_ptr.get());
+            ASSERT(42               == *copy.d_ptr);
+            ASSERT(original.d_ptr.offset() == copy.d_ptr.offset());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int       a = 0;
+            const Obj X(&a);
+            const Obj N;
+
+            ASSERT_SAFE_PASS(*X);
+            ASSERT_SAFE_FAIL(*N);
+            ASSERT_SAFE_PASS(X.operator->());
+            ASSERT_SAFE_FAIL(N.operator->());
+            ASSERT_SAFE_PASS(X[0]);
+            ASSERT_SAFE_FAIL(N[0]);
+            ASSERT_SAFE_PASS(X.offset());
+            ASSERT_SAFE_FAIL(N.offset());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTOR AND COPY-ASSIGNMENT OPERATOR
+        //
+        // Concerns:
+        //: 1 A copy of an offset pointer, located elsewhere, refers to the
+        //:   same object as the original (i.e., the stored offset is
+        //:   recomputed rather than copied).
+        //:
+        //: 2 A copy of a null offset pointer is null.
+        //:
+        //: 3 The original is unaffected.
+        //:
+        //: 4 Assignment returns a reference to the target, and
+        //:   self-assignment has no effect.
+        //
+        // Plan:
+        //: 1 Copy-construct and copy-assign offset pointers located at
+        //:   different addresses from null and non-null originals, and verify
+        //:   'get' on both the copy and the original.  (C-1..4)
+        //
+        // Testing:
+        //   OffsetPtr(const OffsetPtr& original);
+        //   OffsetPtr& operator=(const OffsetPtr& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "COPY CONSTRUCTOR AND COPY-ASSIGNMENT OPERATOR"
+                         << endl
+                         << "============================================="
+                         << endl;
+
+        int  values[3] = { 1, 2, 3 };
+        Obj  originals[2];
+
+        originals[0] = &values[1];
+
+        for (int i = 0; i < 2; ++i) {
+            const Obj& X   = originals[i];
+            int       *EXP = X.get();
+
+            if (veryVerbose) { T_ P_(i) P(EXP) }
+
+            const Obj Y(X);
+
+            ASSERTV(i, EXP == Y.get());
+            ASSERTV(i, EXP == X.get());
+
+            Obj  mZ[2];
+            Obj& mR = (mZ[1] = X);
+
+            ASSERTV(i, &mR == &mZ[1]);
+            ASSERTV(i, EXP == mZ[1].get());
+            ASSERTV(i, EXP == X.get());
+
+            mZ[1] = mZ[1];
+
+            ASSERTV(i, EXP == mZ[1].get());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed offset pointer is null.
+        //:
+        //: 2 An offset pointer constructed or assigned from an address refers
+        //:   to the object at that address, and is null if the address is 0.
+        //:
+        //: 3 'reset' makes an offset pointer null.
+        //:
+        //: 4 Assignment from an address returns a reference to the target.
+        //
+        // Plan:
+        //: 1 Create, assign, and reset offset pointers using addresses of
+        //:   objects before and after the pointer, and 0, and verify 'get' and
+        //:   'isNull'.  (C-1..4)
+        //
+        // Testing:
+        //   OffsetPtr();
+        //   OffsetPtr(TYPE *address);
+        //   OffsetPtr& operator=(TYPE *address);
+        //   void reset();
+        //   TYPE *get() const;
+        //   bool isNull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        int a = 1;
+        int b = 2;
+
+        {
+            const Obj X;
+
+            ASSERT(0 == X.get());
+            ASSERT(X.isNull());
+        }
+        {
+            const Obj X(&a);
+
+            ASSERT(&a == X.get());
+            ASSERT(!X.isNull());
+        }
+        {
+            const Obj X(0);
+
+            ASSERT(0 == X.get());
+            ASSERT(X.isNull());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Obj& mR = (mX = &b);
+
+            ASSERT(&mR == &mX);
+            ASSERT(&b  == X.get());
+
+            mX = &a;
+            ASSERT(&a  == X.get());
+
+            mX = 0;
+            ASSERT(0   == X.get());
+            ASSERT(X.isNull());
+
+            mX = &b;
+            mX.reset();
+            ASSERT(0   == X.get());
+            ASSERT(X.isNull());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create offset pointers, set them to refer to objects, copy them,
+        //:   and verify the objects they refer to.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        int value = 5;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.isNull());
+
+        mX = &value;
+        ASSERT(&value == X.get());
+        ASSERT(5      == *X);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(&value == Y.get());
+        ASSERT(X      == Y);
+
+        mY.reset();
+        ASSERT(Y.isNull());
+        ASSERT(X      != Y);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,422 @@
+// bdlma_persistentarena.cpp                                          -*-C++-*-
+#include <bdlma_persistentarena.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_persistentarena_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>     // 'CreateFileA', 'CreateFileMappingA',
+                         // 'MapViewOfFile', 'UnmapViewOfFile',
+                         // 'FlushViewOfFile'
+#else
+
+#include <fcntl.h>       // 'open'
+#include <sys/mman.h>    // 'mmap', 'msync', 'munmap'
+#include <sys/stat.h>    // 'fstat'
+#include <unistd.h>      // 'close', 'ftruncate'
+
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+
+enum {
+    k_VERSION = 1  // version of the file format
+};
+
+const bsls::Types::Uint64 k_MAGIC = 0x62646c6d61706172ULL;  // "bdlmapar"
+
+struct Header {
+    // This 'struct' describes the header at the start of the file of a
+    // persistent arena.
+
+    bsls::Types::Uint64            d_magic;       // 'k_MAGIC'
+
+    int                            d_version;     // 'k_VERSION'
+
+    int                            d_headerSize;  // 'k_HEADER_SIZE'
+
+    bsls::Types::Int64             d_size;        // size of the file
+
+    AtomicOps::AtomicTypes::Int64  d_offset;      // offset of the first free
+                                                  // byte
+
+    bsls::Types::Int64             d_rootOffset;  // offset of the root
+                                                  // object, or 0 if none
+};
+
+BSLMF_ASSERT(sizeof(Header) <= bdlma::PersistentArena::k_HEADER_SIZE);
+BSLMF_ASSERT(0 == bdlma::PersistentArena::k_HEADER_SIZE
+                                   % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+// HELPER FUNCTIONS
+
+bool isValid(const Header& header, bsls::Types::Int64 fileSize)
+    // Return 'true' if the specified 'header' describes a persistent arena
+    // held in a file of the specified 'fileSize' (in bytes), and 'false'
+    // otherwise.
+{
+    const bsls::Types::Int64 offset = AtomicOps::getInt64Relaxed(
+                                                             &header.d_offset);
+
+    const int headerSize = bdlma::PersistentArena::k_HEADER_SIZE;
+
+    return k_MAGIC                == header.d_magic
+        && k_VERSION              == header.d_version
+        && headerSize             == header.d_headerSize
+        && fileSize               == header.d_size
+        && headerSize             <= offset
+        && offset                 <= fileSize
+        && 0                      <= header.d_rootOffset
+        && header.d_rootOffset    <  offset;
+}
+
+void *mapFile(bsls::Types::Int64 *fileSize,
+              bool               *created,
+              const char         *path,
+              bsls::Types::Int64  size)
+    // Map the file at the specified 'path', creating it with the specified
+    // 'size' (in bytes) if it does not exist or is empty, load its size into
+    // the specified 'fileSize', load into the specified 'created' whether it
+    // was created (or extended from 0 bytes), and return the address of the
+    // mapping.  Return 0, with no effect on 'fileSize' and 'created', if the
+    // file cannot be created or mapped.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    HANDLE file = CreateFileA(path,
+                              GENERIC_READ | GENERIC_WRITE,
+                              0,
+                              0,
+                              OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL,
+                              0);
+    if (INVALID_HANDLE_VALUE == file) {
+        return 0;                                                     // RETURN
+    }
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length)) {
+        CloseHandle(file);
+        return 0;                                                     // RETURN
+    }
+
+    const bool isNew = 0 == length.QuadPart;
+    if (isNew) {
+        length.QuadPart = size;
+    }
+
+    // Creating a mapping larger than the file extends the file.
+
+    HANDLE mapping = CreateFileMappingA(file,
+                                        0,
+                                        PAGE_READWRITE,
+                                        static_cast<DWORD>(length.QuadPart
+                                                                      >> 32),
+                                        static_cast<DWORD>(length.QuadPart),
+                                        0);
+    CloseHandle(file);
+
+    if (0 == mapping) {
+        return 0;                                                     // RETURN
+    }
+
+    void *address = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (0 == address) {
+        return 0;                                                     // RETURN
+    }
+
+    *fileSize = length.QuadPart;
+    *created  = isNew;
+    return address;                                                   // RETURN
+
+#else
+
+    const int fd = ::open(path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) {
+        return 0;                                                     // RETURN
+    }
+
+    struct stat info;
+    if (0 != fstat(fd, &info)) {
+        ::close(fd);
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Int64 length = info.st_size;
+
+    const bool isNew = 0 == length;
+    if (isNew) {
+        if (0 != ftruncate(fd, static_cast<off_t>(size))) {
+            ::close(fd);
+            return 0;                                                 // RETURN
+        }
+        length = size;
+    }
+
+    // The mapping remains valid after the file descriptor is closed.
+
+    void *address = mmap(0,
+                         static_cast<bsl::size_t>(length),
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         fd,
+                         0);
+    ::close(fd);
+
+    if (MAP_FAILED == address) {
+        if (isNew) {
+            // Leave the file empty, so that it is initialized by the next
+            // successful 'open'.
+
+            truncate(path, 0);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    *fileSize = length;
+    *created  = isNew;
+    return address;                                                   // RETURN
+
+#endif
+}
+
+void unmapFile(void *address, bsls::Types::Int64 size)
+    // Unmap the file of the specified 'size' (in bytes) mapped at the
+    // specified 'address'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    UnmapViewOfFile(address);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), static_cast<bsl::size_t>(size));
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                           // ---------------------
+                           // class PersistentArena
+                           // ---------------------
+
+// CREATORS
+PersistentArena::PersistentArena()
+: d_base_p(0)
+, d_size(0)
+, d_wasCreated(false)
+{
+}
+
+PersistentArena::~PersistentArena()
+{
+    close();
+}
+
+// MANIPULATORS
+void *PersistentArena::allocate(size_type size)
+{
+    BSLS_ASSERT(isOpen());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                               size > static_cast<size_type>(d_size))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    // All allocations are rounded up to a multiple of the maximal alignment,
+    // so that the offset of the first free byte is always maximally aligned.
+
+    const bsls::Types::Int64 paddedSize = static_cast<bsls::Types::Int64>(
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(size));
+
+    Header *header = reinterpret_cast<Header *>(d_base_p);
+
+    // Advance the offset of the first free byte, unless another thread does
+    // so first.
+
+    bsls::Types::Int64 offset = AtomicOps::getInt64Relaxed(&header->d_offset);
+    for (;;) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                             paddedSize > d_size - offset)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                         &header->d_offset,
+                                                         offset,
+                                                         offset + paddedSize);
+        if (previous == offset) {
+            break;
+        }
+        offset = previous;
+    }
+
+    return d_base_p + offset;
+}
+
+void PersistentArena::close()
+{
+    if (d_base_p) {
+        unmapFile(d_base_p, d_size);
+
+        d_base_p     = 0;
+        d_size       = 0;
+        d_wasCreated = false;
+    }
+}
+
+int PersistentArena::open(const char *path, bsls::Types::Int64 size)
+{
+    BSLS_ASSERT(path);
+    BSLS_ASSERT(!isOpen());
+    BSLS_ASSERT(k_HEADER_SIZE < size);
+
+    bsls::Types::Int64  fileSize = 0;
+    bool                created  = false;
+
+    void *address = mapFile(&fileSize, &created, path, size);
+    if (0 == address) {
+        return 1;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address);
+
+    if (created) {
+        // A newly created file is zero-filled; initialize its header.
+
+        header->d_magic      = k_MAGIC;
+        header->d_version    = k_VERSION;
+        header->d_headerSize = k_HEADER_SIZE;
+        header->d_size       = fileSize;
+        header->d_rootOffset = 0;
+        AtomicOps::setInt64(&header->d_offset, k_HEADER_SIZE);
+    }
+    else if (fileSize < k_HEADER_SIZE || !isValid(*header, fileSize)) {
+        unmapFile(address, fileSize);
+        return 2;                                                     // RETURN
+    }
+
+    d_base_p     = static_cast<char *>(address);
+    d_size       = fileSize;
+    d_wasCreated = created;
+
+    return 0;
+}
+
+void PersistentArena::setRoot(const void *address)
+{
+    BSLS_ASSERT(isOpen());
+
+    Header *header = reinterpret_cast<Header *>(d_base_p);
+
+    if (0 == address) {
+        header->d_rootOffset = 0;
+        return;                                                       // RETURN
+    }
+
+    const char *p = static_cast<const char *>(address);
+
+    BSLS_ASSERT(d_base_p + k_HEADER_SIZE <= p);
+    BSLS_ASSERT(p < d_base_p + AtomicOps::getInt64(&header->d_offset));
+
+    header->d_rootOffset = p - d_base_p;
+}
+
+int PersistentArena::sync()
+{
+    BSLS_ASSERT(isOpen());
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return !FlushViewOfFile(d_base_p, 0);                             // RETURN
+
+#else
+
+    return msync(d_base_p, static_cast<bsl::size_t>(d_size), MS_SYNC);
+                                                                      // RETURN
+
+#endif
+}
+
+// ACCESSORS
+bsls::Types::Int64 PersistentArena::capacity() const
+{
+    return d_base_p ? d_size - k_HEADER_SIZE : 0;
+}
+
+bsls::Types::Int64 PersistentArena::numBytesInUse() const
+{
+    if (0 == d_base_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const Header *header = reinterpret_cast<const Header *>(d_base_p);
+
+    return AtomicOps::getInt64Relaxed(&header->d_offset) - k_HEADER_SIZE;
+}
+
+void *PersistentArena::root() const
+{
+    BSLS_ASSERT(isOpen());
+
+    const Header *header = reinterpret_cast<const Header *>(d_base_p);
+
+    return header->d_rootOffset ? d_base_p + header->d_rootOffset : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,350 @@
+// bdlma_persistentarena.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_PERSISTENTARENA
+#define INCLUDED_BDLMA_PERSISTENTARENA
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an arena allocator whose memory persists in a mapped file.
+//
+//@CLASSES:
+//  bdlma::PersistentArena: sequential allocator over a memory-mapped file
+//
+//@SEE_ALSO: bdlma_offsetptr, bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::PersistentArena', that implements the 'bslma::Allocator' protocol
+// by sequentially allocating memory from a file mapped into the address space
+// of the process.  Because the file outlives the process, a data structure
+// built in the arena by one process can be used by a later process (e.g., the
+// same program, restarted) simply by mapping the file again, without
+// rebuilding the data structure; the operating system reads the pages of the
+// file on demand, as they are first accessed:
+//..
+//   ,----------------------.
+//  ( bdlma::PersistentArena )
+//   `----------------------'
+//              |         ctor/dtor
+//              |         open
+//              |         close
+//              |         sync
+//              |         setRoot
+//              |         capacity
+//              |         isOpen
+//              |         numBytesInUse
+//              |         root
+//              |         wasCreated
+//              V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                        allocate
+//                        deallocate
+//..
+// As with 'bdlma::BufferedSequentialAllocator', memory is allocated from the
+// arena by advancing an offset, and 'deallocate' has no effect; the memory of
+// the arena is reclaimed only by deleting (or recreating) its file.  Unlike a
+// buffered sequential allocator, a 'bdlma::PersistentArena' never obtains
+// memory from another allocator: when its file is exhausted, 'allocate'
+// throws 'bsl::bad_alloc'.
+//
+///Position Independence
+///---------------------
+// A file is not, in general, mapped at the same address each time it is
+// opened, so a data structure stored in a persistent arena must not contain
+// raw pointers (to objects either within or outside of the arena).  Links
+// between the objects of the data structure should instead be represented by
+// 'bdlma::OffsetPtr' objects (see 'bdlma_offsetptr'), which store the
+// distance between the pointer and the object it refers to, and therefore
+// remain valid wherever the file is mapped.  Note that, for the same reason,
+// containers that store raw pointers to the memory they allocate (e.g.,
+// 'bsl::vector' and 'bsl::unordered_map') cannot be stored in a persistent
+// arena.
+//
+// A persistent arena holds, in the header of its file, the offset of a single
+// *root* object, typically the top-level object of the data structure stored
+// in the arena, which is set by 'setRoot' and retrieved (as an address in the
+// current mapping) by 'root'.
+//
+///File Format
+///-----------
+// The file of a persistent arena starts with a header recording a magic
+// number, a format version, the size of the file, the offset of the next
+// free byte, and the offset of the root object.  'open' refuses a file whose
+// header does not match (e.g., a file that was not created by
+// 'bdlma::PersistentArena', or that was truncated).  The contents of the file
+// are native to the platform that created it: a file must not be opened on a
+// platform having a different byte order, pointer size, or alignment
+// requirements, nor by a program whose stored types have a different layout.
+//
+///Durability
+///----------
+// Modifications made to the arena are visible to any process that opens the
+// file afterwards, even if this process terminates abnormally, as long as the
+// operating system does not crash: they are held in the page cache of the
+// operating system, which writes them back to the file in the background.
+// 'sync' forces that write-back, after which the contents of the arena also
+// survive a crash of the operating system.
+//
+///Thread Safety
+///-------------
+// The 'allocate' method of 'bdlma::PersistentArena' is thread-safe (it may be
+// called concurrently with 'allocate', 'deallocate', and the accessors).  The
+// other manipulators are not thread-safe.  A file must not be opened by more
+// than one 'bdlma::PersistentArena' (in the same or different processes) at
+// the same time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Reference Data Across Restarts
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service loads a large table of reference data at startup,
+// which takes a long time to build, and that we want a restarted service to
+// reuse the table built by its predecessor.
+//
+// First, we define the (position-independent) table, an array of entries
+// linked to the table by an 'OffsetPtr':
+//..
+//  struct Entry {
+//      int    d_key;
+//      double d_value;
+//  };
+//
+//  struct Table {
+//      int                      d_numEntries;
+//      bdlma::OffsetPtr<Entry>  d_entries;
+//  };
+//..
+// Then, we define a function that returns the table held by a persistent
+// arena, building the table only if the arena was just created:
+//..
+//  const Table *loadTable(bdlma::PersistentArena *arena, const char *path)
+//  {
+//      if (0 != arena->open(path, 1024 * 1024)) {
+//          return 0;                                                 // RETURN
+//      }
+//
+//      if (arena->wasCreated()) {
+//          Table *table = new (*arena) Table;
+//
+//          table->d_numEntries = 1000;
+//          table->d_entries    = static_cast<Entry *>(
+//                                   arena->allocate(1000 * sizeof(Entry)));
+//
+//          for (int i = 0; i < 1000; ++i) {
+//              table->d_entries[i].d_key   = i;
+//              table->d_entries[i].d_value = i * 0.5;
+//          }
+//
+//          arena->setRoot(table);
+//      }
+//
+//      return static_cast<const Table *>(arena->root());
+//  }
+//..
+// Next, the first run of the service builds the table:
+//..
+//  {
+//      bdlma::PersistentArena arena;
+//
+//      const Table *table = loadTable(&arena, path);
+//
+//      assert(table);
+//      assert(arena.wasCreated());
+//      assert(1000 == table->d_numEntries);
+//  }
+//..
+// Finally, a later run of the service finds the table already built:
+//..
+//  {
+//      bdlma::PersistentArena arena;
+//
+//      const Table *table = loadTable(&arena, path);
+//
+//      assert(table);
+//      assert(!arena.wasCreated());
+//      assert(1000  == table->d_numEntries);
+//      assert(499.5 == table->d_entries[999].d_value);
+//  }
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                           // =====================
+                           // class PersistentArena
+                           // =====================
+
+class PersistentArena BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete sequential allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, and supplies memory from a
+    // file mapped into the address space of the process, so that the objects
+    // allocated from it persist after the arena is closed.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_HEADER_SIZE = 64  // size (in bytes) of the header of the file of an
+                            // arena, which is not available for allocation
+    };
+
+  private:
+    // DATA
+    char               *d_base_p;     // address of the mapping, or 0 if not
+                                      // open
+
+    bsls::Types::Int64  d_size;       // size (in bytes) of the mapping
+
+    bool                d_wasCreated; // 'true' if the file was created by
+                                      // the last successful 'open'
+
+  private:
+    // NOT IMPLEMENTED
+    PersistentArena(const PersistentArena&);
+    PersistentArena& operator=(const PersistentArena&);
+
+  public:
+    // CREATORS
+    PersistentArena();
+        // Create a persistent arena that is not open.
+
+    virtual ~PersistentArena();
+        // Close this arena (if open), and destroy this object.  Note that the
+        // memory allocated from this arena persists in its file, but is no
+        // longer accessible through addresses returned by 'allocate'.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned block of memory of the
+        // specified 'size' (in bytes) allocated from the file of this arena.
+        // If 'size' is 0, no memory is allocated and 0 is returned.  If the
+        // file does not have 'size' free bytes, throw 'bsl::bad_alloc'.  The
+        // behavior is undefined unless this arena is open.
+
+    void close();
+        // Unmap the file of this arena, if it is open.  Note that this method
+        // does not wait for modifications to be written to the file (see
+        // {Durability}).
+
+    virtual void deallocate(void *address);
+        // This method has no effect on the memory block at the specified
+        // 'address', as all memory allocated by this arena persists in its
+        // file.  The behavior is undefined unless 'address' is 0 or was
+        // allocated by this arena and has not already been deallocated.
+
+    int open(const char *path, bsls::Types::Int64 size);
+        // Map the file at the specified 'path' into the address space of the
+        // process, creating it with the specified 'size' (in bytes) if it does
+        // not exist or is empty.  Return 0 on success, and a non-zero value
+        // (with no effect on this arena) if the file cannot be created or
+        // mapped, or if it exists but does not hold a persistent arena (see
+        // {File Format}).  If the file exists and is not empty, 'size' is
+        // ignored and the arena has the size with which the file was created.
+        // The behavior is undefined unless this arena is not open and
+        // 'k_HEADER_SIZE < size'.  Note that a file created by an unsuccessful
+        // call may be left in place, empty.
+
+    void setRoot(const void *address);
+        // Record, in the file of this arena, the specified 'address' as the
+        // address of the root object of this arena, or that there is no root
+        // object if 'address' is 0.  The behavior is undefined unless this
+        // arena is open and 'address' is 0 or was returned by 'allocate'.
+
+    int sync();
+        // Wait until the modifications made to the arena have been written to
+        // its file.  Return 0 on success, and a non-zero value otherwise.
+        // The behavior is undefined unless this arena is open.
+
+    // ACCESSORS
+    bsls::Types::Int64 capacity() const;
+        // Return the number of bytes of the file of this arena that are
+        // available for allocation, whether or not allocated, or 0 if this
+        // arena is not open.
+
+    bool isOpen() const;
+        // Return 'true' if this arena is open, and 'false' otherwise.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes of the file of this arena that have been
+        // allocated (including any alignment padding), or 0 if this arena is
+        // not open.
+
+    void *root() const;
+        // Return the address, in the current mapping, of the root object of
+        // this arena, or 0 if no root object was set.  The behavior is
+        // undefined unless this arena is open.
+
+    bool wasCreated() const;
+        // Return 'true' if the file of this arena was created (or
+        // initialized) by the last successful call to 'open', and 'false' if
+        // it held a persistent arena already.  The behavior is undefined
+        // unless this arena is open.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class PersistentArena
+                           // ---------------------
+
+// MANIPULATORS
+inline
+void PersistentArena::deallocate(void *)
+{
+}
+
+// ACCESSORS
+inline
+bool PersistentArena::isOpen() const
+{
+    return 0 != d_base_p;
+}
+
+inline
+bool PersistentArena::wasCreated() const
+{
+    return d_wasCreated;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
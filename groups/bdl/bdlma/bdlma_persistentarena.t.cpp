@@ -0,0 +1,948 @@
+// bdlma_persistentarena.t.cpp                                        -*-C++-*-
+#include <bdlma_persistentarena.h>
+
+#include <bdlma_offsetptr.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#include <process.h>    // '_getpid'
+#else
+#include <pthread.h>
+#include <unistd.h>     // 'getpid'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::PersistentArena' is a sequential allocator over a memory-mapped
+// file.  The primary concerns are that 'open' creates and initializes a new
+// file, accepts an existing file holding an arena (with its contents, offset,
+// and root intact), and refuses any other file; that 'allocate' returns
+// maximally-aligned, non-overlapping blocks until the file is exhausted, even
+// when called concurrently; and that no memory is obtained from any other
+// allocator.  The test cases create files, named after the process and test
+// case, in the current directory, and remove them when done.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] PersistentArena();
+// [ 2] ~PersistentArena();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 2] void close();
+// [ 3] void deallocate(void *address);
+// [ 2] int open(const char *path, bsls::Types::Int64 size);
+// [ 4] void setRoot(const void *address);
+// [ 4] int sync();
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 capacity() const;
+// [ 2] bool isOpen() const;
+// [ 3] bsls::Types::Int64 numBytesInUse() const;
+// [ 4] void *root() const;
+// [ 2] bool wasCreated() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: Data structures persist across 'close' and 'open'.
+// [ 5] CONCERN: The 'allocate' method is thread-safe.
+// [ *] CONCERN: No memory is obtained from the default or global allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::PersistentArena Obj;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum {
+    k_MAX_ALIGN   = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+    k_HEADER_SIZE = Obj::k_HEADER_SIZE
+};
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class TempFile {
+    // This class provides the name of a file, unique to the process and the
+    // specified test case and index, that is removed on destruction.
+
+    // DATA
+    char d_path[128];
+
+  public:
+    // CREATORS
+    TempFile(int testCase, int index)
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        const int pid = _getpid();
+#else
+        const int pid = static_cast<int>(getpid());
+#endif
+        bsl::sprintf(d_path,
+                     "bdlma_persistentarena.%d.%d.%d.tmp",
+                     pid,
+                     testCase,
+                     index);
+        bsl::remove(d_path);
+    }
+
+    ~TempFile()
+    {
+        bsl::remove(d_path);
+    }
+
+    // ACCESSORS
+    const char *path() const
+    {
+        return d_path;
+    }
+};
+
+static
+void writeFile(const char *path, const char *contents, int length)
+    // Create (or overwrite) the file at the specified 'path' with the
+    // specified 'length' bytes of the specified 'contents'.
+{
+    FILE *file = bsl::fopen(path, "wb");
+    ASSERT(file);
+    if (length) {
+        ASSERT(1 == bsl::fwrite(contents, length, 1, file));
+    }
+    bsl::fclose(file);
+}
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase4 {
+
+struct Node {
+    // This 'struct' is a node of a position-independent linked list.
+
+    int                     d_value;
+    bdlma::OffsetPtr<Node>  d_next;
+};
+
+}  // close namespace TestCase4
+
+namespace TestCase5 {
+
+enum { k_NUM_THREADS = 8, k_NUM_BLOCKS = 1000, k_MAX_SIZE = 40 };
+
+struct ThreadInfo {
+    int    d_id;
+    Obj   *d_obj_p;
+    char  *d_blocks[k_NUM_BLOCKS];
+};
+
+inline
+int blockSize(int index)
+    // Return the size of the block having the specified 'index'.
+{
+    return 1 + index % k_MAX_SIZE;
+}
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+        info->d_blocks[i] = static_cast<char *>(
+                                      info->d_obj_p->allocate(blockSize(i)));
+        bsl::memset(info->d_blocks[i], info->d_id, blockSize(i));
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Reference Data Across Restarts
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service loads a large table of reference data at startup,
+// which takes a long time to build, and that we want a restarted service to
+// reuse the table built by its predecessor.
+//
+// First, we define the (position-independent) table, an array of entries
+// linked to the table by an 'OffsetPtr':
+//..
+    struct Entry {
+        int    d_key;
+        double d_value;
+    };
+
+    struct Table {
+        int                      d_numEntries;
+        bdlma::OffsetPtr<Entry>  d_entries;
+    };
+//..
+// Then, we define a function that returns the table held by a persistent
+// arena, building the table only if the arena was just created:
+//..
+    const Table *loadTable(bdlma::PersistentArena *arena, const char *path)
+    {
+        if (0 != arena->open(path, 1024 * 1024)) {
+            return 0;                                                 // RETURN
+        }
+
+        if (arena->wasCreated()) {
+            Table *table = new (*arena) Table;
+
+            table->d_numEntries = 1000;
+            table->d_entries    = static_cast<Entry *>(
+                                     arena->allocate(1000 * sizeof(Entry)));
+
+            for (int i = 0; i < 1000; ++i) {
+                table->d_entries[i].d_key   = i;
+                table->d_entries[i].d_value = i * 0.5;
+            }
+
+            arena->setRoot(table);
+        }
+
+        return static_cast<const Table *>(arena->root());
+    }
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is obtained from the default or global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        TempFile    file(test, 0);
+        const char *path = file.path();
+
+// Next, the first run of the service builds the table:
+//..
+    {
+        bdlma::PersistentArena arena;
+
+        const Table *table = loadTable(&arena, path);
+
+        ASSERT(table);
+        ASSERT(arena.wasCreated());
+        ASSERT(1000 == table->d_numEntries);
+    }
+//..
+// Finally, a later run of the service finds the table already built:
+//..
+    {
+        bdlma::PersistentArena arena;
+
+        const Table *table = loadTable(&arena, path);
+
+        ASSERT(table);
+        ASSERT(!arena.wasCreated());
+        ASSERT(1000  == table->d_numEntries);
+        ASSERT(499.5 == table->d_entries[999].d_value);
+    }
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' return non-overlapping blocks.
+        //:
+        //: 2 The number of bytes in use accounts for every allocation.
+        //
+        // Plan:
+        //: 1 Have several threads allocate blocks of various sizes from a
+        //:   common arena, filling each block with a per-thread pattern.
+        //:   After joining the threads, verify the pattern of every block,
+        //:   and that the number of bytes in use is the sum of the padded
+        //:   sizes of the blocks.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' method is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace TestCase5;
+
+        Int64 expectedBytes = 0;
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            expectedBytes += bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                                 blockSize(i));
+        }
+        expectedBytes *= k_NUM_THREADS;
+
+        TempFile file(test, 0);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.open(file.path(), expectedBytes + k_HEADER_SIZE));
+
+        ThreadId   threads[k_NUM_THREADS];
+        ThreadInfo infos[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            infos[i].d_id    = i + 1;
+            infos[i].d_obj_p = &mX;
+
+            threads[i] = createThread(&threadFunction, &infos[i]);
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(threads[i]);
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                const char *p = infos[i].d_blocks[j];
+                for (int k = 0; k < blockSize(j); ++k) {
+                    ASSERTV(i, j, k, infos[i].d_id == p[k]);
+                }
+            }
+        }
+
+        ASSERTV(expectedBytes, X.numBytesInUse(),
+                expectedBytes == X.numBytesInUse());
+        ASSERT(X.capacity() == X.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ROOT AND PERSISTENCE
+        //
+        // Concerns:
+        //: 1 'root' returns 0 for a new arena.
+        //:
+        //: 2 'root' returns the address last passed to 'setRoot', and 0 after
+        //:   'setRoot(0)'.
+        //:
+        //: 3 The contents of the arena, its root, and the offset of its first
+        //:   free byte persist after the arena is closed and the file is
+        //:   opened again (by the same or another 'PersistentArena' object),
+        //:   even if the file is mapped at a different address.
+        //:
+        //: 4 'sync' succeeds.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Build a linked list of 'OffsetPtr'-linked nodes in a new arena,
+        //:   set its head as the root, call 'sync', and close the arena.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Open the file with another object while the address at which it
+        //:   was mapped is occupied by another mapping, traverse the list from
+        //:   the root, and verify that further allocations do not overlap the
+        //:   list.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for roots outside of the allocated part of the arena.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void setRoot(const void *address);
+        //   int sync();
+        //   void *root() const;
+        //   CONCERN: Data structures persist across 'close' and 'open'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROOT AND PERSISTENCE" << endl
+                          << "====================" << endl;
+
+        using TestCase4::Node;
+
+        enum { k_NUM_NODES = 100 };
+
+        TempFile file(test, 0);
+        TempFile other(test, 1);
+
+        const char *firstAddress = 0;
+        Int64       numBytes     = 0;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 64 * 1024));
+            ASSERT(0 == X.root());
+
+            Node *head = 0;
+            for (int i = 0; i < k_NUM_NODES; ++i) {
+                Node *node = new (mX) Node;
+
+                node->d_value = i;
+                node->d_next  = head;
+                head          = node;
+            }
+
+            mX.setRoot(head);
+            ASSERT(head == X.root());
+
+            mX.setRoot(0);
+            ASSERT(0    == X.root());
+
+            mX.setRoot(head);
+            ASSERT(head == X.root());
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                char *base = static_cast<char *>(static_cast<void *>(head))
+                           - (X.numBytesInUse() - sizeof(Node))
+                           - k_HEADER_SIZE;
+
+                ASSERT_PASS(mX.setRoot(head));
+                ASSERT_PASS(mX.setRoot(base + k_HEADER_SIZE));
+                ASSERT_FAIL(mX.setRoot(base));
+                ASSERT_FAIL(mX.setRoot(base + k_HEADER_SIZE
+                                            + X.numBytesInUse()));
+                mX.setRoot(head);
+            }
+
+            ASSERT(0 == mX.sync());
+
+            firstAddress = static_cast<char *>(X.root());
+            numBytes     = X.numBytesInUse();
+        }
+
+        // Occupy the address range of the first mapping (most likely), so
+        // that the file is mapped elsewhere.
+
+        Obj mY;
+        ASSERT(0 == mY.open(other.path(), 64 * 1024));
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 1024));
+            ASSERT(!X.wasCreated());
+            ASSERT(numBytes == X.numBytesInUse());
+
+            if (veryVerbose) {
+                P_(static_cast<const void *>(firstAddress)) P(X.root())
+            }
+
+            const Node *node  = static_cast<const Node *>(X.root());
+            int         count = 0;
+            while (node) {
+                ASSERTV(count, k_NUM_NODES - 1 - count == node->d_value);
+
+                node = node->d_next.get();
+                ++count;
+            }
+            ASSERTV(count, k_NUM_NODES == count);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            ASSERT(static_cast<char *>(X.root()) + sizeof(Node) <= p);
+            ASSERT(numBytes + 8 <= X.numBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned blocks, each following the
+        //:   previous one, within the mapping of the file.
+        //:
+        //: 2 'numBytesInUse' increases by the size of each allocation rounded
+        //:   up to the maximal alignment.
+        //:
+        //: 3 'allocate(0)' returns 0 and has no effect.
+        //:
+        //: 4 'deallocate' has no effect.
+        //:
+        //: 5 'allocate' throws 'bsl::bad_alloc', with no effect, if the file
+        //:   does not have enough free bytes, and the arena can be filled
+        //:   exactly.
+        //
+        // Plan:
+        //: 1 Allocate blocks of sizes 1 to 100 bytes, writing to every byte,
+        //:   and verify their alignment, addresses, and the bytes in use.
+        //:   Deallocate them and verify that the bytes in use are unchanged.
+        //:   (C-1..4)
+        //:
+        //: 2 Allocate from a small arena until it is exhausted, and verify
+        //:   that the allocation that does not fit throws 'bsl::bad_alloc'
+        //:   while a smaller one then succeeds.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        TempFile file(test, 0);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 64 * 1024));
+
+            char  *blocks[101];
+            char  *next     = 0;
+            Int64  expected = 0;
+
+            for (int size = 1; size <= 100; ++size) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, 0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGN);
+                ASSERTV(size, 0 == next || next == p);
+
+                bsl::memset(p, size, size);
+
+                const int padded = static_cast<int>(
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(size));
+
+                expected += padded;
+                next      = p + padded;
+
+                ASSERTV(size, expected == X.numBytesInUse());
+
+                blocks[size] = p;
+            }
+
+            ASSERT(0        == mX.allocate(0));
+            ASSERT(expected == X.numBytesInUse());
+
+            for (int size = 1; size <= 100; ++size) {
+                ASSERTV(size, static_cast<char>(size) == blocks[size][0]);
+                mX.deallocate(blocks[size]);
+            }
+            mX.deallocate(0);
+
+            ASSERT(expected == X.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting exhaustion." << endl;
+        {
+            TempFile small(test, 1);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(small.path(), k_HEADER_SIZE + 1024));
+            ASSERT(1024 == X.capacity());
+
+            mX.allocate(1000);
+
+            const Int64 NUM_BYTES = X.numBytesInUse();
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.allocate(1024 - NUM_BYTES + 1);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(NUM_BYTES == X.numBytesInUse());
+
+            caught = false;
+            try {
+                mX.allocate(static_cast<bslma::Allocator::size_type>(-1));
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(NUM_BYTES == X.numBytesInUse());
+#endif
+
+            ASSERT(0    != mX.allocate(1024 - NUM_BYTES));
+            ASSERT(1024 == X.numBytesInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, DTOR, 'open', 'close', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed arena is not open, and has no capacity and
+        //:   no bytes in use.
+        //:
+        //: 2 'open' creates a file of the specified size if it does not exist
+        //:   or is empty, and 'wasCreated' then returns 'true'.
+        //:
+        //: 3 'open' maps an existing arena file with the size it was created
+        //:   with, ignoring the specified size, and 'wasCreated' then returns
+        //:   'false'.
+        //:
+        //: 4 'open' fails, leaving the arena closed, if the file cannot be
+        //:   created, or if it exists but does not hold an arena.
+        //:
+        //: 5 'close' closes the arena, and has no effect on a closed arena;
+        //:   the destructor closes the arena.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise 'open' and 'close' on new, empty, existing, invalid,
+        //:   truncated, and uncreatable files, and verify the accessors after
+        //:   each call.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   PersistentArena();
+        //   ~PersistentArena();
+        //   void close();
+        //   int open(const char *path, bsls::Types::Int64 size);
+        //   bsls::Types::Int64 capacity() const;
+        //   bool isOpen() const;
+        //   bool wasCreated() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, DTOR, 'open', 'close', AND BASIC ACCESSORS"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        TempFile file(test, 0);
+
+        if (verbose) cout << "\nTesting default construction." << endl;
+        {
+            const Obj X;
+
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting new and existing files." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 8192));
+            ASSERT(X.isOpen());
+            ASSERT(X.wasCreated());
+            ASSERT(8192 - k_HEADER_SIZE == X.capacity());
+            ASSERT(0 == X.numBytesInUse());
+
+            mX.allocate(100);
+
+            mX.close();
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.capacity());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+
+            ASSERT(0 == mX.open(file.path(), 100000));
+            ASSERT(X.isOpen());
+            ASSERT(!X.wasCreated());
+            ASSERT(8192 - k_HEADER_SIZE == X.capacity());
+            ASSERT(0 < X.numBytesInUse());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 100000));
+            ASSERT(!X.wasCreated());
+        }
+
+        if (verbose) cout << "\nTesting empty files." << endl;
+        {
+            writeFile(file.path(), "", 0);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 4096));
+            ASSERT(X.wasCreated());
+            ASSERT(4096 - k_HEADER_SIZE == X.capacity());
+        }
+
+        if (verbose) cout << "\nTesting invalid files." << endl;
+        {
+            char garbage[256];
+            bsl::memset(garbage, 'x', sizeof garbage);
+
+            static const int LENGTHS[] = { 1, 10, k_HEADER_SIZE, 256 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                writeFile(file.path(), garbage, LENGTHS[ti]);
+
+                Obj mX;  const Obj& X = mX;
+
+                ASSERTV(LENGTHS[ti], 0 != mX.open(file.path(), 4096));
+                ASSERTV(LENGTHS[ti], !X.isOpen());
+            }
+
+            // A valid arena file that was truncated.
+
+            bsl::remove(file.path());
+            {
+                Obj mX;
+                ASSERT(0 == mX.open(file.path(), 8192));
+            }
+
+            char contents[4096];
+            FILE *f = bsl::fopen(file.path(), "rb");
+            ASSERT(f);
+            ASSERT(1 == bsl::fread(contents, sizeof contents, 1, f));
+            bsl::fclose(f);
+
+            writeFile(file.path(), contents, sizeof contents);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.open(file.path(), 8192));
+            ASSERT(!X.isOpen());
+        }
+
+        if (verbose) cout << "\nTesting uncreatable files." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.open("no_such_directory/arena.tmp", 4096));
+            ASSERT(!X.isOpen());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::remove(file.path());
+
+            Obj mX;
+
+            ASSERT_FAIL(mX.open(0, 4096));
+            ASSERT_FAIL(mX.open(file.path(), k_HEADER_SIZE));
+            ASSERT_PASS(mX.open(file.path(), k_HEADER_SIZE + 1));
+            ASSERT_FAIL(mX.open(file.path(), 4096));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an arena, allocate a block, write to it, set it as the
+        //:   root, close the arena, and verify that the block can be read
+        //:   after opening the file again.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TempFile file(test, 0);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(!X.isOpen());
+            ASSERT(0 == mX.open(file.path(), 4096));
+            ASSERT(X.isOpen());
+            ASSERT(X.wasCreated());
+
+            char *p = static_cast<char *>(mX.allocate(6));
+            bsl::memcpy(p, "hello", 6);
+
+            mX.setRoot(p);
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.open(file.path(), 4096));
+            ASSERT(!X.wasCreated());
+            ASSERT(X.root());
+            ASSERT(0 == bsl::strcmp("hello",
+                                    static_cast<const char *>(X.root())));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is obtained from the default or global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
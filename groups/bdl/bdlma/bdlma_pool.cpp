@@ -4,7 +4,10 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_pool_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
 #include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
 #include <bsls_performancehint.h>
 
 #include <bsl_algorithm.h>
@@ -31,7 +34,11 @@ enum {
     k_GROWTH_FACTOR      =  2,  // multiplicative factor by which to grow pool
                                 // capacity
 
-    k_MAX_CHUNK_SIZE     = 32   // maximum number of blocks per chunk
+    k_MAX_CHUNK_SIZE     = 32,  // maximum number of blocks per chunk
+
+    k_ADAPTIVE_MAX_CHUNK_BYTES = 64 * 1024
+                                // default maximum chunk size (in bytes) when
+                                // adaptive growth is used
 };
 
 // LOCAL FUNCTIONS
@@ -46,6 +53,81 @@ int roundUp(int x, int y)
     return (x + y - 1) / y * y;
 }
 
+static inline
+int chunkBytes(int numBlocks, int internalBlockSize, int headerSize)
+    // Return the number of bytes obtained from the underlying allocator for a
+    // chunk of the specified 'numBlocks' memory blocks of the specified
+    // 'internalBlockSize', overlaid by a 'Chunk' header of the specified
+    // 'headerSize'.  The size is a multiple of the maximal alignment so that
+    // both the header and the blocks are maximally aligned even if the
+    // underlying allocator returns naturally-aligned memory.
+{
+    return (numBlocks * internalBlockSize + headerSize - 1)
+           & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+}
+
+template <class NODE>
+NODE *sortByAddress(NODE *head)
+    // Sort the singly-linked list (linked through 'd_next_p') starting at the
+    // specified 'head' into ascending address order, and return the new head
+    // of the list.  Note that this function implements a bottom-up merge sort
+    // and allocates no memory.
+{
+    if (!head) {
+        return head;                                                  // RETURN
+    }
+
+    for (bsl::size_t runLength = 1; ; runLength *= 2) {
+        NODE        *remaining = head;
+        NODE       **tail      = &head;
+        bsl::size_t  numMerges = 0;
+
+        while (remaining) {
+            ++numMerges;
+
+            // Split off two runs of at most 'runLength' nodes each.
+
+            NODE        *a     = remaining;
+            NODE        *b     = remaining;
+            bsl::size_t  lenA  = 0;
+            while (b && lenA < runLength) {
+                b = b->d_next_p;
+                ++lenA;
+            }
+            bsl::size_t lenB = runLength;
+
+            // Merge the two runs onto 'tail'.
+
+            while (lenA > 0 || (lenB > 0 && b)) {
+                NODE *next;
+                if (0 == lenA) {
+                    next = b;
+                    b    = b->d_next_p;
+                    --lenB;
+                }
+                else if (0 == lenB || !b || a <= b) {
+                    next = a;
+                    a    = a->d_next_p;
+                    --lenA;
+                }
+                else {
+                    next = b;
+                    b    = b->d_next_p;
+                    --lenB;
+                }
+                *tail = next;
+                tail  = &next->d_next_p;
+            }
+            remaining = b;
+        }
+        *tail = 0;
+
+        if (numMerges <= 1) {
+            return head;                                              // RETURN
+        }
+    }
+}
+
 }  // close unnamed namespace
 
                         // ----------
@@ -53,13 +135,29 @@ int roundUp(int x, int y)
                         // ----------
 
 // PRIVATE MANIPULATORS
+char *Pool::allocateChunk(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    const int size = chunkBytes(numBlocks,
+                                d_internalBlockSize,
+                                static_cast<int>(sizeof(Chunk)));
+
+    Chunk *chunk = static_cast<Chunk *>(d_allocator_p->allocate(size));
+
+    chunk->d_next_p    = d_chunkList_p;
+    chunk->d_numBlocks = numBlocks;
+    d_chunkList_p      = chunk;
+
+    return reinterpret_cast<char *>(&chunk->d_memory);
+}
+
 void Pool::replenish()
 {
-    d_begin_p = static_cast<char *>(d_blockList.allocate(d_chunkSize
-                                                       * d_internalBlockSize));
-    d_end_p = d_begin_p + d_chunkSize * d_internalBlockSize;
+    d_begin_p = allocateChunk(d_chunkSize);
+    d_end_p   = d_begin_p + d_chunkSize * d_internalBlockSize;
 
-    if (   bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
+    if (   bsls::BlockGrowth::BSLS_CONSTANT != d_growthStrategy
         && d_chunkSize < d_maxBlocksPerChunk) {
 
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
@@ -80,9 +178,13 @@ Pool::Pool(int blockSize, bslma::Allocator *basicAllocator)
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
+, d_freeListLength(0)
+, d_numAllocations(0)
+, d_numDeallocations(0)
 {
     BSLS_ASSERT(1 <= blockSize);
 
@@ -101,15 +203,25 @@ Pool::Pool(int                          blockSize,
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(growthStrategy)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
+, d_freeListLength(0)
+, d_numAllocations(0)
+, d_numDeallocations(0)
 {
     BSLS_ASSERT(1 <= blockSize);
 
     d_internalBlockSize = bsl::max(
                      static_cast<int>(sizeof(Link)),
                      roundUp(blockSize, bsls::AlignmentFromType<Link>::VALUE));
+
+    if (bsls::BlockGrowth::BSLS_ADAPTIVE == growthStrategy) {
+        d_maxBlocksPerChunk = bsl::max(
+                         static_cast<int>(k_MAX_CHUNK_SIZE),
+                         k_ADAPTIVE_MAX_CHUNK_BYTES / d_internalBlockSize);
+    }
 }
 
 Pool::Pool(int                          blockSize,
@@ -123,9 +235,13 @@ Pool::Pool(int                          blockSize,
 , d_maxBlocksPerChunk(maxBlocksPerChunk)
 , d_growthStrategy(growthStrategy)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
+, d_freeListLength(0)
+, d_numAllocations(0)
+, d_numDeallocations(0)
 {
     BSLS_ASSERT(1 <= blockSize);
     BSLS_ASSERT(1 <= maxBlocksPerChunk);
@@ -139,23 +255,119 @@ Pool::~Pool()
 {
     BSLS_ASSERT(static_cast<int>(sizeof(Link)) <= d_internalBlockSize);
     BSLS_ASSERT(0 < d_chunkSize);
+
+    release();
 }
 
 // MANIPULATORS
-void Pool::reserveCapacity(int numBlocks)
+void Pool::allocateBatch(void **blocks, int numBlocks)
 {
+    BSLS_ASSERT(blocks || 0 == numBlocks);
     BSLS_ASSERT(0 <= numBlocks);
 
-    Link *p = d_freeList_p;
-    while (p && numBlocks > 0) {
-        p = p->d_next_p;
-        --numBlocks;
+    d_numAllocations += numBlocks;
+
+    void       **cursor = blocks;
+    void **const end    = blocks + numBlocks;
+
+    // Dispense blocks in the same order as 'allocate' (the current chunk,
+    // then the free list), without modifying this pool until any new chunk
+    // has been obtained, so that the pool is left unchanged if the underlying
+    // allocator throws.
+
+    char *begin = d_begin_p;
+    while (begin != d_end_p && cursor != end) {
+        *cursor++  = begin;
+        begin     += d_internalBlockSize;
+    }
+
+    Link *freeList  = d_freeList_p;
+    int   numReused = 0;
+    while (freeList && cursor != end) {
+        *cursor++ = freeList;
+        freeList  = freeList->d_next_p;
+        ++numReused;
+    }
+
+    if (cursor == end) {
+        d_begin_p         = begin;
+        d_freeList_p      = freeList;
+        d_freeListLength -= numReused;
+        return;                                                       // RETURN
+    }
+
+    const int numNeeded = static_cast<int>(end - cursor);
+
+    if (numNeeded > d_chunkSize) {
+        // The remainder does not fit in the chunk the growth strategy would
+        // supply next; obtain a chunk dedicated to this request.
+
+        d_begin_p = allocateChunk(numNeeded);
+        d_end_p   = d_begin_p + numNeeded * d_internalBlockSize;
+    }
+    else {
+        replenish();
+    }
+
+    d_freeList_p     = 0;
+    d_freeListLength = 0;
+
+    for (; cursor != end; ++cursor) {
+        *cursor    = d_begin_p;
+        d_begin_p += d_internalBlockSize;
+    }
+}
+
+void Pool::deallocateBatch(void *const *blocks, int numBlocks)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    d_numDeallocations += numBlocks;
+
+    const int last = numBlocks - 1;
+
+    for (int i = 0; i < last; ++i) {
+        BSLS_ASSERT_SAFE(blocks[i]);
+
+        static_cast<Link *>(blocks[i])->d_next_p =
+                                            static_cast<Link *>(blocks[i + 1]);
     }
 
+    BSLS_ASSERT_SAFE(blocks[last]);
+
+    static_cast<Link *>(blocks[last])->d_next_p = d_freeList_p;
+    d_freeList_p      = static_cast<Link *>(blocks[0]);
+    d_freeListLength += numBlocks;
+}
+
+void Pool::release()
+{
+    while (d_chunkList_p) {
+        Chunk *chunk  = d_chunkList_p;
+        d_chunkList_p = chunk->d_next_p;
+        d_allocator_p->deallocate(chunk);
+    }
+
+    d_freeList_p     = 0;
+    d_freeListLength = 0;
+    d_begin_p        = 0;
+    d_end_p          = 0;
+}
+
+void Pool::reserveCapacity(int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+
+    numBlocks -= bsl::min(numBlocks, d_freeListLength);
+
     if (numBlocks > 0 && d_end_p == d_begin_p) {
-        d_begin_p = static_cast<char *>(d_blockList.allocate(numBlocks
-                                                       * d_internalBlockSize));
-        d_end_p = d_begin_p + numBlocks * d_internalBlockSize;
+        d_begin_p = allocateChunk(numBlocks);
+        d_end_p   = d_begin_p + numBlocks * d_internalBlockSize;
         return;                                                       // RETURN
     }
 
@@ -165,8 +377,7 @@ void Pool::reserveCapacity(int numBlocks)
 
         // Allocate memory and add its blocks to the free list.
 
-        char *begin = static_cast<char *>(
-                        d_blockList.allocate(numBlocks * d_internalBlockSize));
+        char *begin = allocateChunk(numBlocks);
         char *end   = begin + (numBlocks - 1) * d_internalBlockSize;
 
         for (char *p = begin; p < end; p += d_internalBlockSize) {
@@ -175,8 +386,120 @@ void Pool::reserveCapacity(int numBlocks)
         }
 
         reinterpret_cast<Link *>(end)->d_next_p = d_freeList_p;
-        d_freeList_p = reinterpret_cast<Link *>(begin);
+        d_freeList_p      = reinterpret_cast<Link *>(begin);
+        d_freeListLength += numBlocks;
+    }
+}
+
+void Pool::sortFreeList()
+{
+    d_freeList_p = sortByAddress(d_freeList_p);
+}
+
+bsls::Types::size_type Pool::trim()
+{
+    if (!d_freeList_p && d_begin_p == d_end_p) {
+        return 0;                                                     // RETURN
+    }
+
+    // Sort both the free list and the chunk list by address, then sweep them
+    // together, counting the free blocks that fall within each chunk.  The
+    // free blocks of a chunk are contiguous in the sorted free list, so a
+    // fully free chunk is unlinked from both lists in constant time.
+
+    d_freeList_p  = sortByAddress(d_freeList_p);
+    d_chunkList_p = sortByAddress(d_chunkList_p);
+
+    bsls::Types::size_type   numBytes  = 0;
+    Link                   **freeLink  = &d_freeList_p;
+    Chunk                  **chunkLink = &d_chunkList_p;
+
+    while (*chunkLink) {
+        Chunk      *chunk = *chunkLink;
+        const char *begin = reinterpret_cast<char *>(&chunk->d_memory);
+        const char *end   = begin + chunk->d_numBlocks * d_internalBlockSize;
+
+        while (*freeLink && reinterpret_cast<char *>(*freeLink) < begin) {
+            freeLink = &(*freeLink)->d_next_p;
+        }
+
+        Link **firstFreeLink = freeLink;
+        int    numLinked     = 0;
+
+        while (*freeLink && reinterpret_cast<char *>(*freeLink) < end) {
+            ++numLinked;
+            freeLink = &(*freeLink)->d_next_p;
+        }
+
+        int numFree = numLinked;
+
+        // Blocks not yet carved from the current chunk are also free.
+
+        const bool isCurrent = d_begin_p != d_end_p
+                            && begin <= d_begin_p
+                            && d_begin_p < end;
+        if (isCurrent) {
+            numFree += static_cast<int>((d_end_p - d_begin_p)
+                                                       / d_internalBlockSize);
+        }
+
+        if (numFree == chunk->d_numBlocks) {
+            *firstFreeLink    = *freeLink;
+            freeLink          = firstFreeLink;
+            d_freeListLength -= numLinked;
+
+            if (isCurrent) {
+                d_begin_p = 0;
+                d_end_p   = 0;
+            }
+
+            *chunkLink = chunk->d_next_p;
+
+            numBytes += chunkBytes(chunk->d_numBlocks,
+                                   d_internalBlockSize,
+                                   static_cast<int>(sizeof(Chunk)));
+
+            d_allocator_p->deallocate(chunk);
+        }
+        else {
+            chunkLink = &chunk->d_next_p;
+        }
     }
+
+    return numBytes;
+}
+
+// ACCESSORS
+void Pool::loadStatistics(PoolStatistics *result) const
+{
+    BSLS_ASSERT(result);
+
+    int                numBlocks = 0;
+    int                numChunks = 0;
+    bsls::Types::Int64 numBytes  = 0;
+
+    for (const Chunk *chunk = d_chunkList_p; chunk; chunk = chunk->d_next_p) {
+        numBlocks += chunk->d_numBlocks;
+        numBytes  += chunkBytes(chunk->d_numBlocks,
+                                d_internalBlockSize,
+                                static_cast<int>(sizeof(Chunk)));
+        ++numChunks;
+    }
+
+    // Blocks not yet carved from the current chunk are neither in use nor on
+    // the free list.
+
+    const int numUncarved = static_cast<int>((d_end_p - d_begin_p)
+                                                       / d_internalBlockSize);
+
+    result->d_blockSize        = d_blockSize;
+    result->d_numAllocations   = d_numAllocations;
+    result->d_numDeallocations = d_numDeallocations;
+    result->d_numBlocks        = numBlocks;
+    result->d_numBlocksInUse   = numBlocks - d_freeListLength - numUncarved;
+    result->d_freeListLength   = d_freeListLength;
+    result->d_numChunks        = numChunks;
+    result->d_numBytesObtained = numBytes;
 }
 
 }  // close package namespace
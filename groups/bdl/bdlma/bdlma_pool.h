@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlma::Pool: memory manager that allocates memory blocks of uniform size
+//  bdlma::PoolStatistics: snapshot of the usage of a pool
 //
 //@DESCRIPTION: This component implements a memory pool, 'bdlma::Pool', that
 // allocates and manages maximally-aligned memory blocks of some uniform size
@@ -45,8 +46,9 @@ BSLS_IDENT("$Id: $")
 // configure:
 //
 //: 1 GROWTH STRATEGY -- geometrically growing chunk size starting from 1 (in
-//:   terms of the number of memory blocks per chunk), or fixed chunk size.  If
-//:   the growth strategy is not specified, geometric growth is used.
+//:   terms of the number of memory blocks per chunk), fixed chunk size, or
+//:   adaptive chunk size (see below).  If the growth strategy is not
+//:   specified, geometric growth is used.
 //: 2 MAX BLOCKS PER CHUNK -- the maximum number of memory blocks within a
 //:   chunk.  If the maximum blocks per chunk is not specified, an
 //:   implementation-defined default value is used.
@@ -66,6 +68,14 @@ BSLS_IDENT("$Id: $")
 //..
 //  30, 30, 30 ...
 //..
+// If adaptive growth is used, the chunk size grows geometrically, but, if the
+// maximum blocks per chunk is not specified, the default cap is derived from
+// an implementation-defined chunk size *in bytes* (rather than in blocks), so
+// that pools of small blocks go back to the underlying allocator far less
+// often; for example, a pool of 64-byte blocks using adaptive growth reaches
+// chunks of 1024 blocks rather than 32.  Specifying the maximum blocks per
+// chunk explicitly caps the chunk size as for geometric growth.
+//
 // A default-constructed pool has an initial chunk size of 1 (i.e., the number
 // of memory blocks of a given size allocated at once to replenish a pool's
 // memory), and the pool's chunk size grows geometrically until it reaches an
@@ -74,6 +84,47 @@ BSLS_IDENT("$Id: $")
 // currently installed default allocator at the time the 'bdlma::Pool' was
 // created.
 //
+///Returning Unused Memory
+///-----------------------
+// A pool does not return memory to the underlying allocator when individual
+// blocks are deallocated: freed blocks are kept on the free list for reuse.
+// Consequently, a long-lived pool that once experienced a burst of demand
+// retains its high-water mark until 'release' is called or the pool is
+// destroyed.  The 'trim' method returns each chunk whose blocks are all free
+// to the underlying allocator, without disturbing blocks that are still in
+// use.  'trim' is not called automatically; clients choose the policy, e.g.,
+// calling it when a session goes idle or from a periodic housekeeping task
+// (synchronized with other uses of the pool).
+//
+///Free-List Locality
+///------------------
+// Blocks are dispensed from the free list in the reverse order of their
+// deallocation.  After a period of allocating and deallocating blocks in an
+// unrelated order, consecutive free blocks may therefore be scattered across
+// many chunks, and each 'allocate' follows a link to an address that is
+// unlikely to be in the cache.  To hide part of that latency, 'allocate'
+// prefetches the block that the next call will dispense.  In addition, the
+// 'sortFreeList' method reorders the free list by ascending address, so that
+// subsequent allocations are dispensed sequentially, chunk by chunk, as from
+// a freshly replenished pool.  Like 'trim' (which leaves the free list
+// sorted as a side effect), 'sortFreeList' is not called automatically.
+//
+///Statistics
+///----------
+// The 'loadStatistics' method loads a 'bdlma::PoolStatistics' snapshot of the
+// usage of a pool: the number of chunks and bytes obtained from the
+// underlying allocator, the number of blocks those chunks hold, and how many
+// of them are in use or on the free list.  These figures are derived from the
+// chunk list when 'loadStatistics' is called, at a cost linear in the number
+// of chunks.
+//
+// The length of the free list and the cumulative numbers of allocations and
+// deallocations are instead maintained by counters that 'allocate',
+// 'deallocate', and the other manipulators update as they go, at the cost of
+// an integer increment or decrement per call.  These counters are always
+// collected, so the layout of 'bdlma::Pool' does not depend on any build
+// configuration.
+//
 ///Overloaded Global Operator 'new'
 ///--------------------------------
 // This component overloads the global 'operator new' to allow convenient
@@ -263,10 +314,6 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 #endif
 
-#ifndef INCLUDED_BDLMA_INFREQUENTDELETEBLOCKLIST
-#include <bdlma_infrequentdeleteblocklist.h>
-#endif
-
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -287,6 +334,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_blockgrowth.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_CSTDDEF
 #include <bsl_cstddef.h>        // for 'bsl::size_t'
 #endif
@@ -294,6 +349,38 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bdlma {
 
+                         // =====================
+                         // struct PoolStatistics
+                         // =====================
+
+struct PoolStatistics {
+    // This 'struct' provides a snapshot of the usage of a 'Pool', as loaded by
+    // 'Pool::loadStatistics' (see {Statistics}).
+
+    // PUBLIC DATA
+    int                d_blockSize;          // size (in bytes) of the blocks
+                                             // dispensed by the pool
+
+    bsls::Types::Int64 d_numAllocations;     // cumulative number of blocks
+                                             // dispensed
+
+    bsls::Types::Int64 d_numDeallocations;   // cumulative number of blocks
+                                             // returned
+
+    int                d_numBlocks;          // blocks held in chunks
+
+    int                d_numBlocksInUse;     // blocks currently dispensed
+
+    int                d_freeListLength;     // blocks on the free list
+
+    int                d_numChunks;          // chunks obtained from the
+                                             // underlying allocator and not
+                                             // yet returned to it
+
+    bsls::Types::Int64 d_numBytesObtained;   // total size (in bytes) of
+                                             // those chunks
+};
+
                         // ==========
                         // class Pool
                         // ==========
@@ -316,6 +403,19 @@ class Pool {
         Link *d_next_p;  // pointer to next link
     };
 
+    struct Chunk {
+        // This 'struct' overlays the beginning of each chunk of memory blocks
+        // obtained from the underlying allocator, implementing a
+        // singly-linked list of chunks that records the number of blocks in
+        // each, so that chunks can be returned individually by 'trim'.
+
+        Chunk                               *d_next_p;     // next chunk
+
+        int                                  d_numBlocks;  // blocks in chunk
+
+        bsls::AlignmentUtil::MaxAlignedType  d_memory;     // force alignment
+    };
+
     // DATA
     int   d_blockSize;          // size (in bytes) of each allocated memory
                                 // block returned to client
@@ -332,15 +432,31 @@ class Pool {
 
     Link *d_freeList_p;         // linked list of free memory blocks
 
-    InfrequentDeleteBlockList
-          d_blockList;          // memory manager for allocated memory
+    Chunk *d_chunkList_p;       // linked list of allocated chunks
+
+    bslma::Allocator
+          *d_allocator_p;       // memory allocator (held, not owned)
 
     char *d_begin_p;            // start of a contiguous group of memory blocks
 
     char *d_end_p;              // end of a contiguous group of memory blocks
 
+    int   d_freeListLength;     // number of blocks on the free list
+
+    bsls::Types::Int64
+          d_numAllocations;     // cumulative number of blocks dispensed
+
+    bsls::Types::Int64
+          d_numDeallocations;   // cumulative number of blocks returned
+
   private:
     // PRIVATE MANIPULATORS
+    char *allocateChunk(int numBlocks);
+        // Allocate a chunk of the specified 'numBlocks' memory blocks from the
+        // underlying allocator, add it to the list of chunks, and return the
+        // address of its first block.  The behavior is undefined unless
+        // '1 <= numBlocks'.
+
     void replenish();
         // Dynamically allocate a new chunk using this pool's underlying growth
         // strategy.
@@ -372,8 +488,10 @@ class Pool {
         // used, the chunk size grows starting at 'blockSize', doubling in size
         // until the size is exactly 'blockSize * maxBlocksPerChunk'.  If
         // constant growth is used, the chunk size is always
-        // 'blockSize * maxBlocksPerChunk'.  If 'maxBlocksPerChunk' is not
-        // specified, an implementation-defined value is used.  Optionally
+        // 'blockSize * maxBlocksPerChunk'.  If adaptive growth is used, the
+        // chunk size grows as for geometric growth.  If 'maxBlocksPerChunk' is
+        // not specified, an implementation-defined value is used (derived
+        // from a chunk size in bytes if adaptive growth is used).  Optionally
         // specify a 'basicAllocator' used to supply memory.  If
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The behavior is undefined unless '1 <= blockSize' and
@@ -388,12 +506,33 @@ class Pool {
         // Return the address of a contiguous block of maximally-aligned memory
         // having the fixed block size specified at construction.
 
+    void allocateBatch(void **blocks, int numBlocks);
+        // Load into the specified 'blocks' array the addresses of the
+        // specified 'numBlocks' contiguous blocks of maximally-aligned memory,
+        // each having the fixed block size specified at construction.  Blocks
+        // are dispensed in the same order as by successive calls to
+        // 'allocate', except that if more blocks are needed than the current
+        // chunk and the free list can supply, at most one new chunk, large
+        // enough for the remainder, is obtained from the underlying
+        // allocator.  If an exception is thrown, this pool is left
+        // unchanged.  The behavior is undefined unless '0 <= numBlocks' and
+        // 'blocks' refers to an array having at least 'numBlocks' elements.
+
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
         // pool object for reuse.  The behavior is undefined unless 'address'
         // is non-zero, was allocated by this pool, and has not already been
         // deallocated.
 
+    void deallocateBatch(void *const *blocks, int numBlocks);
+        // Relinquish the specified 'numBlocks' memory blocks whose addresses
+        // are held in the specified 'blocks' array back to this pool object
+        // for reuse.  The blocks are added to the front of the free list in
+        // the order in which they appear in 'blocks'.  The behavior is
+        // undefined unless '0 <= numBlocks', and each address in 'blocks' is
+        // non-zero, was allocated by this pool, and has not already been
+        // deallocated.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -421,11 +560,44 @@ class Pool {
         // least the specified 'numBlocks' before the pool replenishes.  The
         // behavior is undefined unless '0 <= numBlocks'.
 
+    void sortFreeList();
+        // Reorder the list of free memory blocks of this pool by ascending
+        // address, so that the blocks are subsequently dispensed in that
+        // order.  Note that this method takes time proportional to
+        // 'F * log(F)', where 'F' is the number of free blocks, and allocates
+        // no memory.
+
+    bsls::Types::size_type trim();
+        // Return every chunk none of whose memory blocks is currently
+        // allocated from this pool to the underlying allocator, and return
+        // the number of bytes (including per-chunk overhead) so released.
+        // Blocks that remain on the free list are left in ascending address
+        // order.  Note that this method takes time proportional to
+        // 'F * log(F) + C * log(C)', where 'F' is the number of free blocks
+        // and 'C' the number of chunks, and allocates no memory; it is
+        // intended to be called periodically (e.g., when a long-lived pool
+        // becomes idle after a burst of activity), not on every
+        // deallocation.
+
     // ACCESSORS
     int blockSize() const;
         // Return the size (in bytes) of the memory blocks allocated from this
         // pool object.  Note that all blocks dispensed by this pool have the
         // same size.
+
+    bsls::BlockGrowth::Strategy growthStrategy() const;
+        // Return the growth strategy of the chunks of this pool object.
+
+    int maxBlocksPerChunk() const;
+        // Return the maximum number of blocks in a chunk of this pool object.
+        // Note that a pool created with the same block size, growth strategy,
+        // and maximum number of blocks per chunk as this pool replenishes
+        // itself in the same way.
+
+    void loadStatistics(PoolStatistics *result) const;
+        // Load into the specified 'result' a snapshot of the usage of this
+        // pool (see {Statistics}).  Note that this operation takes time linear
+        // in the number of chunks held.
 };
 
 }  // close package namespace
@@ -509,10 +681,18 @@ namespace bdlma {
 inline
 void *Pool::allocate()
 {
+    ++d_numAllocations;
+
     if (d_begin_p == d_end_p) {
         if (d_freeList_p) {
             Link *p      = d_freeList_p;
             d_freeList_p = p->d_next_p;
+            --d_freeListLength;
+
+            // Start loading the block to be dispensed by the next call, whose
+            // link will then be read, while the caller uses this one.
+
+            bsls::PerformanceHint::prefetchForWriting(d_freeList_p);
             return p;                                                 // RETURN
         }
 
@@ -529,8 +709,11 @@ void Pool::deallocate(void *address)
 {
     BSLS_ASSERT_SAFE(address);
 
+    ++d_numDeallocations;
+
     static_cast<Link *>(address)->d_next_p = d_freeList_p;
     d_freeList_p = static_cast<Link *>(address);
+    ++d_freeListLength;
 }
 
 template <class TYPE>
@@ -547,20 +730,23 @@ void Pool::deleteObjectRaw(const TYPE *object)
     bslma::DeleterHelper::deleteObjectRaw(object, this);
 }
 
+// ACCESSORS
 inline
-void Pool::release()
+int Pool::blockSize() const
 {
-    d_blockList.release();
-    d_freeList_p = 0;
-    d_begin_p = 0;
-    d_end_p = 0;
+    return d_blockSize;
 }
 
-// ACCESSORS
 inline
-int Pool::blockSize() const
+bsls::BlockGrowth::Strategy Pool::growthStrategy() const
 {
-    return d_blockSize;
+    return d_growthStrategy;
+}
+
+inline
+int Pool::maxBlocksPerChunk() const
+{
+    return d_maxBlocksPerChunk;
 }
 
 }  // close package namespace
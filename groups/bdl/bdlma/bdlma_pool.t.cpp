@@ -1,6 +1,8 @@
 // bdlma_pool.t.cpp                                                   -*-C++-*-
 #include <bdlma_pool.h>
 
+#include <bdlma_infrequentdeleteblocklist.h>
+
 #include <bdls_testutil.h>
 
 #include <bslma_default.h>
@@ -14,6 +16,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_blockgrowth.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -57,16 +60,24 @@ using namespace bsl;
 // [ 3] Pool(bs, gs, mbpc, basicAllocator = 0);
 // [ 6] ~Pool();
 // [ 4] void *allocate();
+// [14] void allocateBatch(void **blocks, int numBlocks);
 // [ 5] void deallocate(address);
+// [14] void deallocateBatch(void *const *blocks, int numBlocks);
 // [ 9] template <class TYPE> void deleteObject(const TYPE *object);
 // [10] template <class TYPE> void deleteObjectRaw(const TYPE *object);
 // [ 6] void release();
 // [11] void reserveCapacity(numBlocks);
+// [15] void sortFreeList();
+// [13] size_type trim();
 // [ 2] int blockSize() const;
+// [ 2] bsls::BlockGrowth::Strategy growthStrategy() const;
+// [ 2] int maxBlocksPerChunk() const;
+// [16] void loadStatistics(PoolStatistics *result) const;
 // [ 7] void *operator new(bsl::size_t size, bdlma::Pool& pool);
 // [ 8] void operator delete(void *address, bdlma::Pool& pool);
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
+// [12] CONCERN: Adaptive growth grows to a cap derived from bytes.
 // [ 2] 'allocate' returns memory of the correct block size.
 // [ 1] int blockSize(numBytes);
 // [ 1] int poolBlockSize(size);
@@ -132,8 +143,9 @@ typedef bdlma::Pool                 Obj;
 
 typedef bsls::BlockGrowth::Strategy Strategy;
 
-// This type was copied from 'bdlma_infrequentdeleteblocklist.h' for testing
-// purposes only.
+// This type has the same footprint as the header of each chunk allocated by
+// 'bdlma::Pool' (and was originally copied from
+// 'bdlma_infrequentdeleteblocklist.h') for testing purposes only.
 
 struct InfrequentDeleteBlock {
     InfrequentDeleteBlock               *d_next_p;
@@ -496,7 +508,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 12: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -552,6 +564,782 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // 'loadStatistics' TEST
+        //
+        // Concerns:
+        //: 1 A new pool reports no chunks, blocks, or bytes, and the block
+        //:   size specified at construction.
+        //:
+        //: 2 The numbers of chunks and bytes reported match the memory
+        //:   obtained from the underlying allocator, whether through
+        //:   'allocate', 'allocateBatch', or 'reserveCapacity', and after
+        //:   'trim' and 'release'.
+        //:
+        //: 3 The numbers of blocks in use and on the free list reflect each
+        //:   allocation and deallocation, blocks not yet dispensed from the
+        //:   current chunk being counted in neither.
+        //:
+        //: 4 The cumulative numbers of allocations and deallocations are
+        //:   always reported.
+        //
+        // Plan:
+        //: 1 Using a pool with constant growth and a test allocator, perform
+        //:   a sequence of operations, and after each verify every field
+        //:   loaded by 'loadStatistics' against the expected values and the
+        //:   statistics of the test allocator.  (C-1..4)
+        //
+        // Testing:
+        //   void loadStatistics(PoolStatistics *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'loadStatistics' TEST" << endl
+                                  << "=====================" << endl;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        const bslma::TestAllocator& A = a;
+
+        const int BLOCK_SIZE = 24;
+        const int NUM_BLOCKS = 8;   // blocks per chunk
+
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+            const Obj& X = mX;
+
+            bdlma::PoolStatistics stats;
+
+            X.loadStatistics(&stats);
+
+            ASSERT(BLOCK_SIZE == stats.d_blockSize);
+            ASSERT(0 == stats.d_numAllocations);
+            ASSERT(0 == stats.d_numDeallocations);
+            ASSERT(0 == stats.d_numBlocks);
+            ASSERT(0 == stats.d_numBlocksInUse);
+            ASSERT(0 == stats.d_freeListLength);
+            ASSERT(0 == stats.d_numChunks);
+            ASSERT(0 == stats.d_numBytesObtained);
+
+            // Allocate 10 blocks, i.e., two chunks, the second partly carved.
+
+            void *p[16];
+            for (int i = 0; i < 10; ++i) {
+                p[i] = mX.allocate();
+            }
+
+            X.loadStatistics(&stats);
+
+            ASSERT(10 == stats.d_numAllocations);
+            ASSERT(0 == stats.d_numDeallocations);
+            ASSERT(2 * NUM_BLOCKS    == stats.d_numBlocks);
+            ASSERT(10                == stats.d_numBlocksInUse);
+            ASSERT(0                 == stats.d_freeListLength);
+            ASSERT(A.numBlocksInUse() == stats.d_numChunks);
+            ASSERT(A.numBytesInUse()  == stats.d_numBytesObtained);
+
+            for (int i = 0; i < 3; ++i) {
+                mX.deallocate(p[i]);
+            }
+
+            X.loadStatistics(&stats);
+
+            ASSERT(10 == stats.d_numAllocations);
+            ASSERT(3 == stats.d_numDeallocations);
+            ASSERT(2 * NUM_BLOCKS    == stats.d_numBlocks);
+            ASSERT(7                 == stats.d_numBlocksInUse);
+            ASSERT(3                 == stats.d_freeListLength);
+            ASSERT(A.numBytesInUse()  == stats.d_numBytesObtained);
+
+            // Take the 6 remaining blocks of the current chunk.
+
+            mX.allocateBatch(p, 6);
+
+            X.loadStatistics(&stats);
+
+            ASSERT(16 == stats.d_numAllocations);
+            ASSERT(2 * NUM_BLOCKS    == stats.d_numBlocks);
+            ASSERT(13                == stats.d_numBlocksInUse);
+            ASSERT(3                 == stats.d_freeListLength);
+
+            mX.deallocateBatch(p, 6);
+
+            X.loadStatistics(&stats);
+
+            ASSERT(9 == stats.d_numDeallocations);
+            ASSERT(7                 == stats.d_numBlocksInUse);
+            ASSERT(9                 == stats.d_freeListLength);
+
+            // Reserve more blocks than are free, obtaining a chunk for the 3
+            // missing blocks.
+
+            mX.reserveCapacity(12);
+
+            X.loadStatistics(&stats);
+
+            ASSERT(3                 == stats.d_numChunks);
+            ASSERT(A.numBlocksInUse() == stats.d_numChunks);
+            ASSERT(A.numBytesInUse()  == stats.d_numBytesObtained);
+            ASSERT(7                 == stats.d_numBlocksInUse);
+            ASSERT(stats.d_numBlocks == stats.d_numBlocksInUse
+                                      + stats.d_freeListLength + 3);
+
+            // 'trim' returns (at least) the reserved chunk, whose blocks are
+            // all free.
+
+            mX.trim();
+
+            X.loadStatistics(&stats);
+
+            ASSERT(3                 >  stats.d_numChunks);
+            ASSERT(A.numBlocksInUse() == stats.d_numChunks);
+            ASSERT(A.numBytesInUse()  == stats.d_numBytesObtained);
+            ASSERT(7                 == stats.d_numBlocksInUse);
+
+            const int FREE = stats.d_freeListLength;
+
+            mX.allocate();
+
+            X.loadStatistics(&stats);
+
+            ASSERT(17                == stats.d_numAllocations);
+            ASSERT(8                 == stats.d_numBlocksInUse);
+            ASSERT(FREE - 1          <= stats.d_freeListLength);
+
+            mX.release();
+
+            X.loadStatistics(&stats);
+
+            ASSERT(17 == stats.d_numAllocations);
+            ASSERT(0 == stats.d_numBlocks);
+            ASSERT(0 == stats.d_numBlocksInUse);
+            ASSERT(0 == stats.d_freeListLength);
+            ASSERT(0 == stats.d_numChunks);
+            ASSERT(0 == stats.d_numBytesObtained);
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(BLOCK_SIZE, &a);  const Obj& X = mX;
+
+            bdlma::PoolStatistics stats;
+
+            ASSERT_PASS(X.loadStatistics(&stats));
+            ASSERT_FAIL(X.loadStatistics(0));
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // 'sortFreeList' TEST
+        //
+        // Concerns:
+        //: 1 After 'sortFreeList', blocks on the free list are dispensed in
+        //:   ascending address order, irrespective of the order in which they
+        //:   were deallocated.
+        //:
+        //: 2 'sortFreeList' neither allocates nor releases memory, and does
+        //:   not affect blocks that are still allocated.
+        //:
+        //: 3 'sortFreeList' has no effect on a pool with an empty free list.
+        //
+        // Plan:
+        //: 1 Using a pool with constant growth and a test allocator, allocate
+        //:   several chunks' worth of blocks, deallocate every other block in
+        //:   a scrambled order, invoke 'sortFreeList', then reallocate the
+        //:   freed blocks and verify that they are dispensed in ascending
+        //:   address order, that the allocator's statistics are unchanged,
+        //:   and that the blocks still in use retain their contents.
+        //:   (C-1..2)
+        //:
+        //: 2 Invoke 'sortFreeList' on a new pool, and on a pool having only
+        //:   undispensed blocks in its current chunk, and verify that
+        //:   allocation proceeds as before.  (C-3)
+        //
+        // Testing:
+        //   void sortFreeList();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'sortFreeList' TEST" << endl
+                                  << "===================" << endl;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        const bslma::TestAllocator& A = a;
+
+        const int BLOCK_SIZE = 32;
+        const int NUM_BLOCKS = 8;   // blocks per chunk
+        const int NUM_CHUNKS = 4;
+        const int NUM_TOTAL  = NUM_BLOCKS * NUM_CHUNKS;
+
+        if (verbose) cout << "\nSorting a scrambled free list." << endl;
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+
+            char *p[NUM_TOTAL];
+            for (int i = 0; i < NUM_TOTAL; ++i) {
+                p[i] = static_cast<char *>(mX.allocate());
+                bsl::memset(p[i], i, BLOCK_SIZE);
+            }
+
+            // Free the odd-numbered blocks, in an order that visits the
+            // chunks alternately from both ends.
+
+            char *freed[NUM_TOTAL / 2];
+            int   numFreed = 0;
+            for (int i = 0; i < NUM_TOTAL / 2; i += 2) {
+                freed[numFreed++] = p[2 * i + 1];
+                if (2 * i + 3 < NUM_TOTAL) {
+                    freed[numFreed++] = p[NUM_TOTAL - 1 - 2 * i];
+                }
+            }
+            ASSERT(NUM_TOTAL / 2 == numFreed);
+
+            for (int i = 0; i < numFreed; ++i) {
+                mX.deallocate(freed[i]);
+            }
+            for (int i = 1; i < NUM_TOTAL; i += 2) {
+                p[i] = 0;
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCS = A.numAllocations();
+            const bsls::Types::Int64 NUM_BYTES  = A.numBytesInUse();
+
+            mX.sortFreeList();
+
+            ASSERT(NUM_ALLOCS == A.numAllocations());
+            ASSERT(NUM_BYTES  == A.numBytesInUse());
+
+            bsl::sort(freed, freed + numFreed);
+
+            for (int i = 0; i < numFreed; ++i) {
+                char *q = static_cast<char *>(mX.allocate());
+                LOOP_ASSERT(i, freed[i] == q);
+            }
+            ASSERT(NUM_ALLOCS == A.numAllocations());
+
+            for (int i = 0; i < NUM_TOTAL; i += 2) {
+                for (int j = 0; j < BLOCK_SIZE; ++j) {
+                    LOOP2_ASSERT(i, j, static_cast<char>(i) == p[i][j]);
+                }
+            }
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nSorting an empty free list." << endl;
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+
+            mX.sortFreeList();
+            ASSERT(0 == A.numBlocksInUse());
+
+            char *p = static_cast<char *>(mX.allocate());
+            ASSERT(1 == A.numBlocksInUse());
+
+            mX.sortFreeList();
+
+            char *q = static_cast<char *>(mX.allocate());
+            ASSERT(q > p);
+            ASSERT(1 == A.numBlocksInUse());
+        }
+        ASSERT(0 == A.numBytesInUse());
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // BATCH ALLOCATION TEST
+        //
+        // Concerns:
+        //: 1 'allocateBatch' loads the requested number of distinct,
+        //:   maximally-aligned blocks of the pool's block size.
+        //:
+        //: 2 Blocks on the free list are dispensed before new memory is used,
+        //:   followed by the remainder of the current chunk.
+        //:
+        //: 3 At most one chunk is obtained from the underlying allocator per
+        //:   call, even when the request exceeds the current chunk size.
+        //:
+        //: 4 'deallocateBatch' returns every block to the free list, in order,
+        //:   and subsequent allocations reuse those blocks before new memory
+        //:   is obtained.
+        //:
+        //: 5 If the underlying allocator throws, the pool is unchanged.
+        //:
+        //: 6 Batches of zero blocks have no effect.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a pool with constant growth and a test allocator, allocate
+        //:   batches of various sizes from pools in various states (empty,
+        //:   partially-dispensed chunk, non-empty free list), verify the
+        //:   addresses loaded, and the number of allocations requested from
+        //:   the allocator.  (C-1..3, 6)
+        //:
+        //: 2 Return a batch using 'deallocateBatch', and verify that a
+        //:   subsequent batch dispenses the same blocks, in order, once the
+        //:   current chunk is exhausted.  (C-4)
+        //:
+        //: 3 In exception-enabled builds, limit the number of allocations of
+        //:   the test allocator, and verify that a failed 'allocateBatch'
+        //:   leaves the free list and the current chunk intact.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void allocateBatch(void **blocks, int numBlocks);
+        //   void deallocateBatch(void *const *blocks, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BATCH ALLOCATION TEST" << endl
+                                  << "=====================" << endl;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        const bslma::TestAllocator& A = a;
+
+        const int BLOCK_SIZE = 24;
+        const int NUM_BLOCKS = 8;   // blocks per chunk
+        const int ALIGNMENT  = bsls::AlignmentUtil::calculateAlignmentFromSize(
+                                                                  BLOCK_SIZE);
+
+        enum { k_MAX_BATCH = 40 };
+
+        if (verbose) cout << "\nAllocating batches." << endl;
+
+        for (int prior = 0; prior <= 2 * NUM_BLOCKS; prior += 3) {
+            for (int freed = 0; freed <= prior; freed += 2) {
+                for (int n = 0; n <= k_MAX_BATCH; n += 5) {
+                    Obj mX(BLOCK_SIZE,
+                           bsls::BlockGrowth::BSLS_CONSTANT,
+                           NUM_BLOCKS,
+                           &a);
+
+                    // Dispense 'prior' blocks, and free the last 'freed' of
+                    // them.
+
+                    void *p[2 * NUM_BLOCKS];
+                    for (int i = 0; i < prior; ++i) {
+                        p[i] = mX.allocate();
+                    }
+                    for (int i = prior - freed; i < prior; ++i) {
+                        mX.deallocate(p[i]);
+                    }
+
+                    const int numInChunk = (NUM_BLOCKS - prior % NUM_BLOCKS)
+                                         % NUM_BLOCKS;
+                    const int numAvail   = freed + numInChunk;
+
+                    const bsls::Types::Int64 NA = A.numAllocations();
+
+                    void *blocks[k_MAX_BATCH];
+                    mX.allocateBatch(blocks, n);
+
+                    LOOP3_ASSERT(prior, freed, n,
+                                 NA + (n > numAvail) == A.numAllocations());
+
+                    // The rest of the current chunk is dispensed first,
+                    // followed by the freed blocks, most recent first.
+
+                    for (int i = numInChunk; i < n && i < numAvail; ++i) {
+                        LOOP4_ASSERT(prior, freed, n, i,
+                                 p[prior - 1 - (i - numInChunk)] == blocks[i]);
+                    }
+
+                    for (int i = 0; i < n; ++i) {
+                        const bsls::Types::UintPtr ADDR =
+                               reinterpret_cast<bsls::Types::UintPtr>(
+                                                                   blocks[i]);
+                        LOOP4_ASSERT(prior, freed, n, i,
+                                     0 == ADDR % ALIGNMENT);
+                        for (int j = 0; j < i; ++j) {
+                            LOOP4_ASSERT(prior, freed, n, i,
+                                         blocks[i] != blocks[j]);
+                        }
+                        for (int j = 0; j < prior - freed; ++j) {
+                            LOOP4_ASSERT(prior, freed, n, i,
+                                         blocks[i] != p[j]);
+                        }
+                        bsl::memset(blocks[i], 0xa5, BLOCK_SIZE);
+                    }
+
+                    // Return the batch; it is reused, in order, once the
+                    // current chunk is exhausted.
+
+                    mX.deallocateBatch(blocks, n);
+
+                    const bsls::Types::Int64 NA2 = A.numAllocations();
+
+                    void *again[k_MAX_BATCH + NUM_BLOCKS];
+                    mX.allocateBatch(again, n + NUM_BLOCKS);
+
+                    int numReused = 0;
+                    for (int i = 0; i < n + NUM_BLOCKS; ++i) {
+                        if (numReused < n && blocks[numReused] == again[i]) {
+                            ++numReused;
+                        }
+                    }
+                    LOOP3_ASSERT(prior, freed, n, n == numReused);
+                    LOOP3_ASSERT(prior, freed, n,
+                                 NA2 + 1 >= A.numAllocations());
+                }
+                ASSERT(0 == A.numBytesInUse());
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nFailing to obtain a chunk." << endl;
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+
+            void *p[3];
+            for (int i = 0; i < 3; ++i) {
+                p[i] = mX.allocate();
+            }
+            mX.deallocate(p[1]);
+
+            a.setAllocationLimit(0);
+
+            void *blocks[k_MAX_BATCH];
+            bool  caught = false;
+            try {
+                mX.allocateBatch(blocks, k_MAX_BATCH);
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            // The rest of the chunk, then the freed block, are still
+            // available.
+
+            const bsls::Types::Int64 NA = A.numAllocations();
+
+            mX.allocateBatch(blocks, NUM_BLOCKS - 2);
+            ASSERT(p[1] == blocks[NUM_BLOCKS - 3]);
+            ASSERT(NA   == A.numAllocations());
+
+            a.setAllocationLimit(-1);
+        }
+        ASSERT(0 == A.numBytesInUse());
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(BLOCK_SIZE, &a);
+
+            void *blocks[1];
+
+            ASSERT_PASS(mX.allocateBatch(0, 0));
+            ASSERT_FAIL(mX.allocateBatch(0, 1));
+            ASSERT_FAIL(mX.allocateBatch(blocks, -1));
+            ASSERT_PASS(mX.allocateBatch(blocks, 1));
+
+            ASSERT_PASS(mX.deallocateBatch(0, 0));
+            ASSERT_FAIL(mX.deallocateBatch(0, 1));
+            ASSERT_FAIL(mX.deallocateBatch(blocks, -1));
+            ASSERT_PASS(mX.deallocateBatch(blocks, 1));
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // 'trim' TEST
+        //
+        // Concerns:
+        //: 1 'trim' returns to the allocator exactly those chunks all of whose
+        //:   blocks are free, and returns the number of bytes released.
+        //:
+        //: 2 Blocks not yet dispensed from the current chunk count as free.
+        //:
+        //: 3 Blocks that are still allocated are unaffected, and free blocks
+        //:   in retained chunks remain available for allocation.
+        //:
+        //: 4 The pool remains usable after 'trim', and 'release' and the
+        //:   destructor reclaim all remaining memory.
+        //
+        // Plan:
+        //: 1 Using a pool with constant growth and a test allocator, allocate
+        //:   several chunks' worth of blocks, free the blocks of some chunks
+        //:   entirely (and of another partially), invoke 'trim', and verify
+        //:   the allocator's statistics and the contents of the blocks still
+        //:   in use.  (C-1, 3..4)
+        //:
+        //: 2 Allocate and free a single block from a new pool, and verify that
+        //:   'trim' releases the partially-dispensed chunk.  (C-2, 4)
+        //
+        // Testing:
+        //   size_type trim();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'trim' TEST" << endl
+                                  << "===========" << endl;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        const bslma::TestAllocator& A = a;
+
+        const int BLOCK_SIZE = 64;
+        const int NUM_BLOCKS = 4;   // blocks per chunk
+        const int NUM_CHUNKS = 6;
+        const int CHUNK_BYTES = blockSize(NUM_BLOCKS * BLOCK_SIZE);
+
+        if (verbose) cout << "\nTrimming fully free chunks." << endl;
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+
+            ASSERT(0 == mX.trim());
+
+            char *p[NUM_CHUNKS * NUM_BLOCKS];
+            for (int i = 0; i < NUM_CHUNKS * NUM_BLOCKS; ++i) {
+                p[i] = static_cast<char *>(mX.allocate());
+                bsl::memset(p[i], i, BLOCK_SIZE);
+            }
+            ASSERT(NUM_CHUNKS == A.numBlocksInUse());
+            ASSERT(0 == mX.trim());
+            ASSERT(NUM_CHUNKS == A.numBlocksInUse());
+
+            // Free chunks 0, 2 and 5 entirely, and one block of chunk 3.
+
+            for (int i = 0; i < NUM_CHUNKS * NUM_BLOCKS; ++i) {
+                const int chunk = i / NUM_BLOCKS;
+                if (0 == chunk || 2 == chunk || 5 == chunk
+                 || 3 * NUM_BLOCKS == i) {
+                    mX.deallocate(p[i]);
+                    p[i] = 0;
+                }
+            }
+
+            ASSERT(3 * CHUNK_BYTES == static_cast<int>(mX.trim()));
+            ASSERT(NUM_CHUNKS - 3 == A.numBlocksInUse());
+            ASSERT(0 == mX.trim());
+
+            for (int i = 0; i < NUM_CHUNKS * NUM_BLOCKS; ++i) {
+                if (p[i]) {
+                    for (int j = 0; j < BLOCK_SIZE; ++j) {
+                        LOOP2_ASSERT(i, j, static_cast<char>(i) == p[i][j]);
+                    }
+                }
+            }
+
+            // The free block of chunk 3 is reused before a new chunk is
+            // obtained.
+
+            bsls::Types::Int64 numAllocations = A.numAllocations();
+            ASSERT(0 != mX.allocate());
+            ASSERT(numAllocations == A.numAllocations());
+            ASSERT(0 != mX.allocate());
+            ASSERT(numAllocations + 1 == A.numAllocations());
+
+            mX.release();
+            ASSERT(0 == A.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTrimming the current chunk." << endl;
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   NUM_BLOCKS,
+                   &a);
+
+            void *p = mX.allocate();
+            ASSERT(0 == mX.trim());
+            mX.deallocate(p);
+
+            ASSERT(CHUNK_BYTES == static_cast<int>(mX.trim()));
+            ASSERT(0 == A.numBytesInUse());
+
+            for (int i = 0; i < 2 * NUM_BLOCKS; ++i) {
+                mX.allocate();
+            }
+            ASSERT(2 == A.numBlocksInUse());
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nTrimming after scattered frees." << endl;
+        {
+            enum { NUM_ALLOC = 1000, STRIDE = 37 };
+
+            Obj mX(BLOCK_SIZE, &a);
+
+            char *p[NUM_ALLOC];
+            for (int i = 0; i < NUM_ALLOC; ++i) {
+                p[i] = static_cast<char *>(mX.allocate());
+                bsl::memset(p[i], i, BLOCK_SIZE);
+            }
+
+            // Free all but every 97th block, in a scattered order.
+
+            for (int i = 0, k = 0; i < NUM_ALLOC; ++i) {
+                k = (k + STRIDE) % NUM_ALLOC;
+                if (0 != k % 97) {
+                    mX.deallocate(p[k]);
+                    p[k] = 0;
+                }
+            }
+
+            const bsls::Types::Int64 numInUse = A.numBlocksInUse();
+            ASSERT(0 < mX.trim());
+            ASSERT(numInUse > A.numBlocksInUse());
+
+            for (int i = 0; i < NUM_ALLOC; ++i) {
+                if (p[i]) {
+                    for (int j = 0; j < BLOCK_SIZE; ++j) {
+                        LOOP2_ASSERT(i, j, static_cast<char>(i) == p[i][j]);
+                    }
+                }
+            }
+
+            // The remaining free blocks are dispensed in ascending address
+            // order.
+
+            const bsls::Types::Int64 numAllocations = A.numAllocations();
+            char *prev = static_cast<char *>(mX.allocate());
+            while (numAllocations == A.numAllocations()) {
+                char *q = static_cast<char *>(mX.allocate());
+                if (numAllocations != A.numAllocations()) {
+                    break;
+                }
+                ASSERT(prev < q);
+                prev = q;
+            }
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nTrimming reserved capacity." << endl;
+        {
+            Obj mX(BLOCK_SIZE, &a);
+
+            void *p = mX.allocate();
+            mX.reserveCapacity(100);
+            ASSERT(2 == A.numBlocksInUse());
+
+            ASSERT(blockSize(100 * BLOCK_SIZE) == static_cast<int>(mX.trim()));
+            ASSERT(1 == A.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(0 != mX.trim());
+            ASSERT(0 == A.numBytesInUse());
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // ADAPTIVE GROWTH TEST
+        //
+        // Concerns:
+        //: 1 With adaptive growth and no explicit 'maxBlocksPerChunk', the
+        //:   chunk size grows geometrically past 'MAX_CHUNK_SIZE' blocks, up
+        //:   to a cap derived from a chunk size in bytes.
+        //:
+        //: 2 An explicit 'maxBlocksPerChunk' caps adaptive growth.
+        //:
+        //: 3 As with geometric growth, the chunk obtained after the reserved
+        //:   capacity is exhausted is sized by the growth sequence, not by
+        //:   the number of blocks reserved.
+        //
+        // Plan:
+        //: 1 Allocate from pools configured with adaptive growth using a test
+        //:   allocator, and verify the size of each chunk requested from the
+        //:   allocator.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Adaptive growth grows to a cap derived from bytes.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ADAPTIVE GROWTH TEST" << endl
+                                  << "====================" << endl;
+
+        const bsls::BlockGrowth::Strategy ADP =
+                                              bsls::BlockGrowth::BSLS_ADAPTIVE;
+
+        bslma::TestAllocator a(veryVeryVerbose);
+        const bslma::TestAllocator& A = a;
+
+        if (verbose) cout << "\nTesting the default adaptive cap." << endl;
+        {
+            const int BLOCK_SIZE = 64;
+            const int MAX_BLOCKS = 64 * 1024 / BLOCK_SIZE;
+
+            Obj mX(BLOCK_SIZE, ADP, &a);
+
+            int chunkSize = INITIAL_CHUNK_SIZE;
+            for (int i = 0; i < 12; ++i) {
+                bsls::Types::Int64 numAllocations = A.numAllocations();
+                for (int j = 0; j < chunkSize; ++j) {
+                    mX.allocate();
+                }
+                LOOP_ASSERT(i, numAllocations + 1 == A.numAllocations());
+                LOOP2_ASSERT(i, A.lastAllocatedNumBytes(),
+                             blockSize(chunkSize * BLOCK_SIZE)
+                                            == (int)A.lastAllocatedNumBytes());
+                chunkSize = growNumBlocks(chunkSize, MAX_BLOCKS);
+            }
+            ASSERT(MAX_BLOCKS == chunkSize);
+            ASSERT(MAX_CHUNK_SIZE < chunkSize);
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nTesting an explicit adaptive cap." << endl;
+        {
+            const int BLOCK_SIZE = 64;
+            const int MAX_BLOCKS = 16;
+
+            Obj mX(BLOCK_SIZE, ADP, MAX_BLOCKS, &a);
+
+            for (int i = 0; i < 10 * MAX_BLOCKS; ++i) {
+                mX.allocate();
+                LOOP_ASSERT(i, blockSize(MAX_BLOCKS * BLOCK_SIZE)
+                                            >= (int)A.lastAllocatedNumBytes());
+            }
+            ASSERT(blockSize(MAX_BLOCKS * BLOCK_SIZE)
+                                            == (int)A.lastAllocatedNumBytes());
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nTesting growth after 'reserveCapacity'."
+                          << endl;
+        {
+            const int BLOCK_SIZE = 32;
+            const int NUM_RESERVED = 100;
+
+            Obj mX(BLOCK_SIZE, ADP, &a);
+            Obj mY(BLOCK_SIZE, bsls::BlockGrowth::BSLS_GEOMETRIC, &a);
+
+            mX.reserveCapacity(NUM_RESERVED);
+            for (int i = 0; i < NUM_RESERVED; ++i) {
+                mX.allocate();
+            }
+            bsls::Types::Int64 numAllocations = A.numAllocations();
+            mX.allocate();
+            ASSERT(numAllocations + 1 == A.numAllocations());
+            ASSERT(blockSize(INITIAL_CHUNK_SIZE * BLOCK_SIZE)
+                                            == (int)A.lastAllocatedNumBytes());
+
+            mY.reserveCapacity(NUM_RESERVED);
+            for (int i = 0; i < NUM_RESERVED; ++i) {
+                mY.allocate();
+            }
+            mY.allocate();
+            ASSERT(blockSize(INITIAL_CHUNK_SIZE * BLOCK_SIZE)
+                                            == (int)A.lastAllocatedNumBytes());
+        }
+        ASSERT(0 == A.numBytesInUse());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // RESERVECAPACITY TEST
@@ -1577,6 +2365,8 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   int blockSize() const;
+        //   bsls::BlockGrowth::Strategy growthStrategy() const;
+        //   int maxBlocksPerChunk() const;
         //   'allocate' returns memory of the correct block size.
         // --------------------------------------------------------------------
 
@@ -1601,6 +2391,9 @@ int main(int argc, char *argv[])
                 const Obj& X = mX;
 
                 ASSERT(BLOCK_SIZE == X.blockSize());
+                ASSERT(bsls::BlockGrowth::BSLS_CONSTANT
+                                                      == X.growthStrategy());
+                ASSERT(NUM_BLOCKS == X.maxBlocksPerChunk());
 
                 char *lastP = 0;
                 for (int oi = 0; oi < NUM_BLOCKS; ++oi) {
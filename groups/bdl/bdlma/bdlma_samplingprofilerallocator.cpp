@@ -0,0 +1,375 @@
+// bdlma_samplingprofilerallocator.cpp                                -*-C++-*-
+#include <bdlma_samplingprofilerallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_samplingprofilerallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cmath.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+#include <execinfo.h>
+#define BDLMA_SAMPLINGPROFILERALLOCATOR_EXECINFO 1
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#define BDLMA_SAMPLINGPROFILERALLOCATOR_WINDOWS 1
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+// CONSTANTS
+const bsls::Types::Uint64 k_RANDOM_SEED = 0x9e3779b97f4a7c15ULL;
+    // arbitrary non-zero seed of the generator of sampling intervals
+
+// LOCAL FUNCTIONS
+static
+int captureStack(void **frames, int maxFrames)
+    // Load into the specified 'frames' array the return addresses of (at
+    // most) the specified 'maxFrames' innermost frames of the call stack of
+    // the calling thread, and return the number of addresses loaded.
+{
+#if defined(BDLMA_SAMPLINGPROFILERALLOCATOR_EXECINFO)
+    const int numFrames = backtrace(frames, maxFrames);
+    return numFrames < 0 ? 0 : numFrames;
+#elif defined(BDLMA_SAMPLINGPROFILERALLOCATOR_WINDOWS)
+    return CaptureStackBackTrace(0, maxFrames, frames, 0);
+#else
+    (void)frames;
+    (void)maxFrames;
+    return 0;
+#endif
+}
+
+static
+bsls::Types::UintPtr hashStack(void *const *frames, int numFrames)
+    // Return a hash of the specified 'numFrames' return addresses held in the
+    // specified 'frames' array.
+{
+    bsls::Types::UintPtr hash = 0;
+    for (int i = 0; i < numFrames; ++i) {
+        hash += reinterpret_cast<bsls::Types::UintPtr>(frames[i]);
+        hash += hash << 10;
+        hash ^= hash >> 6;
+    }
+    hash += hash << 3;
+    hash ^= hash >> 11;
+    return hash;
+}
+
+static
+void writeMappedLibraries(bsl::ostream& stream)
+    // Write the memory map of the calling process, if available, to the
+    // specified 'stream', preceded by the header expected by 'pprof'.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#else
+    (void)stream;
+#endif
+}
+
+}  // close unnamed namespace
+
+                      // -------------------------------
+                      // class SamplingProfilerAllocator
+                      // -------------------------------
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 SamplingProfilerAllocator::nextSamplingInterval()
+{
+    if (1 == d_samplingInterval) {
+        return 1;                                                     // RETURN
+    }
+
+    // Advance a 64-bit xorshift generator, and map the 53 high-order bits of
+    // its state to a uniform variate in '(0, 1]'.
+
+    d_randomState ^= d_randomState >> 12;
+    d_randomState ^= d_randomState << 25;
+    d_randomState ^= d_randomState >> 27;
+
+    const double uniform =
+            static_cast<double>((d_randomState * 2685821657736338717ULL) >> 11)
+                                       / 9007199254740992.0  // 2^53
+          + 1.0 / 9007199254740992.0;
+
+    const double interval = -bsl::log(uniform)
+                                   * static_cast<double>(d_samplingInterval);
+
+    return static_cast<bsls::Types::Int64>(interval) + 1;
+}
+
+void SamplingProfilerAllocator::sample(Header *header, size_type size)
+{
+    void      *frames[k_MAX_FRAMES];
+    const int  numFrames = captureStack(frames, k_MAX_FRAMES);
+
+    const bsls::Types::UintPtr hash = hashStack(frames, numFrames);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    // Only one of the threads whose allocations exhausted the countdown
+    // samples, namely the first one to acquire the lock; it restarts the
+    // countdown, which may have been decremented concurrently since.
+
+    const bsls::Types::Int64 interval = nextSamplingInterval();
+    for (;;) {
+        const bsls::Types::Int64 remaining = d_bytesUntilSample.loadRelaxed();
+        if (remaining > 0) {
+            return;                                                   // RETURN
+        }
+        if (remaining == d_bytesUntilSample.testAndSwap(remaining,
+                                                        interval)) {
+            break;
+        }
+    }
+
+    Bucket **chain  = d_table_p + hash % k_NUM_HASH_BUCKETS;
+    Bucket  *bucket = *chain;
+    while (bucket
+        && (bucket->d_hash != hash
+         || bucket->d_numFrames != numFrames
+         || 0 != bsl::memcmp(bucket->d_frames,
+                             frames,
+                             numFrames * sizeof *frames))) {
+        bucket = bucket->d_next_p;
+    }
+
+    if (!bucket) {
+        bucket = static_cast<Bucket *>(d_allocator_p->allocate(
+                                                              sizeof(Bucket)));
+        bucket->d_next_p         = *chain;
+        bucket->d_numBlocksInUse = 0;
+        bucket->d_numBytesInUse  = 0;
+        bucket->d_numBlocksTotal = 0;
+        bucket->d_numBytesTotal  = 0;
+        bucket->d_hash           = hash;
+        bucket->d_numFrames      = numFrames;
+        bsl::memcpy(bucket->d_frames, frames, numFrames * sizeof *frames);
+        *chain = bucket;
+    }
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    ++bucket->d_numBlocksInUse;
+    bucket->d_numBytesInUse += numBytes;
+    ++bucket->d_numBlocksTotal;
+    bucket->d_numBytesTotal += numBytes;
+
+    ++d_numSamplesTotal;
+    ++d_numSampledInUse;
+
+    header->d_data.d_bucket_p = bucket;
+    header->d_data.d_size     = size;
+}
+
+// CREATORS
+SamplingProfilerAllocator::SamplingProfilerAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_samplingInterval(k_DEFAULT_SAMPLING_INTERVAL)
+, d_bytesUntilSample(0)
+, d_randomState(k_RANDOM_SEED)
+, d_numSamplesTotal(0)
+, d_numSampledInUse(0)
+, d_table_p(0)
+, d_lock()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_table_p = static_cast<Bucket **>(d_allocator_p->allocate(
+                                       k_NUM_HASH_BUCKETS * sizeof(Bucket *)));
+    bsl::memset(d_table_p, 0, k_NUM_HASH_BUCKETS * sizeof(Bucket *));
+
+    d_bytesUntilSample.storeRelaxed(nextSamplingInterval());
+}
+
+SamplingProfilerAllocator::SamplingProfilerAllocator(
+                                       bsls::Types::Int64  samplingInterval,
+                                       bslma::Allocator   *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_bytesUntilSample(0)
+, d_randomState(k_RANDOM_SEED)
+, d_numSamplesTotal(0)
+, d_numSampledInUse(0)
+, d_table_p(0)
+, d_lock()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= samplingInterval);
+
+    d_table_p = static_cast<Bucket **>(d_allocator_p->allocate(
+                                       k_NUM_HASH_BUCKETS * sizeof(Bucket *)));
+    bsl::memset(d_table_p, 0, k_NUM_HASH_BUCKETS * sizeof(Bucket *));
+
+    d_bytesUntilSample.storeRelaxed(nextSamplingInterval());
+}
+
+SamplingProfilerAllocator::~SamplingProfilerAllocator()
+{
+    BSLS_ASSERT(0 == d_numSampledInUse);
+
+    for (int i = 0; i < k_NUM_HASH_BUCKETS; ++i) {
+        Bucket *bucket = d_table_p[i];
+        while (bucket) {
+            Bucket *next = bucket->d_next_p;
+            d_allocator_p->deallocate(bucket);
+            bucket = next;
+        }
+    }
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void *SamplingProfilerAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                              d_allocator_p->allocate(sizeof(Header) + size));
+
+    header->d_data.d_bucket_p = 0;
+
+    const bsls::Types::Int64 remaining = d_bytesUntilSample.addRelaxed(
+                                       -static_cast<bsls::Types::Int64>(size));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(remaining <= 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(header,
+                                                            d_allocator_p);
+        sample(header, size);
+        proctor.release();
+    }
+
+    return header + 1;
+}
+
+void SamplingProfilerAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(header->d_data.d_bucket_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bsls::BslLockGuard guard(&d_lock);
+
+        Bucket *bucket = header->d_data.d_bucket_p;
+
+        --bucket->d_numBlocksInUse;
+        bucket->d_numBytesInUse -= static_cast<bsls::Types::Int64>(
+                                                       header->d_data.d_size);
+
+        --d_numSampledInUse;
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+bsls::Types::Int64 SamplingProfilerAllocator::numSampledBlocksInUse() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numSampledInUse;
+}
+
+bsls::Types::Int64 SamplingProfilerAllocator::numSamplesTotal() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numSamplesTotal;
+}
+
+bsl::ostream&
+SamplingProfilerAllocator::writeHeapProfile(bsl::ostream& stream) const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    bsls::Types::Int64 numBlocksInUse = 0;
+    bsls::Types::Int64 numBytesInUse  = 0;
+    bsls::Types::Int64 numBlocksTotal = 0;
+    bsls::Types::Int64 numBytesTotal  = 0;
+
+    for (int i = 0; i < k_NUM_HASH_BUCKETS; ++i) {
+        for (const Bucket *bucket = d_table_p[i];
+             bucket;
+             bucket = bucket->d_next_p) {
+            numBlocksInUse += bucket->d_numBlocksInUse;
+            numBytesInUse  += bucket->d_numBytesInUse;
+            numBlocksTotal += bucket->d_numBlocksTotal;
+            numBytesTotal  += bucket->d_numBytesTotal;
+        }
+    }
+
+    stream << "heap profile: " << numBlocksInUse << ": " << numBytesInUse
+           << " [" << numBlocksTotal << ": " << numBytesTotal
+           << "] @ heap_v2/" << d_samplingInterval << '\n';
+
+    const bsl::ios_base::fmtflags flags = stream.flags();
+
+    for (int i = 0; i < k_NUM_HASH_BUCKETS; ++i) {
+        for (const Bucket *bucket = d_table_p[i];
+             bucket;
+             bucket = bucket->d_next_p) {
+            stream << bsl::dec
+                   << bucket->d_numBlocksInUse << ": "
+                   << bucket->d_numBytesInUse  << " ["
+                   << bucket->d_numBlocksTotal << ": "
+                   << bucket->d_numBytesTotal  << "] @" << bsl::hex;
+
+            for (int j = 0; j < bucket->d_numFrames; ++j) {
+                stream << " 0x" << reinterpret_cast<bsls::Types::UintPtr>(
+                                                        bucket->d_frames[j]);
+            }
+            stream << '\n';
+        }
+    }
+
+    stream.flags(flags);
+
+    writeMappedLibraries(stream);
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,370 @@
+// bdlma_samplingprofilerallocator.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLMA_SAMPLINGPROFILERALLOCATOR
+#define INCLUDED_BDLMA_SAMPLINGPROFILERALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that profiles a sample of its allocations.
+//
+//@CLASSES:
+//  bdlma::SamplingProfilerAllocator: allocator recording sampled call stacks
+//
+//@SEE_ALSO: bdlma_countingallocator, bslma_testallocator
+//
+//@DESCRIPTION: This component provides a concrete allocator,
+// 'bdlma::SamplingProfilerAllocator', that implements the 'bslma::Allocator'
+// protocol by forwarding each request to an underlying allocator supplied at
+// construction, and that records the call stacks of a random *sample* of its
+// allocations, so as to identify the call sites responsible for most of the
+// memory allocated through it:
+//..
+//   ,--------------------------------.
+//  ( bdlma::SamplingProfilerAllocator )
+//   `--------------------------------'
+//                |           ctor/dtor
+//                |           samplingInterval
+//                |           numSamplesTotal
+//                |           numSampledBlocksInUse
+//                |           writeHeapProfile
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                            allocate
+//                            deallocate
+//..
+// The overhead of an allocation that is not sampled is that of a header
+// (maximally aligned) prepended to each block and a single atomic
+// subtraction; deallocating a block that was not sampled requires no
+// synchronization at all.  Unlike 'bslma::TestAllocator', which locks a
+// mutex and records every block, a 'bdlma::SamplingProfilerAllocator' is
+// therefore suitable for use in production.
+//
+///Sampling
+///--------
+// A 'bdlma::SamplingProfilerAllocator' samples its allocations by *bytes*
+// rather than by call: conceptually, each byte allocated is sampled with
+// probability '1 / samplingInterval', and an allocation is sampled if any of
+// its bytes is.  This is implemented, as by 'tcmalloc', by counting down the
+// number of bytes remaining until the next sample, and drawing each interval
+// between two samples from an exponential distribution whose mean is
+// 'samplingInterval'.  Large allocations are thus more likely to be sampled
+// than small ones, in proportion to their size, and the number of bytes (and
+// blocks) allocated by each call site can be estimated from the samples
+// without bias (see {Heap Profile Format}).  A 'samplingInterval' of 1
+// samples every allocation.
+//
+// The call stack of each sampled allocation is captured (on platforms that
+// support doing so; see {Call Stacks}), and the sample is accounted to a
+// *bucket* identifying that call stack.  Each bucket records the number of
+// sampled blocks allocated from that stack that are currently in use, and the
+// cumulative number of sampled blocks allocated from it, together with their
+// sizes.
+//
+///Heap Profile Format
+///-------------------
+// The 'writeHeapProfile' method writes the buckets in the legacy text format
+// of the 'gperftools' heap profiler, which is understood by 'pprof':
+//..
+//  heap profile: <inuse blocks>: <inuse bytes> [<total blocks>: <total bytes>]
+//  @ heap_v2/<samplingInterval>
+//  <inuse blocks>: <inuse bytes> [<total blocks>: <total bytes>] @ <frames>
+//  ...
+//..
+// (the first two lines above form a single line), where '<frames>' is the
+// sequence of return addresses of the call stack in hexadecimal, innermost
+// first.  The counts are those of the sampled blocks; the 'heap_v2' tag
+// directs 'pprof' to scale each bucket by the inverse of the probability
+// that a block of its average size is sampled.  On Linux, the profile ends
+// with a 'MAPPED_LIBRARIES:' section holding the memory map of the process,
+// which 'pprof' uses to symbolize the addresses.
+//
+///Call Stacks
+///-----------
+// Call stacks are captured using 'backtrace' on Linux and Darwin, and using
+// 'CaptureStackBackTrace' on Windows; on other platforms, every sample is
+// accounted to a single bucket having an empty call stack.  At most
+// 'k_MAX_FRAMES' frames are recorded per sample, starting with the frames of
+// this component itself.  Note that capturing a call stack is relatively
+// expensive; it is done only for sampled allocations, outside of any lock.
+//
+///Thread Safety
+///-------------
+// 'bdlma::SamplingProfilerAllocator' is fully thread-safe, provided that the
+// underlying allocator is.  Only sampled allocations, deallocations of
+// sampled blocks, and 'writeHeapProfile' acquire a lock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Call Sites That Allocate the Most Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service allocates much more memory than expected, and that
+// we want to find out which call sites are responsible, without the overhead
+// of recording every allocation.  First, we create a sampling profiler
+// allocator that samples on average once every 64 kilobytes, and install it
+// as the allocator of the service (here, a vector of strings):
+//..
+//  bdlma::SamplingProfilerAllocator profiler(64 * 1024);
+//
+//  bsl::vector<bsl::string> messages(&profiler);
+//..
+// Then, the service runs as usual:
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      messages.push_back(bsl::string(100 + i % 100, 'x'));
+//  }
+//..
+// Next, we verify that some of the allocations were sampled (roughly one in
+// every 64 kilobytes of the 1.5 megabytes or so allocated):
+//..
+//  assert(0 < profiler.numSamplesTotal());
+//  assert(profiler.numSampledBlocksInUse() <= profiler.numSamplesTotal());
+//..
+// Finally, we write the heap profile, which would typically be saved to a
+// file and analyzed using 'pprof':
+//..
+//  bsl::ostringstream profile;
+//  profiler.writeHeapProfile(profile);
+//
+//  assert(0 == profile.str().find("heap profile: "));
+//  assert(bsl::string::npos != profile.str().find("@ heap_v2/65536"));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                      // ===============================
+                      // class SamplingProfilerAllocator
+                      // ===============================
+
+class SamplingProfilerAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete, thread-safe allocator that forwards each
+    // request to an underlying allocator and records the call stack of a
+    // random sample of the allocations, by bytes, as described in the
+    // component-level documentation.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_FRAMES                = 32,          // maximum number of frames
+                                                   // recorded per sample
+
+        k_DEFAULT_SAMPLING_INTERVAL = 512 * 1024   // default mean number of
+                                                   // bytes between two
+                                                   // samples
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Bucket {
+        // This 'struct' holds the statistics of the sampled allocations made
+        // from one call stack, and is linked in a chain of the hash table of
+        // buckets.
+
+        Bucket               *d_next_p;          // next bucket in chain
+
+        bsls::Types::Int64    d_numBlocksInUse;  // sampled blocks in use
+
+        bsls::Types::Int64    d_numBytesInUse;   // bytes of those blocks
+
+        bsls::Types::Int64    d_numBlocksTotal;  // sampled blocks ever
+
+        bsls::Types::Int64    d_numBytesTotal;   // bytes of those blocks
+
+        bsls::Types::UintPtr  d_hash;            // hash of the call stack
+
+        int                   d_numFrames;       // number of frames
+
+        void                 *d_frames[k_MAX_FRAMES];
+                                                 // return addresses
+    };
+
+    union Header {
+        // This 'union' prepends each block allocated from the underlying
+        // allocator, and records whether the block was sampled.
+
+        struct {
+            Bucket    *d_bucket_p;  // bucket of the sample, or 0 if the block
+                                    // was not sampled
+
+            size_type  d_size;      // size requested, if sampled
+        } d_data;
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;  // force alignment
+    };
+
+    enum {
+        k_NUM_HASH_BUCKETS = 1024  // number of chains in the hash table of
+                                   // buckets
+    };
+
+    // DATA
+    const bsls::Types::Int64  d_samplingInterval;  // mean bytes per sample
+
+    bsls::AtomicInt64         d_bytesUntilSample;  // countdown to the next
+                                                   // sample
+
+    bsls::Types::Uint64       d_randomState;       // state of the generator
+                                                   // of sampling intervals
+
+    bsls::Types::Int64        d_numSamplesTotal;   // cumulative number of
+                                                   // samples
+
+    bsls::Types::Int64        d_numSampledInUse;   // sampled blocks in use
+
+    Bucket                  **d_table_p;           // hash table of buckets,
+                                                   // by call stack (owned)
+
+    mutable bsls::BslLock     d_lock;              // guards all statistics
+                                                   // and the buckets
+
+    bslma::Allocator         *d_allocator_p;       // underlying allocator
+                                                   // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingProfilerAllocator(const SamplingProfilerAllocator&);
+    SamplingProfilerAllocator& operator=(const SamplingProfilerAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 nextSamplingInterval();
+        // Return the number of bytes to be allocated before the next sample,
+        // drawn from an exponential distribution whose mean is
+        // 'samplingInterval()'.  The behavior is undefined unless 'd_lock' is
+        // held by the calling thread.
+
+    void sample(Header *header, size_type size);
+        // Determine whether the block of the specified 'size' prefixed by the
+        // specified 'header', whose allocation exhausted the countdown to the
+        // next sample, is sampled, and if so, record the call stack of the
+        // calling thread in 'header' and start the countdown to the next
+        // sample.
+
+  public:
+    // CREATORS
+    explicit
+    SamplingProfilerAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SamplingProfilerAllocator(bsls::Types::Int64  samplingInterval,
+                              bslma::Allocator   *basicAllocator = 0);
+        // Create a sampling profiler allocator.  Optionally specify a
+        // 'samplingInterval' indicating the mean number of bytes allocated
+        // between two samples; if 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory, including that used to
+        // record the samples.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '1 <= samplingInterval' and 'basicAllocator' (or the
+        // default allocator) is thread-safe.
+
+    virtual ~SamplingProfilerAllocator();
+        // Destroy this allocator object, and release the memory used to
+        // record the samples.  The behavior is undefined unless all memory
+        // allocated from this allocator has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated block of memory of the specified 'size' (in
+        // bytes), obtained from the underlying allocator, and record the call
+        // stack of the calling thread if the allocation is sampled.  If
+        // 'size' is 0, a null pointer is returned with no other effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator, updating the statistics of the bucket of the
+        // block if it was sampled.  If 'address' is 0, this function has no
+        // effect.  The behavior is undefined unless 'address' was allocated
+        // using this allocator object and has not already been deallocated.
+
+    // ACCESSORS
+    bsls::Types::Int64 numSampledBlocksInUse() const;
+        // Return the number of sampled blocks that are currently allocated
+        // from this object.
+
+    bsls::Types::Int64 numSamplesTotal() const;
+        // Return the cumulative number of allocations from this object that
+        // were sampled.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the mean number of bytes allocated between two samples.
+
+    bsl::ostream& writeHeapProfile(bsl::ostream& stream) const;
+        // Write the statistics of the sampled allocations of this object,
+        // aggregated by call stack, to the specified 'stream' in the heap
+        // profile format understood by 'pprof' (see {Heap Profile Format}),
+        // and return a reference to 'stream'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class SamplingProfilerAllocator
+                      // -------------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SamplingProfilerAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,638 @@
+// bdlma_samplingprofilerallocator.t.cpp                              -*-C++-*-
+#include <bdlma_samplingprofilerallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlma::SamplingProfilerAllocator' forwards each request to an underlying
+// allocator and records the call stack of a random sample of the allocations,
+// by bytes.  The primary concerns are that: 1) every request is forwarded to
+// the underlying allocator, and every block returned to it, 2) the number of
+// samples is consistent with the sampling interval (every allocation being
+// sampled if the interval is 1), 3) the statistics of sampled blocks are
+// updated on deallocation, and 4) the heap profile is written in the
+// documented format.  The 'bslma_testallocator' component is used to verify
+// the memory obtained from the underlying allocator.
+//-----------------------------------------------------------------------------
+// [ 2] SamplingProfilerAllocator(Allocator *ba = 0);
+// [ 2] SamplingProfilerAllocator(Int64 samplingInterval, *ba = 0);
+// [ 2] ~SamplingProfilerAllocator();
+// [ 2] void *allocate(size_type size);
+// [ 2] void deallocate(void *address);
+// [ 2] Int64 numSampledBlocksInUse() const;
+// [ 2] Int64 numSamplesTotal() const;
+// [ 2] Int64 samplingInterval() const;
+// [ 4] ostream& writeHeapProfile(ostream& stream) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Allocations are sampled at the specified mean rate.
+// [ 5] USAGE EXAMPLE
+// [ *] CONCERN: Precondition violations are detected when enabled.
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_SAFE_PASS(EXPR)     BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR)     BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+//=============================================================================
+//                       GLOBAL TYPES AND CONSTANTS
+//-----------------------------------------------------------------------------
+
+typedef bdlma::SamplingProfilerAllocator Obj;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+int countLines(const bsl::string& text, const char *prefix)
+    // Return the number of lines of the specified 'text' that start with the
+    // specified 'prefix', up to (and excluding) the first empty line.
+{
+    const bsl::size_t length = bsl::strlen(prefix);
+
+    int                count = 0;
+    bsl::size_t        pos   = 0;
+    while (pos < text.size() && '\n' != text[pos]) {
+        if (0 == text.compare(pos, length, prefix)) {
+            ++count;
+        }
+        pos = text.find('\n', pos);
+        if (bsl::string::npos == pos) {
+            break;
+        }
+        ++pos;
+    }
+    return count;
+}
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Call Sites That Allocate the Most Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service allocates much more memory than expected, and that
+// we want to find out which call sites are responsible, without the overhead
+// of recording every allocation.  First, we create a sampling profiler
+// allocator that samples on average once every 64 kilobytes, and install it
+// as the allocator of the service (here, a vector of strings):
+//..
+    bdlma::SamplingProfilerAllocator profiler(64 * 1024);
+
+    bsl::vector<bsl::string> messages(&profiler);
+//..
+// Then, the service runs as usual:
+//..
+    for (int i = 0; i < 10000; ++i) {
+        messages.push_back(bsl::string(100 + i % 100, 'x'));
+    }
+//..
+// Next, we verify that some of the allocations were sampled (roughly one in
+// every 64 kilobytes of the 1.5 megabytes or so allocated):
+//..
+    ASSERT(0 < profiler.numSamplesTotal());
+    ASSERT(profiler.numSampledBlocksInUse() <= profiler.numSamplesTotal());
+//..
+// Finally, we write the heap profile, which would typically be saved to a
+// file and analyzed using 'pprof':
+//..
+    bsl::ostringstream profile;
+    profiler.writeHeapProfile(profile);
+
+    ASSERT(0 == profile.str().find("heap profile: "));
+    ASSERT(bsl::string::npos != profile.str().find("@ heap_v2/65536"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'writeHeapProfile'
+        //
+        // Concerns:
+        //: 1 The first line of the profile holds the numbers (and bytes) of
+        //:   sampled blocks in use and ever sampled, and the sampling
+        //:   interval, in the documented format.
+        //:
+        //: 2 One line is written per distinct call stack of the sampled
+        //:   allocations, in the documented format.
+        //:
+        //: 3 The totals reflect deallocated blocks.
+        //:
+        //: 4 The format flags of the stream are unchanged.
+        //
+        // Plan:
+        //: 1 Using a sampling interval of 1, allocate blocks from two call
+        //:   sites, write the heap profile, and verify the header line and
+        //:   the bucket lines.  (C-1..2)
+        //:
+        //: 2 Deallocate some of the blocks, and verify the header line of the
+        //:   new profile.  (C-3)
+        //:
+        //: 3 Verify the format flags of the stream after each call.  (C-4)
+        //
+        // Testing:
+        //   ostream& writeHeapProfile(ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'writeHeapProfile'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            {
+                bsl::ostringstream oss(&ta);
+                X.writeHeapProfile(oss);
+
+                ASSERTV(oss.str(),
+                        0 == oss.str().find("heap profile: 0: 0 [0: 0] @ "
+                                            "heap_v2/1\n"));
+                ASSERT(0 == countLines(oss.str(), "0: "));
+                ASSERT(0 == countLines(oss.str(), "1: "));
+            }
+
+            void *blocks[4];
+            for (int i = 0; i < 4; ++i) {
+                if (i % 2) {
+                    blocks[i] = mX.allocate(100);
+                }
+                else {
+                    blocks[i] = mX.allocate(28);
+                }
+            }
+
+            {
+                bsl::ostringstream oss(&ta);
+                ASSERT(&oss == &X.writeHeapProfile(oss));
+
+                const bsl::string& profile = oss.str();
+                if (veryVerbose) { P(profile); }
+
+                ASSERTV(profile,
+                        0 == profile.find("heap profile: 4: 256 [4: 256] @ "
+                                          "heap_v2/1\n"));
+                ASSERT(bsl::ios_base::dec == (oss.flags() &
+                                              bsl::ios_base::basefield));
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+                // The two call sites are on distinct lines, hence have
+                // distinct call stacks.
+
+                ASSERTV(profile, 1 == countLines(profile, "2: 56 [2: 56] @"));
+                ASSERTV(profile,
+                        1 == countLines(profile, "2: 200 [2: 200] @"));
+                ASSERT(bsl::string::npos != profile.find("] @ 0x"));
+#endif
+            }
+
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[1]);
+            mX.deallocate(blocks[3]);
+
+            {
+                bsl::ostringstream oss(&ta);
+                X.writeHeapProfile(oss);
+
+                ASSERTV(oss.str(),
+                        0 == oss.str().find("heap profile: 1: 28 [4: 256] @ "
+                                            "heap_v2/1\n"));
+            }
+
+            mX.deallocate(blocks[2]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SAMPLING RATE
+        //
+        // Concerns:
+        //: 1 On average, one allocation is sampled per 'samplingInterval()'
+        //:   bytes allocated.
+        //:
+        //: 2 The same allocator samples according to the same sequence of
+        //:   intervals.
+        //
+        // Plan:
+        //: 1 For several sampling intervals, allocate a large number of
+        //:   blocks, and verify that the number of samples lies within a
+        //:   (wide) range around its expected value.  (C-1)
+        //:
+        //: 2 Repeat the allocations with a second allocator object, and
+        //:   verify that the number of samples is the same.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Allocations are sampled at the specified mean rate.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING RATE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        static const struct {
+            int   d_line;      // source line number
+            Int64 d_interval;  // sampling interval
+            int   d_size;      // size of each allocation
+        } DATA[] = {
+            //LINE  INTERVAL   SIZE
+            //----  --------   ----
+            { L_,      1000,    10 },
+            { L_,     10000,   100 },
+            { L_,    100000,  1000 },
+            { L_,    512000,  5000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const int NUM_ALLOCATIONS = 10000;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const Int64 INTERVAL = DATA[ti].d_interval;
+            const int   SIZE     = DATA[ti].d_size;
+
+            const Int64 EXPECTED = Int64(NUM_ALLOCATIONS) * SIZE / INTERVAL;
+
+            Int64 numSamples[2];
+
+            for (int pass = 0; pass < 2; ++pass) {
+                Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, INTERVAL == X.samplingInterval());
+
+                for (int i = 0; i < NUM_ALLOCATIONS; ++i) {
+                    mX.deallocate(mX.allocate(SIZE));
+                }
+
+                numSamples[pass] = X.numSamplesTotal();
+
+                ASSERTV(LINE, 0 == X.numSampledBlocksInUse());
+            }
+
+            if (veryVerbose) { P_(LINE) P_(EXPECTED) P(numSamples[0]) }
+
+            ASSERTV(LINE, EXPECTED, numSamples[0],
+                    EXPECTED / 2 <= numSamples[0]
+                 && numSamples[0] <= EXPECTED * 2);
+            ASSERTV(LINE, numSamples[0], numSamples[1],
+                    numSamples[0] == numSamples[1]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, 'allocate', 'deallocate', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor uses 'k_DEFAULT_SAMPLING_INTERVAL', and
+        //:   the other constructor the specified sampling interval.
+        //:
+        //: 2 Memory is supplied by the specified allocator, or by the default
+        //:   allocator if none is specified.
+        //:
+        //: 3 Allocated blocks are maximally aligned and do not overlap.
+        //:
+        //: 4 Every allocation is sampled if the sampling interval is 1.
+        //:
+        //: 5 Deallocating a sampled block updates the statistics.
+        //:
+        //: 6 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 7 The destructor releases the memory used to record the samples.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, and verify 'samplingInterval' and the allocator
+        //:   supplying memory.  (C-1..2)
+        //:
+        //: 2 Using a sampling interval of 1, allocate blocks of various
+        //:   sizes, write to them, and verify their alignment and the
+        //:   accessors.  Then deallocate them, verifying the accessors.
+        //:   (C-3..6)
+        //:
+        //: 3 Verify that no memory remains in use from the underlying
+        //:   allocator after the objects are destroyed.  (C-7)
+        //:
+        //: 4 Verify that a sampling interval of 0 is rejected.  (C-8)
+        //
+        // Testing:
+        //   SamplingProfilerAllocator(Allocator *ba = 0);
+        //   SamplingProfilerAllocator(Int64 samplingInterval, *ba = 0);
+        //   ~SamplingProfilerAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   Int64 numSampledBlocksInUse() const;
+        //   Int64 numSamplesTotal() const;
+        //   Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, 'allocate', 'deallocate', AND ACCESSORS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+            ASSERT(0 <  da.numBlocksInUse());
+            ASSERT(0 == ta.numBlocksTotal());
+
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == Y.samplingInterval());
+            ASSERT(0 <  ta.numBlocksInUse());
+
+            Obj mZ(1234, &ta);  const Obj& Z = mZ;
+
+            ASSERT(1234 == Z.samplingInterval());
+            ASSERT(0    == Z.numSamplesTotal());
+            ASSERT(0    == Z.numSampledBlocksInUse());
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *p = mZ.allocate(10);
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+            mZ.deallocate(p);
+            ASSERT(NUM_BLOCKS     == ta.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'allocate' and 'deallocate'." << endl;
+
+        const Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numSamplesTotal());
+
+            mX.deallocate(0);
+
+            enum { k_NUM_BLOCKS = 8 };
+
+            void *blocks[k_NUM_BLOCKS];
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                const int SIZE = 1 << i;
+
+                blocks[i] = mX.allocate(SIZE);
+                bsl::memset(blocks[i], 0xa5, SIZE);
+
+                ASSERTV(i, 0 == reinterpret_cast<UintPtr>(blocks[i])
+                                                           % k_MAX_ALIGN);
+                ASSERTV(i, i + 1 == X.numSamplesTotal());
+                ASSERTV(i, i + 1 == X.numSampledBlocksInUse());
+            }
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                    const char *p = static_cast<char *>(blocks[i]);
+                    const char *q = static_cast<char *>(blocks[j]);
+                    ASSERTV(i, j, i == j || p + (1 << i) <= q
+                                         || q + (1 << j) <= p);
+                }
+            }
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+
+                ASSERTV(i, k_NUM_BLOCKS == X.numSamplesTotal());
+                ASSERTV(i, k_NUM_BLOCKS - i - 1 == X.numSampledBlocksInUse());
+            }
+        }
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+        ASSERT(0                  == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS_RAW(Obj( 1, &ta));
+            ASSERT_FAIL_RAW(Obj( 0, &ta));
+            ASSERT_FAIL_RAW(Obj(-1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate a few blocks, and
+        //:   verify the number of samples and the memory in use from the
+        //:   underlying allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *p = mX.allocate(16);
+            void *q = mX.allocate(64);
+
+            ASSERT(0 != p);
+            ASSERT(0 != q);
+            ASSERT(p != q);
+            ASSERT(2 == X.numSamplesTotal());
+            ASSERT(2 == X.numSampledBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(2 == X.numSamplesTotal());
+            ASSERT(1 == X.numSampledBlocksInUse());
+
+            mX.deallocate(q);
+            ASSERT(0 == X.numSampledBlocksInUse());
+
+            ASSERT(0 < NUM_BLOCKS);
+            ASSERT(NUM_BLOCKS <= ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(1000000, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(16);
+            ASSERT(0 != p);
+            ASSERT(0 == X.numSamplesTotal());
+            mX.deallocate(p);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -26,6 +26,7 @@ BSLS_IDENT("$Id: $")
 //                |         allocateAndExpand
 //                |         reserveCapacity
 //                |         truncate
+//                |         tryExpand
 //                V
 //    ,-----------------------.
 //   ( bdlma::ManagedAllocator )
@@ -55,6 +56,12 @@ BSLS_IDENT("$Id: $")
 // 'bdlma::SequentialAllocator' is more general purpose than a
 // 'bdlma::SequentialPool'.
 //
+// The virtual call overhead can be avoided where the concrete type is known:
+// 'bdlma::SequentialAllocator' is declared 'final' (when compiled as C++11),
+// and all of its allocation methods are inline, so the compiler can
+// devirtualize (and inline) calls made through a 'bdlma::SequentialAllocator'
+// pointer or reference, e.g., from a 'bslma::StaticAllocator'.
+//
 ///Optional 'initialSize' Parameter
 ///--------------------------------
 // An optional 'initialSize' parameter can be supplied at construction to
@@ -90,6 +97,20 @@ BSLS_IDENT("$Id: $")
 // 'alignmentStrategy' is not specified, natural alignment is used.  See
 // 'bsls_alignment' for more details.
 //
+///Checkpoints
+///-----------
+// The 'checkpoint' method returns a value recording the current allocation
+// state of the allocator, and the 'rewind' method restores the allocator to a
+// state previously recorded by 'checkpoint', reclaiming all memory allocated
+// since then without regard to the number of individual allocations: the
+// buffers and separately-allocated blocks obtained after the checkpoint are
+// returned to the underlying allocator, and subsequent allocations resume from
+// the position in the internal buffer that was current when the checkpoint was
+// taken.  Memory allocated before the checkpoint is unaffected, and a
+// allocator may be rewound to the same checkpoint repeatedly.  See
+// 'bdlma_autorewinder' for a proctor that rewinds a allocator to a checkpoint
+// on scope exit.
+//
 ///Usage
 ///-----
 // Allocators are often supplied, at construction, to objects requiring
@@ -226,6 +247,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_blockgrowth.h>
 #endif
 
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -233,7 +258,7 @@ namespace bdlma {
                       // class SequentialAllocator
                       // =========================
 
-class SequentialAllocator : public ManagedAllocator {
+class SequentialAllocator BSLS_CPP11_FINAL : public ManagedAllocator {
     // This class implements the 'ManagedAllocator' protocol to provide
     // a fast allocator that dispenses heterogeneous blocks of memory (of
     // varying, user-specified sizes) from a sequence of dynamically-allocated
@@ -246,6 +271,13 @@ class SequentialAllocator : public ManagedAllocator {
     // behavior is defined by the (optional) allocator specified at
     // construction.
 
+  public:
+    // PUBLIC TYPES
+    typedef SequentialPool::Checkpoint Checkpoint;
+        // 'Checkpoint' is an alias for the type recording the allocation
+        // state of this allocator, as returned by 'checkpoint'.
+
+  private:
     // DATA
     SequentialPool d_sequentialPool;  // manager for allocated memory blocks
 
@@ -357,6 +389,19 @@ class SequentialAllocator : public ManagedAllocator {
         // supplied at construction to allocate a new internal buffer, then
         // allocate memory from the new buffer.
 
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) whose address is a multiple of the specified
+        // 'alignment', ignoring the alignment strategy specified at
+        // construction.  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  If the allocation request (including the padding needed
+        // to reach a suitably aligned address) exceeds the remaining free
+        // memory space in the current internal buffer, use the allocator
+        // supplied at construction to allocate a new internal buffer, then
+        // allocate memory from the new buffer.  The behavior is undefined
+        // unless 'alignment' is a positive power of two.  Note that
+        // 'alignment' may exceed 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'.
+
     void *allocateAndExpand(size_type *size);
         // Return the address of a contiguous block of memory of at least the
         // specified '*size' (in bytes), and load the actual amount of memory
@@ -400,6 +445,37 @@ class SequentialAllocator : public ManagedAllocator {
         // 'address' is 'originalSize', 'newSize <= originalSize',
         // '0 <= newSize', and 'release' was not called after allocating the
         // memory block at 'address'.
+
+    void rewind(const Checkpoint& checkpoint);
+        // Release all memory allocated through this allocator since the
+        // specified 'checkpoint' was obtained from it, returning any internal
+        // buffers and separately-allocated blocks obtained since then to the
+        // allocator supplied at construction, and resume allocating from the
+        // position recorded by 'checkpoint'.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this allocator, and neither 'release'
+        // nor 'rewind' to a checkpoint obtained earlier than 'checkpoint' has
+        // been called since.  See 'bdlma::SequentialPool::rewind'.
+
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize);
+        // Attempt to increase the amount of memory allocated at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' now spans 'newSize' bytes, and
+        // 'false' with no effect otherwise.  This method can only expand the
+        // memory block returned by the most recent 'allocate' request from
+        // this allocator, and only if the remaining free memory in the
+        // current internal buffer suffices.  The behavior is undefined unless
+        // the memory at 'address' was originally allocated by this allocator,
+        // the size of the memory block at 'address' is 'originalSize',
+        // '0 < originalSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.
+
+    // ACCESSORS
+    Checkpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // allocator, for use with 'rewind'.
 };
 
 // ============================================================================
@@ -553,6 +629,18 @@ void *SequentialAllocator::allocate(size_type size)
     return d_sequentialPool.allocate(size);
 }
 
+inline
+void *SequentialAllocator::allocateAligned(size_type size,
+                                           size_type alignment)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_sequentialPool.allocate(size, alignment);
+}
+
 inline
 void SequentialAllocator::deallocate(void *)
 {
@@ -572,6 +660,27 @@ int SequentialAllocator::truncate(void *address,
     return d_sequentialPool.truncate(address, originalSize, newSize);
 }
 
+inline
+void SequentialAllocator::rewind(const Checkpoint& checkpoint)
+{
+    d_sequentialPool.rewind(checkpoint);
+}
+
+inline
+bool SequentialAllocator::tryExpand(void      *address,
+                                    size_type  originalSize,
+                                    size_type  newSize)
+{
+    return d_sequentialPool.tryExpand(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+SequentialAllocator::Checkpoint SequentialAllocator::checkpoint() const
+{
+    return d_sequentialPool.checkpoint();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
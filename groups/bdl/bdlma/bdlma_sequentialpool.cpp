@@ -1,6 +1,7 @@
 // bdlma_sequentialpool.cpp                                           -*-C++-*-
 #include <bdlma_sequentialpool.h>
 
+#include <bsls_alignmentutil.h>
 #include <bsls_performancehint.h>
 
 #include <bsl_climits.h>  // 'INT_MAX'
@@ -8,8 +9,13 @@
 enum {
     INITIAL_SIZE  = 256,  // default initial allocation size (in bytes)
 
-    GROWTH_FACTOR =   2   // multiplicative factor by which to grow allocation
+    GROWTH_FACTOR =   2,  // multiplicative factor by which to grow allocation
                           // size
+
+    MAX_ADAPTIVE_GROWTH_STEPS = 2
+                          // maximum number of times the buffer size may grow
+                          // by 'GROWTH_FACTOR' to fit a single request when
+                          // adaptive growth is used
 };
 
 namespace BloombergLP {
@@ -29,11 +35,20 @@ int SequentialPool::calculateNextBufferSize(int size) const
         return nextSize;                                              // RETURN
     }
 
+    // With adaptive growth, a request too large to fit after a bounded
+    // number of growth steps is an outlier: it is served from a dedicated
+    // block (see 'allocate') instead of inflating all subsequent buffers.
+
+    const int maxSteps = bsls::BlockGrowth::BSLS_ADAPTIVE == d_growthStrategy
+                         ? MAX_ADAPTIVE_GROWTH_STEPS
+                         : INT_MAX;
+
     int oldSize;
+    int numSteps = 0;
     do {
         oldSize   = nextSize;
         nextSize *= GROWTH_FACTOR;
-    } while (nextSize < size && oldSize < nextSize);
+    } while (nextSize < size && oldSize < nextSize && ++numSteps < maxSteps);
 
     // If 'nextSize' overflows, use 'oldSize'.
 
@@ -238,6 +253,35 @@ void *SequentialPool::allocateHelp(bsls::Types::size_type size)
     return d_buffer.allocateRaw(size);
 }
 
+void *SequentialPool::allocateAlignedHelp(bsls::Types::size_type size,
+                                          bsls::Types::size_type alignment)
+{
+    // Internal buffers are maximally aligned, so a new buffer needs at most
+    // 'alignment - BSLS_MAX_ALIGNMENT' bytes of padding before the block.
+
+    const bsls::Types::size_type padding =
+                  alignment > bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                  ? alignment - bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                  : 0;
+    const int required = static_cast<int>(size + padding);
+
+    const int nextSize = calculateNextBufferSize(required);
+
+    if (nextSize < required) {
+        char *block = static_cast<char *>(d_blockList.allocate(required));
+        return block + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                               block,
+                                               static_cast<int>(alignment));
+                                                                      // RETURN
+    }
+
+    d_buffer.replaceBuffer(static_cast<char *>(d_blockList.allocate(nextSize)),
+                           nextSize);
+
+    return d_buffer.allocateRaw(static_cast<int>(size),
+                                static_cast<int>(alignment));
+}
+
 void *SequentialPool::allocateAndExpand(bsls::Types::size_type *size)
 {
     BSLS_ASSERT(size);
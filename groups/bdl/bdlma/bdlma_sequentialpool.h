@@ -12,7 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bdlma::SequentialPool: memory pool using dynamically-allocated buffers
 //
-//@SEE_ALSO: bdlma_infrequentdeleteblocklist, bdlma_sequentialallocator
+//@SEE_ALSO: bdlma_infrequentdeleteblocklist, bdlma_sequentialallocator,
+//           bdlma_blockcacheallocator
 //
 //@DESCRIPTION: This component provides a fast sequential memory pool,
 // 'bdlma::SequentialPool', that dispenses heterogeneous memory blocks (of
@@ -52,8 +53,12 @@ BSLS_IDENT("$Id: $")
 ///-----------------------------------
 // An optional 'growthStrategy' parameter can be supplied at construction to
 // specify the growth rate of the dynamically-allocated buffers.  The buffers
-// can grow either geometrically or remain constant in size.  If
-// 'growthStrategy' is not specified, geometric growth is used.  See
+// can grow geometrically, remain constant in size, or grow adaptively.  If
+// 'growthStrategy' is not specified, geometric growth is used.  With adaptive
+// growth, the buffers grow geometrically as long as each request fits after
+// at most two growth steps; a larger request is served by a separate memory
+// block, and the current internal buffer is kept, so that an occasional
+// outsized request does not inflate the size of every subsequent buffer.  See
 // 'bsls_blockgrowth' for more details.
 //
 ///Optional 'alignmentStrategy' Parameter
@@ -64,6 +69,19 @@ BSLS_IDENT("$Id: $")
 // 'alignmentStrategy' is not specified, natural alignment is used.  See
 // 'bsls_alignment' for more details.
 //
+///Checkpoints
+///-----------
+// The 'checkpoint' method returns a value recording the current allocation
+// state of the pool, and the 'rewind' method restores the pool to a state
+// previously recorded by 'checkpoint', reclaiming all memory allocated since
+// then without regard to the number of individual allocations: the buffers and
+// separately-allocated blocks obtained after the checkpoint are returned to
+// the underlying allocator, and subsequent allocations resume from the
+// position in the internal buffer that was current when the checkpoint was
+// taken.  Memory allocated before the checkpoint is unaffected, and a pool may
+// be rewound to the same checkpoint repeatedly.  See 'bdlma_autorewinder' for
+// a proctor that rewinds a pool to a checkpoint on scope exit.
+//
 ///Usage
 ///-----
 ///Example 1: Using 'bdlma::SequentialPool' for Efficient Allocations
@@ -339,6 +357,21 @@ class SequentialPool {
     // *exception* *neutral*: If memory cannot be allocated, the behavior is
     // defined by the (optional) allocator specified at construction.
 
+  public:
+    // PUBLIC TYPES
+    struct Checkpoint {
+        // This 'struct' records the allocation state of a sequential pool, as
+        // returned by 'checkpoint', so that the pool can later be rewound to
+        // that state using 'rewind'.  Its members are implementation details
+        // and must not be used directly by clients.
+
+        char *d_buffer_p;    // current buffer (if any)
+        int   d_bufferSize;  // size (in bytes) of current buffer
+        int   d_cursor;      // offset of next available byte in buffer
+        void *d_block_p;     // most recently allocated block (if any)
+    };
+
+  private:
     // DATA
     BufferManager       d_buffer;          // memory manager for current buffer
 
@@ -366,6 +399,16 @@ class SequentialPool {
         // satisfy a memory allocation request of the specified 'size' (in
         // bytes), or the maximum buffer size if the buffer can no longer grow.
 
+    // PRIVATE MANIPULATORS
+    void *allocateAlignedHelp(bsls::Types::size_type size,
+                              bsls::Types::size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) aligned to the specified 'alignment', obtained
+        // from a newly allocated internal buffer (or from a dedicated block if
+        // the request cannot be satisfied by an internal buffer).  The
+        // behavior is undefined unless '0 < size' and 'alignment' is a
+        // positive power of two.
+
   public:
     // CREATORS
     explicit
@@ -472,6 +515,22 @@ class SequentialPool {
         // allocate memory from the new buffer.  The behavior is undefined
         // unless '0 < size'.
 
+    void *allocate(bsls::Types::size_type size,
+                   bsls::Types::size_type alignment);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) whose address is a multiple of the specified
+        // 'alignment', ignoring the alignment strategy specified at
+        // construction.  If the allocation request (including the padding
+        // needed to reach a suitably aligned address) exceeds the remaining
+        // free memory space in the current internal buffer, use the allocator
+        // supplied at construction to allocate a new internal buffer, then
+        // allocate memory from the new buffer.  The behavior is undefined
+        // unless '0 < size' and 'alignment' is a positive power of two.  Note
+        // that 'alignment' may exceed 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'
+        // (e.g., to obtain cache-line or page-aligned memory), and that only
+        // the bytes skipped to reach the aligned address are consumed as
+        // padding.
+
     void *allocateAndExpand(bsls::Types::size_type *size);
         // Return the address of a contiguous block of memory of at least the
         // specified '*size' (in bytes), and load the actual amount of memory
@@ -520,6 +579,39 @@ class SequentialPool {
         // block at 'address' is 'originalSize', 'newSize <= originalSize',
         // '0 <= newSize', and 'release' was not called after allocating the
         // memory block at 'address'.
+
+    void rewind(const Checkpoint& checkpoint);
+        // Release all memory allocated through this pool since the specified
+        // 'checkpoint' was obtained from it, returning any internal buffers
+        // and separately-allocated blocks obtained since then to the
+        // underlying allocator, and resume allocating from the position
+        // recorded by 'checkpoint'.  Memory allocated before 'checkpoint' was
+        // obtained is unaffected.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this pool, and neither 'release' nor
+        // 'rewind' to a checkpoint obtained earlier than 'checkpoint' has
+        // been called since.  Note that 'checkpoint' remains valid after this
+        // call, so the pool may be rewound to it repeatedly.
+
+    bool tryExpand(void                   *address,
+                   bsls::Types::size_type  originalSize,
+                   bsls::Types::size_type  newSize);
+        // Attempt to increase the amount of memory allocated at the specified
+        // 'address' from the specified 'originalSize' (in bytes) to the
+        // specified 'newSize' (in bytes) without moving it.  Return 'true' if
+        // the memory block at 'address' now spans 'newSize' bytes, and
+        // 'false' with no effect otherwise.  This method can only expand the
+        // memory block returned by the most recent 'allocate' request from
+        // this memory pool, and only if the remaining free memory in the
+        // current internal buffer suffices.  The behavior is undefined unless
+        // the memory at 'address' was originally allocated by this memory
+        // pool, the size of the memory block at 'address' is 'originalSize',
+        // '0 < originalSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.
+
+    // ACCESSORS
+    Checkpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // pool, for use with 'rewind'.
 };
 
 }  // close package namespace
@@ -618,6 +710,24 @@ void *SequentialPool::allocate(bsls::Types::size_type size)
     return allocateHelp(size);
 }
 
+inline
+void *SequentialPool::allocate(bsls::Types::size_type size,
+                               bsls::Types::size_type alignment)
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_buffer.buffer())) {
+        void *result = d_buffer.allocate(size, alignment);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(result)) {
+            return result;                                            // RETURN
+        }
+    }
+
+    return allocateAlignedHelp(size, alignment);
+}
+
 template <class TYPE>
 inline
 void SequentialPool::deleteObjectRaw(const TYPE *object)
@@ -659,6 +769,42 @@ int SequentialPool::truncate(void *address, int originalSize, int newSize)
     return d_buffer.truncate(address, originalSize, newSize);
 }
 
+inline
+void SequentialPool::rewind(const Checkpoint& checkpoint)
+{
+    d_blockList.releaseAfter(checkpoint.d_block_p);
+    d_buffer.restore(checkpoint.d_buffer_p,
+                     checkpoint.d_bufferSize,
+                     checkpoint.d_cursor);
+}
+
+inline
+bool SequentialPool::tryExpand(void                   *address,
+                               bsls::Types::size_type  originalSize,
+                               bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 < originalSize);
+    BSLS_ASSERT_SAFE(originalSize <= newSize);
+
+    return d_buffer.buffer()
+        && d_buffer.tryExpand(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+SequentialPool::Checkpoint SequentialPool::checkpoint() const
+{
+    Checkpoint checkpoint;
+
+    checkpoint.d_buffer_p   = d_buffer.buffer();
+    checkpoint.d_bufferSize = d_buffer.bufferSize();
+    checkpoint.d_cursor     = d_buffer.cursor();
+    checkpoint.d_block_p    = d_blockList.mostRecentBlock();
+
+    return checkpoint;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
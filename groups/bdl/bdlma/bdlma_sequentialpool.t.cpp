@@ -10,8 +10,10 @@
 #include <bsls_alignedbuffer.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_asserttest.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 
 using namespace BloombergLP;
@@ -72,17 +74,24 @@ using namespace bsl;
 //
 // // MANIPULATORS
 // [ 4] void *allocate(size_type size);
+// [11] void *allocate(size_type size, size_type alignment);
 // [ 7] void *allocateAndExpand(size_type *size);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
 // [ 9] void reserveCapacity(int numBytes);
 // [ 8] int truncate(void *address, int originalSize, int newSize);
+// [13] void rewind(const Checkpoint& checkpoint);
+// [14] bool tryExpand(void *, size_type oldSize, size_type newSize);
+//
+// // ACCESSORS
+// [13] Checkpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [10] FREE FUNCTION: 'operator new(size_t, bdlma::SequentialPool)'
-// [11] USAGE EXAMPLE
+// [12] CONCERN: Adaptive growth serves outliers from dedicated blocks.
+// [15] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -464,7 +473,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 11: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -487,6 +496,480 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // 'tryExpand' TEST
+        //
+        // Concerns:
+        //: 1 'tryExpand' succeeds for the most recently allocated block if the
+        //:   remaining free memory in the current buffer suffices, and the
+        //:   next allocation follows the expanded block.
+        //:
+        //: 2 'tryExpand' fails, with no effect, for a block other than the
+        //:   most recently allocated one, if the remaining free memory is
+        //:   insufficient, and for a pool that has no current buffer.
+        //:
+        //: 3 'tryExpand' never allocates memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks from a pool, attempt to expand them to various
+        //:   sizes, and verify the return value, the address of the next
+        //:   allocation, and the number of blocks in use from the object
+        //:   allocator.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   bool tryExpand(void *, size_type oldSize, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'tryExpand' TEST" << endl
+                                  << "================" << endl;
+
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(DEFAULT_SIZE, bsls::Alignment::BSLS_BYTEALIGNED, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            char *q = static_cast<char *>(mX.allocate(8));
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(false == mX.tryExpand(p, 8, 16));
+            ASSERT(true  == mX.tryExpand(q, 8, 8));
+            ASSERT(true  == mX.tryExpand(q, 8, 64));
+            ASSERT(true  == mX.tryExpand(q, 64, 128));
+            ASSERT(false == mX.tryExpand(q, 128, DEFAULT_SIZE));
+
+            char *r = static_cast<char *>(mX.allocate(8));
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+            ASSERT(q + 128    == r);
+
+            // Once a new buffer is obtained, the last block of the previous
+            // buffer can no longer grow, even though that buffer has room.
+
+            mX.allocate(DEFAULT_SIZE / 2);
+            ASSERT(NUM_BLOCKS <  ta.numBlocksInUse());
+            ASSERT(false      == mX.tryExpand(r, 8, 16));
+        }
+
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(&ta);
+
+            char c;
+            ASSERT(false == mX.tryExpand(&c, 1, 2));
+            ASSERT(0     == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&objectAllocator);
+
+            void *p = mX.allocate(8);
+
+            ASSERT_SAFE_PASS(mX.tryExpand(p, 8, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(0, 8, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(p, 0, 8));
+            ASSERT_SAFE_FAIL(mX.tryExpand(p, 8, 7));
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // 'checkpoint' AND 'rewind' TEST
+        //
+        // Concerns:
+        //: 1 Rewinding to a checkpoint taken within the current buffer does
+        //:   not return memory to the underlying allocator, and the next
+        //:   allocation is served from the position recorded by the
+        //:   checkpoint.
+        //:
+        //: 2 Rewinding to a checkpoint returns every buffer and dedicated
+        //:   block obtained since the checkpoint to the underlying allocator,
+        //:   and no other memory.
+        //:
+        //: 3 Rewinding to a checkpoint taken before any memory was obtained
+        //:   returns all memory to the underlying allocator.
+        //:
+        //: 4 A pool can be rewound to the same checkpoint repeatedly, and to
+        //:   an earlier checkpoint after a later one.
+        //
+        // Plan:
+        //: 1 Take a checkpoint, allocate within the current buffer, rewind,
+        //:   and verify that the number of blocks in use is unchanged and
+        //:   that the next allocation returns the same address.  (C-1)
+        //:
+        //: 2 Take a checkpoint, allocate enough memory (including outlying
+        //:   requests) to obtain several new blocks, rewind, and verify the
+        //:   number of blocks and bytes in use, and the address of the next
+        //:   allocation.  Repeat several times with the same checkpoint.
+        //:   (C-2, 4)
+        //:
+        //: 3 Take a checkpoint of a pool that has not allocated, allocate,
+        //:   rewind, and verify that no memory is in use.  (C-3)
+        //:
+        //: 4 Take two nested checkpoints, rewind to the inner and then to the
+        //:   outer, verifying the memory in use after each.  (C-4)
+        //
+        // Testing:
+        //   void rewind(const Checkpoint& checkpoint);
+        //   Checkpoint checkpoint() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'checkpoint' AND 'rewind' TEST" << endl
+                                  << "==============================" << endl;
+
+        if (verbose) cout << "\nTesting rewind within the current buffer."
+                          << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(DEFAULT_SIZE, &ta);
+            mX.allocate(8);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            void *p = mX.allocate(8);
+            mX.allocate(16);
+
+            mX.rewind(CP);
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+            ASSERT(p          == mX.allocate(8));
+        }
+
+        if (verbose) cout << "\nTesting rewind across new blocks." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(DEFAULT_SIZE, &ta);
+            mX.allocate(8);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            const bsls::Types::Int64 NUM_BYTES  = ta.numBytesInUse();
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            void *p = mX.allocate(8);
+
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 8; ++j) {
+                    mX.allocate(DEFAULT_SIZE);
+                }
+                mX.allocate(64 * DEFAULT_SIZE);
+                LOOP_ASSERT(i, NUM_BLOCKS < ta.numBlocksInUse());
+
+                mX.rewind(CP);
+                LOOP_ASSERT(i, NUM_BLOCKS == ta.numBlocksInUse());
+                LOOP_ASSERT(i, NUM_BYTES  == ta.numBytesInUse());
+                LOOP_ASSERT(i, p          == mX.allocate(8));
+            }
+        }
+
+        if (verbose) cout << "\nTesting rewind to an empty pool." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(&ta);
+
+            const Obj::Checkpoint CP = mX.checkpoint();
+
+            for (int i = 0; i < 32; ++i) {
+                mX.allocate(DEFAULT_SIZE);
+            }
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.rewind(CP);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.allocate(8);
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting nested checkpoints." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(DEFAULT_SIZE, &ta);
+
+            const Obj::Checkpoint OUTER = mX.checkpoint();
+            const bsls::Types::Int64 NUM_OUTER = ta.numBlocksInUse();
+
+            for (int i = 0; i < 8; ++i) {
+                mX.allocate(DEFAULT_SIZE);
+            }
+
+            const Obj::Checkpoint INNER = mX.checkpoint();
+            const bsls::Types::Int64 NUM_INNER = ta.numBlocksInUse();
+
+            for (int i = 0; i < 8; ++i) {
+                mX.allocate(DEFAULT_SIZE);
+            }
+            ASSERT(NUM_INNER < ta.numBlocksInUse());
+
+            mX.rewind(INNER);
+            ASSERT(NUM_INNER == ta.numBlocksInUse());
+
+            mX.rewind(OUTER);
+            ASSERT(NUM_OUTER == ta.numBlocksInUse());
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // ADAPTIVE GROWTH TEST
+        //
+        // Concerns:
+        //: 1 With adaptive growth, a stream of small requests obtains the same
+        //:   sequence of internal buffers as with geometric growth.
+        //:
+        //: 2 A request that fits after at most two growth steps grows the
+        //:   internal buffer to fit it.
+        //:
+        //: 3 A larger (outlying) request is served from a dedicated block,
+        //:   the current buffer remains in use, and the size of the next
+        //:   internal buffer is not inflated by the outlier.
+        //:
+        //: 4 The maximum buffer size caps adaptive growth.
+        //
+        // Plan:
+        //: 1 Allocate the same stream of small requests from a geometric and
+        //:   an adaptive pool, each supplied with its own test allocator, and
+        //:   verify that both allocators see the same sequence of requests.
+        //:   (C-1)
+        //:
+        //: 2 Make medium and outlying requests from an adaptive pool and
+        //:   verify the size of each block obtained from its test allocator,
+        //:   and that small requests made in between do not allocate.
+        //:   (C-2..4)
+        //
+        // Testing:
+        //   CONCERN: Adaptive growth serves outliers from dedicated blocks.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ADAPTIVE GROWTH TEST" << endl
+                                  << "====================" << endl;
+
+        const bsls::BlockGrowth::Strategy ADP =
+                                              bsls::BlockGrowth::BSLS_ADAPTIVE;
+        const bsls::BlockGrowth::Strategy GEO =
+                                             bsls::BlockGrowth::BSLS_GEOMETRIC;
+
+        if (verbose) cout << "\nTesting small requests." << endl;
+        {
+            bslma::TestAllocator ta("geometric", veryVeryVeryVerbose);
+            bslma::TestAllocator tb("adaptive",  veryVeryVeryVerbose);
+
+            Obj mX(GEO, &ta);
+            Obj mY(ADP, &tb);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.allocate(24);
+                mY.allocate(24);
+                LOOP_ASSERT(i, ta.numAllocations() == tb.numAllocations());
+                LOOP_ASSERT(i, ta.lastAllocatedNumBytes()
+                                                == tb.lastAllocatedNumBytes());
+            }
+        }
+
+        if (verbose) cout << "\nTesting medium and outlying requests."
+                          << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(DEFAULT_SIZE, ADP, &ta);
+
+            const int SIZE = DEFAULT_SIZE;  // first buffer size
+
+            ASSERT(1 == ta.numAllocations());
+            ASSERT(blockSize(SIZE) == (int)ta.lastAllocatedNumBytes());
+
+            mX.allocate(8);
+            ASSERT(1 == ta.numAllocations());
+
+            // A request needing two growth steps grows the buffer.
+
+            mX.allocate(3 * SIZE);
+            ASSERT(2 == ta.numAllocations());
+            ASSERT(blockSize(4 * SIZE) == (int)ta.lastAllocatedNumBytes());
+
+            mX.allocate(8);
+            ASSERT(2 == ta.numAllocations());
+
+            // An outlier is served from a dedicated block.
+
+            const int OUTLIER = 64 * SIZE;
+
+            char *p = static_cast<char *>(mX.allocate(OUTLIER));
+            ASSERT(3 == ta.numAllocations());
+            ASSERT(blockSize(OUTLIER) == (int)ta.lastAllocatedNumBytes());
+            bsl::memset(p, 0xab, OUTLIER);
+
+            // The current buffer remains in use...
+
+            mX.allocate(8);
+            ASSERT(3 == ta.numAllocations());
+
+            // ...and its successor is not inflated by the outlier.
+
+            mX.allocate(4 * SIZE);
+            ASSERT(4 == ta.numAllocations());
+            ASSERT(blockSize(8 * SIZE) == (int)ta.lastAllocatedNumBytes());
+
+            mX.release();
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting the maximum buffer size." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            const int MAX_SIZE = 4 * DEFAULT_SIZE;
+
+            Obj mX(DEFAULT_SIZE, MAX_SIZE, ADP, &ta);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(DEFAULT_SIZE / 2);
+                LOOP_ASSERT(i, blockSize(MAX_SIZE)
+                                           >= (int)ta.lastAllocatedNumBytes());
+            }
+            ASSERT(blockSize(MAX_SIZE) == (int)ta.lastAllocatedNumBytes());
+
+            mX.allocate(MAX_SIZE + 1);
+            ASSERT(blockSize(MAX_SIZE + 1) == (int)ta.lastAllocatedNumBytes());
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // ALIGNED 'allocate' TEST:
+        //
+        // Concerns:
+        //: 1 The returned address is a multiple of the requested alignment,
+        //:   for alignments both below and above the maximal alignment.
+        //:
+        //: 2 Consecutive aligned requests are served from the current
+        //:   internal buffer, consuming only the padding needed to reach the
+        //:   next aligned address.
+        //:
+        //: 3 When the current buffer cannot satisfy the request, a new buffer
+        //:   large enough to hold the block plus the alignment slack is
+        //:   allocated.
+        //:
+        //: 4 A request too large for an internal buffer is satisfied by a
+        //:   dedicated block, and the current buffer remains in use.
+        //:
+        //: 5 All memory is reclaimed by 'release'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a pool supplied with a test allocator, request a sequence
+        //:   of cache-line and page-aligned blocks, and verify the returned
+        //:   addresses and the number of blocks allocated from the test
+        //:   allocator.  Write to each returned block in its entirety so that
+        //:   the test allocator detects any overrun.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size, size_type alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ALIGNED 'allocate' TEST" << endl
+                                  << "=======================" << endl;
+
+        typedef bsls::Types::IntPtr IntPtr;
+
+        enum { LINE_SIZE = 64, PAGE = 4096 };
+
+        if (verbose) cout << "\nTesting requests served from the buffer."
+                          << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(&ta);
+
+            char *p = static_cast<char *>(mX.allocate(1, LINE_SIZE));
+            ASSERT(0 == reinterpret_cast<IntPtr>(p) % LINE_SIZE);
+            ASSERT(1 == ta.numBlocksInUse());
+            memset(p, 0xa5, 1);
+
+            char *q = static_cast<char *>(mX.allocate(LINE_SIZE, LINE_SIZE));
+            ASSERT(p + LINE_SIZE == q);
+            ASSERT(1 == ta.numBlocksInUse());
+            memset(q, 0xa5, LINE_SIZE);
+
+            char *r = static_cast<char *>(mX.allocate(1, 1));
+            ASSERT(q + LINE_SIZE == r);
+
+            void *s = mX.allocate(8, MAX_ALIGN);
+            ASSERT(0 == reinterpret_cast<IntPtr>(s) % MAX_ALIGN);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting replenishment." << endl;
+
+            char *t = static_cast<char *>(mX.allocate(100, PAGE));
+            ASSERTV(t, 0 == reinterpret_cast<IntPtr>(t) % PAGE);
+            ASSERT(2 == ta.numBlocksInUse());
+            memset(t, 0xa5, 100);
+
+            char *u = static_cast<char *>(mX.allocate(100, LINE_SIZE));
+            ASSERT(t + 128 == u);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting requests exceeding the buffer."
+                          << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(64, bsls::BlockGrowth::BSLS_CONSTANT, &ta);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            char *p = static_cast<char *>(mX.allocate(8, 8));
+            ASSERT(1 == ta.numBlocksInUse());
+
+            char *q = static_cast<char *>(mX.allocate(1000, 256));
+            ASSERTV(q, 0 == reinterpret_cast<IntPtr>(q) % 256);
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(blockSize(1000 + 256 - MAX_ALIGN)
+                                           == (int)ta.lastAllocatedNumBytes());
+            memset(q, 0xa5, 1000);
+
+            char *r = static_cast<char *>(mX.allocate(8, 8));
+            ASSERT(p + 8 == r);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&objectAllocator);
+
+            ASSERT_PASS(mX.allocate(1, 64));
+            ASSERT_FAIL(mX.allocate(0, 64));
+            ASSERT_FAIL(mX.allocate(1,  0));
+            ASSERT_FAIL(mX.allocate(1, 48));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // GLOBAL OPERATOR NEW TEST
@@ -0,0 +1,164 @@
+// bdlma_shardedcountingallocator.cpp                                 -*-C++-*-
+#include <bdlma_shardedcountingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_shardedcountingallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_threadshardutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bslma::Allocator::size_type OFFSET =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+}  // close unnamed namespace
+
+                       // ------------------------------
+                       // class ShardedCountingAllocator
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+int ShardedCountingAllocator::shardIndex()
+{
+    return ThreadShardUtil::shardIndex(k_NUM_SHARDS);
+}
+
+// CREATORS
+ShardedCountingAllocator::ShardedCountingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_name_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 == name());
+    BSLS_ASSERT(0 == numBytesInUse());
+    BSLS_ASSERT(0 == numBytesTotal());
+    BSLS_ASSERT(d_allocator_p);
+}
+
+ShardedCountingAllocator::ShardedCountingAllocator(
+                                              const char       *name,
+                                              bslma::Allocator *basicAllocator)
+: d_name_p(name)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(name == this->name());
+    BSLS_ASSERT(0 == numBytesInUse());
+    BSLS_ASSERT(0 == numBytesTotal());
+    BSLS_ASSERT(d_allocator_p);
+}
+
+ShardedCountingAllocator::~ShardedCountingAllocator()
+{
+    BSLS_ASSERT(0               <= numBytesInUse());
+    BSLS_ASSERT(0               <= numBytesTotal());
+    BSLS_ASSERT(numBytesInUse() <= numBytesTotal());
+    BSLS_ASSERT(d_allocator_p);
+}
+
+// MANIPULATORS
+void *ShardedCountingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    // Round up 'size' for maximal alignment and add sufficient space to record
+    // 'size' in the allocated block.
+
+    const size_type totalSize =
+                 bsls::AlignmentUtil::roundUpToMaximalAlignment(size) + OFFSET;
+
+    void *address = d_allocator_p->allocate(totalSize);
+
+    Shard& shard = d_shards[shardIndex()];
+
+    shard.d_numBytesInUse.addRelaxed(static_cast<bsls::Types::Int64>(size));
+    shard.d_numBytesTotal.addRelaxed(static_cast<bsls::Types::Int64>(size));
+
+    *static_cast<size_type *>(address) = size;
+
+    return static_cast<char *>(address) + OFFSET;
+}
+
+void ShardedCountingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    address = static_cast<char *>(address) - OFFSET;
+
+    const size_type recordedSize = *static_cast<size_type *>(address);
+
+    d_shards[shardIndex()].d_numBytesInUse.addRelaxed(
+                               -static_cast<bsls::Types::Int64>(recordedSize));
+
+    d_allocator_p->deallocate(address);
+}
+
+// ACCESSORS
+bsls::Types::Int64 ShardedCountingAllocator::numBytesInUse() const
+{
+    bsls::Types::Int64 numBytes = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        numBytes += d_shards[i].d_numBytesInUse.loadRelaxed();
+    }
+    return numBytes;
+}
+
+bsls::Types::Int64 ShardedCountingAllocator::numBytesTotal() const
+{
+    bsls::Types::Int64 numBytes = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        numBytes += d_shards[i].d_numBytesTotal.loadRelaxed();
+    }
+    return numBytes;
+}
+
+bsl::ostream& ShardedCountingAllocator::print(bsl::ostream& stream) const
+{
+    stream << "----------------------------------------\n"
+           << "    Sharded Counting Allocator State\n"
+           << "----------------------------------------\n";
+
+    if (d_name_p) {
+        stream << "Allocator name: " << name() << "\n";
+    }
+
+    stream << "Bytes in use:   " << numBytesInUse() << "\n"
+           << "Bytes in total: " << numBytesTotal() << "\n";
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
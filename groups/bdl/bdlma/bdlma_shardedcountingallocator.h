@@ -0,0 +1,290 @@
+// bdlma_shardedcountingallocator.h                                   -*-C++-*-
+#ifndef INCLUDED_BDLMA_SHARDEDCOUNTINGALLOCATOR
+#define INCLUDED_BDLMA_SHARDEDCOUNTINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a counting allocator whose counters scale across threads.
+//
+//@CLASSES:
+//  bdlma::ShardedCountingAllocator: counting allocator with sharded counters
+//
+//@SEE_ALSO: bdlma_countingallocator, bdlma_hierarchicalallocator
+//
+//@DESCRIPTION: This component provides a counting allocator,
+// 'bdlma::ShardedCountingAllocator', that implements the 'bslma::Allocator'
+// protocol and, like 'bdlma::CountingAllocator', tracks: (1) the number of
+// bytes currently in use ('numBytesInUse'), and (2) the cumulative number of
+// bytes that have ever been allocated ('numBytesTotal'), based solely on the
+// number of bytes requested in calls to 'allocate':
+//..
+//   ,-------------------------------.
+//  ( bdlma::ShardedCountingAllocator )
+//   `-------------------------------'
+//                |           ctor/dtor
+//                |           numBytesInUse
+//                |           numBytesTotal
+//                |           name
+//                |           print
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                            allocate
+//                            deallocate
+//..
+// A 'bdlma::CountingAllocator' updates a single pair of atomic counters on
+// every 'allocate' and 'deallocate'.  When many threads allocate from the same
+// counting allocator, the cache line holding those counters moves from core to
+// core on each operation, and that traffic can dominate the cost of the
+// allocator.  A 'bdlma::ShardedCountingAllocator' instead keeps
+// 'k_NUM_SHARDS' pairs of counters, each on its own cache line, and each
+// thread updates the pair (or "shard") assigned to it the first time it uses
+// any sharded counting allocator.  The accessors sum the counters of all
+// shards, so reading the byte counts costs time proportional to
+// 'k_NUM_SHARDS', and is expected to be far less frequent than allocation.
+//
+// Note that a 'bdlma::ShardedCountingAllocator' is substantially larger than
+// a 'bdlma::CountingAllocator' (a few kilobytes), and is therefore intended to
+// be used for long-lived allocators shared by many threads (e.g., the
+// allocator accounting for the memory of a subsystem).  A single-threaded
+// client gains nothing over a 'bdlma::CountingAllocator'.
+//
+///Byte Counts
+///-----------
+// The byte counts are maintained as for 'bdlma::CountingAllocator' (see
+// {'bdlma_countingallocator'|Byte Counts}).  A block may be deallocated by a
+// thread other than the one that allocated it, so that the counters of an
+// individual shard may be negative; only their sum is meaningful.  In
+// addition, the sums are not taken atomically with respect to concurrent
+// allocations: if other threads are allocating or deallocating while
+// 'numBytesInUse' (or 'numBytesTotal') is called, the value returned is one
+// that the count had, or would have had had the concurrent operations been
+// applied in a different order.  In the absence of concurrent operations
+// (e.g., after the threads using the allocator have been joined), the values
+// returned are exact.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::ShardedCountingAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary') provided that the underlying allocator (established at
+// construction) is fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accounting for the Memory of a Multi-Threaded Subsystem
+///------------------------------------------------------------------
+// Suppose that a subsystem, whose worker threads all allocate from a common
+// allocator, must report the memory it uses.  First, we create a sharded
+// counting allocator to be supplied to the subsystem:
+//..
+//  bdlma::ShardedCountingAllocator subsystemAllocator("subsystem");
+//..
+// Then, each worker thread allocates (and deallocates) memory as usual; for
+// brevity, we show the allocations of a single thread:
+//..
+//  void *buffer  = subsystemAllocator.allocate(1024);
+//  void *message = subsystemAllocator.allocate(100);
+//
+//  subsystemAllocator.deallocate(buffer);
+//..
+// Finally, a monitoring task reports the memory used by the subsystem:
+//..
+//  assert( 100 == subsystemAllocator.numBytesInUse());
+//  assert(1124 == subsystemAllocator.numBytesTotal());
+//
+//  subsystemAllocator.deallocate(message);
+//
+//  assert(   0 == subsystemAllocator.numBytesInUse());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // ==============================
+                       // class ShardedCountingAllocator
+                       // ==============================
+
+class ShardedCountingAllocator BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete "counting" allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, and provides instrumentation
+    // to track: (1) the number of bytes currently in use, and (2) the
+    // cumulative number of bytes that have ever been allocated, using
+    // per-thread shards of counters so that concurrent allocations by
+    // different threads do not contend for the same cache line.
+    //
+    // Note that, like many other allocators, this allocator relies on the
+    // currently installed default allocator (see 'bslma_default').  Clients
+    // may, however, override this allocator by supplying (at construction) any
+    // other allocator implementing the 'bslma::Allocator' protocol provided
+    // that it is fully thread-safe.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_SHARDS = 16  // number of shards of counters
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_SIZE = 128  // size (in bytes) of each shard, large enough
+                            // that the counters of two shards never share a
+                            // cache line (or a pair of adjacent lines)
+    };
+
+    struct Shard {
+        // This 'struct' holds the counters updated by the threads assigned to
+        // one shard, padded to 'k_SHARD_SIZE' bytes.
+
+        bsls::AtomicInt64 d_numBytesInUse;  // bytes allocated less bytes
+                                            // deallocated by these threads
+
+        bsls::AtomicInt64 d_numBytesTotal;  // bytes allocated by these
+                                            // threads
+
+        char              d_padding[k_SHARD_SIZE
+                                    - 2 * sizeof(bsls::AtomicInt64)];
+    };
+
+    // DATA
+    Shard             d_shards[k_NUM_SHARDS];  // counters, by shard
+
+    const char       *d_name_p;                // optionally specified name of
+                                               // this allocator object (or 0)
+
+    bslma::Allocator *d_allocator_p;           // memory allocator (held, not
+                                               // owned)
+
+  private:
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard assigned to the calling thread,
+        // assigning one on the first call from that thread.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCountingAllocator(const ShardedCountingAllocator&);
+    ShardedCountingAllocator& operator=(const ShardedCountingAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    ShardedCountingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ShardedCountingAllocator(const char       *name,
+                             bslma::Allocator *basicAllocator = 0);
+        // Create a sharded counting allocator.  Optionally specify a 'name'
+        // (associated with this object) to be included in messages output by
+        // the 'print' method, thereby distinguishing this counting allocator
+        // from others that might be used in the same program.  If 'name' is 0
+        // (or not specified), no distinguishing name is incorporated in
+        // 'print' output.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    virtual ~ShardedCountingAllocator();
+        // Destroy this allocator object.  Note that destroying this allocator
+        // has no effect on any outstanding allocated memory.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated block of memory of the specified 'size' (in
+        // bytes).  If 'size' is 0, a null pointer is returned with no other
+        // effect (e.g., on allocation statistics).  Otherwise, invoke the
+        // 'allocate' method of the allocator supplied at construction, and
+        // increment the number of currently (and cumulatively) allocated bytes
+        // by 'size', in the shard of the calling thread.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect (e.g., on
+        // allocation statistics).  Otherwise, decrease the number of currently
+        // allocated bytes by the size originally requested for the block, in
+        // the shard of the calling thread.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object and has not
+        // already been deallocated.
+
+    // ACCESSORS
+    const char *name() const;
+        // Return the name of this counting allocator, or 0 if no name was
+        // specified at construction.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently allocated from this object,
+        // summed over all shards (see {Byte Counts}).
+
+    bsls::Types::Int64 numBytesTotal() const;
+        // Return the cumulative number of bytes ever allocated from this
+        // object, summed over all shards (see {Byte Counts}).
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write the accumulated state information held in this allocator to
+        // the specified 'stream' in some reasonable (multi-line) format, and
+        // return a reference to 'stream'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class ShardedCountingAllocator
+                       // ------------------------------
+
+// ACCESSORS
+inline
+const char *ShardedCountingAllocator::name() const
+{
+    return d_name_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
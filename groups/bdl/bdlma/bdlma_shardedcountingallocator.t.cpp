@@ -0,0 +1,671 @@
+// bdlma_shardedcountingallocator.t.cpp                               -*-C++-*-
+#include <bdlma_shardedcountingallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ShardedCountingAllocator' tracks the number of bytes currently in
+// use and the cumulative number of bytes that have ever been allocated, like
+// 'bdlma::CountingAllocator', but keeps its counters in per-thread shards that
+// are summed by the accessors.  The primary concerns are that the two byte
+// counts are correctly maintained, including when blocks are allocated and
+// deallocated by different threads, that 'allocate' returns maximally-aligned
+// memory blocks of the expected size from the object allocator, and that
+// 'deallocate' returns memory blocks back to the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedCountingAllocator(Allocator *ba = 0);
+// [ 2] ShardedCountingAllocator(const char *name, Allocator *ba = 0);
+// [ 2] ~ShardedCountingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] const char *name() const;
+// [ 3] Int64 numBytesInUse() const;
+// [ 3] Int64 numBytesTotal() const;
+// [ 4] bsl::ostream& print(bsl::ostream& stream) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ 5] CONCERN: Counts are exact when threads allocate concurrently.
+// [ 5] CONCERN: Blocks may be deallocated by another thread.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ShardedCountingAllocator Obj;
+
+typedef bsls::Types::Int64 Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase5 {
+
+enum { k_NUM_BLOCKS = 100 };
+
+struct ThreadInfo {
+    int    d_numIterations;           // number of allocate/deallocate pairs
+    int    d_size;                    // size of each allocation
+    Obj   *d_obj_p;                   // allocator under test
+    void  *d_blocks[k_NUM_BLOCKS];    // blocks left allocated on exit
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj& mX = *info->d_obj_p;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        void *p = mX.allocate(info->d_size);
+        bsl::memset(p, 0xff, info->d_size);
+        mX.deallocate(p);
+    }
+
+    // Leave blocks allocated, to be deallocated by the main thread.
+
+    for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+        info->d_blocks[i] = mX.allocate(info->d_size);
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accounting for the Memory of a Multi-Threaded Subsystem
+///------------------------------------------------------------------
+// Suppose that a subsystem, whose worker threads all allocate from a common
+// allocator, must report the memory it uses.  First, we create a sharded
+// counting allocator to be supplied to the subsystem:
+//..
+    bdlma::ShardedCountingAllocator subsystemAllocator("subsystem");
+//..
+// Then, each worker thread allocates (and deallocates) memory as usual; for
+// brevity, we show the allocations of a single thread:
+//..
+    void *buffer  = subsystemAllocator.allocate(1024);
+    void *message = subsystemAllocator.allocate(100);
+
+    subsystemAllocator.deallocate(buffer);
+//..
+// Finally, a monitoring task reports the memory used by the subsystem:
+//..
+    ASSERT( 100 == subsystemAllocator.numBytesInUse());
+    ASSERT(1124 == subsystemAllocator.numBytesTotal());
+
+    subsystemAllocator.deallocate(message);
+
+    ASSERT(   0 == subsystemAllocator.numBytesInUse());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that the counts are exact under concurrent use.
+        //
+        // Concerns:
+        //: 1 'allocate' and 'deallocate' are thread-safe, and, once the
+        //:   threads using the allocator are joined, the counts summed over
+        //:   the shards are exact.
+        //:
+        //: 2 Blocks allocated by one thread may be deallocated by another,
+        //:   even though the threads update different shards.
+        //
+        // Plan:
+        //: 1 Create more threads than there are shards, each of which
+        //:   allocates and deallocates a number of blocks of a size specific
+        //:   to the thread, and leaves a number of blocks allocated.  Join the
+        //:   threads and verify the counts.  (C-1)
+        //:
+        //: 2 Deallocate the blocks left allocated by the threads from the
+        //:   main thread, and verify that no byte remains in use.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Counts are exact when threads allocate concurrently.
+        //   CONCERN: Blocks may be deallocated by another thread.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase5;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum {
+            k_NUM_THREADS    = Obj::k_NUM_SHARDS + 4,
+            k_NUM_ITERATIONS = 10000
+        };
+
+        Obj mX(&sa);  const Obj& X = mX;
+
+        ThreadInfo info[k_NUM_THREADS];
+        ThreadId   ids[k_NUM_THREADS];
+
+        Int64 expectedInUse = 0;
+        Int64 expectedTotal = 0;
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            info[i].d_numIterations = k_NUM_ITERATIONS;
+            info[i].d_size          = i + 1;
+            info[i].d_obj_p         = &mX;
+
+            expectedInUse += k_NUM_BLOCKS * (i + 1);
+            expectedTotal += (k_NUM_ITERATIONS + k_NUM_BLOCKS) * (i + 1);
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ids[i] = createThread(&threadFunction, &info[i]);
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(ids[i]);
+        }
+
+        ASSERTV(expectedInUse, X.numBytesInUse(),
+                expectedInUse == X.numBytesInUse());
+        ASSERTV(expectedTotal, X.numBytesTotal(),
+                expectedTotal == X.numBytesTotal());
+        ASSERT(k_NUM_THREADS * k_NUM_BLOCKS == sa.numBlocksInUse());
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                mX.deallocate(info[i].d_blocks[j]);
+            }
+        }
+
+        ASSERT(0             == X.numBytesInUse());
+        ASSERT(expectedTotal == X.numBytesTotal());
+        ASSERT(0             == sa.numBlocksInUse());
+        ASSERT(0             == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PRINT METHOD
+        //
+        // Concerns:
+        //: 1 The 'print' method writes the name (if any) and the byte counts
+        //:   of the allocator in the intended format.
+        //:
+        //: 2 The 'print' method returns the supplied 'ostream'.
+        //:
+        //: 3 The 'print' method allocates no memory from the object
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Print an unnamed object and a named object, each having one
+        //:   outstanding memory block out of two total allocations, and
+        //:   verify the output, the value returned, and (using a
+        //:   'bslma::TestAllocatorMonitor') that no memory is allocated from
+        //:   the object allocator.  (C-1..3)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT METHOD" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_name_p;    // name of the allocator, or 0
+            const char *d_expected;  // expected output
+        } DATA[] = {
+            { L_, 0,
+              "----------------------------------------\n"
+              "    Sharded Counting Allocator State\n"
+              "----------------------------------------\n"
+              "Bytes in use:   8\n"
+              "Bytes in total: 64\n"                                       },
+            { L_, "Sharded",
+              "----------------------------------------\n"
+              "    Sharded Counting Allocator State\n"
+              "----------------------------------------\n"
+              "Allocator name: Sharded\n"
+              "Bytes in use:   8\n"
+              "Bytes in total: 64\n"                                       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const NAME     = DATA[ti].d_name_p;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            bsl::ostringstream os;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(NAME, &sa);  const Obj& X = mX;
+
+            void *p1 = mX.allocate( 8);
+            void *p2 = mX.allocate(56);  mX.deallocate(p2);
+
+            bslma::TestAllocatorMonitor sam(&sa);
+
+            ASSERTV(LINE, &os == &X.print(os));
+
+            ASSERTV(LINE, sam.isInUseSame());
+            ASSERTV(LINE, sam.isTotalSame());
+
+            if (veryVerbose) {
+                cout << "ACTUAL:"   << endl << os.str() << endl;
+                cout << "EXPECTED:" << endl << EXPECTED << endl;
+            }
+
+            ASSERTV(LINE, os.str(), EXPECTED == os.str());
+
+            mX.deallocate(p1);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate', 'deallocate', AND BYTE COUNTS
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of (at least) the
+        //:   requested size obtained from the object allocator, and
+        //:   increases both byte counts by the requested size.
+        //:
+        //: 2 'deallocate' returns the block to the object allocator, and
+        //:   decreases the number of bytes in use by the requested size.
+        //:
+        //: 3 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //
+        // Plan:
+        //: 1 Allocate blocks of a range of sizes, write to them, and verify
+        //:   their alignment, the byte counts, and the blocks in use from the
+        //:   object allocator.  Then deallocate them, verifying the same.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that 'allocate(0)' and 'deallocate(0)' have no effect.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   Int64 numBytesInUse() const;
+        //   Int64 numBytesTotal() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate', 'deallocate', AND BYTE COUNTS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { k_NUM_BLOCKS = 20 };
+
+        const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numBytesTotal());
+            ASSERT(0 == sa.numBlocksTotal());
+
+            mX.deallocate(0);
+            ASSERT(0 == sa.numBlocksTotal());
+
+            void  *blocks[k_NUM_BLOCKS];
+            Int64  total = 0;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                const int SIZE = i * 7 + 1;
+
+                blocks[i] = mX.allocate(SIZE);
+                bsl::memset(blocks[i], 0xa5, SIZE);
+                total += SIZE;
+
+                ASSERTV(i, 0 == bsls::Types::UintPtr(blocks[i]) % MAX_ALIGN);
+                ASSERTV(i, total == X.numBytesInUse());
+                ASSERTV(i, total == X.numBytesTotal());
+                ASSERTV(i, i + 1 == sa.numBlocksInUse());
+            }
+
+            Int64 inUse = total;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+                inUse -= i * 7 + 1;
+
+                ASSERTV(i, inUse == X.numBytesInUse());
+                ASSERTV(i, total == X.numBytesTotal());
+                ASSERTV(i, k_NUM_BLOCKS - i - 1 == sa.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, DTOR, AND 'name'
+        //
+        // Concerns:
+        //: 1 An object created with either constructor has byte counts of 0,
+        //:   and the name, if any, specified at construction.
+        //:
+        //: 2 Memory is supplied by the specified allocator, or by the default
+        //:   allocator if none is specified.
+        //:
+        //: 3 The destructor has no effect on outstanding allocated memory.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, verify 'name' and the byte counts, and allocate a
+        //:   block to verify the allocator supplying memory.  (C-1..2)
+        //:
+        //: 2 Destroy an object having an outstanding block, and verify that
+        //:   the block is still in use from the object allocator.  (C-3)
+        //
+        // Testing:
+        //   ShardedCountingAllocator(Allocator *ba = 0);
+        //   ShardedCountingAllocator(const char *name, Allocator *ba = 0);
+        //   ~ShardedCountingAllocator();
+        //   const char *name() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, DTOR, AND 'name'" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator         da("default",   veryVeryVeryVerbose);
+        bslma::TestAllocator         fa("footprint", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *NAME = "Sharded";
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            Obj                  *objPtr = 0;
+            bslma::TestAllocator *objAllocatorPtr = 0;
+            const char           *expectedName = 0;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new (fa) Obj();
+                objAllocatorPtr = &da;
+              } break;
+              case 'b': {
+                objPtr = new (fa) Obj(&sa);
+                objAllocatorPtr = &sa;
+              } break;
+              case 'c': {
+                objPtr = new (fa) Obj(NAME);
+                objAllocatorPtr = &da;
+                expectedName = NAME;
+              } break;
+              case 'd': {
+                objPtr = new (fa) Obj(NAME, &sa);
+                objAllocatorPtr = &sa;
+                expectedName = NAME;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+            bslma::TestAllocator& oa = *objAllocatorPtr;
+
+            const Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            ASSERTV(CONFIG, expectedName == X.name());
+            ASSERTV(CONFIG, 0 == X.numBytesInUse());
+            ASSERTV(CONFIG, 0 == X.numBytesTotal());
+
+            void *p = mX.allocate(10);
+            ASSERTV(CONFIG, NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+            fa.deleteObject(objPtr);
+
+            ASSERTV(CONFIG, NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+            oa.deallocate(static_cast<char *>(p)
+                                 - bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == fa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate a few blocks, and
+        //:   verify the byte counts.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            void *p = mX.allocate(16);
+            void *q = mX.allocate(64);
+
+            ASSERT(80 == X.numBytesInUse());
+            ASSERT(80 == X.numBytesTotal());
+            ASSERT( 2 == sa.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(64 == X.numBytesInUse());
+            ASSERT(80 == X.numBytesTotal());
+
+            mX.deallocate(q);
+            ASSERT( 0 == X.numBytesInUse());
+            ASSERT( 0 == sa.numBlocksInUse());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,628 @@
+// bdlma_sharedmemorypool.cpp                                         -*-C++-*-
+#include <bdlma_sharedmemorypool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sharedmemorypool_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>     // 'CreateFileMappingA', 'OpenFileMappingA',
+                         // 'MapViewOfFile', 'UnmapViewOfFile'
+#else
+
+#include <fcntl.h>       // 'O_CREAT', 'O_EXCL', 'O_RDWR'
+#include <sys/mman.h>    // 'shm_open', 'shm_unlink', 'mmap', 'munmap'
+#include <sys/stat.h>    // 'fstat'
+#include <unistd.h>      // 'close', 'ftruncate'
+
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::AtomicOperations AtomicOps;
+
+enum {
+    k_VERSION         = 1,   // version of the segment layout
+
+    k_CACHE_LINE_SIZE = 64,  // size of the region of the header holding each
+                             // free list, so that the free lists of different
+                             // size classes do not share a cache line
+
+    k_GRANULE         = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+                             // unit of the offsets held in free lists, and
+                             // size of the header of each block
+
+    k_LARGE_BLOCK     = bdlma::SharedMemoryPool::k_NUM_SIZE_CLASSES
+                             // size class recorded for blocks larger than
+                             // 'k_MAX_POOLED_BLOCK_SIZE'
+};
+
+const bsls::Types::Int64 k_MAGIC = 0x62646c6d6173686dLL;  // "bdlmashm"
+
+struct Header {
+    // This 'struct' describes the header at the start of a shared-memory
+    // segment, which is followed (at offset 'k_CACHE_LINE_SIZE') by the
+    // 'FreeList' of each size class.
+
+    AtomicOps::AtomicTypes::Int64  d_magic;       // 'k_MAGIC', set (last) by
+                                                  // 'create'
+
+    int                            d_version;     // 'k_VERSION'
+
+    int                            d_headerSize;  // 'k_HEADER_SIZE'
+
+    bsls::Types::Int64             d_size;        // size of the segment
+
+    AtomicOps::AtomicTypes::Int64  d_offset;      // offset of the first
+                                                  // uncarved byte
+
+    AtomicOps::AtomicTypes::Int64  d_rootOffset;  // offset of the root
+                                                  // object, or 0 if none
+};
+
+struct FreeList {
+    // This 'struct' describes the free list of a size class.  The head of the
+    // list holds, in its low 32 bits, the offset (in units of 'k_GRANULE') of
+    // the header of the first free block, or 0 if the list is empty, and, in
+    // its high 32 bits, a counter incremented by each change to the list, so
+    // that a compare-and-swap of the head fails if the list changed (and
+    // changed back) since the head was read.
+
+    AtomicOps::AtomicTypes::Int64  d_head;
+
+    char                           d_padding[k_CACHE_LINE_SIZE
+                                                             - sizeof(d_head)];
+};
+
+struct BlockHeader {
+    // This 'struct' describes the header preceding each block.
+
+    AtomicOps::AtomicTypes::Int  d_next;       // offset (in units of
+                                               // 'k_GRANULE') of the next
+                                               // free block, if this block
+                                               // is free
+
+    int                          d_sizeClass;  // size class of the block
+};
+
+BSLMF_ASSERT(sizeof(Header) <= k_CACHE_LINE_SIZE);
+BSLMF_ASSERT(sizeof(FreeList) == k_CACHE_LINE_SIZE);
+BSLMF_ASSERT(k_CACHE_LINE_SIZE
+               + bdlma::SharedMemoryPool::k_NUM_SIZE_CLASSES * sizeof(FreeList)
+                                    <= bdlma::SharedMemoryPool::k_HEADER_SIZE);
+BSLMF_ASSERT(0 == bdlma::SharedMemoryPool::k_HEADER_SIZE % k_GRANULE);
+BSLMF_ASSERT(sizeof(BlockHeader) <= k_GRANULE);
+
+// HELPER FUNCTIONS
+
+inline
+Header *header(char *base)
+    // Return the address of the header of the segment mapped at the specified
+    // 'base'.
+{
+    return reinterpret_cast<Header *>(base);
+}
+
+inline
+FreeList *freeList(char *base, int sizeClass)
+    // Return the address of the free list of the specified 'sizeClass' of
+    // the segment mapped at the specified 'base'.
+{
+    return reinterpret_cast<FreeList *>(base + k_CACHE_LINE_SIZE) + sizeClass;
+}
+
+inline
+int sizeClassOf(bsl::size_t size)
+    // Return the size class of blocks of the specified 'size' (in bytes), or
+    // 'k_LARGE_BLOCK' if 'size' exceeds 'k_MAX_POOLED_BLOCK_SIZE'.
+{
+    if (size > bdlma::SharedMemoryPool::k_MAX_POOLED_BLOCK_SIZE) {
+        return k_LARGE_BLOCK;                                         // RETURN
+    }
+
+    int         sizeClass = 0;
+    bsl::size_t blockSize = bdlma::SharedMemoryPool::k_MIN_BLOCK_SIZE;
+    while (blockSize < size) {
+        blockSize <<= 1;
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+bool isValid(char *base, bsls::Types::Int64 size)
+    // Return 'true' if the segment of the specified 'size' (in bytes) mapped
+    // at the specified 'base' has been initialized by 'create', and 'false'
+    // otherwise.
+{
+    if (size < bdlma::SharedMemoryPool::k_HEADER_SIZE) {
+        return false;                                                 // RETURN
+    }
+
+    const Header *h = header(base);
+
+    if (k_MAGIC != AtomicOps::getInt64Acquire(&h->d_magic)) {
+        return false;                                                 // RETURN
+    }
+
+    const bsls::Types::Int64 offset = AtomicOps::getInt64Relaxed(&h->d_offset);
+
+    return k_VERSION                               == h->d_version
+        && bdlma::SharedMemoryPool::k_HEADER_SIZE  == h->d_headerSize
+        && size                                    >= h->d_size
+        && bdlma::SharedMemoryPool::k_HEADER_SIZE  <= offset
+        && offset                                  <= h->d_size;
+}
+
+void unmapSegment(char *base, bsls::Types::Int64 size, void *handle)
+    // Unmap the segment of the specified 'size' (in bytes) mapped at the
+    // specified 'base', and close the specified 'handle' (Windows only).
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(handle));
+    (void)size;
+
+#else
+
+    munmap(base, static_cast<bsl::size_t>(size));
+    (void)handle;
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // ----------------------
+                          // class SharedMemoryPool
+                          // ----------------------
+
+// PRIVATE MANIPULATORS
+void *SharedMemoryPool::carve(bsls::Types::Int64 size)
+{
+    Header *h = header(d_base_p);
+
+    // Advance the offset of the first uncarved byte, unless another thread
+    // (in any process) does so first.
+
+    bsls::Types::Int64 offset = AtomicOps::getInt64Relaxed(&h->d_offset);
+    for (;;) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_size - offset)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                               &h->d_offset,
+                                                               offset,
+                                                               offset + size);
+        if (previous == offset) {
+            break;
+        }
+        offset = previous;
+    }
+
+    return d_base_p + offset;
+}
+
+// CLASS METHODS
+int SharedMemoryPool::remove(const char *name)
+{
+    BSLS_ASSERT(name);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    (void)name;
+    return 0;
+
+#else
+
+    return shm_unlink(name);
+
+#endif
+}
+
+// CREATORS
+SharedMemoryPool::SharedMemoryPool()
+: d_base_p(0)
+, d_size(0)
+, d_handle_p(0)
+{
+}
+
+SharedMemoryPool::~SharedMemoryPool()
+{
+    detach();
+}
+
+// MANIPULATORS
+void *SharedMemoryPool::allocate(size_type size)
+{
+    BSLS_ASSERT(isAttached());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const int sizeClass = sizeClassOf(size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_LARGE_BLOCK == sizeClass)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (size > static_cast<size_type>(d_size)) {
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        const bsls::Types::Int64 blockSize =
+                                  static_cast<bsls::Types::Int64>(
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(size));
+
+        char *block = static_cast<char *>(carve(k_GRANULE + blockSize));
+#ifndef BDE_BUILD_TARGET_EXC
+        if (0 == block) {
+            return 0;                                                 // RETURN
+        }
+#endif
+        reinterpret_cast<BlockHeader *>(block)->d_sizeClass = k_LARGE_BLOCK;
+        return block + k_GRANULE;                                     // RETURN
+    }
+
+    // Pop the first block of the free list of 'sizeClass', unless the list is
+    // empty.  Note that the block may be popped (and its 'd_next' changed) by
+    // another thread between reading the head and the compare-and-swap, in
+    // which case the counter in the head will have changed as well.
+
+    FreeList *list = freeList(d_base_p, sizeClass);
+
+    bsls::Types::Int64 head = AtomicOps::getInt64Acquire(&list->d_head);
+    for (;;) {
+        const bsls::Types::Uint64 index =
+                           static_cast<bsls::Types::Uint64>(head) & 0xffffffff;
+        if (0 == index) {
+            break;
+        }
+
+        char *block = d_base_p + index * k_GRANULE;
+
+        const bsls::Types::Uint64 next = static_cast<unsigned int>(
+                                    AtomicOps::getIntRelaxed(
+                          &reinterpret_cast<BlockHeader *>(block)->d_next));
+
+        const bsls::Types::Int64 newHead = static_cast<bsls::Types::Int64>(
+                  ((static_cast<bsls::Types::Uint64>(head) >> 32) + 1) << 32
+                | next);
+
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                                 &list->d_head,
+                                                                 head,
+                                                                 newHead);
+        if (previous == head) {
+            return block + k_GRANULE;                                 // RETURN
+        }
+        head = previous;
+    }
+
+    const bsls::Types::Int64 blockSize = k_MIN_BLOCK_SIZE << sizeClass;
+
+    char *block = static_cast<char *>(carve(k_GRANULE + blockSize));
+#ifndef BDE_BUILD_TARGET_EXC
+    if (0 == block) {
+        return 0;                                                     // RETURN
+    }
+#endif
+    reinterpret_cast<BlockHeader *>(block)->d_sizeClass = sizeClass;
+    return block + k_GRANULE;
+}
+
+int SharedMemoryPool::attach(const char *name)
+{
+    BSLS_ASSERT(name);
+    BSLS_ASSERT(!isAttached());
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+    if (0 == mapping) {
+        return 1;                                                     // RETURN
+    }
+
+    char *base = static_cast<char *>(
+                         MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    if (0 == base) {
+        CloseHandle(mapping);
+        return 1;                                                     // RETURN
+    }
+
+    MEMORY_BASIC_INFORMATION info;
+    const bsls::Types::Int64 size =
+                                  VirtualQuery(base, &info, sizeof info)
+                                  ? static_cast<bsls::Types::Int64>(
+                                                              info.RegionSize)
+                                  : 0;
+
+    if (!isValid(base, size)) {
+        unmapSegment(base, size, mapping);
+        return 2;                                                     // RETURN
+    }
+
+    d_handle_p = mapping;
+
+#else
+
+    const int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return 1;                                                     // RETURN
+    }
+
+    struct stat info;
+    if (0 != fstat(fd, &info) || 0 == info.st_size) {
+        // A segment whose size is 0 is being created by 'create'.
+
+        ::close(fd);
+        return 2;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 size = info.st_size;
+
+    // The mapping remains valid after the file descriptor is closed.
+
+    void *address = mmap(0,
+                         static_cast<bsl::size_t>(size),
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         fd,
+                         0);
+    ::close(fd);
+
+    if (MAP_FAILED == address) {
+        return 1;                                                     // RETURN
+    }
+
+    char *base = static_cast<char *>(address);
+
+    if (!isValid(base, size)) {
+        unmapSegment(base, size, 0);
+        return 2;                                                     // RETURN
+    }
+
+#endif
+
+    d_base_p = base;
+    d_size   = header(base)->d_size;
+
+    return 0;
+}
+
+int SharedMemoryPool::create(const char *name, bsls::Types::Int64 size)
+{
+    BSLS_ASSERT(name);
+    BSLS_ASSERT(!isAttached());
+    BSLS_ASSERT(k_HEADER_SIZE < size);
+    BSLS_ASSERT(size / k_GRANULE
+                             <= static_cast<bsls::Types::Int64>(0xffffffffu));
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                        0,
+                                        PAGE_READWRITE,
+                                        static_cast<DWORD>(size >> 32),
+                                        static_cast<DWORD>(size),
+                                        name);
+    if (0 == mapping) {
+        return 1;                                                     // RETURN
+    }
+
+    if (ERROR_ALREADY_EXISTS == GetLastError()) {
+        CloseHandle(mapping);
+        return 1;                                                     // RETURN
+    }
+
+    char *base = static_cast<char *>(
+                         MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+    if (0 == base) {
+        CloseHandle(mapping);
+        return 1;                                                     // RETURN
+    }
+
+    d_handle_p = mapping;
+
+#else
+
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0666);
+    if (fd < 0) {
+        return 1;                                                     // RETURN
+    }
+
+    if (0 != ftruncate(fd, static_cast<off_t>(size))) {
+        ::close(fd);
+        shm_unlink(name);
+        return 1;                                                     // RETURN
+    }
+
+    void *address = mmap(0,
+                         static_cast<bsl::size_t>(size),
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         fd,
+                         0);
+    ::close(fd);
+
+    if (MAP_FAILED == address) {
+        shm_unlink(name);
+        return 1;                                                     // RETURN
+    }
+
+    char *base = static_cast<char *>(address);
+
+#endif
+
+    // A newly created segment is zero-filled (so that every free list is
+    // empty); initialize its header, and set its magic number last, so that
+    // a concurrent 'attach' does not observe a partially initialized header.
+
+    Header *h = header(base);
+
+    h->d_version    = k_VERSION;
+    h->d_headerSize = k_HEADER_SIZE;
+    h->d_size       = size;
+    AtomicOps::setInt64Relaxed(&h->d_offset, k_HEADER_SIZE);
+    AtomicOps::setInt64Relaxed(&h->d_rootOffset, 0);
+    AtomicOps::setInt64Release(&h->d_magic, k_MAGIC);
+
+    d_base_p = base;
+    d_size   = size;
+
+    return 0;
+}
+
+void SharedMemoryPool::deallocate(void *address)
+{
+    BSLS_ASSERT(isAttached());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    char        *block       = static_cast<char *>(address) - k_GRANULE;
+    BlockHeader *blockHeader = reinterpret_cast<BlockHeader *>(block);
+
+    BSLS_ASSERT(d_base_p + k_HEADER_SIZE <= block);
+    BSLS_ASSERT(block < d_base_p + d_size);
+
+    const int sizeClass = blockHeader->d_sizeClass;
+
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass <= k_LARGE_BLOCK);
+
+    if (k_LARGE_BLOCK == sizeClass) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Uint64 index = (block - d_base_p) / k_GRANULE;
+
+    // Push the block onto the free list of its size class.
+
+    FreeList *list = freeList(d_base_p, sizeClass);
+
+    bsls::Types::Int64 head = AtomicOps::getInt64Relaxed(&list->d_head);
+    for (;;) {
+        AtomicOps::setIntRelaxed(&blockHeader->d_next,
+                                 static_cast<int>(
+                                       static_cast<bsls::Types::Uint64>(head)
+                                                                & 0xffffffff));
+
+        const bsls::Types::Int64 newHead = static_cast<bsls::Types::Int64>(
+                  ((static_cast<bsls::Types::Uint64>(head) >> 32) + 1) << 32
+                | index);
+
+        const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64AcqRel(
+                                                                 &list->d_head,
+                                                                 head,
+                                                                 newHead);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+}
+
+void SharedMemoryPool::detach()
+{
+    if (d_base_p) {
+        unmapSegment(d_base_p, d_size, d_handle_p);
+
+        d_base_p   = 0;
+        d_size     = 0;
+        d_handle_p = 0;
+    }
+}
+
+void SharedMemoryPool::setRoot(const void *address)
+{
+    BSLS_ASSERT(isAttached());
+
+    Header *h = header(d_base_p);
+
+    if (0 == address) {
+        AtomicOps::setInt64Release(&h->d_rootOffset, 0);
+        return;                                                       // RETURN
+    }
+
+    const char *p = static_cast<const char *>(address);
+
+    BSLS_ASSERT(d_base_p + k_HEADER_SIZE <= p);
+    BSLS_ASSERT(p < d_base_p + AtomicOps::getInt64(&h->d_offset));
+
+    AtomicOps::setInt64Release(&h->d_rootOffset, p - d_base_p);
+}
+
+// ACCESSORS
+bsls::Types::Int64 SharedMemoryPool::capacity() const
+{
+    return d_base_p ? d_size - k_HEADER_SIZE : 0;
+}
+
+bsls::Types::Int64 SharedMemoryPool::numBytesRemaining() const
+{
+    if (0 == d_base_p) {
+        return 0;                                                     // RETURN
+    }
+
+    return d_size - AtomicOps::getInt64Relaxed(&header(d_base_p)->d_offset);
+}
+
+void *SharedMemoryPool::root() const
+{
+    BSLS_ASSERT(isAttached());
+
+    const bsls::Types::Int64 offset = AtomicOps::getInt64Acquire(
+                                          &header(d_base_p)->d_rootOffset);
+
+    return offset ? d_base_p + offset : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,343 @@
+// bdlma_sharedmemorypool.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLMA_SHAREDMEMORYPOOL
+#define INCLUDED_BDLMA_SHAREDMEMORYPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pool allocator over a segment shared between processes.
+//
+//@CLASSES:
+//  bdlma::SharedMemoryPool: size-class pool over a named shared-memory segment
+//
+//@SEE_ALSO: bdlma_offsetptr, bdlma_persistentarena, bdlma_multipool
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::SharedMemoryPool', that implements the 'bslma::Allocator' protocol
+// by supplying memory from a named shared-memory segment (e.g., one created
+// with 'shm_open' and mapped with 'mmap').  Any number of processes may
+// attach to the same segment, and allocate from and deallocate to it
+// concurrently, so that data built in the segment by one process (e.g., a
+// large, read-mostly table) is shared by all of them rather than duplicated
+// in each:
+//..
+//   ,-----------------------.
+//  ( bdlma::SharedMemoryPool )
+//   `-----------------------'
+//               |         ctor/dtor
+//               |         create
+//               |         attach
+//               |         detach
+//               |         remove
+//               |         setRoot
+//               |         capacity
+//               |         isAttached
+//               |         numBytesRemaining
+//               |         root
+//               V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                         allocate
+//                         deallocate
+//..
+///Size Classes
+///------------
+// Like 'bdlma::Multipool', a shared-memory pool serves blocks from
+// 'k_NUM_SIZE_CLASSES' size classes, whose block sizes are successive powers
+// of two starting at 'k_MIN_BLOCK_SIZE', and keeps a free list of the blocks
+// of each size class that have been deallocated.  A block not found on the
+// free list of its size class is carved from the unused part of the segment.
+// Each block is preceded by a header of maximal alignment recording its size
+// class.
+//
+// The free lists are held in the segment itself and are shared by all
+// attached processes.  They are lock-free: a block is pushed onto (or popped
+// from) a free list with a single compare-and-swap of the head of the list,
+// which records the offset of the first block together with a counter
+// protecting against the ABA problem.  A process that terminates, even
+// abnormally, while allocating or deallocating therefore never leaves a lock
+// held.
+//
+// Blocks larger than 'k_MAX_POOLED_BLOCK_SIZE' are carved directly from the
+// segment and are *not* reused after they are deallocated; such blocks are
+// intended for the large, long-lived arrays of shared tables.  When the
+// unused part of the segment cannot hold a block, 'allocate' throws
+// 'bsl::bad_alloc'; the segment never grows.
+//
+///Position Independence
+///---------------------
+// A segment is, in general, mapped at a different address in each process,
+// so a data structure built in the segment must not contain raw pointers;
+// links between its objects should be 'bdlma::OffsetPtr' objects (see
+// 'bdlma_offsetptr').  Note that containers holding raw pointers to the
+// memory they allocate (e.g., 'bsl::vector' and 'bsl::unordered_map') cannot
+// be shared in this way.  The segment holds the offset of a single *root*
+// object, set by 'setRoot' and retrieved (as an address in the mapping of the
+// calling process) by 'root', from which the other processes find the data
+// structure.
+//
+///Lifetime of a Segment
+///---------------------
+// A segment is created by 'create', which fails if a segment having the same
+// name exists, and is attached to by 'attach'.  A segment persists until it
+// is removed by the 'remove' class method (and, on some platforms, until the
+// last process detaches from it); removing a segment does not affect the
+// processes attached to it.  On Windows, where named shared memory exists
+// only as long as some process has it open, 'remove' has no effect.
+//
+///Thread Safety
+///-------------
+// The 'allocate' and 'deallocate' methods of 'bdlma::SharedMemoryPool' are
+// thread-safe, and process-safe: they may be called concurrently by threads
+// of any process attached to the same segment.  'setRoot' and 'root' may
+// likewise be called concurrently.  The other manipulators are not
+// thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Table Between Worker Processes
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service runs several worker processes, each of which needs
+// the same large table of reference data, and that we want the workers to
+// share a single copy of the table.
+//
+// First, we define the (position-independent) table:
+//..
+//  struct Table {
+//      int                    d_numEntries;
+//      bdlma::OffsetPtr<int>  d_entries;
+//  };
+//..
+// Then, the parent process creates a segment, builds the table in it, and
+// records the table as the root of the segment:
+//..
+//  bdlma::SharedMemoryPool parentPool;
+//
+//  int rc = parentPool.create(segmentName, 1024 * 1024);
+//  assert(0 == rc);
+//
+//  Table *table = new (parentPool) Table;
+//
+//  table->d_numEntries = 10000;
+//  table->d_entries    = static_cast<int *>(
+//                             parentPool.allocate(10000 * sizeof(int)));
+//
+//  for (int i = 0; i < 10000; ++i) {
+//      table->d_entries[i] = i * i;
+//  }
+//
+//  parentPool.setRoot(table);
+//..
+// Next, each worker process (here, for brevity, the same process) attaches
+// to the segment, and finds the table:
+//..
+//  bdlma::SharedMemoryPool workerPool;
+//
+//  rc = workerPool.attach(segmentName);
+//  assert(0 == rc);
+//
+//  const Table *shared = static_cast<const Table *>(workerPool.root());
+//
+//  assert(10000 == shared->d_numEntries);
+//  assert(81    == shared->d_entries[9]);
+//..
+// Finally, once all workers are started, the segment is removed, so that it
+// is reclaimed when the last process detaches from it:
+//..
+//  rc = bdlma::SharedMemoryPool::remove(segmentName);
+//  assert(0 == rc);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // ======================
+                          // class SharedMemoryPool
+                          // ======================
+
+class SharedMemoryPool BSLS_CPP11_FINAL : public bslma::Allocator {
+    // This class defines a concrete pool allocator mechanism that implements
+    // the 'bslma::Allocator' protocol, and supplies memory from a named
+    // shared-memory segment, using lock-free free lists held in the segment
+    // so that processes attached to the same segment can share memory.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_SIZE_CLASSES      = 12,    // number of size classes
+
+        k_MIN_BLOCK_SIZE        = 16,    // block size of the smallest class
+
+        k_MAX_POOLED_BLOCK_SIZE = k_MIN_BLOCK_SIZE
+                                           << (k_NUM_SIZE_CLASSES - 1),
+                                         // block size of the largest class
+
+        k_HEADER_SIZE           = 1024   // size (in bytes) of the header of
+                                         // a segment, which is not available
+                                         // for allocation
+    };
+
+  private:
+    // DATA
+    char               *d_base_p;    // address of the mapping, or 0 if not
+                                     // attached
+
+    bsls::Types::Int64  d_size;      // size (in bytes) of the mapping
+
+    void               *d_handle_p;  // handle of the segment (Windows only),
+                                     // or 0
+
+  private:
+    // PRIVATE MANIPULATORS
+    void *carve(bsls::Types::Int64 size);
+        // Return the address of a maximally-aligned block of the specified
+        // 'size' (in bytes) carved from the unused part of the segment.  Throw
+        // 'bsl::bad_alloc' if the unused part is smaller than 'size'.
+
+  private:
+    // NOT IMPLEMENTED
+    SharedMemoryPool(const SharedMemoryPool&);
+    SharedMemoryPool& operator=(const SharedMemoryPool&);
+
+  public:
+    // CLASS METHODS
+    static int remove(const char *name);
+        // Remove the name of the shared-memory segment having the specified
+        // 'name', so that no process can attach to it and it is reclaimed
+        // when no process is attached to it.  Return 0 on success, and a
+        // non-zero value otherwise (e.g., if there is no such segment).  Note
+        // that, on Windows, this method has no effect and returns 0.
+
+    // CREATORS
+    SharedMemoryPool();
+        // Create a shared-memory pool that is not attached to a segment.
+
+    virtual ~SharedMemoryPool();
+        // Detach this pool from its segment (if attached), and destroy this
+        // object.  Note that the segment, and the memory allocated from it,
+        // persist until the segment is removed.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes) allocated from the segment of
+        // this pool.  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  If the segment does not have enough unused memory,
+        // throw 'bsl::bad_alloc'.  The behavior is undefined unless this pool
+        // is attached.
+
+    int attach(const char *name);
+        // Attach this pool to the existing shared-memory segment having the
+        // specified 'name'.  Return 0 on success, and a non-zero value (with
+        // no effect on this pool) if there is no such segment, if it cannot
+        // be mapped, or if it is not (or not yet) initialized by 'create'.
+        // The behavior is undefined unless this pool is not attached.
+
+    int create(const char *name, bsls::Types::Int64 size);
+        // Create a shared-memory segment having the specified 'name' and
+        // 'size' (in bytes), and attach this pool to it.  Return 0 on
+        // success, and a non-zero value (with no effect on this pool) if a
+        // segment having 'name' exists or if the segment cannot be created.
+        // The behavior is undefined unless this pool is not attached,
+        // 'k_HEADER_SIZE < size', and 'size' is less than 2^32 times the
+        // maximal alignment of the platform (e.g., 64GB if that alignment is
+        // 16).  Note that, on POSIX platforms, 'name' should start with '/'
+        // and contain no other '/'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the free list
+        // of its size class in the segment of this pool, so that it can be
+        // reused by any attached process.  If 'address' is 0, this method
+        // has no effect.  The behavior is undefined unless 'address' was
+        // allocated from the same segment (by any attached pool) and has not
+        // already been deallocated.  Note that blocks larger than
+        // 'k_MAX_POOLED_BLOCK_SIZE' are not reused.
+
+    void detach();
+        // Unmap the segment of this pool, if attached.  Note that the segment
+        // persists until it is removed.
+
+    void setRoot(const void *address);
+        // Record, in the segment of this pool, the specified 'address' as the
+        // address of the root object of the segment, or that there is no root
+        // object if 'address' is 0.  The behavior is undefined unless this
+        // pool is attached, and 'address' is 0 or was returned by 'allocate'
+        // (by this pool).
+
+    // ACCESSORS
+    bsls::Types::Int64 capacity() const;
+        // Return the number of bytes of the segment of this pool that are
+        // available for allocation, whether or not allocated, or 0 if this
+        // pool is not attached.
+
+    bool isAttached() const;
+        // Return 'true' if this pool is attached to a segment, and 'false'
+        // otherwise.
+
+    bsls::Types::Int64 numBytesRemaining() const;
+        // Return the number of bytes of the segment of this pool that have
+        // not yet been carved into blocks, or 0 if this pool is not attached.
+        // Note that blocks on the free lists are not included.
+
+    void *root() const;
+        // Return the address, in the mapping of this pool, of the root object
+        // of the segment, or 0 if no root object was set.  The behavior is
+        // undefined unless this pool is attached.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class SharedMemoryPool
+                          // ----------------------
+
+// ACCESSORS
+inline
+bool SharedMemoryPool::isAttached() const
+{
+    return 0 != d_base_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
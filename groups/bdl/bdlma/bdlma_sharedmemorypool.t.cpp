@@ -0,0 +1,1044 @@
+// bdlma_sharedmemorypool.t.cpp                                       -*-C++-*-
+#include <bdlma_sharedmemorypool.h>
+
+#include <bdlma_offsetptr.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#include <process.h>    // '_getpid'
+#else
+#include <fcntl.h>      // 'O_CREAT', 'O_EXCL', 'O_RDWR'
+#include <pthread.h>
+#include <sys/mman.h>   // 'shm_open'
+#include <sys/wait.h>   // 'waitpid'
+#include <unistd.h>     // 'close', 'fork', 'ftruncate', 'getpid'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::SharedMemoryPool' is a size-class pool over a named shared-memory
+// segment.  The primary concerns are that 'create' creates and initializes a
+// new segment (and refuses an existing one), and that 'attach' maps an
+// existing segment with its contents, free lists, and root intact; that
+// 'allocate' returns maximally-aligned, non-overlapping blocks large enough
+// for the requested size, reusing the deallocated blocks of the same size
+// class (but not large blocks), until the segment is exhausted; that the
+// free lists remain consistent when used concurrently by several threads and
+// by several processes; and that no memory is obtained from any other
+// allocator.  The test cases create segments named after the process and test
+// case, and remove them when done.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int remove(const char *name);
+//
+// CREATORS
+// [ 2] SharedMemoryPool();
+// [ 2] ~SharedMemoryPool();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 2] int attach(const char *name);
+// [ 2] int create(const char *name, bsls::Types::Int64 size);
+// [ 3] void deallocate(void *address);
+// [ 2] void detach();
+// [ 4] void setRoot(const void *address);
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 capacity() const;
+// [ 2] bool isAttached() const;
+// [ 3] bsls::Types::Int64 numBytesRemaining() const;
+// [ 4] void *root() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: Data structures are shared between processes.
+// [ 5] CONCERN: 'allocate' and 'deallocate' are thread-safe.
+// [ *] CONCERN: No memory is obtained from the default or global allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SharedMemoryPool Obj;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+enum {
+    k_MAX_ALIGN   = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+    k_HEADER_SIZE = Obj::k_HEADER_SIZE,
+    k_MAX_POOLED  = Obj::k_MAX_POOLED_BLOCK_SIZE
+};
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class SegmentName {
+    // This class provides the name of a shared-memory segment, unique to the
+    // process and the specified test case and index, that is removed on
+    // destruction.
+
+    // DATA
+    char d_name[128];
+
+  public:
+    // CREATORS
+    SegmentName(int testCase, int index)
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        const int pid = _getpid();
+#else
+        const int pid = static_cast<int>(getpid());
+#endif
+        bsl::sprintf(d_name,
+                     "/bdlma_sharedmemorypool.%d.%d.%d",
+                     pid,
+                     testCase,
+                     index);
+        Obj::remove(d_name);
+    }
+
+    ~SegmentName()
+    {
+        Obj::remove(d_name);
+    }
+
+    // ACCESSORS
+    const char *name() const
+    {
+        return d_name;
+    }
+};
+
+static
+Int64 blockCost(int size)
+    // Return the number of bytes of a segment carved for a block of the
+    // specified 'size' (in bytes).
+{
+    Int64 blockSize = Obj::k_MIN_BLOCK_SIZE;
+    if (size > k_MAX_POOLED) {
+        blockSize = bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+    }
+    else {
+        while (blockSize < size) {
+            blockSize *= 2;
+        }
+    }
+    return k_MAX_ALIGN + blockSize;
+}
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase4 {
+
+struct Node {
+    // This 'struct' is a node of a position-independent linked list.
+
+    int                     d_value;
+    bdlma::OffsetPtr<Node>  d_next;
+};
+
+}  // close namespace TestCase4
+
+namespace TestCase5 {
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_ITERATIONS = 200,
+    k_NUM_BLOCKS     = 50,
+    k_MAX_SIZE       = 300
+};
+
+struct ThreadInfo {
+    int   d_id;
+    Obj  *d_obj_p;
+    int   d_numErrors;
+};
+
+inline
+int blockSize(int index)
+    // Return the size of the block having the specified 'index'.
+{
+    return 1 + (index * 37) % k_MAX_SIZE;
+}
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    char *blocks[k_NUM_BLOCKS];
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            blocks[j] = static_cast<char *>(
+                                      info->d_obj_p->allocate(blockSize(j)));
+            bsl::memset(blocks[j], info->d_id, blockSize(j));
+        }
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            for (int k = 0; k < blockSize(j); ++k) {
+                if (info->d_id != blocks[j][k]) {
+                    ++info->d_numErrors;
+                    break;
+                }
+            }
+            info->d_obj_p->deallocate(blocks[j]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Table Between Worker Processes
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service runs several worker processes, each of which needs
+// the same large table of reference data, and that we want the workers to
+// share a single copy of the table.
+//
+// First, we define the (position-independent) table:
+//..
+    struct Table {
+        int                    d_numEntries;
+        bdlma::OffsetPtr<int>  d_entries;
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is obtained from the default or global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        SegmentName  segment(test, 0);
+        const char  *segmentName = segment.name();
+
+// Then, the parent process creates a segment, builds the table in it, and
+// records the table as the root of the segment:
+//..
+    bdlma::SharedMemoryPool parentPool;
+
+    int rc = parentPool.create(segmentName, 1024 * 1024);
+    ASSERT(0 == rc);
+
+    Table *table = new (parentPool) Table;
+
+    table->d_numEntries = 10000;
+    table->d_entries    = static_cast<int *>(
+                               parentPool.allocate(10000 * sizeof(int)));
+
+    for (int i = 0; i < 10000; ++i) {
+        table->d_entries[i] = i * i;
+    }
+
+    parentPool.setRoot(table);
+//..
+// Next, each worker process (here, for brevity, the same process) attaches
+// to the segment, and finds the table:
+//..
+    bdlma::SharedMemoryPool workerPool;
+
+    rc = workerPool.attach(segmentName);
+    ASSERT(0 == rc);
+
+    const Table *shared = static_cast<const Table *>(workerPool.root());
+
+    ASSERT(10000 == shared->d_numEntries);
+    ASSERT(81    == shared->d_entries[9]);
+//..
+// Finally, once all workers are started, the segment is removed, so that it
+// is reclaimed when the last process detaches from it:
+//..
+    rc = bdlma::SharedMemoryPool::remove(segmentName);
+    ASSERT(0 == rc);
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate' never hand out a
+        //:   block that is in use.
+        //:
+        //: 2 Deallocated blocks are reused by all threads, so that the number
+        //:   of bytes carved from the segment is bounded by the number of
+        //:   blocks in use at any one time.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate a batch of blocks of
+        //:   various sizes from pools attached to a common segment, fill each
+        //:   block with a per-thread pattern, verify the pattern, and
+        //:   deallocate the blocks.  (C-1)
+        //:
+        //: 2 Verify that the number of bytes carved does not exceed that of
+        //:   the blocks of all threads in use at the same time.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'allocate' and 'deallocate' are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace TestCase5;
+
+        Int64 batchBytes = 0;
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            batchBytes += blockCost(blockSize(j));
+        }
+
+        SegmentName segment(test, 0);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.create(segment.name(), 1024 * 1024));
+
+        Obj        pools[k_NUM_THREADS];
+        ThreadId   threads[k_NUM_THREADS];
+        ThreadInfo infos[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == pools[i].attach(segment.name()));
+
+            infos[i].d_id        = i + 1;
+            infos[i].d_obj_p     = &pools[i];
+            infos[i].d_numErrors = 0;
+
+            threads[i] = createThread(&threadFunction, &infos[i]);
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(threads[i]);
+            ASSERTV(i, infos[i].d_numErrors, 0 == infos[i].d_numErrors);
+        }
+
+        const Int64 carved = X.capacity() - X.numBytesRemaining();
+
+        if (veryVerbose) { P_(batchBytes) P(carved) }
+
+        ASSERTV(carved, batchBytes, carved <= batchBytes * k_NUM_THREADS);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ROOT AND SHARING BETWEEN PROCESSES
+        //
+        // Concerns:
+        //: 1 'root' returns 0 for a new segment.
+        //:
+        //: 2 'root' returns the address last passed to 'setRoot' (by any pool
+        //:   attached to the segment), and 0 after 'setRoot(0)'.
+        //:
+        //: 3 A data structure built in the segment by one process is visible
+        //:   to another process attached to the segment, even if the segment
+        //:   is mapped at a different address.
+        //:
+        //: 4 Blocks deallocated by one process are reused by another.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Set and clear the root of a new segment through two attached
+        //:   pools.  (C-1..2)
+        //:
+        //: 2 (POSIX only) Fork a child process that attaches to the segment
+        //:   (while the address at which the parent mapped it is occupied by
+        //:   another mapping), builds a linked list of 'OffsetPtr'-linked
+        //:   nodes, deallocates a block, and sets the root; in the parent,
+        //:   traverse the list from the root and verify that the next
+        //:   allocation reuses the deallocated block.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for roots outside of the carved part of the segment.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void setRoot(const void *address);
+        //   void *root() const;
+        //   CONCERN: Data structures are shared between processes.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROOT AND SHARING BETWEEN PROCESSES" << endl
+                          << "==================================" << endl;
+
+        using TestCase4::Node;
+
+        enum { k_NUM_NODES = 100 };
+
+        SegmentName segment(test, 0);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.create(segment.name(), 64 * 1024));
+        ASSERT(0 == X.root());
+
+        if (verbose) cout << "\nTesting 'setRoot' and 'root'." << endl;
+        {
+            Obj mY;  const Obj& Y = mY;
+            ASSERT(0 == mY.attach(segment.name()));
+            ASSERT(0 == Y.root());
+
+            void *p = mX.allocate(10);
+
+            mX.setRoot(p);
+            ASSERT(p == X.root());
+            ASSERT(0 != Y.root());
+
+            bsl::memcpy(p, "shared", 7);
+            ASSERT(0 == bsl::strcmp("shared",
+                                    static_cast<const char *>(Y.root())));
+
+            mY.setRoot(0);
+            ASSERT(0 == X.root());
+            ASSERT(0 == Y.root());
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                char *end = static_cast<char *>(p) + blockCost(10)
+                                                                 - k_MAX_ALIGN;
+
+                ASSERT_PASS(mX.setRoot(p));
+                ASSERT_PASS(mX.setRoot(0));
+                ASSERT_FAIL(mX.setRoot(static_cast<char *>(p)
+                                               - k_MAX_ALIGN - k_HEADER_SIZE));
+                ASSERT_FAIL(mX.setRoot(end));
+            }
+
+            mX.deallocate(p);
+        }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "\nTesting sharing between processes." << endl;
+        {
+            SegmentName other(test, 1);
+
+            void *freed = mX.allocate(24);
+            mX.setRoot(freed);
+
+            const pid_t pid = fork();
+            ASSERT(0 <= pid);
+
+            if (0 == pid) {
+                // Child process: the mapping of 'mX' is inherited at the same
+                // address; occupy it with another segment first, so that the
+                // new attachment is (most likely) mapped elsewhere.
+
+                Obj mY;
+                Obj mZ;  const Obj& Z = mZ;
+
+                int status = 0;
+                if (0 != mY.create(other.name(), 64 * 1024)
+                 || 0 != mZ.attach(segment.name())) {
+                    status = 1;
+                }
+                else {
+                    Node *head = 0;
+                    for (int i = 0; i < k_NUM_NODES; ++i) {
+                        Node *node = new (mZ) Node;
+
+                        node->d_value = i;
+                        node->d_next  = head;
+                        head          = node;
+                    }
+
+                    // The root is the block to deallocate.
+
+                    mZ.deallocate(Z.root());
+                    mZ.setRoot(head);
+                }
+
+                mX.detach();
+                _exit(status);
+            }
+
+            int status = -1;
+            ASSERT(pid == waitpid(pid, &status, 0));
+            ASSERTV(status, 0 == status);
+
+            const Node *node  = static_cast<const Node *>(X.root());
+            int         count = 0;
+            while (node) {
+                ASSERTV(count, k_NUM_NODES - 1 - count == node->d_value);
+
+                node = node->d_next.get();
+                ++count;
+            }
+            ASSERTV(count, k_NUM_NODES == count);
+
+            ASSERT(freed == mX.allocate(20));
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, writable blocks of at least
+        //:   the requested size within the segment.
+        //:
+        //: 2 'numBytesRemaining' decreases by the size of the block of the
+        //:   size class of each allocation (plus its header), or by the size
+        //:   of a large allocation rounded up to the maximal alignment (plus
+        //:   its header).
+        //:
+        //: 3 'allocate(0)' returns 0 and has no effect, and 'deallocate(0)'
+        //:   has no effect.
+        //:
+        //: 4 'deallocate' makes a block available to the next allocation of
+        //:   the same size class (in last-in, first-out order), and of no
+        //:   other size class, without carving the segment.
+        //:
+        //: 5 Large blocks are not reused.
+        //:
+        //: 6 'allocate' throws 'bsl::bad_alloc', with no effect, if the
+        //:   segment does not have enough uncarved bytes, but still reuses
+        //:   deallocated blocks.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks of every size from 1 to twice the largest pooled
+        //:   size (in steps), writing to every byte, and verify their
+        //:   alignment and the number of bytes remaining.  (C-1..3)
+        //:
+        //: 2 Deallocate blocks of several size classes, and verify the
+        //:   addresses returned by subsequent allocations.  (C-4..5)
+        //:
+        //: 3 Exhaust a small segment, and verify that further allocations
+        //:   throw unless a deallocated block can be reused.  (C-6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for deallocating addresses outside the segment and
+        //:   for using a detached pool.  (C-7)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesRemaining() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        SegmentName segment(test, 0);
+
+        if (verbose) cout << "\nTesting 'allocate'." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.create(segment.name(), 4 * 1024 * 1024));
+
+            Int64 remaining = X.numBytesRemaining();
+            ASSERT(X.capacity() == remaining);
+
+            for (int size = 1; size <= 2 * k_MAX_POOLED;
+                                                       size += size / 8 + 1) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, 0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGN);
+
+                bsl::memset(p, size, size);
+
+                remaining -= blockCost(size);
+                ASSERTV(size, remaining, X.numBytesRemaining(),
+                        remaining == X.numBytesRemaining());
+            }
+
+            ASSERT(0         == mX.allocate(0));
+            ASSERT(remaining == X.numBytesRemaining());
+
+            mX.deallocate(0);
+            ASSERT(remaining == X.numBytesRemaining());
+        }
+        ASSERT(0 == Obj::remove(segment.name()));
+
+        if (verbose) cout << "\nTesting 'deallocate'." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.create(segment.name(), 1024 * 1024));
+
+            void *a1 = mX.allocate(10);
+            void *a2 = mX.allocate(16);
+            void *b1 = mX.allocate(17);
+            void *c1 = mX.allocate(k_MAX_POOLED);
+            void *d1 = mX.allocate(k_MAX_POOLED + 1);
+
+            const Int64 REMAINING = X.numBytesRemaining();
+
+            mX.deallocate(a1);
+            mX.deallocate(a2);
+            mX.deallocate(b1);
+            mX.deallocate(c1);
+            mX.deallocate(d1);
+            ASSERT(REMAINING == X.numBytesRemaining());
+
+            ASSERT(a2 == mX.allocate(1));
+            ASSERT(a1 == mX.allocate(16));
+            ASSERT(REMAINING == X.numBytesRemaining());
+
+            ASSERT(b1 == mX.allocate(32));
+            ASSERT(c1 == mX.allocate(k_MAX_POOLED / 2 + 1));
+            ASSERT(REMAINING == X.numBytesRemaining());
+
+            void *d2 = mX.allocate(k_MAX_POOLED + 1);
+            ASSERT(d1 != d2);
+            ASSERT(REMAINING - blockCost(k_MAX_POOLED + 1)
+                                                    == X.numBytesRemaining());
+
+            void *e1 = mX.allocate(10);
+            ASSERT(e1 != a1);
+            ASSERT(e1 != a2);
+        }
+        ASSERT(0 == Obj::remove(segment.name()));
+
+        if (verbose) cout << "\nTesting exhaustion." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.create(segment.name(), k_HEADER_SIZE + 1024));
+            ASSERT(1024 == X.capacity());
+
+            void *p = mX.allocate(200);
+            ASSERT(1024 - blockCost(200) == X.numBytesRemaining());
+
+            mX.allocate(400);
+
+            const Int64 REMAINING = X.numBytesRemaining();
+            ASSERT(REMAINING < blockCost(200));
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.allocate(200);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(REMAINING == X.numBytesRemaining());
+
+            caught = false;
+            try {
+                mX.allocate(static_cast<bslma::Allocator::size_type>(-1));
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(REMAINING == X.numBytesRemaining());
+#endif
+
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(200));
+            ASSERT(REMAINING == X.numBytesRemaining());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_FAIL(mX.allocate(1));
+            ASSERT_FAIL(mX.deallocate(0));
+
+            ASSERT(0 == mX.attach(segment.name()));
+
+            char  local[64];
+            void *p = mX.allocate(8);
+
+            ASSERT_PASS(mX.deallocate(p));
+            ASSERT_FAIL(mX.deallocate(local + k_MAX_ALIGN));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, DTOR, 'create', 'attach', 'detach', 'remove', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed pool is not attached, and has no capacity
+        //:   and no bytes remaining.
+        //:
+        //: 2 'create' creates a segment of the specified size, and attaches
+        //:   the pool to it, unless a segment having the same name exists.
+        //:
+        //: 3 'attach' attaches the pool to an existing segment with the size
+        //:   it was created with and the blocks carved from it, and fails,
+        //:   leaving the pool detached, if there is no such segment or if it
+        //:   was not initialized by 'create'.
+        //:
+        //: 4 'detach' detaches the pool, and has no effect on a detached
+        //:   pool; the destructor detaches the pool.  Neither affects the
+        //:   segment.
+        //:
+        //: 5 'remove' removes the name of a segment, without affecting pools
+        //:   attached to it, and fails if there is no such segment.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise 'create', 'attach', 'detach', and 'remove' on new,
+        //:   existing, removed, and uninitialized segments, and verify the
+        //:   accessors after each call.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   static int remove(const char *name);
+        //   SharedMemoryPool();
+        //   ~SharedMemoryPool();
+        //   int attach(const char *name);
+        //   int create(const char *name, bsls::Types::Int64 size);
+        //   void detach();
+        //   bsls::Types::Int64 capacity() const;
+        //   bool isAttached() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, DTOR, 'create', 'attach', 'detach', "
+                          << "'remove', AND ACCESSORS" << endl
+                          << "=========================================="
+                          << "=======================" << endl;
+
+        SegmentName segment(test, 0);
+
+        if (verbose) cout << "\nTesting default construction." << endl;
+        {
+            const Obj X;
+
+            ASSERT(!X.isAttached());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.numBytesRemaining());
+        }
+
+        if (verbose) cout << "\nTesting new and existing segments." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.attach(segment.name()));
+            ASSERT(!X.isAttached());
+
+            ASSERT(0 == mX.create(segment.name(), 8192));
+            ASSERT(X.isAttached());
+            ASSERT(8192 - k_HEADER_SIZE == X.capacity());
+            ASSERT(X.capacity() == X.numBytesRemaining());
+
+            mX.allocate(100);
+
+            const Int64 REMAINING = X.numBytesRemaining();
+            ASSERT(REMAINING < X.capacity());
+
+            {
+                Obj mY;  const Obj& Y = mY;
+
+                ASSERT(0 != mY.create(segment.name(), 8192));
+                ASSERT(!Y.isAttached());
+
+                ASSERT(0 == mY.attach(segment.name()));
+                ASSERT(Y.isAttached());
+                ASSERT(X.capacity() == Y.capacity());
+                ASSERT(REMAINING    == Y.numBytesRemaining());
+            }
+
+            mX.detach();
+            ASSERT(!X.isAttached());
+            ASSERT(0 == X.capacity());
+
+            mX.detach();
+            ASSERT(!X.isAttached());
+
+            ASSERT(0 == mX.attach(segment.name()));
+            ASSERT(8192 - k_HEADER_SIZE == X.capacity());
+            ASSERT(REMAINING            == X.numBytesRemaining());
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            ASSERT(0 == Obj::remove(segment.name()));
+            ASSERT(0 != Obj::remove(segment.name()));
+
+            ASSERT(X.isAttached());
+            ASSERT(0 != mX.allocate(100));
+
+            Obj mY;  const Obj& Y = mY;
+            ASSERT(0 != mY.attach(segment.name()));
+            ASSERT(!Y.isAttached());
+#endif
+        }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "\nTesting uninitialized segments." << endl;
+        {
+            // A segment created by another means (or whose creation is in
+            // progress) is refused.
+
+            int fd = shm_open(segment.name(), O_RDWR | O_CREAT | O_EXCL, 0666);
+            ASSERT(0 <= fd);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 != mX.attach(segment.name()));
+            ASSERT(!X.isAttached());
+
+            ASSERT(0 == ftruncate(fd, 8192));
+
+            ASSERT(0 != mX.attach(segment.name()));
+            ASSERT(!X.isAttached());
+
+            ::close(fd);
+            ASSERT(0 == Obj::remove(segment.name()));
+        }
+#endif
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_FAIL(mX.create(0, 4096));
+            ASSERT_FAIL(mX.create(segment.name(), k_HEADER_SIZE));
+            ASSERT_PASS(mX.create(segment.name(), k_HEADER_SIZE + 1));
+            ASSERT_FAIL(mX.create(segment.name(), 4096));
+            ASSERT_FAIL(mX.attach(segment.name()));
+
+            mX.detach();
+
+            ASSERT_FAIL(mX.attach(0));
+            ASSERT_FAIL(Obj::remove(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a segment, allocate a block, write to it, and set it as
+        //:   the root.  Attach a second pool to the segment, and verify that
+        //:   it reads the block, and reuses it once deallocated.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        SegmentName segment(test, 0);
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(!X.isAttached());
+        ASSERT(0 == mX.create(segment.name(), 4096));
+        ASSERT(X.isAttached());
+
+        char *p = static_cast<char *>(mX.allocate(6));
+        bsl::memcpy(p, "hello", 6);
+
+        mX.setRoot(p);
+
+        Obj mY;  const Obj& Y = mY;
+
+        ASSERT(0 == mY.attach(segment.name()));
+        ASSERT(Y.isAttached());
+        ASSERT(Y.root());
+        ASSERT(0 == bsl::strcmp("hello",
+                                static_cast<const char *>(Y.root())));
+
+        mY.deallocate(Y.root());
+        mY.setRoot(0);
+
+        ASSERT(p == mX.allocate(8));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is obtained from the default or global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,364 @@
+// bdlma_slaballocator.cpp                                            -*-C++-*-
+#include <bdlma_slaballocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_slaballocator_cpp,"$Id$ $CSID$")
+
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+// TYPES
+enum {
+    k_DEFAULT_NUM_SIZE_CLASSES = 8,     // default number of size classes
+
+    k_MIN_SLAB_SIZE            = 4096,  // minimum slab size (in bytes)
+
+    k_BLOCKS_PER_SLAB          = 8,     // number of blocks of the largest
+                                        // size class spanned by a slab
+
+    k_INITIAL_NUM_SLABS        = 4      // number of slabs spanned by the
+                                        // first buffer obtained from the
+                                        // underlying allocator
+};
+
+// STATIC HELPER FUNCTIONS
+static
+int computeSlabSize(int maxBlockSize)
+    // Return the size of the slabs of an allocator whose largest size class
+    // has the specified 'maxBlockSize'.
+{
+    int slabSize = k_MIN_SLAB_SIZE;
+    while (slabSize < maxBlockSize * k_BLOCKS_PER_SLAB) {
+        slabSize *= 2;
+    }
+    return slabSize;
+}
+
+static
+int floorLog2(int value)
+    // Return the base-2 logarithm of the specified 'value', rounded down.  The
+    // behavior is undefined unless '0 < value'.
+{
+    BSLS_ASSERT(0 < value);
+
+    int result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+                           // -------------------
+                           // class SlabAllocator
+                           // -------------------
+
+// PRIVATE MANIPULATORS
+void *SlabAllocator::allocateHuge(bsls::Types::size_type size, int alignment)
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(k_HEADER_SIZE <= alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT(alignment < d_slabSize);
+    BSLS_ASSERT(size <= static_cast<bsls::Types::size_type>(
+                                            INT_MAX - alignment - d_slabSize));
+
+    // Reserve enough space to reach a slab boundary in the block, whose
+    // address is only guaranteed to be maximally aligned, where the header is
+    // stored, followed by the block at its alignment.
+
+    const int blockSize = d_slabSize + alignment + static_cast<int>(size);
+
+    char *block = static_cast<char *>(d_hugeBlockList.allocate(blockSize));
+
+    char *boundary = block + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                                  block,
+                                                                  d_slabSize);
+
+    SlabHeader *header  = reinterpret_cast<SlabHeader *>(boundary);
+    header->d_sizeClass = k_HUGE_BLOCK_CLASS;
+    header->d_block_p   = block;
+
+    return boundary + alignment;
+}
+
+void *SlabAllocator::allocateLarge(bsls::Types::size_type size,
+                                   bsls::Types::size_type alignment)
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT(alignment < static_cast<bsls::Types::size_type>(d_slabSize));
+
+    const int align = alignment < static_cast<bsls::Types::size_type>(
+                                                                 k_HEADER_SIZE)
+                      ? static_cast<int>(k_HEADER_SIZE)
+                      : static_cast<int>(alignment);
+
+    // In a new slab, the block follows the slab header and its own header.
+
+    const int offset = align < 2 * k_HEADER_SIZE ? 2 * k_HEADER_SIZE : align;
+
+    if (size > static_cast<bsls::Types::size_type>(d_slabSize - offset)) {
+        return allocateHuge(size, align);                             // RETURN
+    }
+
+    const int capacity = (static_cast<int>(size) + k_HEADER_SIZE - 1)
+                                              & ~(k_HEADER_SIZE - 1);
+
+    // Every block on the list of index 'log2(capacity)' (rounded up) can hold
+    // 'capacity' bytes; a block on the list of index 'log2(capacity)' (rounded
+    // down) can hold them only if its own capacity is large enough.  Only the
+    // head of each list is examined.
+
+    const int floorIndex = floorLog2(capacity);
+    const int ceilIndex  = floorIndex
+                         + (0 != (capacity & (capacity - 1)) ? 1 : 0);
+
+    for (int index = ceilIndex; index >= floorIndex; --index) {
+        Link *p = d_largeLists[index - k_MIN_BLOCK_SHIFT];
+
+        if (p
+         && capacity <= reinterpret_cast<const LargeHeader *>(
+                   reinterpret_cast<char *>(p) - k_HEADER_SIZE)->d_capacity
+         && 0 == (reinterpret_cast<bsls::Types::UintPtr>(p) & (align - 1))) {
+            d_largeLists[index - k_MIN_BLOCK_SHIFT] = p->d_next_p;
+            return p;                                                 // RETURN
+        }
+    }
+
+    char *block = 0;
+    if (d_largeCursor_p) {
+        block = d_largeCursor_p + k_HEADER_SIZE;
+        block += bsls::AlignmentUtil::calculateAlignmentOffset(block, align);
+    }
+
+    if (0 == block || d_largeEnd_p - block < capacity) {
+        char *slab = allocateSlab();
+
+        reinterpret_cast<SlabHeader *>(slab)->d_sizeClass =
+                                                           k_LARGE_BLOCK_CLASS;
+
+        d_largeEnd_p = slab + d_slabSize;
+        block        = slab + offset;
+    }
+
+    reinterpret_cast<LargeHeader *>(block - k_HEADER_SIZE)->d_capacity =
+                                                                      capacity;
+    d_largeCursor_p = block + capacity;
+
+    return block;
+}
+
+char *SlabAllocator::allocateSlab()
+{
+    if (d_bufferManager.buffer()) {
+        void *slab = d_bufferManager.allocate(d_slabSize, d_slabSize);
+        if (slab) {
+            return static_cast<char *>(slab);                         // RETURN
+        }
+    }
+
+    // Every buffer obtained from the underlying allocator spans at least two
+    // slabs, so that it holds a slab whatever its alignment.
+
+    char *buffer = static_cast<char *>(
+                                      d_blockList.allocate(d_nextBufferSize));
+    d_bufferManager.replaceBuffer(buffer, d_nextBufferSize);
+
+    if (d_nextBufferSize <= INT_MAX / 2) {
+        d_nextBufferSize *= 2;
+    }
+
+    void *slab = d_bufferManager.allocate(d_slabSize, d_slabSize);
+    BSLS_ASSERT(slab);
+
+    return static_cast<char *>(slab);
+}
+
+void SlabAllocator::deallocateLarge(void *address, int sizeClass)
+{
+    BSLS_ASSERT(address);
+
+    if (k_HUGE_BLOCK_CLASS == sizeClass) {
+        const SlabHeader *header = reinterpret_cast<const SlabHeader *>(
+                        reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                                & d_slabMask);
+
+        d_hugeBlockList.deallocate(header->d_block_p);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(k_LARGE_BLOCK_CLASS == sizeClass);
+
+    const int capacity = reinterpret_cast<const LargeHeader *>(
+                     static_cast<char *>(address) - k_HEADER_SIZE)->d_capacity;
+    const int index    = floorLog2(capacity) - k_MIN_BLOCK_SHIFT;
+
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_LARGE_LISTS);
+
+    Link *p = static_cast<Link *>(address);
+    p->d_next_p = d_largeLists[index];
+    d_largeLists[index] = p;
+}
+
+void *SlabAllocator::replenish(int sizeClass)
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < d_numSizeClasses);
+
+    char *slab = allocateSlab();
+
+    reinterpret_cast<SlabHeader *>(slab)->d_sizeClass = sizeClass;
+
+    // The first block starts at a multiple of the block size past the header,
+    // so that every block of the slab is aligned to the block size.
+
+    const int  blockSize = 1 << (sizeClass + k_MIN_BLOCK_SHIFT);
+    SizeClass& entry     = d_classes[sizeClass];
+    char      *block     = slab + (blockSize < k_HEADER_SIZE
+                                   ? static_cast<int>(k_HEADER_SIZE)
+                                   : blockSize);
+
+    entry.d_cursor_p = block + blockSize;
+    entry.d_end_p    = slab  + d_slabSize;
+
+    return block;
+}
+
+void SlabAllocator::reset()
+{
+    for (int i = 0; i < d_numSizeClasses; ++i) {
+        d_classes[i].d_freeList_p = 0;
+        d_classes[i].d_cursor_p   = 0;
+        d_classes[i].d_end_p      = 0;
+    }
+
+    for (int i = 0; i < k_NUM_LARGE_LISTS; ++i) {
+        d_largeLists[i] = 0;
+    }
+
+    d_largeCursor_p = 0;
+    d_largeEnd_p    = 0;
+
+    if (d_externalBuffer_p) {
+        d_bufferManager.replaceBuffer(d_externalBuffer_p,
+                                      d_externalBufferSize);
+    }
+    else {
+        d_bufferManager.reset();
+    }
+
+    d_nextBufferSize = k_INITIAL_NUM_SLABS * d_slabSize;
+}
+
+// CREATORS
+SlabAllocator::SlabAllocator(bslma::Allocator *basicAllocator)
+: d_numSizeClasses(k_DEFAULT_NUM_SIZE_CLASSES)
+, d_maxBlockSize(1 << (k_DEFAULT_NUM_SIZE_CLASSES - 1 + k_MIN_BLOCK_SHIFT))
+, d_slabSize(computeSlabSize(d_maxBlockSize))
+, d_slabMask(~static_cast<bsls::Types::UintPtr>(d_slabSize - 1))
+, d_bufferManager()
+, d_externalBuffer_p(0)
+, d_externalBufferSize(0)
+, d_nextBufferSize(0)
+, d_blockList(basicAllocator)
+, d_hugeBlockList(basicAllocator)
+{
+    reset();
+}
+
+SlabAllocator::SlabAllocator(int               numSizeClasses,
+                             bslma::Allocator *basicAllocator)
+: d_numSizeClasses(numSizeClasses)
+, d_maxBlockSize(1 << (numSizeClasses - 1 + k_MIN_BLOCK_SHIFT))
+, d_slabSize(computeSlabSize(d_maxBlockSize))
+, d_slabMask(~static_cast<bsls::Types::UintPtr>(d_slabSize - 1))
+, d_bufferManager()
+, d_externalBuffer_p(0)
+, d_externalBufferSize(0)
+, d_nextBufferSize(0)
+, d_blockList(basicAllocator)
+, d_hugeBlockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= numSizeClasses);
+    BSLS_ASSERT(numSizeClasses <= k_MAX_NUM_SIZE_CLASSES);
+
+    reset();
+}
+
+SlabAllocator::SlabAllocator(char             *buffer,
+                             int               size,
+                             bslma::Allocator *basicAllocator)
+: d_numSizeClasses(k_DEFAULT_NUM_SIZE_CLASSES)
+, d_maxBlockSize(1 << (k_DEFAULT_NUM_SIZE_CLASSES - 1 + k_MIN_BLOCK_SHIFT))
+, d_slabSize(computeSlabSize(d_maxBlockSize))
+, d_slabMask(~static_cast<bsls::Types::UintPtr>(d_slabSize - 1))
+, d_bufferManager()
+, d_externalBuffer_p(buffer)
+, d_externalBufferSize(size)
+, d_nextBufferSize(0)
+, d_blockList(basicAllocator)
+, d_hugeBlockList(basicAllocator)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < size);
+
+    reset();
+}
+
+SlabAllocator::SlabAllocator(char             *buffer,
+                             int               size,
+                             int               numSizeClasses,
+                             bslma::Allocator *basicAllocator)
+: d_numSizeClasses(numSizeClasses)
+, d_maxBlockSize(1 << (numSizeClasses - 1 + k_MIN_BLOCK_SHIFT))
+, d_slabSize(computeSlabSize(d_maxBlockSize))
+, d_slabMask(~static_cast<bsls::Types::UintPtr>(d_slabSize - 1))
+, d_bufferManager()
+, d_externalBuffer_p(buffer)
+, d_externalBufferSize(size)
+, d_nextBufferSize(0)
+, d_blockList(basicAllocator)
+, d_hugeBlockList(basicAllocator)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(1 <= numSizeClasses);
+    BSLS_ASSERT(numSizeClasses <= k_MAX_NUM_SIZE_CLASSES);
+
+    reset();
+}
+
+SlabAllocator::~SlabAllocator()
+{
+}
+
+// MANIPULATORS
+void SlabAllocator::release()
+{
+    d_blockList.release();
+    d_hugeBlockList.release();
+    reset();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
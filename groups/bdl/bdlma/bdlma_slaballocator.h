@@ -0,0 +1,652 @@
+// bdlma_slaballocator.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_SLABALLOCATOR
+#define INCLUDED_BDLMA_SLABALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator carving size-class slabs from a buffer.
+//
+//@CLASSES:
+//   bdlma::SlabAllocator: size-class pooling allocator over a monotonic arena
+//
+//@SEE_ALSO: bdlma_multipoolallocator, bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::SlabAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and dispenses memory blocks from a set of size classes, each of
+// which reuses its deallocated blocks, where the memory for all size classes
+// is carved sequentially from an (optional) external buffer supplied at
+// construction and, once that buffer is exhausted, from geometrically growing
+// buffers obtained from an (optional) allocator:
+//..
+//   ,--------------------.
+//  ( bdlma::SlabAllocator )
+//   `--------------------'
+//                |         ctor/dtor
+//                |         maxPooledBlockSize
+//                |         numSizeClasses
+//                |         slabSize
+//                V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//                |         release
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                          allocate
+//                          deallocate
+//..
+// A 'bdlma::SlabAllocator' provides the same behavior as a
+// 'bdlma::MultipoolAllocator' supplied with a
+// 'bdlma::BufferedSequentialAllocator' (i.e., a multipool over a monotonic
+// buffer), but does so in a single object: there is one set of bookkeeping,
+// no header is stored in front of pooled blocks, and no buffer is returned to
+// the underlying allocator until 'release' is called (or the allocator is
+// destroyed).
+//
+///Size Classes and Slabs
+///----------------------
+// The allocator manages 'numSizeClasses' size classes, where the block size of
+// the first class is 8 bytes and the block size of each successive class is
+// twice that of the previous class; the block size of the last class is
+// reported by 'maxPooledBlockSize'.  An allocation request is served by the
+// smallest size class whose block size is at least the requested size.
+//
+// Each size class obtains its blocks from *slabs*: contiguous regions of
+// 'slabSize' bytes, carved from the current buffer at an address that is a
+// multiple of 'slabSize'.  The first few bytes of each slab record the size
+// class to which the slab belongs, so that the size class of a block passed to
+// 'deallocate' is found by rounding its address down to a multiple of
+// 'slabSize'.  A size class carves blocks from its most recent slab on demand,
+// and deallocated blocks are kept on a per-class free list, from which
+// subsequent allocations of that class are served first.  Every block is
+// aligned to its block size, so that a request for a block of at most
+// 'maxPooledBlockSize' bytes having an alignment of at most
+// 'maxPooledBlockSize' is also served by a size class.
+//
+///Large Blocks
+///------------
+// A request exceeding 'maxPooledBlockSize' (or having a larger alignment) that
+// fits in a slab is carved, at its own alignment and preceded by a small
+// header recording its size, from a slab shared by such *large* blocks.  A
+// deallocated large block is kept on a free list (of blocks of similar size),
+// from which subsequent large requests it can hold are served first.  A
+// request too large to fit in a slab is forwarded to the underlying allocator
+// (padded so that its header lies on a slab boundary), and is returned to the
+// underlying allocator when it is deallocated.
+//
+///External Buffer and Growth
+///--------------------------
+// An (optional) external buffer can be supplied at construction.  Slabs are
+// carved from the external buffer first; note that, since slabs are aligned
+// on 'slabSize' boundaries, up to 'slabSize - 1' bytes at the start of the
+// buffer may be skipped, and a buffer smaller than '2 * slabSize' bytes is not
+// guaranteed to hold even a single slab.  Once the external buffer (if any) is
+// exhausted, buffers of geometrically increasing size are obtained from the
+// allocator supplied at construction (or the default allocator).  Note that
+// every size class that is used occupies at least one slab, so that an
+// external buffer intended to satisfy all requests should span (at least) as
+// many slabs as there are size classes in use.
+//
+// The 'release' method returns the allocator to its initial state: the per-
+// class free lists are discarded, the external buffer is made available again
+// in its entirety, and each buffer (and each huge block not yet deallocated)
+// obtained from the underlying allocator is returned to it.  Neither the cost
+// of 'release' nor the number of calls made to the underlying allocator
+// depends on the number of pooled or large blocks, or slabs, allocated.
+//
+///Thread Safety
+///-------------
+// 'bdlma::SlabAllocator' is *const* *thread-safe*, but is not *thread-safe*:
+// concurrent invocations of manipulators on the same object must be
+// synchronized by the caller.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recycling Message Buffers Within a Fixed Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service retains the payload of each incoming message, of
+// varying length, until a fixed number of subsequent messages have arrived
+// (e.g., to allow for retransmission requests).  Payloads are allocated and
+// deallocated at a high rate, but the amount of memory in use at any time is
+// bounded.  Using a 'bdlma::SlabAllocator' constructed with a sufficiently
+// large buffer, the payload memory is recycled within the buffer, and the
+// underlying allocator is never consulted.
+//
+// First, we create the buffer and the allocator:
+//..
+//  enum { k_BUFFER_SIZE = 64 * 1024 };
+//
+//  bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+//  bslma::TestAllocator               underlyingAllocator;
+//
+//  bdlma::SlabAllocator allocator(buffer.buffer(),
+//                                 k_BUFFER_SIZE,
+//                                 &underlyingAllocator);
+//..
+// Then, we simulate a stream of messages, having payloads of between 16 and
+// 200 bytes, retaining the 32 most recent payloads in a circular window:
+//..
+//  enum { k_WINDOW_SIZE = 32 };
+//
+//  char *window[k_WINDOW_SIZE] = { 0 };
+//
+//  for (int i = 0; i < 100000; ++i) {
+//      char *&payload = window[i % k_WINDOW_SIZE];
+//
+//      allocator.deallocate(payload);
+//
+//      const int length = 16 + (i * 7919) % 185;
+//
+//      payload = static_cast<char *>(allocator.allocate(length));
+//      bsl::memset(payload, 'x', length);
+//  }
+//..
+// Finally, we observe that, although 100000 payloads were allocated, no memory
+// was obtained from the underlying allocator: the blocks of each of the five
+// size classes in use are recycled from its free list, and the buffer holds
+// enough slabs for the at most 32 blocks of any size class that are in use at
+// one time:
+//..
+//  assert(0 == underlyingAllocator.numBlocksTotal());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_BLOCKLIST
+#include <bdlma_blocklist.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_BUFFERMANAGER
+#include <bdlma_buffermanager.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_INFREQUENTDELETEBLOCKLIST
+#include <bdlma_infrequentdeleteblocklist.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_MANAGEDALLOCATOR
+#include <bdlma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CPP11
+#include <bsls_cpp11.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                           // ===================
+                           // class SlabAllocator
+                           // ===================
+
+class SlabAllocator BSLS_CPP11_FINAL : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide an
+    // allocator that dispenses memory blocks from a set of size classes, each
+    // of which maintains a free list of deallocated blocks for reuse.  Memory
+    // for all size classes is carved, in aligned slabs, from an (optional)
+    // external buffer supplied at construction and then from geometrically
+    // growing buffers obtained from an (optional) allocator supplied at
+    // construction.  This class is *exception* *neutral*: If memory cannot be
+    // allocated, the behavior is defined by the (optional) allocator
+    // specified at construction.
+
+    // PRIVATE TYPES
+    enum {
+        k_MIN_BLOCK_SHIFT          =  3,  // 'log2' of smallest block size
+
+        k_MAX_NUM_SIZE_CLASSES     = 16,  // maximum number of size classes
+
+        k_LARGE_BLOCK_CLASS        = -1,  // size class recorded in the header
+                                          // of a slab holding large blocks
+
+        k_HUGE_BLOCK_CLASS         = -2,  // size class recorded in the header
+                                          // of a block obtained from the
+                                          // underlying allocator
+
+        k_NUM_LARGE_LISTS          = 19,  // number of free lists of large
+                                          // blocks, indexed by
+                                          // 'log2(capacity) -
+                                          // k_MIN_BLOCK_SHIFT'
+
+        k_HEADER_SIZE              = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                                          // size of the header at the start of
+                                          // every slab, and in front of every
+                                          // large block
+    };
+
+    struct Link {
+        // This 'struct' overlays a deallocated block on a size-class free
+        // list.
+
+        Link *d_next_p;  // next deallocated block (or 0)
+    };
+
+    struct SizeClass {
+        // This 'struct' holds the state of a single size class.
+
+        Link *d_freeList_p;  // deallocated blocks of this class (or 0)
+        char *d_cursor_p;    // next uncarved block in the current slab
+        char *d_end_p;       // end of the current slab
+    };
+
+    struct SlabHeader {
+        // This 'struct' is stored at the start of every slab, and at the slab
+        // boundary preceding every huge block.
+
+        int   d_sizeClass;  // index of owning size class,
+                            // 'k_LARGE_BLOCK_CLASS', or 'k_HUGE_BLOCK_CLASS'
+
+        void *d_block_p;    // block obtained from 'd_hugeBlockList' (huge
+                            // blocks only)
+    };
+
+    struct LargeHeader {
+        // This 'struct' is stored in front of every large block.
+
+        int d_capacity;  // size (in bytes) available to the block
+    };
+
+    // DATA
+    SizeClass                 d_classes[k_MAX_NUM_SIZE_CLASSES];
+                                                // per-class state
+
+    Link                     *d_largeLists[k_NUM_LARGE_LISTS];
+                                                // deallocated large blocks
+
+    char                     *d_largeCursor_p;  // next uncarved byte in the
+                                                // current large-block slab
+
+    char                     *d_largeEnd_p;     // end of the current large-
+                                                // block slab
+
+    int                       d_numSizeClasses; // number of size classes
+
+    int                       d_maxBlockSize;   // block size of the largest
+                                                // size class
+
+    int                       d_slabSize;       // size (and alignment) of
+                                                // every slab
+
+    bsls::Types::UintPtr      d_slabMask;       // '~(d_slabSize - 1)'
+
+    BufferManager             d_bufferManager;  // buffer currently being
+                                                // carved (if any)
+
+    char                     *d_externalBuffer_p;
+                                                // buffer supplied at
+                                                // construction (or 0)
+
+    int                       d_externalBufferSize;
+                                                // size of external buffer
+
+    int                       d_nextBufferSize; // size of next buffer obtained
+                                                // from 'd_blockList'
+
+    InfrequentDeleteBlockList d_blockList;      // buffers obtained from the
+                                                // underlying allocator
+
+    BlockList                 d_hugeBlockList;  // huge blocks obtained from
+                                                // the underlying allocator
+
+  private:
+    // PRIVATE CLASS METHODS
+    static int findSizeClass(int size);
+        // Return the index of the smallest size class whose block size is at
+        // least the specified 'size'.  The behavior is undefined unless
+        // '0 < size'.
+
+    // PRIVATE MANIPULATORS
+    void *allocateHuge(bsls::Types::size_type size, int alignment);
+        // Return the address of a block of the specified 'size' (in bytes)
+        // aligned to the specified 'alignment', obtained from the underlying
+        // allocator and preceded by a slab header on a slab boundary.  The
+        // behavior is undefined unless '0 < size', 'alignment' is a power of
+        // two, and 'k_HEADER_SIZE <= alignment < slabSize()'.
+
+    void *allocateLarge(bsls::Types::size_type size,
+                        bsls::Types::size_type alignment);
+        // Return the address of a block of the specified 'size' (in bytes)
+        // aligned to the specified 'alignment', reusing a deallocated large
+        // block if one is suitable, carving it from the current large-block
+        // slab if the block fits in a slab, and obtaining it from the
+        // underlying allocator otherwise.  The behavior is undefined unless
+        // '0 < size', 'alignment' is a power of two, and
+        // 'alignment < slabSize()'.
+
+    char *allocateSlab();
+        // Return the address of a region of 'slabSize()' bytes whose address
+        // is a multiple of 'slabSize()', carved from the current buffer,
+        // obtaining a new buffer from the underlying allocator if the current
+        // buffer has insufficient space.
+
+    void deallocateLarge(void *address, int sizeClass);
+        // Return the large or huge block at the specified 'address', whose
+        // slab header records the specified 'sizeClass', to this allocator.
+        // The behavior is undefined unless 'address' is a large or huge block
+        // allocated by this allocator, and has not already been deallocated.
+
+    void *replenish(int sizeClass);
+        // Carve a new slab for the specified 'sizeClass', and return the
+        // address of its first block.  The behavior is undefined unless
+        // '0 <= sizeClass < numSizeClasses()'.
+
+    void reset();
+        // Reset the state of every size class, and of the buffer currently
+        // being carved, to that of a newly constructed object.
+
+  private:
+    // NOT IMPLEMENTED
+    SlabAllocator(const SlabAllocator&);
+    SlabAllocator& operator=(const SlabAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    SlabAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SlabAllocator(int numSizeClasses, bslma::Allocator *basicAllocator = 0);
+        // Create a slab allocator that carves slabs from buffers obtained from
+        // the underlying allocator.  Optionally specify 'numSizeClasses',
+        // indicating the number of size classes, the block size of the first
+        // being 8 bytes and that of each additional class successively
+        // doubling.  If 'numSizeClasses' is not specified, an
+        // implementation-defined number of size classes is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // '1 <= numSizeClasses <= 16'.
+
+    SlabAllocator(char             *buffer,
+                  int               size,
+                  bslma::Allocator *basicAllocator = 0);
+    SlabAllocator(char             *buffer,
+                  int               size,
+                  int               numSizeClasses,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a slab allocator that carves slabs from the specified
+        // external 'buffer' having the specified 'size' (in bytes), and then,
+        // once 'buffer' is exhausted, from buffers obtained from the
+        // underlying allocator.  Optionally specify 'numSizeClasses',
+        // indicating the number of size classes, the block size of the first
+        // being 8 bytes and that of each additional class successively
+        // doubling.  If 'numSizeClasses' is not specified, an
+        // implementation-defined number of size classes is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < size', 'buffer' has at
+        // least 'size' bytes, and '1 <= numSizeClasses <= 16'.  Note that
+        // 'buffer' is not guaranteed to hold a slab unless
+        // '2 * slabSize() <= size'.
+
+    virtual ~SlabAllocator();
+        // Destroy this slab allocator.  All memory allocated from this
+        // allocator is released.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of naturally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the block is a large block (see
+        // {Large Blocks}).
+
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return the address of a contiguous block of memory of (at least) the
+        // specified 'size' (in bytes) whose address is a multiple of the
+        // specified 'alignment'.  If 'size' is 0, no memory is allocated and 0
+        // is returned.  The behavior is undefined unless 'alignment' is a
+        // power of two and 'alignment < slabSize()'.  Note that the returned
+        // block must be deallocated using 'deallocate'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator for reuse (or, if the block was obtained from the
+        // underlying allocator, back to the underlying allocator).  If
+        // 'address' is 0, this method has no effect.  The behavior is
+        // undefined unless 'address' was allocated by this allocator, and has
+        // not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this allocator for reuse.  If
+        // 'address' is 0, this method has no effect.  The behavior is
+        // undefined unless 'address' was allocated by this allocator using
+        // 'allocate(size)', and has not already been deallocated.  Note that,
+        // unlike 'deallocate', this method does not read the header of the
+        // slab holding a block of at most 'maxPooledBlockSize()' bytes.
+
+    virtual void release();
+        // Release all memory currently allocated through this allocator,
+        // returning every buffer (and huge block) obtained from the underlying
+        // allocator to it, and making the external buffer supplied at
+        // construction (if any) available for subsequent allocations.
+
+    // ACCESSORS
+    int maxPooledBlockSize() const;
+        // Return the block size (in bytes) of the largest size class of this
+        // allocator.
+
+    int numSizeClasses() const;
+        // Return the number of size classes of this allocator.
+
+    int slabSize() const;
+        // Return the size (in bytes) of the slabs carved by this allocator.
+        // Note that every slab starts at an address that is a multiple of
+        // this value.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // -------------------
+                           // class SlabAllocator
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+inline
+int SlabAllocator::findSizeClass(int size)
+{
+    BSLS_ASSERT_SAFE(0 < size);
+
+    const unsigned int index = static_cast<unsigned int>(size - 1)
+                                                          >> k_MIN_BLOCK_SHIFT;
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return index ? 32 - __builtin_clz(index) : 0;
+#else
+    int sizeClass = 0;
+    for (unsigned int i = index; i; i >>= 1) {
+        ++sizeClass;
+    }
+    return sizeClass;
+#endif
+}
+
+// MANIPULATORS
+inline
+void *SlabAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                              size > static_cast<size_type>(d_maxBlockSize))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return allocateLarge(size, k_HEADER_SIZE);                    // RETURN
+    }
+
+    const int  sizeClass = findSizeClass(static_cast<int>(size));
+    SizeClass& entry     = d_classes[sizeClass];
+
+    if (entry.d_freeList_p) {
+        Link *p = entry.d_freeList_p;
+        entry.d_freeList_p = p->d_next_p;
+        return p;                                                     // RETURN
+    }
+
+    const int blockSize = 1 << (sizeClass + k_MIN_BLOCK_SHIFT);
+
+    if (entry.d_end_p - entry.d_cursor_p >= blockSize) {
+        char *p = entry.d_cursor_p;
+        entry.d_cursor_p += blockSize;
+        return p;                                                     // RETURN
+    }
+
+    return replenish(sizeClass);
+}
+
+inline
+void *SlabAllocator::allocateAligned(size_type size, size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+    BSLS_ASSERT_SAFE(alignment < static_cast<size_type>(d_slabSize));
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    if (size      <= static_cast<size_type>(d_maxBlockSize)
+     && alignment <= static_cast<size_type>(d_maxBlockSize)) {
+        // Every block is aligned to its block size, so every block whose size
+        // is at least 'alignment' is suitably aligned.
+
+        return SlabAllocator::allocate(size < alignment ? alignment : size);
+                                                                      // RETURN
+    }
+
+    return allocateLarge(size,
+                         alignment < static_cast<size_type>(k_HEADER_SIZE)
+                         ? static_cast<size_type>(k_HEADER_SIZE)
+                         : alignment);
+}
+
+inline
+void SlabAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    const SlabHeader *header = reinterpret_cast<const SlabHeader *>(
+                        reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                                & d_slabMask);
+    const int sizeClass = header->d_sizeClass;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 > sizeClass)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        deallocateLarge(address, sizeClass);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(sizeClass < d_numSizeClasses);
+
+    Link *p = static_cast<Link *>(address);
+    p->d_next_p = d_classes[sizeClass].d_freeList_p;
+    d_classes[sizeClass].d_freeList_p = p;
+}
+
+inline
+void SlabAllocator::deallocateSized(void *address, size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                              size > static_cast<size_type>(d_maxBlockSize))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        SlabAllocator::deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 < size);
+
+    const int sizeClass = findSizeClass(static_cast<int>(size));
+
+    BSLS_ASSERT_SAFE(sizeClass == reinterpret_cast<const SlabHeader *>(
+                        reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                   & d_slabMask)->d_sizeClass);
+
+    Link *p = static_cast<Link *>(address);
+    p->d_next_p = d_classes[sizeClass].d_freeList_p;
+    d_classes[sizeClass].d_freeList_p = p;
+}
+
+// ACCESSORS
+inline
+int SlabAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int SlabAllocator::numSizeClasses() const
+{
+    return d_numSizeClasses;
+}
+
+inline
+int SlabAllocator::slabSize() const
+{
+    return d_slabSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
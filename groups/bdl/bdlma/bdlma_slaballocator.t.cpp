@@ -0,0 +1,962 @@
+// bdlma_slaballocator.t.cpp                                          -*-C++-*-
+#include <bdlma_slaballocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlma::SlabAllocator' dispenses blocks from a set of size classes, carving
+// slabs for each class from an external buffer or from buffers obtained from
+// an underlying allocator.  The primary concerns are that: 1) the constructors
+// configure the size classes and slab size as documented, 2) allocated blocks
+// are suitably aligned, do not overlap, and are carved from slabs aligned on
+// 'slabSize' boundaries, 3) deallocated blocks are reused by subsequent
+// allocations of the same size class, and 4) 'release' and the destructor
+// return all memory obtained from the underlying allocator, and make the
+// external buffer available again.  The 'bslma_testallocator' component is
+// used to verify the memory obtained from the underlying allocator.
+//-----------------------------------------------------------------------------
+// [ 2] SlabAllocator(Allocator *ba = 0);
+// [ 2] SlabAllocator(int numSizeClasses, Allocator *ba = 0);
+// [ 2] SlabAllocator(char *buffer, int size, Allocator *ba = 0);
+// [ 2] SlabAllocator(char *buffer, int size, int nsc, Allocator *ba = 0);
+// [ 6] ~SlabAllocator();
+// [ 3] void *allocate(size_type size);
+// [ 5] void *allocateAligned(size_type size, size_type alignment);
+// [ 4] void deallocate(void *address);
+// [ 4] void deallocateSized(void *address, size_type size);
+// [ 6] void release();
+// [ 2] int maxPooledBlockSize() const;
+// [ 2] int numSizeClasses() const;
+// [ 2] int slabSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: Precondition violations are detected when enabled.
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_SAFE_PASS(EXPR)     BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR)     BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+//=============================================================================
+//                       GLOBAL TYPES AND CONSTANTS
+//-----------------------------------------------------------------------------
+
+typedef bdlma::SlabAllocator Obj;
+
+typedef bsls::Types::UintPtr UintPtr;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+int blockSize(int size)
+    // Return the block size of the smallest size class able to hold a block
+    // of the specified 'size'.
+{
+    int blockSize = 8;
+    while (blockSize < size) {
+        blockSize *= 2;
+    }
+    return blockSize;
+}
+
+static
+UintPtr slabOf(const void *address, int slabSize)
+    // Return the address of the slab, of the specified 'slabSize', holding
+    // the specified 'address'.
+{
+    return reinterpret_cast<UintPtr>(address) & ~UintPtr(slabSize - 1);
+}
+
+static
+bool isInBuffer(const void *address, const char *buffer, int size)
+    // Return 'true' if the specified 'address' lies within the specified
+    // 'buffer' of the specified 'size', and 'false' otherwise.
+{
+    const char *p = static_cast<const char *>(address);
+    return buffer <= p && p < buffer + size;
+}
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recycling Message Buffers Within a Fixed Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service retains the payload of each incoming message, of
+// varying length, until a fixed number of subsequent messages have arrived
+// (e.g., to allow for retransmission requests).  Payloads are allocated and
+// deallocated at a high rate, but the amount of memory in use at any time is
+// bounded.  Using a 'bdlma::SlabAllocator' constructed with a sufficiently
+// large buffer, the payload memory is recycled within the buffer, and the
+// underlying allocator is never consulted.
+//
+// First, we create the buffer and the allocator:
+//..
+    enum { k_BUFFER_SIZE = 64 * 1024 };
+
+    bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+    bslma::TestAllocator               underlyingAllocator;
+
+    bdlma::SlabAllocator allocator(buffer.buffer(),
+                                   k_BUFFER_SIZE,
+                                   &underlyingAllocator);
+//..
+// Then, we simulate a stream of messages, having payloads of between 16 and
+// 200 bytes, retaining the 32 most recent payloads in a circular window:
+//..
+    enum { k_WINDOW_SIZE = 32 };
+
+    char *window[k_WINDOW_SIZE] = { 0 };
+
+    for (int i = 0; i < 100000; ++i) {
+        char *&payload = window[i % k_WINDOW_SIZE];
+
+        allocator.deallocate(payload);
+
+        const int length = 16 + (i * 7919) % 185;
+
+        payload = static_cast<char *>(allocator.allocate(length));
+        bsl::memset(payload, 'x', length);
+    }
+//..
+// Finally, we observe that, although 100000 payloads were allocated, no memory
+// was obtained from the underlying allocator: the blocks of each of the five
+// size classes in use are recycled from its free list, and the buffer holds
+// enough slabs for the at most 32 blocks of any size class that are in use at
+// one time:
+//..
+    ASSERT(0 == underlyingAllocator.numBlocksTotal());
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'release' AND DTOR TEST
+        //
+        // Concerns:
+        //: 1 'release' returns every buffer obtained from the underlying
+        //:   allocator, with one 'deallocate' call per buffer.
+        //:
+        //: 2 After 'release', the free lists are empty, and allocation
+        //:   resumes from the start of the external buffer (if any).
+        //:
+        //: 3 The destructor returns every buffer obtained from the underlying
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Using allocators with and without an external buffer, allocate
+        //:   and deallocate enough blocks of several size classes to exhaust
+        //:   the external buffer, then invoke 'release', and verify that no
+        //:   memory is in use from the test allocator, that a block allocated
+        //:   after the release is not one that was deallocated before it,
+        //:   and that (with an external buffer) the first block allocated
+        //:   after 'release' is the same as the first block allocated after
+        //:   construction.  (C-1..2)
+        //:
+        //: 2 Allocate blocks again, let the allocator go out of scope, and
+        //:   verify that no memory is in use from the test allocator.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        //   ~SlabAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'release' AND DTOR TEST" << endl
+                                  << "=======================" << endl;
+
+        enum { k_BUFFER_SIZE = 16 * 1024 };
+
+        bsls::AlignedBuffer<k_BUFFER_SIZE> bufferStorage;
+        char *buffer = bufferStorage.buffer();
+
+        for (int withBuffer = 0; withBuffer < 2; ++withBuffer) {
+            if (veryVerbose) { T_ P(withBuffer) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                Obj *mX = withBuffer
+                          ? new (ta) Obj(buffer, k_BUFFER_SIZE, &ta)
+                          : new (ta) Obj(&ta);
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+                ASSERT(1 == NUM_BLOCKS);
+
+                void *first  = mX->allocate(8);
+                void *second = mX->allocate(8);
+                ASSERT(first && second);
+                LOOP_ASSERT(withBuffer, withBuffer ==
+                                  isInBuffer(first, buffer, k_BUFFER_SIZE));
+
+                for (int i = 0; i < 1000; ++i) {
+                    void *p = mX->allocate(1 + i % 300);
+                    bsl::memset(p, 0xa5, 1 + i % 300);
+                    if (0 == i % 3) {
+                        mX->deallocate(p);
+                    }
+                }
+                mX->allocate(10000);
+                mX->deallocate(second);
+
+                const bsls::Types::Int64 NUM_DEALLOCS = ta.numDeallocations();
+                const bsls::Types::Int64 NUM_BUFFERS  =
+                                             ta.numBlocksInUse() - NUM_BLOCKS;
+                ASSERT(0 < NUM_BUFFERS);
+
+                mX->release();
+
+                LOOP_ASSERT(ta.numBlocksInUse(),
+                            NUM_BLOCKS == ta.numBlocksInUse());
+                LOOP2_ASSERT(NUM_BUFFERS,
+                             ta.numDeallocations() - NUM_DEALLOCS,
+                             NUM_BUFFERS ==
+                                   ta.numDeallocations() - NUM_DEALLOCS);
+
+                // The free lists are discarded by 'release'; with an external
+                // buffer, carving restarts at the beginning of the buffer.
+
+                if (withBuffer) {
+                    ASSERT(first == mX->allocate(8));
+                }
+
+                for (int i = 0; i < 1000; ++i) {
+                    mX->allocate(1 + i % 300);
+                }
+                ASSERT(NUM_BLOCKS < ta.numBlocksInUse());
+
+                ta.deleteObject(mX);
+            }
+            LOOP_ASSERT(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'allocateAligned' TEST
+        //
+        // Concerns:
+        //: 1 The returned block is aligned to the requested alignment, for
+        //:   alignments up to (but excluding) 'slabSize()'.
+        //:
+        //: 2 The returned blocks do not overlap, and may be deallocated
+        //:   using 'deallocate'.
+        //:
+        //: 3 Allocating 0 bytes returns 0.
+        //:
+        //: 4 A request whose size and alignment are at most
+        //:   'maxPooledBlockSize()' is served by a size class, without
+        //:   padding.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For each alignment from 1 to 'slabSize() / 2' and a set of
+        //:   sizes, allocate a block, verify its alignment, fill it, and
+        //:   deallocate it with 'deallocate'.  (C-1..2)
+        //:
+        //: 2 Verify that 'allocateAligned(0, alignment)' returns 0.  (C-3)
+        //:
+        //: 3 Allocate 1000 blocks of 64 bytes aligned to 64 bytes, and verify
+        //:   that consecutive blocks are adjacent or in different slabs, and
+        //:   that the memory in use from the test allocator is less than twice
+        //:   their total size.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid alignments.  (C-5)
+        //
+        // Testing:
+        //   void *allocateAligned(size_type size, size_type alignment);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocateAligned' TEST" << endl
+                                  << "======================" << endl;
+
+        const int SIZES[] = { 1, 3, 8, 15, 16, 17, 100, 1024, 1025, 5000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int alignment = 1; alignment < X.slabSize(); alignment *= 2) {
+                for (int i = 0; i < NUM_SIZES; ++i) {
+                    const int SIZE = SIZES[i];
+
+                    char *p = static_cast<char *>(
+                                          mX.allocateAligned(SIZE, alignment));
+                    char *q = static_cast<char *>(
+                                          mX.allocateAligned(SIZE, alignment));
+
+                    LOOP2_ASSERT(alignment, SIZE, p && q);
+                    LOOP2_ASSERT(alignment, SIZE,
+                               0 == reinterpret_cast<UintPtr>(p) % alignment);
+                    LOOP2_ASSERT(alignment, SIZE,
+                               0 == reinterpret_cast<UintPtr>(q) % alignment);
+                    LOOP2_ASSERT(alignment, SIZE,
+                                 p + SIZE <= q || q + SIZE <= p);
+
+                    bsl::memset(p, 0x5a, SIZE);
+                    bsl::memset(q, 0xa5, SIZE);
+
+                    mX.deallocate(p);
+                    mX.deallocate(q);
+                }
+            }
+
+            ASSERT(0 == mX.allocateAligned(0, 8));
+            ASSERT(0 == mX.allocateAligned(0, 256));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting over-aligned pooled blocks." << endl;
+        {
+            enum { k_NUM_BLOCKS = 1000, k_SIZE = 64 };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            char *prev = 0;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                char *p = static_cast<char *>(
+                                        mX.allocateAligned(k_SIZE, k_SIZE));
+
+                LOOP_ASSERT(i, 0 == reinterpret_cast<UintPtr>(p) % k_SIZE);
+                LOOP_ASSERT(i, 0 == prev
+                            || prev + k_SIZE == p
+                            || slabOf(prev, X.slabSize())
+                                                 != slabOf(p, X.slabSize()));
+
+                bsl::memset(p, 'x', k_SIZE);
+                prev = p;
+            }
+
+            if (veryVerbose) { P(ta.numBytesInUse()) }
+
+            LOOP_ASSERT(ta.numBytesInUse(),
+                        ta.numBytesInUse() < 2 * k_NUM_BLOCKS * k_SIZE);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(mX.allocateAligned(8, 1));
+            ASSERT_SAFE_PASS(mX.allocateAligned(8, X.slabSize() / 2));
+
+            ASSERT_SAFE_FAIL(mX.allocateAligned(8, 0));
+            ASSERT_SAFE_FAIL(mX.allocateAligned(8, 3));
+            ASSERT_SAFE_FAIL(mX.allocateAligned(8, X.slabSize()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'deallocate' TEST
+        //
+        // Concerns:
+        //: 1 A deallocated block is reused by the next allocation of the same
+        //:   size class, whether it was deallocated with 'deallocate' or
+        //:   'deallocateSized'.
+        //:
+        //: 2 Deallocated blocks are reused in LIFO order, and each size class
+        //:   reuses only its own blocks.
+        //:
+        //: 3 Deallocating a null pointer has no effect, a deallocated block
+        //:   larger than 'maxPooledBlockSize()' is reused by the next
+        //:   allocation of the same size, and a block too large to fit in a
+        //:   slab is returned to the underlying allocator.
+        //:
+        //: 4 No other memory is returned to the underlying allocator.
+        //
+        // Plan:
+        //: 1 For each size in a range covering every size class, allocate
+        //:   two blocks, deallocate them (using 'deallocate' and
+        //:   'deallocateSized' in turn), and verify that the next two
+        //:   allocations of a size in the same size class return the same
+        //:   blocks in reverse order, and that an allocation of another size
+        //:   class returns neither.  (C-1..2)
+        //:
+        //: 2 Deallocate a null pointer, a large block, and a block of
+        //:   'slabSize()' bytes, and verify that the large block is reused,
+        //:   and that only the last block is returned to the test allocator.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   void deallocate(void *address);
+        //   void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'deallocate' TEST" << endl
+                                  << "=================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int sized = 0; sized < 2; ++sized) {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int size = 1; size <= X.maxPooledBlockSize(); ++size) {
+                const int OTHER = size <= 8 ? 9 : 1;
+
+                void *p = mX.allocate(size);
+                void *q = mX.allocate(size);
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                if (sized) {
+                    mX.deallocateSized(p, size);
+                    mX.deallocateSized(q, size);
+                }
+                else {
+                    mX.deallocate(p);
+                    mX.deallocate(q);
+                }
+                LOOP2_ASSERT(sized, size, NUM_BLOCKS == ta.numBlocksInUse());
+
+                void *r = mX.allocate(OTHER);
+                LOOP2_ASSERT(sized, size, p != r && q != r);
+
+                const int SAME = blockSize(size) - (size + 1) % 4;
+
+                LOOP2_ASSERT(sized, size, q == mX.allocate(SAME));
+                LOOP2_ASSERT(sized, size, p == mX.allocate(SAME));
+                LOOP2_ASSERT(sized, size, p != mX.allocate(size));
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *large = mX.allocate(X.maxPooledBlockSize() + 1);
+
+            mX.deallocate(0);
+            mX.deallocateSized(0, 8);
+            if (sized) {
+                mX.deallocateSized(large, X.maxPooledBlockSize() + 1);
+            }
+            else {
+                mX.deallocate(large);
+            }
+            ASSERT(NUM_BLOCKS <= ta.numBlocksInUse());
+            ASSERT(large == mX.allocate(X.maxPooledBlockSize() + 1));
+
+            void *huge = mX.allocate(X.slabSize());
+            bsl::memset(huge, 'x', X.slabSize());
+
+            const bsls::Types::Int64 NUM_HUGE = ta.numBlocksInUse();
+
+            if (sized) {
+                mX.deallocateSized(huge, X.slabSize());
+            }
+            else {
+                mX.deallocate(huge);
+            }
+            ASSERT(NUM_HUGE - 1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' TEST
+        //
+        // Concerns:
+        //: 1 The returned blocks do not overlap, and pooled blocks are aligned
+        //:   to their block size.
+        //:
+        //: 2 Blocks of the same size class are carved consecutively from a
+        //:   slab aligned on a 'slabSize()' boundary, and blocks of different
+        //:   size classes come from different slabs.
+        //:
+        //: 3 Blocks larger than 'maxPooledBlockSize()' are maximally aligned,
+        //:   and are carved consecutively, each preceded by a header, from
+        //:   slabs shared by such blocks.
+        //:
+        //: 4 Allocating 0 bytes returns 0.
+        //:
+        //: 5 Memory is carved from the external buffer (if any) until it is
+        //:   exhausted, and then from the underlying allocator.
+        //:
+        //: 6 Large blocks are packed densely in the memory carved by the
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For each size from 1 to '2 * maxPooledBlockSize()', for
+        //:   allocators having each valid number of size classes, allocate
+        //:   several blocks, verify their alignment, that consecutive blocks
+        //:   are adjacent (separated by a header, for large blocks) or in
+        //:   different slabs, and fill each block to detect overlap.  (C-1..3)
+        //:
+        //: 2 Verify that 'allocate(0)' returns 0.  (C-4)
+        //:
+        //: 3 Using an allocator with an external buffer, allocate blocks of a
+        //:   single size class and verify that they are taken from the buffer
+        //:   until the test allocator is first used.  (C-5)
+        //:
+        //: 4 Using an allocator with an external buffer, allocate blocks of
+        //:   2000 bytes until the test allocator is first used, and verify
+        //:   that the blocks taken from the buffer occupy more than 90% of
+        //:   it.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocate' TEST" << endl
+                                  << "===============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting alignment and placement." << endl;
+
+        for (int nsc = 1; nsc <= 12; ++nsc) {
+            Obj mX(nsc, &ta);  const Obj& X = mX;
+
+            const int SLAB = X.slabSize();
+
+            for (int size = 1; size <= 2 * X.maxPooledBlockSize(); ++size) {
+                if (size > 64 && 0 != size % 61
+                 && size != X.maxPooledBlockSize()
+                 && size != X.maxPooledBlockSize() + 1) {
+                    continue;
+                }
+
+                const int ALIGN = size <= X.maxPooledBlockSize()
+                                  ? blockSize(size)
+                                  : static_cast<int>(k_MAX_ALIGN);
+
+                char *prev = 0;
+
+                for (int i = 0; i < 3; ++i) {
+                    char *p = static_cast<char *>(mX.allocate(size));
+
+                    LOOP3_ASSERT(nsc, size, i, p);
+                    LOOP3_ASSERT(nsc, size, i,
+                                   0 == reinterpret_cast<UintPtr>(p) % ALIGN);
+
+                    bsl::memset(p, i, size);
+
+                    if (size <= X.maxPooledBlockSize()) {
+                        const int BLOCK = blockSize(size);
+
+                        LOOP3_ASSERT(nsc, size, i,
+                                     slabOf(p, SLAB) + k_MAX_ALIGN <=
+                                                 reinterpret_cast<UintPtr>(p));
+                        LOOP3_ASSERT(nsc, size, i,
+                                     slabOf(p + BLOCK - 1, SLAB) ==
+                                                              slabOf(p, SLAB));
+                        LOOP3_ASSERT(nsc, size, i,
+                                     0 == prev
+                                  || prev + BLOCK == p
+                                  || slabOf(prev, SLAB) != slabOf(p, SLAB));
+                    }
+                    else {
+                        const int CAPACITY = (size + k_MAX_ALIGN - 1)
+                                                         & ~(k_MAX_ALIGN - 1);
+
+                        LOOP3_ASSERT(nsc, size, i,
+                                     slabOf(p, SLAB) + 2 * k_MAX_ALIGN <=
+                                                 reinterpret_cast<UintPtr>(p));
+                        LOOP3_ASSERT(nsc, size, i,
+                                     slabOf(p + size - 1, SLAB) ==
+                                                              slabOf(p, SLAB));
+                        LOOP3_ASSERT(nsc, size, i,
+                                     0 == prev
+                                  || prev + CAPACITY + k_MAX_ALIGN == p
+                                  || slabOf(prev, SLAB) != slabOf(p, SLAB));
+                    }
+
+                    if (prev) {
+                        LOOP3_ASSERT(nsc, size, i, prev[0] == i - 1);
+                        LOOP3_ASSERT(nsc, size, i, prev[size - 1] == i - 1);
+                    }
+                    prev = p;
+                }
+            }
+
+            char *p8  = static_cast<char *>(mX.allocate(8));
+            char *p16 = static_cast<char *>(mX.allocate(9));
+            if (2 <= nsc) {
+                LOOP_ASSERT(nsc, slabOf(p8, SLAB) != slabOf(p16, SLAB));
+            }
+
+            ASSERT(0 == mX.allocate(0));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting external buffer." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            enum { k_BUFFER_SIZE = 64 * 1024 };
+
+            bsls::AlignedBuffer<k_BUFFER_SIZE> bufferStorage;
+            char *buffer = bufferStorage.buffer();
+
+            Obj mX(buffer, k_BUFFER_SIZE, &ta);
+
+            int numInBuffer = 0;
+            while (0 == ta.numBlocksTotal()) {
+                void *p = mX.allocate(64);
+                if (0 == ta.numBlocksTotal()) {
+                    ASSERT(isInBuffer(p, buffer, k_BUFFER_SIZE));
+                    ++numInBuffer;
+                }
+                else {
+                    ASSERT(!isInBuffer(p, buffer, k_BUFFER_SIZE));
+                }
+            }
+
+            // Every one of the seven (or eight) slabs that fit in the buffer
+            // is used.
+
+            const int PER_SLAB = (mX.slabSize() - k_MAX_ALIGN) / 64;
+            LOOP2_ASSERT(numInBuffer, PER_SLAB, 7 * PER_SLAB <= numInBuffer);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting memory use of large blocks." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            enum { k_BUFFER_SIZE = 1024 * 1024, k_SIZE = 2000 };
+
+            char *buffer = static_cast<char *>(ta.allocate(k_BUFFER_SIZE));
+
+            {
+                Obj mX(buffer, k_BUFFER_SIZE, &ta);
+
+                int numInBuffer = 0;
+                for (;;) {
+                    void *p = mX.allocate(k_SIZE);
+                    if (!isInBuffer(p, buffer, k_BUFFER_SIZE)) {
+                        break;
+                    }
+                    bsl::memset(p, 'x', k_SIZE);
+                    ++numInBuffer;
+                }
+
+                if (veryVerbose) { P(numInBuffer) }
+
+                LOOP_ASSERT(numInBuffer,
+                            10.0 * numInBuffer * k_SIZE > 9.0 * k_BUFFER_SIZE);
+            }
+
+            ta.deallocate(buffer);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR AND ACCESSOR TEST
+        //
+        // Concerns:
+        //: 1 The allocator is configured with the specified number of size
+        //:   classes, or with 8 size classes by default.
+        //:
+        //: 2 'maxPooledBlockSize' is '2 ^ (numSizeClasses + 2)'.
+        //:
+        //: 3 'slabSize' is a power of two, at least 4096, and at least eight
+        //:   times 'maxPooledBlockSize'.
+        //:
+        //: 4 No memory is obtained from the underlying allocator at
+        //:   construction, and the default allocator is used if none is
+        //:   supplied.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Construct allocators using each constructor and each valid
+        //:   number of size classes, and verify the values returned by the
+        //:   accessors, and that no memory is in use from the test allocator.
+        //:   (C-1..4)
+        //:
+        //: 2 Install a test allocator as the default, and verify that it
+        //:   supplies memory to an allocator constructed without one.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid constructor arguments.  (C-5)
+        //
+        // Testing:
+        //   SlabAllocator(Allocator *ba = 0);
+        //   SlabAllocator(int numSizeClasses, Allocator *ba = 0);
+        //   SlabAllocator(char *buffer, int size, Allocator *ba = 0);
+        //   SlabAllocator(char *buffer, int size, int nsc, Allocator *ba = 0);
+        //   int maxPooledBlockSize() const;
+        //   int numSizeClasses() const;
+        //   int slabSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CTOR AND ACCESSOR TEST" << endl
+                                  << "======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        char buffer[64];
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(8    == X.numSizeClasses());
+            ASSERT(1024 == X.maxPooledBlockSize());
+            ASSERT(8192 == X.slabSize());
+        }
+        {
+            Obj mX(buffer, sizeof buffer, &ta);  const Obj& X = mX;
+
+            ASSERT(8    == X.numSizeClasses());
+            ASSERT(1024 == X.maxPooledBlockSize());
+            ASSERT(8192 == X.slabSize());
+        }
+
+        for (int nsc = 1; nsc <= 16; ++nsc) {
+            Obj mX(nsc, &ta);                     const Obj& X = mX;
+            Obj mY(buffer, sizeof buffer, nsc, &ta);  const Obj& Y = mY;
+
+            const int MAX_BLOCK = 4 << nsc;
+
+            LOOP_ASSERT(nsc, nsc       == X.numSizeClasses());
+            LOOP_ASSERT(nsc, MAX_BLOCK == X.maxPooledBlockSize());
+            LOOP_ASSERT(nsc, nsc       == Y.numSizeClasses());
+            LOOP_ASSERT(nsc, MAX_BLOCK == Y.maxPooledBlockSize());
+
+            const int SLAB = X.slabSize();
+
+            LOOP_ASSERT(nsc, SLAB == Y.slabSize());
+            LOOP_ASSERT(nsc, 0 == (SLAB & (SLAB - 1)));
+            LOOP_ASSERT(nsc, 4096 <= SLAB);
+            LOOP_ASSERT(nsc, 8 * MAX_BLOCK <= SLAB);
+            LOOP_ASSERT(nsc, 4096 == SLAB || 8 * MAX_BLOCK == SLAB);
+        }
+        ASSERT(0 == ta.numBlocksTotal());
+
+        if (verbose) cout << "\nTesting default allocator." << endl;
+        {
+            bslma::TestAllocator         da(veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;
+
+            mX.allocate(8);
+            ASSERT(1 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS_RAW(Obj( 1, &ta));
+            ASSERT_PASS_RAW(Obj(16, &ta));
+            ASSERT_FAIL_RAW(Obj( 0, &ta));
+            ASSERT_FAIL_RAW(Obj(17, &ta));
+
+            ASSERT_PASS_RAW(Obj(buffer, sizeof buffer, &ta));
+            ASSERT_FAIL_RAW(Obj((char *)0, sizeof buffer, &ta));
+            ASSERT_FAIL_RAW(Obj(buffer,             0, &ta));
+
+            ASSERT_PASS_RAW(Obj(buffer, sizeof buffer,  1, &ta));
+            ASSERT_PASS_RAW(Obj(buffer, sizeof buffer, 16, &ta));
+            ASSERT_FAIL_RAW(Obj(buffer, sizeof buffer,  0, &ta));
+            ASSERT_FAIL_RAW(Obj(buffer, sizeof buffer, 17, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   That the basic functionality of 'bdlma::SlabAllocator' works
+        //   properly.
+        //
+        // Plan:
+        //   Create a slab allocator with three size classes.  Allocate memory
+        //   from each size class, as well as a large block.  Then deallocate
+        //   the blocks and verify that they are reused.  Finally,
+        //   'release' the allocator and let it go out of scope.
+        //
+        // Testing:
+        //   This "test" exercises basic functionality, but tests nothing.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+
+            ASSERT(3  == X.numSizeClasses());
+            ASSERT(32 == X.maxPooledBlockSize());
+            ASSERT(0  == ta.numBlocksTotal());
+
+            void *p = mX.allocate(8);   ASSERT(p);
+            void *q = mX.allocate(16);  ASSERT(q);
+            void *r = mX.allocate(32);  ASSERT(r);
+            void *s = mX.allocate(33);  ASSERT(s);
+
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            mX.deallocateSized(q, 16);
+            mX.deallocate(r);
+            mX.deallocate(s);
+
+            ASSERT(p == mX.allocate(5));
+            ASSERT(q == mX.allocate(12));
+            ASSERT(r == mX.allocate(32));
+            ASSERT(s == mX.allocate(33));
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.allocate(8);
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
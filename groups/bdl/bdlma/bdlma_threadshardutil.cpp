@@ -0,0 +1,65 @@
+// bdlma_threadshardutil.cpp                                          -*-C++-*-
+#include <bdlma_threadshardutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadshardutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define BDLMA_THREADSHARDUTIL_THREAD_LOCAL __declspec(thread)
+#else
+#define BDLMA_THREADSHARDUTIL_THREAD_LOCAL __thread
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+static bsls::AtomicOperations::AtomicTypes::Int s_numThreads = { 0 };
+    // number of threads that have been assigned an ordinal
+
+static BDLMA_THREADSHARDUTIL_THREAD_LOCAL unsigned int t_ordinal = 0;
+    // ordinal (plus one) of the calling thread, or 0 if none has been
+    // assigned yet
+
+}  // close unnamed namespace
+
+                          // ----------------------
+                          // struct ThreadShardUtil
+                          // ----------------------
+
+// CLASS METHODS
+unsigned int ThreadShardUtil::threadOrdinal()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == t_ordinal)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        t_ordinal = static_cast<unsigned int>(
+                 bsls::AtomicOperations::addIntNvRelaxed(&s_numThreads, 1));
+    }
+
+    return t_ordinal - 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
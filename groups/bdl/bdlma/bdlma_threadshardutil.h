@@ -0,0 +1,168 @@
+// bdlma_threadshardutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADSHARDUTIL
+#define INCLUDED_BDLMA_THREADSHARDUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility assigning each thread a shard of shared state.
+//
+//@CLASSES:
+//  bdlma::ThreadShardUtil: namespace for assigning shards to threads
+//
+//@SEE_ALSO: bdlma_shardedcountingallocator, bdlma_blockcacheallocator,
+//           bdlma_objectpool
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlma::ThreadShardUtil',
+// that assigns to each thread a small integer, so that a memory manager
+// shared by many threads can split its state into a fixed number of
+// *shards*, each on its own cache line, and have each thread operate on "its"
+// shard instead of contending with every other thread on a single one.
+//
+// Each thread is given an *ordinal* the first time it calls 'threadOrdinal'
+// (or 'shardIndex'): the first such thread in the process is given 0, the
+// next one 1, and so on.  The ordinal is kept in a thread-local variable, so
+// that, after the first call, obtaining it costs a single thread-local read.
+// 'shardIndex' maps the ordinal to a shard in a round-robin fashion, so that
+// up to 'numShards' threads each have a shard of their own, and the threads
+// beyond that share shards evenly.  Note that the ordinal of a thread is the
+// same for every client of this component, so that the shards of distinct
+// memory managers used by the same thread have the same index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharding a Counter
+///- - - - - - - - - - - - - - -
+// Suppose that we want to count events reported by many threads, without
+// having every thread update the same atomic counter.
+//
+// First, we define a counter keeping one count for each of a fixed number of
+// shards, each count on its own cache line:
+//..
+//  class ShardedCounter {
+//      // This class implements a counter that can be incremented by many
+//      // threads with little contention.
+//
+//      // PRIVATE TYPES
+//      enum { k_NUM_SHARDS = 16 };
+//
+//      struct Shard {
+//          bsls::AtomicInt64 d_count;
+//          char              d_pad[64 - sizeof(bsls::AtomicInt64)];
+//      };
+//
+//      // DATA
+//      Shard d_shards[k_NUM_SHARDS];
+//
+//    public:
+//      // MANIPULATORS
+//      void increment()
+//          // Increment this counter.
+//      {
+//          const int index = bdlma::ThreadShardUtil::shardIndex(k_NUM_SHARDS);
+//          d_shards[index].d_count.addRelaxed(1);
+//      }
+//
+//      // ACCESSORS
+//      bsls::Types::Int64 count() const
+//          // Return the value of this counter.
+//      {
+//          bsls::Types::Int64 result = 0;
+//          for (int i = 0; i < k_NUM_SHARDS; ++i) {
+//              result += d_shards[i].d_count.loadRelaxed();
+//          }
+//          return result;
+//      }
+//  };
+//..
+// Then, each thread increments the counter, which updates the count of the
+// shard assigned to the thread:
+//..
+//  ShardedCounter counter;
+//
+//  counter.increment();
+//  counter.increment();
+//
+//  assert(2 == counter.count());
+//..
+// Finally, note that the shard used by the calling thread does not change:
+//..
+//  assert(bdlma::ThreadShardUtil::shardIndex(16)
+//                                  == bdlma::ThreadShardUtil::shardIndex(16));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // ======================
+                          // struct ThreadShardUtil
+                          // ======================
+
+struct ThreadShardUtil {
+    // This 'struct' provides a namespace for utility functions assigning a
+    // shard to each thread.
+
+    // CLASS METHODS
+    static unsigned int threadOrdinal();
+        // Return the ordinal of the calling thread, assigned (starting at 0)
+        // in the order in which threads first call this method (or
+        // 'shardIndex').
+
+    static int shardIndex(int numShards);
+        // Return the index, in the range '[0 .. numShards)', of the shard
+        // assigned to the calling thread among the specified 'numShards'
+        // shards.  The behavior is undefined unless '1 <= numShards'.  Note
+        // that the index returned to a given thread for a given 'numShards'
+        // never changes.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // struct ThreadShardUtil
+                          // ----------------------
+
+// CLASS METHODS
+inline
+int ThreadShardUtil::shardIndex(int numShards)
+{
+    BSLS_ASSERT_SAFE(1 <= numShards);
+
+    return static_cast<int>(threadOrdinal()
+                                       % static_cast<unsigned int>(numShards));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,396 @@
+// bdlma_threadshardutil.t.cpp                                        -*-C++-*-
+#include <bdlma_threadshardutil.h>
+
+#include <bdls_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ThreadShardUtil' assigns an ordinal to each thread the first time
+// the thread calls it, and maps that ordinal to a shard index.  The primary
+// concerns are that the ordinals of distinct threads are distinct, that the
+// ordinal (and hence the shard) of a thread never changes, and that the shard
+// indices are distributed in a round-robin fashion.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] unsigned int threadOrdinal();
+// [ 2] int shardIndex(int numShards);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// [ 2] CONCERN: Distinct threads are assigned distinct ordinals.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ThreadShardUtil Util;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase2 {
+
+struct ThreadInfo {
+    unsigned int d_ordinal;     // ordinal of the thread
+    int          d_shardIndex;  // shard index of the thread among 4 shards
+    bool         d_isStable;    // 'true' if repeated calls agree
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    info->d_ordinal    = Util::threadOrdinal();
+    info->d_shardIndex = Util::shardIndex(4);
+    info->d_isStable   = true;
+
+    for (int i = 0; i < 100; ++i) {
+        if (info->d_ordinal    != Util::threadOrdinal()
+         || info->d_shardIndex != Util::shardIndex(4)) {
+            info->d_isStable = false;
+        }
+    }
+    return 0;
+}
+
+}  // close namespace TestCase2
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharding a Counter
+///- - - - - - - - - - - - - - -
+// Suppose that we want to count events reported by many threads, without
+// having every thread update the same atomic counter.
+//
+// First, we define a counter keeping one count for each of a fixed number of
+// shards, each count on its own cache line:
+//..
+    class ShardedCounter {
+        // This class implements a counter that can be incremented by many
+        // threads with little contention.
+
+        // PRIVATE TYPES
+        enum { k_NUM_SHARDS = 16 };
+
+        struct Shard {
+            bsls::AtomicInt64 d_count;
+            char              d_pad[64 - sizeof(bsls::AtomicInt64)];
+        };
+
+        // DATA
+        Shard d_shards[k_NUM_SHARDS];
+
+      public:
+        // MANIPULATORS
+        void increment()
+            // Increment this counter.
+        {
+            const int index = bdlma::ThreadShardUtil::shardIndex(k_NUM_SHARDS);
+            d_shards[index].d_count.addRelaxed(1);
+        }
+
+        // ACCESSORS
+        bsls::Types::Int64 count() const
+            // Return the value of this counter.
+        {
+            bsls::Types::Int64 result = 0;
+            for (int i = 0; i < k_NUM_SHARDS; ++i) {
+                result += d_shards[i].d_count.loadRelaxed();
+            }
+            return result;
+        }
+    };
+//..
+
+}  // close namespace UsageExample
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace UsageExample;
+
+// Then, each thread increments the counter, which updates the count of the
+// shard assigned to the thread:
+//..
+    ShardedCounter counter;
+
+    counter.increment();
+    counter.increment();
+
+    ASSERT(2 == counter.count());
+//..
+// Finally, note that the shard used by the calling thread does not change:
+//..
+    ASSERT(bdlma::ThreadShardUtil::shardIndex(16)
+                                    == bdlma::ThreadShardUtil::shardIndex(16));
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'threadOrdinal' AND 'shardIndex'
+        //
+        // Concerns:
+        //: 1 Distinct threads are assigned distinct ordinals.
+        //:
+        //: 2 The ordinal, and the shard index, of a thread do not change.
+        //:
+        //: 3 'shardIndex' returns the ordinal of the thread modulo the number
+        //:   of shards, so that threads having consecutive ordinals are
+        //:   assigned consecutive shards.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a number of threads, each of which records its ordinal
+        //:   and its shard index among 4 shards, and verifies that repeated
+        //:   calls return the same values.  Join the threads, and verify that
+        //:   the ordinals are distinct and that the shard indices are the
+        //:   ordinals modulo 4.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   unsigned int threadOrdinal();
+        //   int shardIndex(int numShards);
+        //   CONCERN: Distinct threads are assigned distinct ordinals.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'threadOrdinal' AND 'shardIndex'" << endl
+                          << "================================" << endl;
+
+        using namespace TestCase2;
+
+        enum { k_NUM_THREADS = 10 };
+
+        const unsigned int MAIN_ORDINAL = Util::threadOrdinal();
+
+        ThreadInfo info[k_NUM_THREADS];
+        ThreadId   ids[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ids[i] = createThread(&threadFunction, &info[i]);
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            joinThread(ids[i]);
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            if (veryVerbose) { T_ P_(i) P(info[i].d_ordinal) }
+
+            LOOP_ASSERT(i, info[i].d_isStable);
+            LOOP_ASSERT(i, MAIN_ORDINAL != info[i].d_ordinal);
+            LOOP_ASSERT(i, static_cast<int>(info[i].d_ordinal % 4)
+                                                     == info[i].d_shardIndex);
+
+            for (int j = 0; j < i; ++j) {
+                LOOP2_ASSERT(i, j, info[i].d_ordinal != info[j].d_ordinal);
+            }
+        }
+
+        ASSERT(MAIN_ORDINAL == Util::threadOrdinal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(Util::shardIndex(1));
+            ASSERT_SAFE_FAIL(Util::shardIndex(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Obtain the ordinal and the shard indices of the calling thread,
+        //:   and verify that they are consistent.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const unsigned int ORDINAL = Util::threadOrdinal();
+
+        ASSERT(ORDINAL == Util::threadOrdinal());
+
+        ASSERT(0                              == Util::shardIndex(1));
+        ASSERT(static_cast<int>(ORDINAL % 16) == Util::shardIndex(16));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
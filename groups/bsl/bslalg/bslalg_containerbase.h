@@ -260,6 +260,34 @@ class ContainerBase : public
     ContainerBase& operator=(const ContainerBase&);
 
   private:
+    // PRIVATE CLASS METHODS
+    template <class T>
+    static bool tryExpandImp(bslma::Allocator              *mechanism,
+                             T                             *p,
+                             typename ALLOCATOR::size_type  originalN,
+                             typename ALLOCATOR::size_type  newN)
+        // Attempt to extend, using the specified 'mechanism', the storage for
+        // the specified 'originalN' objects of type 'T' at the specified 'p'
+        // to hold the specified 'newN' objects without moving it.  Return
+        // 'true' on success, and 'false' otherwise.
+    {
+        return mechanism->tryExpand(p,
+                                    originalN * sizeof(T),
+                                    newN * sizeof(T));
+    }
+
+    template <class T>
+    static bool tryExpandImp(void                          *,
+                             T                             *,
+                             typename ALLOCATOR::size_type,
+                             typename ALLOCATOR::size_type)
+        // Return 'false'.  Note that this overload is selected if 'ALLOCATOR'
+        // is not based on 'bslma::Allocator', for which in-place expansion is
+        // not supported.
+    {
+        return false;
+    }
+
     // PRIVATE MANIPULATORS
     template <class T>
     typename ALLOCATOR::template rebind<T>::other
@@ -342,6 +370,21 @@ class ContainerBase : public
         // Call the 'T' destructor for the object pointed to by 'p'.  Do not
         // directly deallocate any memory.
 
+    template <class T>
+    bool tryExpandN(T *p, size_type originalN, size_type newN)
+        // Attempt to extend the storage for 'originalN' objects of type 'T',
+        // starting at 'p' and obtained from 'allocateN', to hold 'newN'
+        // objects without moving it.  Return 'true' if the storage now holds
+        // 'newN' objects, in which case 'newN' must be passed to a subsequent
+        // 'deallocateN' of 'p', and 'false' with no effect otherwise.  If
+        // 'ALLOCATOR' is not based on 'bslma::Allocator', return 'false'.
+        // The behavior is undefined unless '0 < originalN <= newN'.  Note
+        // that whether the storage can be extended is determined by
+        // 'bslma::Allocator::tryExpand'.
+    {
+        return tryExpandImp(this->bslmaAllocator(), p, originalN, newN);
+    }
+
     // ACCESSORS
     bool equalAllocator(const ContainerBase& rhs) const;
         // Returns 'this->allocator() == rhs.allocator()'.
@@ -15,6 +15,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 #include <new>
 
 using namespace BloombergLP;
@@ -24,8 +25,10 @@ using namespace std;
 //                             TEST PLAN
 //-----------------------------------------------------------------------------
 //
-//
+// [ 2] bool tryExpandN(T *p, size_type originalN, size_type newN);
 //-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -375,6 +378,59 @@ bool operator!=(const Allocator<T1>& lhs, const Allocator<T2>& rhs)
 int TestType::s_numCopyConstruct = 0;
 int TestType::s_numDestroy = 0;
 
+class ExpandingTestAllocator : public bslma::Allocator {
+    // This test class forwards allocations to a 'bslma::TestAllocator', and
+    // records the arguments of each 'tryExpand' call, returning a result that
+    // is set by the client.
+
+    // DATA
+    bslma::TestAllocator  d_upstream;          // supplies the memory
+    bool                  d_result;            // result of 'tryExpand'
+    int                   d_numTryExpandCalls; // number of 'tryExpand' calls
+    void                 *d_lastAddress_p;     // last address passed
+    size_type             d_lastOriginalSize;  // last original size passed
+    size_type             d_lastNewSize;       // last new size passed
+
+  public:
+    // CREATORS
+    ExpandingTestAllocator()
+    : d_result(false)
+    , d_numTryExpandCalls(0)
+    , d_lastAddress_p(0)
+    , d_lastOriginalSize(0)
+    , d_lastNewSize(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size) { return d_upstream.allocate(size); }
+
+    void deallocate(void *address) { d_upstream.deallocate(address); }
+
+    bool tryExpand(void *address, size_type originalSize, size_type newSize)
+    {
+        ++d_numTryExpandCalls;
+        d_lastAddress_p    = address;
+        d_lastOriginalSize = originalSize;
+        d_lastNewSize      = newSize;
+        return d_result;
+    }
+
+    void setResult(bool result) { d_result = result; }
+        // Set the value returned by subsequent 'tryExpand' calls to the
+        // specified 'result'.
+
+    // ACCESSORS
+    int numTryExpandCalls() const { return d_numTryExpandCalls; }
+    void *lastAddress() const { return d_lastAddress_p; }
+    size_type lastOriginalSize() const { return d_lastOriginalSize; }
+    size_type lastNewSize() const { return d_lastNewSize; }
+    bsls::Types::Int64 numBlocksInUse() const
+    {
+        return d_upstream.numBlocksInUse();
+    }
+};
+
 } // close anonymous namespace
 
 //=============================================================================
@@ -521,7 +577,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -552,6 +608,88 @@ int main(int argc, char *argv[])
     ASSERT(fixedArray[2] == 3);
 //..
 
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'tryExpandN'
+        //
+        // Concerns:
+        //: 1 For an allocator based on 'bslma::Allocator', 'tryExpandN'
+        //:   forwards to 'tryExpand' of the mechanism, converting the numbers
+        //:   of objects to numbers of bytes, and returns its result.
+        //:
+        //: 2 For an allocator not based on 'bslma::Allocator', 'tryExpandN'
+        //:   returns 'false'.
+        //
+        // Plan:
+        //: 1 Using a mechanism that records the arguments of 'tryExpand' and
+        //:   returns a configurable result, call 'tryExpandN' for objects of
+        //:   two sizes and verify the arguments recorded and the value
+        //:   returned.  (C-1)
+        //:
+        //: 2 Call 'tryExpandN' on a container base using 'std::allocator' and
+        //:   verify that 'false' is returned.  (C-2)
+        //
+        // Testing:
+        //   bool tryExpandN(T *p, size_type originalN, size_type newN);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'tryExpandN'"
+                            "\n====================\n");
+
+        if (verbose) printf("\nTesting 'bslma'-based allocator.\n");
+        {
+            ExpandingTestAllocator eta;
+
+            typedef bslalg::ContainerBase<Allocator<int> > Obj;
+
+            Allocator<int> a(&eta);
+
+            Obj mX(a);
+
+            int *intPtr = 0;
+            intPtr = mX.allocateN(intPtr, 4);
+
+            ASSERT(false == mX.tryExpandN(intPtr, 4, 8));
+            ASSERT(1     == eta.numTryExpandCalls());
+            ASSERT(intPtr == eta.lastAddress());
+            ASSERT(4 * static_cast<ptrdiff_t>(sizeof(int))
+                                                    == eta.lastOriginalSize());
+            ASSERT(8 * static_cast<ptrdiff_t>(sizeof(int))
+                                                         == eta.lastNewSize());
+
+            eta.setResult(true);
+
+            TestType *ttPtr = 0;
+            ttPtr = mX.allocateN(ttPtr, 2);
+
+            ASSERT(true  == mX.tryExpandN(ttPtr, 2, 3));
+            ASSERT(2     == eta.numTryExpandCalls());
+            ASSERT(ttPtr == eta.lastAddress());
+            ASSERT(2 * static_cast<ptrdiff_t>(sizeof(TestType))
+                                                    == eta.lastOriginalSize());
+            ASSERT(3 * static_cast<ptrdiff_t>(sizeof(TestType))
+                                                         == eta.lastNewSize());
+
+            mX.deallocateN(ttPtr, 3);
+            mX.deallocateN(intPtr, 4);
+            ASSERT(0 == eta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting non-'bslma' allocator.\n");
+        {
+            typedef bslalg::ContainerBase<std::allocator<int> > Obj;
+
+            Obj mX((std::allocator<int>()));
+
+            int *intPtr = 0;
+            intPtr = mX.allocateN(intPtr, 4);
+
+            ASSERT(false == mX.tryExpandN(intPtr, 4, 8));
+
+            mX.deallocateN(intPtr, 4);
+        }
+
       } break;
       case 1: {
         // --------------------------------------------------------------------
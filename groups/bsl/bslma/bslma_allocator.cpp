@@ -4,7 +4,10 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_bslexceptionutil.h>
+#include <bsls_exceptionutil.h>
 
 namespace BloombergLP {
 
@@ -20,6 +23,77 @@ Allocator::~Allocator()
 {
 }
 
+// MANIPULATORS
+void *Allocator::allocateAligned(size_type size, size_type alignment)
+{
+    BSLS_ASSERT(0 < alignment);
+    BSLS_ASSERT(0 == (alignment & (alignment - 1)));
+
+    if (alignment > bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    // A block whose size is a multiple of 'alignment' is naturally aligned to
+    // (at least) 'alignment', since 'alignment' does not exceed the maximal
+    // alignment.
+
+    return allocate((size + alignment - 1) & ~(alignment - 1));
+}
+
+void Allocator::deallocateSized(void *address, size_type)
+{
+    deallocate(address);
+}
+
+void Allocator::allocateBatch(void      **blocks,
+                              size_type   numBlocks,
+                              size_type   size)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    size_type numAllocated = 0;
+
+    BSLS_TRY {
+        for (; numAllocated < numBlocks; ++numAllocated) {
+            blocks[numAllocated] = allocate(size);
+        }
+    }
+    BSLS_CATCH(...) {
+        deallocateBatch(blocks, numAllocated, size);
+        BSLS_RETHROW;
+    }
+}
+
+void Allocator::deallocateBatch(void *const *blocks,
+                                size_type    numBlocks,
+                                size_type    size)
+{
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    if (0 == size) {
+        return;                                                       // RETURN
+    }
+
+    for (size_type i = 0; i < numBlocks; ++i) {
+        deallocate(blocks[i]);
+    }
+}
+
+bool Allocator::tryExpand(void      *address,
+                          size_type  originalSize,
+                          size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < originalSize);
+    BSLS_ASSERT(originalSize <= newSize);
+
+    (void)address;
+    (void)originalSize;
+    (void)newSize;
+
+    return false;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -119,6 +119,73 @@ BSLS_IDENT("$Id: $")
 // is known that the 'address' does *not* refer to a secondary base class of
 // the object being deleted.
 //
+///Sized Deallocation
+///------------------
+// In addition to the pure virtual 'deallocate' method, the protocol provides
+// a (non-pure) virtual 'deallocateSized' method that is passed the size of
+// the block being returned, allowing concrete allocators that segregate
+// memory by size (e.g., 'bdlma::SlabAllocator') to locate the owning size
+// class without reading a per-block header.  The default implementation
+// simply ignores the size and forwards to 'deallocate', so existing derived
+// classes need not be changed.
+//
+// Since most allocators do not override 'deallocateSized', and calling the
+// default implementation costs a second virtual call, clients holding only a
+// 'bslma::Allocator' (e.g., 'bsl::allocator') call 'deallocate'.  A concrete
+// allocator *opts in* to sized deallocation by declaring 'deallocateSized'
+// itself; clients that know the concrete type of the allocator at compile
+// time (e.g., 'bslma::DeleterHelper' when deleting an object of
+// non-polymorphic type) detect the declaration and call 'deallocateSized'
+// only on such types.
+//
+///Over-Aligned Allocation
+///-----------------------
+// The protocol also provides a (non-pure) virtual 'allocateAligned' method
+// that takes an explicit power-of-two 'alignment'.  The default
+// implementation satisfies any alignment not exceeding
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' by rounding 'size' up to a
+// multiple of 'alignment' (relying on the natural alignment guarantee of
+// 'allocate'), and throws 'std::bad_alloc' for larger alignments.  Concrete
+// allocators that can carve over-aligned blocks directly from their buffers
+// (e.g., 'bdlma::SequentialAllocator', 'bdlma::BufferedSequentialAllocator',
+// and 'bdlma::MultipoolAllocator') override this method to serve cache-line
+// and page alignment without requiring clients to over-allocate and adjust
+// the returned address themselves.  A block obtained from 'allocateAligned' is
+// returned to the allocator using 'deallocate'.
+//
+///Batch Allocation
+///----------------
+// The protocol further provides (non-pure) virtual 'allocateBatch' and
+// 'deallocateBatch' methods that obtain, and return, a number of blocks of
+// the same size in a single call.  Clients that need many blocks at once
+// (e.g., 'bsl::list' when inserting a range of elements, or when being
+// cleared) use these methods to amortize the cost of the virtual dispatch
+// and, for concrete allocators that segregate memory by size (e.g.,
+// 'bdlma::MultipoolAllocator'), the cost of locating the pool serving that
+// size, over the whole batch.  The default implementations simply invoke
+// 'allocate' and 'deallocate' once per block, so existing derived classes
+// need not be changed.  'allocateBatch' either obtains every requested block
+// or, if an exception is thrown, none of them.
+//
+///In-Place Expansion
+///------------------
+// Finally, the protocol provides a (non-pure) virtual 'tryExpand' method that
+// attempts to grow a previously allocated block to a larger size without
+// moving it.  Containers that grow geometrically (e.g., 'bsl::vector' and
+// 'bsl::string') call 'tryExpand' before allocating a new buffer and
+// relocating their elements, so that, when the allocator can satisfy the
+// larger size in place, the copy (and the transient doubling of the memory
+// footprint) is avoided altogether.  Allocators that carve blocks from a
+// contiguous buffer (e.g., 'bdlma::SequentialAllocator' and
+// 'bdlma::BufferedSequentialAllocator') can expand the most recently
+// allocated block into the unused remainder of their buffer, and allocators
+// that round requests up to a size class (e.g., 'bdlma::MultipoolAllocator')
+// can expand any block whose new size still fits its class.  The default
+// implementation returns 'false' (i.e., it never expands), so existing
+// derived classes need not be changed.  Once a block has been expanded, its
+// size is the new size for the purposes of 'deallocateSized' and of any
+// further expansion.
+//
 ///Usage
 ///-----
 // The 'bslma::Allocator' protocol provided in this component defines a
@@ -429,12 +496,84 @@ class Allocator {
         // conforms to the platform requirement for any object of the specified
         // 'size'.
 
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) whose address is a multiple of the
+        // specified 'alignment'.  If 'size' is 0, a null pointer is returned
+        // with no other effect.  If this allocator cannot return a suitably
+        // aligned block of the requested number of bytes, then it will throw a
+        // 'std::bad_alloc' exception in an exception-enabled build, or else
+        // will abort the program in a non-exception build.  The behavior is
+        // undefined unless '0 <= size' and 'alignment' is a positive power of
+        // two.  Note that the default implementation supports only alignments
+        // not exceeding 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'; derived
+        // classes may override this method to support larger alignments.  Also
+        // note that the returned block must be deallocated using the
+        // 'deallocate' method.
+
     virtual void deallocate(void *address) = 0;
         // Return the memory block at the specified 'address' back to this
         // allocator.  If 'address' is 0, this function has no effect.  The
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this allocator.  If 'address'
+        // is 0, this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object, 'size' is the
+        // same value that was passed to the 'allocate' call that returned
+        // 'address', and 'address' has not already been deallocated.  Note
+        // that the default implementation ignores 'size' and calls
+        // 'deallocate(address)'; derived classes may override this method to
+        // avoid recovering the size of the block from a header or lookup (see
+        // {Sized Deallocation}).
+
+    virtual void allocateBatch(void      **blocks,
+                               size_type   numBlocks,
+                               size_type   size);
+        // Load into the specified 'blocks' array the addresses of the
+        // specified 'numBlocks' newly allocated blocks of memory, each of (at
+        // least) the specified 'size' (in bytes) and aligned as if returned
+        // by 'allocate(size)'.  If 'size' is 0, 'numBlocks' null pointers are
+        // loaded with no other effect.  If an exception is thrown, every block
+        // allocated by this call is deallocated before the exception
+        // propagates.  The behavior is undefined unless '0 <= numBlocks',
+        // '0 <= size', and 'blocks' refers to an array having at least
+        // 'numBlocks' elements.  Note that the default implementation calls
+        // 'allocate(size)' 'numBlocks' times; derived classes may override
+        // this method to obtain the blocks more efficiently.
+
+    virtual void deallocateBatch(void *const *blocks,
+                                 size_type    numBlocks,
+                                 size_type    size);
+        // Return the specified 'numBlocks' memory blocks whose addresses are
+        // held in the specified 'blocks' array, each having the specified
+        // 'size' (in bytes), back to this allocator.  If 'size' is 0, this
+        // method has no effect.  The behavior is undefined unless
+        // '0 <= numBlocks', and each address in 'blocks' was allocated using
+        // this allocator object with a request for 'size' bytes and has not
+        // already been deallocated.  Note that the default implementation
+        // calls 'deallocate' once for each address; derived classes may
+        // override this method to return the blocks more efficiently.
+
+    virtual bool tryExpand(void      *address,
+                           size_type  originalSize,
+                           size_type  newSize);
+        // Attempt to extend the memory block at the specified 'address',
+        // having the specified 'originalSize' (in bytes), to the specified
+        // 'newSize' (in bytes) without moving it.  Return 'true' if the block
+        // now holds (at least) 'newSize' bytes, and 'false' (with no effect)
+        // otherwise.  If 'true' is returned, 'newSize' replaces
+        // 'originalSize' as the size of the block for all subsequent
+        // operations on it (e.g., 'deallocateSized(address, newSize)').  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated,
+        // 'originalSize' is the current size of the block, and
+        // '0 < originalSize <= newSize'.  Note that the default
+        // implementation returns 'false'; derived classes may override this
+        // method to extend blocks in place when their storage permits.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
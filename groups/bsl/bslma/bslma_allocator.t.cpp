@@ -2,7 +2,10 @@
 
 #include <bslma_allocator.h>
 
+#include <bslma_deleterhelper.h>
+
 #include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 
 #include <stdio.h>
@@ -33,11 +36,16 @@ using namespace BloombergLP;
 // [ 3] template<typename TYPE> deleteObjectRaw(const TYPE *);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
 // [ 5] void operator delete(void *address, bslma::Allocator& basicAllocator);
+// [ 6] virtual void deallocateSized(void *address, size_type size);
+// [ 7] virtual void *allocateAligned(size_type size, size_type alignment);
+// [ 8] virtual void allocateBatch(void **, size_type, size_type);
+// [ 8] virtual void deallocateBatch(void *const *, size_type, size_type);
+// [ 9] virtual bool tryExpand(void *, size_type, size_type);
 //-----------------------------------------------------------------------------
 // [ 1] PROTOCOL TEST - Make sure derived class compiles and links.
 // [ 4] OPERATOR TEST - Make sure overloaded operators call correct functions.
 // [ 5] EXCEPTION SAFETY - Ensure operator delete is invoked on an exception.
-// [ 6] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
+// [10] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
 //=============================================================================
 
 //=============================================================================
@@ -132,6 +140,103 @@ class my_Allocator : public bslma::Allocator {
         // Return number of times deallocate called.
 };
 
+class my_SizedAllocator : public bslma::Allocator {
+    // Test class used to verify that 'deallocateSized' is dispatched to
+    // derived classes that override it.
+
+    char      d_storage[64];          // space returned by 'allocate'
+
+    int       d_deallocateCount;      // number of 'deallocate' calls
+
+    int       d_sizedDeallocateCount; // number of 'deallocateSized' calls
+
+    size_type d_lastSize;             // last size passed to
+                                      // 'deallocateSized'
+
+    bsls::AlignmentUtil::MaxAlignedType d_align; // no use but to align this
+                                                 // struct
+
+  public:
+    my_SizedAllocator()
+    : d_deallocateCount(0)
+    , d_sizedDeallocateCount(0)
+    , d_lastSize(0)
+    {
+    }
+
+    ~my_SizedAllocator() { }
+
+    void *allocate(size_type) { return d_storage; }
+
+    void deallocate(void *) { ++d_deallocateCount; }
+
+    void deallocateSized(void *, size_type size)
+    {
+        ++d_sizedDeallocateCount;
+        d_lastSize = size;
+    }
+
+    int deallocateCount() const { return d_deallocateCount; }
+        // Return number of times 'deallocate' called.
+
+    int sizedDeallocateCount() const { return d_sizedDeallocateCount; }
+        // Return number of times 'deallocateSized' called.
+
+    size_type lastSize() const { return d_lastSize; }
+        // Return the size passed to the last 'deallocateSized' call.
+};
+
+class my_LimitedAllocator : public bslma::Allocator {
+    // Test class used to verify that the default 'allocateBatch' returns the
+    // blocks it obtained if a subsequent allocation fails.  Each block is
+    // obtained from global 'operator new', and 'allocate' throws
+    // 'std::bad_alloc' once a configurable number of blocks is outstanding.
+
+    int       d_numOutstanding;       // number of blocks not yet deallocated
+
+    int       d_limit;                // maximum number of outstanding blocks
+
+    int       d_deallocateCount;      // number of 'deallocate' calls
+
+  public:
+    explicit my_LimitedAllocator(int limit)
+    : d_numOutstanding(0)
+    , d_limit(limit)
+    , d_deallocateCount(0)
+    {
+    }
+
+    ~my_LimitedAllocator() { }
+
+    void *allocate(size_type size)
+    {
+        if (d_numOutstanding == d_limit) {
+#ifdef BDE_BUILD_TARGET_EXC
+            throw std::bad_alloc();
+#else
+            abort();
+#endif
+        }
+        ++d_numOutstanding;
+        return operator new(size ? size : 1);
+    }
+
+    void deallocate(void *address)
+    {
+        ++d_deallocateCount;
+        if (address) {
+            --d_numOutstanding;
+            operator delete(address);
+        }
+    }
+
+    int numOutstanding() const { return d_numOutstanding; }
+        // Return the number of blocks not yet deallocated.
+
+    int deallocateCount() const { return d_deallocateCount; }
+        // Return number of times 'deallocate' called.
+};
+
 class my_NewDeleteAllocator : public bslma::Allocator {
     // Test class used to verify examples.
 
@@ -425,7 +530,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -479,6 +584,377 @@ int main(int argc, char *argv[])
             deleteMyType(&a, t);
         }
 
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // IN-PLACE EXPANSION TEST:
+        //   We want to make sure that the default implementation of
+        //   'tryExpand' declines to expand and leaves the block untouched.
+        //
+        // Plan:
+        //   Call 'tryExpand' through a base-class reference on an allocator
+        //   that does not override it, for a number of sizes, and verify that
+        //   'false' is returned, that no allocation or deallocation took
+        //   place, and that the contents of the block are unchanged.  Finally,
+        //   verify that, in appropriate build modes, defensive checks are
+        //   triggered for invalid arguments.
+        //
+        // Testing:
+        //   virtual bool tryExpand(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nIN-PLACE EXPANSION TEST"
+                            "\n=======================\n");
+
+        if (verbose) printf("\nTesting default implementation.\n");
+        {
+            my_SizedAllocator myA;  bslma::Allocator& a = myA;
+
+            char *block = static_cast<char *>(a.allocate(16));
+            memset(block, 'x', 16);
+
+            ASSERT(!a.tryExpand(block, 16, 16));
+            ASSERT(!a.tryExpand(block, 16, 17));
+            ASSERT(!a.tryExpand(block, 16, 1024));
+
+            for (int i = 0; i < 16; ++i) {
+                ASSERTV(i, 'x' == block[i]);
+            }
+
+            ASSERT(0 == myA.deallocateCount());
+            ASSERT(0 == myA.sizedDeallocateCount());
+
+            a.deallocateSized(block, 16);
+            ASSERT(1  == myA.sizedDeallocateCount());
+            ASSERT(16 == myA.lastSize());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            my_SizedAllocator myA;  bslma::Allocator& a = myA;
+
+            void *block = a.allocate(8);
+
+            ASSERT_PASS(a.tryExpand(block, 8, 8));
+            ASSERT_FAIL(a.tryExpand(0,     8, 8));
+            ASSERT_FAIL(a.tryExpand(block, 0, 8));
+            ASSERT_FAIL(a.tryExpand(block, 8, 7));
+
+            a.deallocateSized(block, 8);
+        }
+
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BATCH ALLOCATION TEST:
+        //   We want to make sure that the default implementations of
+        //   'allocateBatch' and 'deallocateBatch' forward to 'allocate' and
+        //   'deallocate', and that 'allocateBatch' returns every block it
+        //   obtained if an allocation fails.
+        //
+        // Plan:
+        //   Call 'allocateBatch' and 'deallocateBatch' through a base-class
+        //   reference on an allocator that overrides only 'allocate' and
+        //   'deallocate', for a number of batch sizes, and verify the
+        //   addresses loaded, the number of blocks outstanding, and the
+        //   number of 'deallocate' calls.  Verify that 'deallocateSized' is
+        //   not called by 'deallocateBatch' even if overridden.  Verify that a
+        //   'deallocateBatch' of size 0 does not call 'deallocate'.  Then,
+        //   using an allocator that throws once a limit on the number of
+        //   outstanding blocks is reached, verify (in exception-enabled
+        //   builds) that a failed 'allocateBatch' leaves no block
+        //   outstanding.  Finally, verify that, in appropriate build modes,
+        //   defensive checks are triggered for invalid arguments.
+        //
+        // Testing:
+        //   virtual void allocateBatch(void **, size_type, size_type);
+        //   virtual void deallocateBatch(void *const *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBATCH ALLOCATION TEST"
+                            "\n=====================\n");
+
+        enum { k_MAX_BATCH = 8 };
+
+        if (verbose) printf("\nTesting default implementation.\n");
+        {
+            for (int n = 0; n <= k_MAX_BATCH; ++n) {
+                my_LimitedAllocator myA(k_MAX_BATCH);
+                bslma::Allocator&   a = myA;
+
+                void *blocks[k_MAX_BATCH];
+                memset(blocks, 0, sizeof blocks);
+
+                a.allocateBatch(blocks, n, 24);
+                ASSERTV(n, n == myA.numOutstanding());
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, blocks[i]);
+                    for (int j = 0; j < i; ++j) {
+                        ASSERTV(n, i, j, blocks[i] != blocks[j]);
+                    }
+                    memset(blocks[i], 0xa5, 24);
+                }
+
+                a.deallocateBatch(blocks, n, 24);
+                ASSERTV(n, 0 == myA.numOutstanding());
+                ASSERTV(n, n == myA.deallocateCount());
+            }
+
+            my_SizedAllocator myA;  bslma::Allocator& a = myA;
+
+            void *blocks[3] = { 0, 0, 0 };
+            a.allocateBatch(blocks, 3, 16);
+            a.deallocateBatch(blocks, 3, 16);
+            ASSERT(3 == myA.deallocateCount());
+            ASSERT(0 == myA.sizedDeallocateCount());
+
+            a.deallocateBatch(blocks, 3, 0);
+            ASSERT(3 == myA.deallocateCount());
+            ASSERT(0 == myA.sizedDeallocateCount());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\nTesting failed allocation.\n");
+        {
+            for (int limit = 0; limit < k_MAX_BATCH; ++limit) {
+                my_LimitedAllocator myA(limit);
+                bslma::Allocator&   a = myA;
+
+                void *blocks[k_MAX_BATCH];
+
+                bool caught = false;
+                try {
+                    a.allocateBatch(blocks, k_MAX_BATCH, 8);
+                }
+                catch (const std::bad_alloc&) {
+                    caught = true;
+                }
+                ASSERTV(limit, caught);
+                ASSERTV(limit, 0     == myA.numOutstanding());
+                ASSERTV(limit, limit == myA.deallocateCount());
+            }
+        }
+#endif
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            my_SizedAllocator myA;  bslma::Allocator& a = myA;
+
+            void *blocks[1];
+
+            ASSERT_PASS(a.allocateBatch(blocks, 1, 8));
+            ASSERT_PASS(a.allocateBatch(0, 0, 8));
+            ASSERT_FAIL(a.allocateBatch(0, 1, 8));
+
+            ASSERT_PASS(a.deallocateBatch(blocks, 1, 8));
+            ASSERT_PASS(a.deallocateBatch(0, 0, 8));
+            ASSERT_FAIL(a.deallocateBatch(0, 1, 8));
+        }
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'allocateAligned' TEST:
+        //   We want to make sure that the default implementation of
+        //   'allocateAligned' obtains a naturally aligned block from
+        //   'allocate' for alignments not exceeding the maximal alignment,
+        //   and reports failure for larger alignments.
+        //
+        // Plan:
+        //   Call 'allocateAligned' through a base-class reference on an
+        //   allocator that overrides only 'allocate', and verify
+        //   that the size forwarded is rounded up to a multiple of the
+        //   requested alignment.  Verify that a request for an alignment
+        //   greater than 'BSLS_MAX_ALIGNMENT' throws 'std::bad_alloc' in
+        //   exception-enabled builds.  Finally, verify that, in appropriate
+        //   build modes, defensive checks are triggered for alignments that
+        //   are not positive powers of two.
+        //
+        // Testing:
+        //   virtual void *allocateAligned(size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'allocateAligned' TEST"
+                            "\n======================\n");
+
+        typedef bslma::Allocator::size_type size_type;
+
+        enum { MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+        if (verbose) printf("\nTesting default implementation.\n");
+        {
+            static const struct {
+                int       d_line;       // source line number
+                size_type d_size;       // requested size
+                size_type d_alignment;  // requested alignment
+                size_type d_expSize;    // size forwarded to 'allocate'
+            } DATA[] = {
+                //LINE  SIZE  ALIGN       EXPSIZE
+                //----  ----  ---------   -------
+                { L_,      1,         1,        1 },
+                { L_,      3,         1,        3 },
+                { L_,      1,         2,        2 },
+                { L_,      3,         2,        4 },
+                { L_,      4,         4,        4 },
+                { L_,      5,         4,        8 },
+                { L_,     10,         8,       16 },
+                { L_,     17, MAX_ALIGN,
+                             (17 + MAX_ALIGN - 1) & ~(MAX_ALIGN - 1) },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE    = DATA[ti].d_line;
+                const size_type SIZE    = DATA[ti].d_size;
+                const size_type ALIGN   = DATA[ti].d_alignment;
+                const size_type EXPSIZE = DATA[ti].d_expSize;
+
+                my_Allocator myA;  bslma::Allocator& a = myA;
+
+                ASSERTV(LINE, &myA == a.allocateAligned(SIZE, ALIGN));
+                ASSERTV(LINE, 1       == myA.fun());
+                ASSERTV(LINE, 1       == myA.allocateCount());
+                ASSERTV(LINE, EXPSIZE == myA.arg());
+            }
+
+            my_Allocator myA;  bslma::Allocator& a = myA;
+
+            a.allocateAligned(0, 8);
+            ASSERT(1 == myA.allocateCount());
+            ASSERT(0 == myA.arg());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\nTesting unsupported alignment.\n");
+        {
+            my_Allocator myA;  bslma::Allocator& a = myA;
+
+            bool caught = false;
+            try {
+                a.allocateAligned(8, 2 * MAX_ALIGN);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == myA.allocateCount());
+        }
+#endif
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            my_Allocator myA;  bslma::Allocator& a = myA;
+
+            ASSERT_PASS(a.allocateAligned(8, 8));
+            ASSERT_FAIL(a.allocateAligned(8, 0));
+            ASSERT_FAIL(a.allocateAligned(8, 3));
+            ASSERT_FAIL(a.allocateAligned(8, 6));
+        }
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'deallocateSized' TEST:
+        //   We want to make sure that 'deallocateSized' forwards to
+        //   'deallocate' unless overridden, that 'deleteObject' and
+        //   'deleteObjectRaw' (which know only the protocol) call
+        //   'deallocate', and that 'bslma::DeleterHelper' calls
+        //   'deallocateSized' with the size of non-polymorphic objects only
+        //   for a concrete allocator type that overrides it.
+        //
+        // Plan:
+        //   Call 'deallocateSized' through a base-class reference on an
+        //   allocator that overrides only 'deallocate', and verify that
+        //   'deallocate' was invoked.  Then, using an allocator that
+        //   overrides both methods, verify that 'deallocateSized' receives
+        //   the supplied size, that 'deleteObject' and 'deleteObjectRaw'
+        //   call 'deallocate', and that 'bslma::DeleterHelper' called with
+        //   the concrete allocator type calls 'deallocateSized' with
+        //   'sizeof(TYPE)' for a non-polymorphic type, and 'deallocate' for a
+        //   polymorphic type.  Finally, verify that 'bslma::DeleterHelper'
+        //   does not detect the (forwarding) 'deallocateSized' declared by
+        //   'bslma::Allocator' itself.
+        //
+        // Testing:
+        //   virtual void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'deallocateSized' TEST"
+                            "\n======================\n");
+
+        if (verbose) printf("\nTesting default implementation.\n");
+        {
+            my_Allocator myA;  bslma::Allocator& a = myA;
+
+            void *p = a.allocate(8);
+            ASSERT(0 == myA.deallocateCount());
+            a.deallocateSized(p, 8);
+            ASSERT(2 == myA.fun());
+            ASSERT(1 == myA.deallocateCount());
+        }
+
+        if (verbose) printf("\nTesting overridden implementation.\n");
+        {
+            my_SizedAllocator myA;  bslma::Allocator& a = myA;
+
+            void *p = a.allocate(24);
+            a.deallocateSized(p, 24);
+            ASSERT(0  == myA.deallocateCount());
+            ASSERT(1  == myA.sizedDeallocateCount());
+            ASSERT(24 == myA.lastSize());
+
+            my_Class1 *pC1 = new(a.allocate(sizeof(my_Class1))) my_Class1;
+            a.deleteObject(pC1);
+            ASSERT(1 == myA.deallocateCount());
+            ASSERT(1 == myA.sizedDeallocateCount());
+
+            pC1 = new(a.allocate(sizeof(my_Class1))) my_Class1;
+            a.deleteObjectRaw(pC1);
+            ASSERT(2 == myA.deallocateCount());
+            ASSERT(1 == myA.sizedDeallocateCount());
+
+            pC1 = new(a.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObject(pC1, &myA);
+            ASSERT(2 == myA.deallocateCount());
+            ASSERT(2 == myA.sizedDeallocateCount());
+            ASSERT(sizeof(my_Class1) == myA.lastSize());
+
+            pC1 = new(a.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObjectRaw(pC1, &myA);
+            ASSERT(2 == myA.deallocateCount());
+            ASSERT(3 == myA.sizedDeallocateCount());
+            ASSERT(sizeof(my_Class1) == myA.lastSize());
+
+            my_Class2 *pC2 = new(a.allocate(sizeof(my_Class2))) my_Class2;
+            bslma::DeleterHelper::deleteObject(pC2, &myA);
+            ASSERT(3 == myA.deallocateCount());
+            ASSERT(3 == myA.sizedDeallocateCount());
+
+            bslma::DeleterHelper::deleteObject((my_Class1 *)0, &myA);
+            ASSERT(3 == myA.deallocateCount());
+            ASSERT(3 == myA.sizedDeallocateCount());
+        }
+
+        if (verbose) printf("\nTesting detection.\n");
+        {
+            ASSERT(1 == bslma::DeleterHelper_HasSizedDeallocate<
+                                                   my_SizedAllocator>::value);
+            ASSERT(0 == bslma::DeleterHelper_HasSizedDeallocate<
+                                                        my_Allocator>::value);
+            ASSERT(0 == bslma::DeleterHelper_HasSizedDeallocate<
+                                                    bslma::Allocator>::value);
+        }
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
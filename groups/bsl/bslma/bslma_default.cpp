@@ -6,6 +6,13 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bslma_allocator.h>            // for testing only
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define BSLMA_DEFAULT_THREAD_LOCAL __declspec(thread)
+#else
+#define BSLMA_DEFAULT_THREAD_LOCAL __thread
+#endif
 
 namespace BloombergLP {
 
@@ -13,6 +20,14 @@ namespace bslma {
 
 class Allocator;
 
+namespace {
+
+static BSLMA_DEFAULT_THREAD_LOCAL Allocator *t_threadAllocator_p = 0;
+    // thread default allocator of the calling thread, or 0 if none is
+    // installed
+
+}  // close unnamed namespace
+
                                // --------------
                                // struct Default
                                // --------------
@@ -28,6 +43,10 @@ bsls::AtomicOperations::AtomicTypes::Int     Default::s_locked    = {0};
 
 bsls::AtomicOperations::AtomicTypes::Pointer Default::s_globalAllocator = {0};
 
+                        // *** thread default allocator ***
+
+bsls::AtomicOperations::AtomicTypes::Int Default::s_numThreadAllocators = {0};
+
 // CLASS METHODS
 
                         // *** default allocator ***
@@ -51,6 +70,32 @@ void Default::setDefaultAllocatorRaw(Allocator *basicAllocator)
     bsls::AtomicOperations::setPtrRelease(&s_allocator, basicAllocator);
 }
 
+                        // *** thread default allocator ***
+
+Allocator *Default::setThreadDefaultAllocator(Allocator *basicAllocator)
+{
+    Allocator *previous = t_threadAllocator_p;
+    t_threadAllocator_p = basicAllocator;
+
+    // Keep count of the threads having a thread default allocator installed.
+    // The calling thread observes its own update of the count, which is all
+    // that 'defaultAllocator' needs to find the allocator just installed.
+
+    if (!previous && basicAllocator) {
+        bsls::AtomicOperations::addIntRelaxed(&s_numThreadAllocators, 1);
+    }
+    else if (previous && !basicAllocator) {
+        bsls::AtomicOperations::addIntRelaxed(&s_numThreadAllocators, -1);
+    }
+
+    return previous;
+}
+
+Allocator *Default::threadDefaultAllocator()
+{
+    return t_threadAllocator_p;
+}
+
                         // *** global allocator ***
 
 Allocator *Default::setGlobalAllocator(Allocator *basicAllocator)
@@ -100,6 +100,39 @@ BSLS_IDENT("$Id: $")
 // at most once.  If called, it should be invoked in 'main' before starting any
 // threads and before initializing singletons.
 //
+///Thread Default Allocator
+///------------------------
+// In addition to the process-wide default allocator, each thread has a
+// *thread* *default* *allocator*, which is initially 0 (i.e., not installed).
+// While a thread default allocator is installed in a thread,
+// 'bslma::Default::defaultAllocator' (and hence 'bslma::Default::allocator'
+// with no argument or an explicit 0) called from that thread returns it
+// instead of the process-wide default allocator, which is neither consulted
+// nor locked by such calls.  Calls made from other threads are unaffected.
+//
+// The thread default allocator is set using
+// 'bslma::Default::setThreadDefaultAllocator', which returns the allocator
+// previously installed in the calling thread (or 0), and can be inspected
+// using 'bslma::Default::threadDefaultAllocator'.  Unlike the process-wide
+// default allocator, the thread default allocator is never locked.  It allows
+// a worker thread to route the allocations of objects created without an
+// explicit allocator (e.g., temporary strings and vectors) to an allocator
+// owned by that thread, such as an unsynchronized multipool or arena, without
+// supplying that allocator to every constructor.  Note that objects retain
+// the allocator with which they were created, so the installed allocator must
+// outlive every object created in that thread while it was installed, and
+// such objects must not be handed to other threads unless that allocator can
+// be used from them.  'bslma::ThreadDefaultAllocatorGuard' provides scoped
+// installation of a thread default allocator.
+//
+// The thread default allocators are held in thread-local storage private to
+// this component, and 'bslma::Default::defaultAllocator' looks up that of the
+// calling thread only while some thread of the process has one installed, so
+// that a process not using thread default allocators pays nothing for them.
+// A thread that installed a thread default allocator should uninstall it
+// before exiting, so that the lookup can again be skipped once no thread has
+// one installed.
+//
 ///Usage
 ///-----
 // The following sequence of usage examples illustrate recommended use of the
@@ -672,6 +705,11 @@ struct Default {
     static bsls::AtomicOperations::AtomicTypes::Pointer s_globalAllocator;
                                                   // the global allocator
 
+    static bsls::AtomicOperations::AtomicTypes::Int     s_numThreadAllocators;
+                                                  // number of threads having
+                                                  // a thread default
+                                                  // allocator installed
+
   public:
     // CLASS METHODS
 
@@ -710,19 +748,36 @@ struct Default {
         // disabled by this method.
 
     static Allocator *defaultAllocator();
-        // Return the address of the default allocator and disable all
-        // subsequent calls to the 'setDefaultAllocator' method.  Note that
-        // prior to the first call to 'setDefaultAllocator' or
-        // 'setDefaultAllocatorRaw' methods, the address of the default
-        // allocator is that of the 'NewDeleteAllocator' singleton.  Also note
-        // that subsequent calls to 'setDefaultAllocatorRaw' method are *not*
-        // disabled by this method.
+        // Return the address of the thread default allocator of the calling
+        // thread if one is installed; otherwise, return the address of the
+        // default allocator and disable all subsequent calls to the
+        // 'setDefaultAllocator' method.  Note that prior to the first call to
+        // 'setDefaultAllocator' or 'setDefaultAllocatorRaw' methods, the
+        // address of the default allocator is that of the
+        // 'NewDeleteAllocator' singleton.  Also note that subsequent calls to
+        // 'setDefaultAllocatorRaw' method are *not* disabled by this method.
 
     static Allocator *allocator(Allocator *basicAllocator = 0);
-        // Return the allocator returned by 'defaultAllocator' and disable all
-        // subsequent calls to the 'setDefaultAllocator' method if the
-        // optionally-specified 'basicAllocator' is 0; return 'basicAllocator'
-        // otherwise.
+        // Return the allocator returned by 'defaultAllocator' (with its side
+        // effects) if the optionally-specified 'basicAllocator' is 0; return
+        // 'basicAllocator' otherwise.
+
+                        // *** thread default allocator ***
+
+    static Allocator *setThreadDefaultAllocator(Allocator *basicAllocator);
+        // Install the specified 'basicAllocator' as the thread default
+        // allocator of the calling thread, or uninstall the thread default
+        // allocator if 'basicAllocator' is 0, and return the thread default
+        // allocator that was installed in the calling thread immediately
+        // before calling this method (or 0 if none was).  The behavior is
+        // undefined unless 'basicAllocator' is 0 or is the address of an
+        // allocator that outlives every object created in the calling thread
+        // using the default allocator while it is installed.
+
+    static Allocator *threadDefaultAllocator();
+        // Return the address of the thread default allocator of the calling
+        // thread, or 0 if none is installed.  This method has no
+        // side-effects.
 
                         // *** global allocator ***
 
@@ -771,6 +826,17 @@ void Default::lockDefaultAllocator()
 inline
 Allocator *Default::defaultAllocator()
 {
+    // The thread default allocator (which is held in thread-local storage) is
+    // looked up only if some thread has one installed, so that processes not
+    // using thread default allocators do not pay for the lookup.
+
+    if (bsls::AtomicOperations::getIntRelaxed(&s_numThreadAllocators)) {
+        Allocator *threadAllocator = threadDefaultAllocator();
+        if (threadAllocator) {
+            return threadAllocator;                                   // RETURN
+        }
+    }
+
     if (!bsls::AtomicOperations::getPtrAcquire(&s_allocator)) {
         setDefaultAllocatorRaw(&NewDeleteAllocator::singleton());
     }
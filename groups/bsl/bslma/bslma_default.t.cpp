@@ -45,12 +45,14 @@ using namespace BloombergLP;
 // [ 4] bslma::Allocator *allocator(*ba = 0);
 // [ 9] bslma::Allocator *globalAllocator(*ba = 0);
 // [ 9] bslma::Allocator *setGlobalAllocator(*ba);
+// [10] bslma::Allocator *setThreadDefaultAllocator(*ba);
+// [10] bslma::Allocator *threadDefaultAllocator();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BOOTSTRAP TEST
-// [10] USAGE EXAMPLE 1
-// [11] USAGE EXAMPLE 2
-// [12] USAGE EXAMPLE 3
+// [11] USAGE EXAMPLE 1
+// [12] USAGE EXAMPLE 2
+// [13] USAGE EXAMPLE 3
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -507,7 +509,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3
         //
@@ -563,7 +565,7 @@ int main(int argc, char *argv[])
 //..
 
       } break;
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -655,7 +657,7 @@ int main(int argc, char *argv[])
 // invocations (i.e., even with correct code).
 
       } break;
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -729,6 +731,90 @@ int main(int argc, char *argv[])
     ASSERT(1 == defaultCountingAllocator.numBlocksTotal());
 //..
 
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD DEFAULT ALLOCATOR
+        //
+        // Concerns:
+        //   1) Initially, no thread default allocator is installed.
+        //   2) 'setThreadDefaultAllocator' unconditionally sets the thread
+        //      default allocator of the calling thread and returns the one
+        //      that was in effect prior to the call (or 0).
+        //   3) While a thread default allocator is installed,
+        //      'defaultAllocator', and 'allocator' called with no argument
+        //      or 0, return it; 'allocator' called with a non-zero argument
+        //      returns that argument.
+        //   4) While a thread default allocator is installed, the default
+        //      allocator is neither changed nor locked by calls to
+        //      'defaultAllocator' or 'allocator'.
+        //   5) Uninstalling the thread default allocator (by setting it to 0)
+        //      reverts to the default allocator, with the usual side-effects.
+        //   6) Replacing an installed thread default allocator, or
+        //      uninstalling one when none is installed, does not prevent a
+        //      thread default allocator installed later from being used.
+        //
+        // Plan:
+        //   Call 'threadDefaultAllocator' in the first substantive line of
+        //   the test case to verify that no thread default allocator is
+        //   installed.  Install and replace thread default allocators, and
+        //   assert the values returned by each method.  Verify that
+        //   'setDefaultAllocator' succeeds after 'defaultAllocator' and
+        //   'allocator' were called while a thread default allocator was
+        //   installed, and fails once the thread default allocator is
+        //   uninstalled and 'defaultAllocator' is called.  Finally, install
+        //   a thread default allocator again after uninstalling twice, and
+        //   verify that it is used until it is uninstalled.
+        //
+        // Testing:
+        //   bslma::Allocator *setThreadDefaultAllocator(*ba);
+        //   bslma::Allocator *threadDefaultAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING THREAD DEFAULT ALLOCATOR"
+                            "\n================================\n");
+
+        ASSERT(0 == Obj::threadDefaultAllocator());
+
+        ASSERT(0 == Obj::setThreadDefaultAllocator(U));
+        ASSERT(U == Obj::threadDefaultAllocator());
+        ASSERT(U == Obj::defaultAllocator());
+        ASSERT(U == Obj::allocator());
+        ASSERT(U == Obj::allocator(0));
+        ASSERT(V == Obj::allocator(V));
+
+        ASSERT(U == Obj::setThreadDefaultAllocator(V));
+        ASSERT(V == Obj::threadDefaultAllocator());
+        ASSERT(V == Obj::defaultAllocator());
+        ASSERT(V == Obj::allocator());
+        ASSERT(U == Obj::allocator(U));
+
+        // The default allocator is not locked.
+
+        ASSERT(0 == Obj::setDefaultAllocator(U));
+        ASSERT(V == Obj::defaultAllocator());
+
+        ASSERT(V == Obj::setThreadDefaultAllocator(0));
+        ASSERT(0 == Obj::threadDefaultAllocator());
+        ASSERT(U == Obj::defaultAllocator());
+        ASSERT(U == Obj::allocator());
+
+        // The default allocator is now locked.
+
+        ASSERT(0 != Obj::setDefaultAllocator(V));
+        ASSERT(U == Obj::defaultAllocator());
+
+        ASSERT(0 == Obj::setThreadDefaultAllocator(0));
+        ASSERT(0 == Obj::threadDefaultAllocator());
+        ASSERT(U == Obj::defaultAllocator());
+
+        ASSERT(0 == Obj::setThreadDefaultAllocator(V));
+        ASSERT(V == Obj::defaultAllocator());
+        ASSERT(V == Obj::allocator(0));
+
+        ASSERT(V == Obj::setThreadDefaultAllocator(0));
+        ASSERT(U == Obj::defaultAllocator());
+
       } break;
       case 9: {
         // --------------------------------------------------------------------
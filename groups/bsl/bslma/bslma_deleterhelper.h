@@ -27,6 +27,19 @@ BSLS_IDENT("$Id: $")
 // 'bsl::is_polymorphic'.  See the 'bslmf_ispolymporphic' component for more
 // details.
 //
+///Sized Deallocation
+///------------------
+// When 'TYPE' is not polymorphic, the size of the object's memory footprint
+// is known to be 'sizeof(TYPE)'.  In that case, if 'ALLOCATOR' itself
+// declares a member function 'deallocateSized(void *, bsls::Types::size_type)'
+// (as does 'bdlma::SlabAllocator'), the functions in this component return
+// the footprint by calling that function with 'sizeof(TYPE)'.  Otherwise, the
+// single-argument 'deallocate' is called.  Note that a 'deallocateSized'
+// merely inherited by 'ALLOCATOR' (e.g., from 'bslma::Allocator', whose
+// default implementation forwards to 'deallocate') is not used, so an
+// allocator that does not opt in to sized deallocation by overriding
+// 'deallocateSized' incurs no additional call.
+//
 ///Usage
 ///-----
 // The following 'my_RawDeleterGuard' class defines a guard that
@@ -88,6 +101,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_ispolymorphic.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -96,10 +113,16 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 namespace BloombergLP {
 
 namespace bslma {
 
+class Allocator;
+
              // =================================
              // local struct DeleterHelper_Helper
              // =================================
@@ -122,6 +145,75 @@ struct DeleterHelper_Helper<1> {
     }
 };
 
+             // ==============================================
+             // local struct DeleterHelper_HasSizedDeallocate
+             // ==============================================
+
+template <class ALLOCATOR>
+struct DeleterHelper_HasSizedDeallocate {
+    // This 'struct' template provides an enumerator, 'value', that is
+    // non-zero if the (template parameter) 'ALLOCATOR' type itself (i.e., not
+    // a base class of 'ALLOCATOR') declares a member function
+    // 'deallocateSized(void *, bsls::Types::size_type)', and 0 otherwise.
+    // Note that the value is 0 for 'bslma::Allocator', whose
+    // 'deallocateSized' merely forwards to 'deallocate'.
+
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+
+    struct NoType {
+        char d_padding[2];
+    };
+
+    template <class TYPE, void (TYPE::*)(void *, bsls::Types::size_type)>
+    struct Match {
+        // Note that no conversion is applied to a pointer-to-member template
+        // argument, so '&TYPE::deallocateSized' matches only if the member
+        // is declared by 'TYPE' itself.
+    };
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static YesType match(Match<TYPE, &TYPE::deallocateSized> *);
+    template <class TYPE>
+    static NoType match(...);
+        // Declared but not defined.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        value = sizeof(match<ALLOCATOR>(0)) == sizeof(YesType)
+             && !bsl::is_same<ALLOCATOR, Allocator>::value
+    };
+};
+
+             // =======================================
+             // local struct DeleterHelper_Deallocator
+             // =======================================
+
+template <int IS_SIZED>
+struct DeleterHelper_Deallocator {
+    template <class ALLOCATOR>
+    static void deallocate(ALLOCATOR              *allocator,
+                           void                   *address,
+                           bsls::Types::size_type)
+    {
+        allocator->deallocate(address);
+    }
+};
+
+template <>
+struct DeleterHelper_Deallocator<1> {
+    template <class ALLOCATOR>
+    static void deallocate(ALLOCATOR              *allocator,
+                           void                   *address,
+                           bsls::Types::size_type  size)
+    {
+        allocator->deallocateSized(address, size);
+    }
+};
+
                            // ====================
                            // struct DeleterHelper
                            // ====================
@@ -140,7 +232,9 @@ struct DeleterHelper {
         // appropriately to 'void *', was allocated using 'allocator' and has
         // not already been deallocated.  Note that
         // 'dynamic_cast<void *>(object)' is applied if 'TYPE' is polymorphic,
-        // and 'static_cast<void *>(object)' is applied otherwise.
+        // and 'static_cast<void *>(object)' is applied otherwise.  Also note
+        // that if 'TYPE' is not polymorphic and 'ALLOCATOR' declares
+        // 'deallocateSized', that method is called with 'sizeof(TYPE)'.
 
     template <class TYPE, class ALLOCATOR>
     static void deleteObjectRaw(const TYPE *object, ALLOCATOR *allocator);
@@ -150,7 +244,9 @@ struct DeleterHelper {
         // 'allocator' is non-null, 'object' is !not! a secondary base class
         // pointer (i.e., the address is (numerically) the same as when it was
         // originally dispensed by 'allocator'), and 'object' was allocated
-        // using 'allocator' and has not already been deallocated.
+        // using 'allocator' and has not already been deallocated.  Note that
+        // if 'TYPE' is not polymorphic and 'ALLOCATOR' declares
+        // 'deallocateSized', that method is called with 'sizeof(TYPE)'.
 };
 
 // ============================================================================
@@ -180,7 +276,12 @@ void DeleterHelper::deleteObject(const TYPE *object,
         const_cast<TYPE *>(object)->~TYPE();
 #endif
 
-        allocator->deallocate(address);
+        DeleterHelper_Deallocator<
+                      DeleterHelper_HasSizedDeallocate<ALLOCATOR>::value
+                   && !bsl::is_polymorphic<TYPE>::value>::deallocate(
+                                                                 allocator,
+                                                                 address,
+                                                                 sizeof(TYPE));
     }
 }
 
@@ -200,7 +301,12 @@ void DeleterHelper::deleteObjectRaw(const TYPE *object,
         const_cast<TYPE *>(object)->~TYPE();
 #endif
 
-        allocator->deallocate(address);
+        DeleterHelper_Deallocator<
+                      DeleterHelper_HasSizedDeallocate<ALLOCATOR>::value
+                   && !bsl::is_polymorphic<TYPE>::value>::deallocate(
+                                                                 allocator,
+                                                                 address,
+                                                                 sizeof(TYPE));
     }
 }
 
@@ -28,7 +28,8 @@ using namespace BloombergLP;
 // [2] template <TYPE, ALLOC> deleteObject(const TYPE *, ALLOC *);
 // [1] template <TYPE, ALLOC> deleteObjectRaw(const TYPE *, ALLOC *);
 //-----------------------------------------------------------------------------
-// [3] USAGE EXAMPLE
+// [3] SIZED DEALLOCATION
+// [4] USAGE EXAMPLE
 //=============================================================================
 
 //=============================================================================
@@ -121,6 +122,44 @@ class my_NewDeleteAllocator {
     int getCount() const            { return d_count; }
 };
 
+class my_SizedPool {
+    // Test class that provides both 'deallocate' and 'deallocateSized'
+    // methods, and records which was called.
+
+    typedef bsls::Types::size_type size_type;
+
+    int       d_numUnsized;  // number of 'deallocate' calls
+    int       d_numSized;    // number of 'deallocateSized' calls
+    size_type d_lastSize;    // last size passed to 'deallocateSized'
+
+  public:
+    my_SizedPool() : d_numUnsized(0), d_numSized(0), d_lastSize(0) { }
+
+    void *allocate(unsigned size) { return operator new(size); }
+
+    void deallocate(void *address)
+    {
+        ++d_numUnsized;
+        operator delete(address);
+    }
+
+    void deallocateSized(void *address, size_type size)
+    {
+        ++d_numSized;
+        d_lastSize = size;
+        operator delete(address);
+    }
+
+    int numUnsized() const { return d_numUnsized; }
+    int numSized() const { return d_numSized; }
+    size_type lastSize() const { return d_lastSize; }
+};
+
+class my_DerivedSizedPool : public my_SizedPool {
+    // Test class that inherits, but does not itself declare,
+    // 'deallocateSized'.
+};
+
 static int globalObjectStatus = 0;  // global flag set by test-object d'tors
 static int class3ObjectCount  = 0;  // count set by 'my_Class3' c'tor/d'tor
 
@@ -257,7 +296,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TEST
         //
@@ -279,6 +318,95 @@ int main(int argc, char *argv[])
         // The Usage example from the component header file is replicated
         // above.
 
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SIZED DEALLOCATION TEST:
+        //   We want to make sure that the 'deallocateSized' method of an
+        //   allocator that declares one is called with the size of a
+        //   non-polymorphic object, and that 'deallocate' is called
+        //   otherwise, including when 'deallocateSized' is merely inherited.
+        //
+        // Plan:
+        //   Using a pool declaring 'deallocateSized', delete objects of
+        //   non-polymorphic and polymorphic type with both 'deleteObject' and
+        //   'deleteObjectRaw', and verify which method was called and the
+        //   size passed.  Repeat with a pool that inherits
+        //   'deallocateSized', and verify that 'deallocate' is called.
+        //   Verify that an allocator having only 'deallocate'
+        //   ('my_NewDeleteAllocator') is still supported.
+        //
+        // Testing:
+        //   SIZED DEALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSIZED DEALLOCATION TEST"
+                            "\n=======================\n");
+
+        ASSERT(1 == bslma::DeleterHelper_HasSizedDeallocate<
+                                                        my_SizedPool>::value);
+        ASSERT(0 == bslma::DeleterHelper_HasSizedDeallocate<
+                                                 my_DerivedSizedPool>::value);
+        ASSERT(0 == bslma::DeleterHelper_HasSizedDeallocate<
+                                               my_NewDeleteAllocator>::value);
+
+        if (verbose) printf("\tWith a sized pool.\n");
+        {
+            my_SizedPool pool;
+
+            my_Class1 *pC1 = new(pool.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObject(pC1, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(1 == pool.numSized());
+            ASSERT(0 == pool.numUnsized());
+            ASSERT(sizeof(my_Class1) == pool.lastSize());
+
+            pC1 = new(pool.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObjectRaw(pC1, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(2 == pool.numSized());
+            ASSERT(0 == pool.numUnsized());
+
+            my_Class2 *pC2 = new(pool.allocate(sizeof(my_Class2))) my_Class2;
+            bslma::DeleterHelper::deleteObject(pC2, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(2 == pool.numSized());
+            ASSERT(1 == pool.numUnsized());
+
+            pC2 = new(pool.allocate(sizeof(my_Class2))) my_Class2;
+            bslma::DeleterHelper::deleteObjectRaw(pC2, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(2 == pool.numSized());
+            ASSERT(2 == pool.numUnsized());
+        }
+
+        if (verbose) printf("\tWith an inherited sized method.\n");
+        {
+            my_DerivedSizedPool pool;
+
+            my_Class1 *pC1 = new(pool.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObject(pC1, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(0 == pool.numSized());
+            ASSERT(1 == pool.numUnsized());
+
+            pC1 = new(pool.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObjectRaw(pC1, &pool);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(0 == pool.numSized());
+            ASSERT(2 == pool.numUnsized());
+        }
+
+        if (verbose) printf("\tWith an unsized allocator.\n");
+        {
+            my_NewDeleteAllocator myA;
+
+            my_Class1 *pC1 = new(myA.allocate(sizeof(my_Class1))) my_Class1;
+            bslma::DeleterHelper::deleteObject(pC1, &myA);
+            ASSERT(0 == globalObjectStatus);
+            ASSERT(2 == myA.getCount());
+        }
+
       } break;
       case 2: {
         // --------------------------------------------------------------------
@@ -0,0 +1,635 @@
+// bslma_staticallocator.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLMA_STATICALLOCATOR
+#define INCLUDED_BSLMA_STATICALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compatible allocator bound to a concrete allocator.
+//
+//@CLASSES:
+//  bslma::StaticAllocator: STL-compatible allocator with static dispatch
+//
+//@SEE_ALSO: bslstl_allocator, bslma_allocator, bslma_usesbslmaallocator
+//
+//@DESCRIPTION: This component provides an STL-compatible allocator template,
+// 'bslma::StaticAllocator', that is parameterized by both the type of object
+// being allocated and a *concrete* allocator type derived from
+// 'bslma::Allocator' (e.g., 'bdlma::MultipoolAllocator' or
+// 'bdlma::SequentialAllocator').  Like 'bsl::allocator', a
+// 'bslma::StaticAllocator' is a proxy holding a pointer to an allocator object
+// that it does not own, and it adheres to the allocator requirements of the
+// C++ standard.  Unlike 'bsl::allocator', which always forwards to the
+// virtual 'allocate' and 'deallocate' methods of the 'bslma::Allocator'
+// protocol, a 'bslma::StaticAllocator' initialized with a pointer to an
+// object of its (template parameter) 'ALLOCATOR' type invokes
+// 'ALLOCATOR::allocate' and 'ALLOCATOR::deallocate' by qualified name,
+// provided that 'ALLOCATOR' is 'final' (see {Final Allocator Types}).  The
+// calls are therefore bound at compile time and, when the concrete allocator
+// defines those methods inline (as the 'bdlma' pool-based allocators do), the
+// allocation fast path of the underlying pool is inlined into the container
+// using it.
+//
+///Interoperation with 'bslma' Allocator Propagation
+///-------------------------------------------------
+// A 'bslma::StaticAllocator' is implicitly convertible from 'bslma::Allocator
+// *' and provides a 'mechanism' accessor returning a 'bslma::Allocator *', so
+// 'bsl' containers (and 'bsl::allocator_traits') treat it as a bslma-style
+// allocator: elements having the 'bslma::UsesBslmaAllocator' trait are
+// supplied the 'mechanism' of the container's allocator when constructed, and
+// a container copy-constructed without an explicit allocator uses the
+// default allocator, exactly as with 'bsl::allocator'.  Elements thus share
+// the container's allocator (i.e., the allocator is *scoped*), although
+// nested containers reach it through the 'bslma::Allocator' protocol unless
+// they, too, are instantiated with a 'bslma::StaticAllocator'.
+//
+// A 'bslma::StaticAllocator' initialized with a 'bslma::Allocator *' (or
+// default-constructed) rather than an 'ALLOCATOR *' forwards to that
+// mechanism through the virtual 'bslma::Allocator' interface.  Two
+// 'bslma::StaticAllocator' objects compare equal if and only if they share
+// the same mechanism, regardless of how they were initialized.
+//
+///Final Allocator Types
+///---------------------
+// Because calls made through an 'ALLOCATOR *' are not virtual, they would
+// bypass the overrides of any class derived from 'ALLOCATOR'.  Calls are
+// therefore bound statically only if 'ALLOCATOR' is declared 'final', so that
+// the dynamic type of the object supplied is known to be 'ALLOCATOR'.  If
+// 'ALLOCATOR' is not 'final' (or if the compiler does not support 'final'),
+// a pointer to an 'ALLOCATOR' is accepted as a 'bslma::Allocator *', and the
+// calls are dispatched virtually, exactly as with 'bsl::allocator'.  To bind
+// to a concrete allocator that is not itself 'final', such as the 'bdlma'
+// allocators, derive a 'final' class from it that overrides nothing, e.g.:
+//..
+//  class FinalMultipoolAllocator final : public bdlma::MultipoolAllocator {
+//    public:
+//      using bdlma::MultipoolAllocator::MultipoolAllocator;
+//  };
+//..
+// The calls are then resolved to the (inline) members inherited from
+// 'bdlma::MultipoolAllocator'.  Also note that memory is returned to an
+// 'ALLOCATOR' using its unsized 'deallocate' method.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Binding Allocation to a Concrete Allocator
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a concrete allocator, 'my_CountingAllocator', whose
+// 'allocate' and 'deallocate' methods are defined inline, and that we want
+// node-based containers to call those methods directly rather than through
+// the virtual 'bslma::Allocator' interface.
+//
+// First, we define the allocator, declaring it 'final' so that calls can be
+// bound to its methods statically:
+//..
+//  class my_CountingAllocator final : public bslma::Allocator {
+//      // This class implements the 'bslma::Allocator' protocol using the
+//      // global operators 'new' and 'delete', counting the number of blocks
+//      // outstanding.
+//
+//      // DATA
+//      int d_numBlocksInUse;  // number of blocks currently allocated
+//
+//    public:
+//      // CREATORS
+//      my_CountingAllocator() : d_numBlocksInUse(0) {}
+//          // Create a counting allocator having no blocks in use.
+//
+//      // MANIPULATORS
+//      virtual void *allocate(size_type size)
+//          // Return a newly allocated block of at least the specified
+//          // 'size' bytes.
+//      {
+//          ++d_numBlocksInUse;
+//          return ::operator new(size);
+//      }
+//
+//      virtual void deallocate(void *address)
+//          // Return the memory block at the specified 'address' to this
+//          // allocator.
+//      {
+//          --d_numBlocksInUse;
+//          ::operator delete(address);
+//      }
+//
+//      // ACCESSORS
+//      int numBlocksInUse() const { return d_numBlocksInUse; }
+//          // Return the number of blocks currently in use.
+//  };
+//..
+// Then, we create a 'bslma::StaticAllocator' bound to an object of that
+// type, and allocate some memory.  The call to 'allocate' is resolved at
+// compile time to 'my_CountingAllocator::allocate':
+//..
+//  my_CountingAllocator countingAllocator;
+//
+//  typedef bslma::StaticAllocator<int, my_CountingAllocator> IntAllocator;
+//
+//  IntAllocator intAllocator(&countingAllocator);
+//
+//  int *p = intAllocator.allocate(4);
+//  assert(1 == countingAllocator.numBlocksInUse());
+//..
+// Next, we rebind the allocator to a different element type, as a node-based
+// container would, and observe that the rebound allocator shares the same
+// concrete allocator:
+//..
+//  typedef IntAllocator::rebind<double>::other DoubleAllocator;
+//
+//  DoubleAllocator doubleAllocator(intAllocator);
+//  assert(intAllocator       == doubleAllocator);
+//  assert(&countingAllocator == doubleAllocator.allocator());
+//
+//  double *q = doubleAllocator.allocate(2);
+//  assert(2 == countingAllocator.numBlocksInUse());
+//..
+// Then, we observe that the allocator exposes the 'bslma::Allocator' that
+// should be passed to elements that use the bslma allocator model:
+//..
+//  assert(&countingAllocator == intAllocator.mechanism());
+//..
+// Finally, we return the memory:
+//..
+//  doubleAllocator.deallocate(q, 2);
+//  intAllocator.deallocate(p, 4);
+//  assert(0 == countingAllocator.numBlocksInUse());
+//..
+// In practice, a 'bslma::StaticAllocator' is used to instantiate a 'bsl'
+// container, e.g.:
+//..
+//  bdlma::MultipoolAllocator multipoolAllocator;
+//
+//  typedef bslma::StaticAllocator<bsl::string, bdlma::MultipoolAllocator>
+//                                                               StringAlloc;
+//
+//  bsl::vector<bsl::string, StringAlloc> strings(&multipoolAllocator);
+//..
+// The vector's array is obtained by calling the inline
+// 'bdlma::MultipoolAllocator::allocate' directly, and each 'bsl::string'
+// element is supplied '&multipoolAllocator' as its allocator.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslma {
+
+                       // ==============================
+                       // struct StaticAllocator_IsFinal
+                       // ==============================
+
+template <class TYPE>
+struct StaticAllocator_IsFinal {
+    // This component-private meta-function has a 'value' of 'true' if the
+    // (template parameter) 'TYPE' is a class declared 'final', and 'false'
+    // otherwise, including on platforms that do not support 'final'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_FINAL)                              \
+ && defined(BSLS_PLATFORM_CMP_MSVC)
+    enum { value = __is_sealed(TYPE) };
+#elif defined(BSLS_COMPILERFEATURES_SUPPORT_FINAL)                            \
+   && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    enum { value = __is_final(TYPE) };
+#else
+    enum { value = false };
+#endif
+};
+
+                           // =====================
+                           // class StaticAllocator
+                           // =====================
+
+template <class TYPE, class ALLOCATOR>
+class StaticAllocator {
+    // An STL-compatible allocator that forwards allocation calls either
+    // directly (i.e., non-virtually) to an object of the (template parameter)
+    // concrete 'ALLOCATOR' type, if 'ALLOCATOR' is 'final', or, if
+    // initialized from a 'bslma::Allocator' pointer, to that object through
+    // the 'bslma::Allocator' protocol.  This class template adheres to the
+    // allocator requirements defined in section 20.1.5
+    // [lib.allocator.requirements] of the C++ standard.  The behavior is
+    // undefined unless 'ALLOCATOR' is derived from 'bslma::Allocator'.
+
+    // DATA
+    ALLOCATOR *d_allocator_p;  // concrete allocator called directly, or 0
+
+    Allocator *d_mechanism_p;  // mechanism for elements and for fallback
+                               // allocation (never null)
+
+    // FRIENDS
+    template <class OTHER_TYPE, class OTHER_ALLOCATOR>
+    friend class StaticAllocator;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StaticAllocator,
+                                   bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(StaticAllocator,
+                                   bslmf::IsBitwiseMoveable);
+
+    // PUBLIC TYPES
+    typedef std::size_t     size_type;
+    typedef std::ptrdiff_t  difference_type;
+    typedef TYPE           *pointer;
+    typedef const TYPE     *const_pointer;
+    typedef TYPE&           reference;
+    typedef const TYPE&     const_reference;
+    typedef TYPE            value_type;
+
+    template <class ANY_TYPE>
+    struct rebind {
+        // This nested 'struct' template, parameterized by 'ANY_TYPE', provides
+        // a namespace for an 'other' type alias, which is an allocator type
+        // bound to the same 'ALLOCATOR' type as this one but that allocates
+        // elements of 'ANY_TYPE'.
+
+        typedef StaticAllocator<ANY_TYPE, ALLOCATOR> other;
+    };
+
+    // CREATORS
+    StaticAllocator();
+        // Create a proxy object that forwards allocation calls to the
+        // currently installed default allocator through the
+        // 'bslma::Allocator' protocol.
+
+    template <class ANY_ALLOCATOR>
+    StaticAllocator(ANY_ALLOCATOR *allocator,
+                    typename bsl::enable_if<
+                              StaticAllocator_IsFinal<ALLOCATOR>::value
+                           && bsl::is_convertible<ANY_ALLOCATOR *,
+                                                  ALLOCATOR *>::value>::type *
+                                                                         = 0);
+                                                                    // IMPLICIT
+        // Create a proxy object that forwards allocation calls directly to
+        // the specified 'allocator'.  If 'allocator' is 0, the currently
+        // installed default allocator is used instead (through the
+        // 'bslma::Allocator' protocol).  Note that this constructor
+        // participates in overload resolution only if 'ALLOCATOR' is 'final'
+        // and 'ANY_ALLOCATOR *' is convertible to 'ALLOCATOR *' (i.e.,
+        // 'ANY_ALLOCATOR' is 'ALLOCATOR', possibly cv-qualified); otherwise,
+        // 'allocator' is accepted by the constructor taking a
+        // 'bslma::Allocator *'.  Also note that, as a template, it is never
+        // selected for a null pointer literal, which is therefore
+        // unambiguously accepted by the constructor taking a
+        // 'bslma::Allocator *'.
+
+    StaticAllocator(Allocator *mechanism);                          // IMPLICIT
+        // Create a proxy object that forwards allocation calls to the
+        // specified 'mechanism' through the 'bslma::Allocator' protocol.  If
+        // 'mechanism' is 0, the currently installed default allocator is used
+        // instead.
+
+    template <class ANY_TYPE>
+    StaticAllocator(const StaticAllocator<ANY_TYPE, ALLOCATOR>& original);
+        // Create a proxy object that forwards allocation calls in the same way
+        // as the specified 'original', which may be instantiated for a
+        // different element type.  The newly created allocator compares equal
+        // to 'original'.
+
+    //! StaticAllocator(const StaticAllocator& original) = default;
+        // Create a proxy object that forwards allocation calls in the same way
+        // as the specified 'original'.
+
+    //! ~StaticAllocator() = default;
+        // Destroy this object.  Note that this does not destroy the object
+        // pointed to by 'mechanism()'.
+
+    // MANIPULATORS
+    //! StaticAllocator& operator=(const StaticAllocator& rhs) = default;
+        // Make this object forward allocation calls in the same way as the
+        // specified 'rhs', and return a reference providing modifiable access
+        // to this object.
+
+    pointer allocate(size_type n, const void *hint = 0);
+        // Allocate enough (properly aligned) space for the specified 'n'
+        // objects of (template parameter) 'TYPE', calling 'allocate' on the
+        // concrete allocator directly if this object was initialized with
+        // one, and on the mechanism otherwise.  The optionally specified
+        // 'hint' argument is ignored by this allocator type.  The behavior is
+        // undefined unless 'n <= max_size()'.
+
+    void deallocate(pointer p, size_type n = 1);
+        // Return the memory at the specified 'p', previously allocated for the
+        // optionally specified 'n' objects of (template parameter) 'TYPE', to
+        // the concrete allocator (directly) if this object was initialized
+        // with one, and to the mechanism otherwise.  If 'n' is not specified,
+        // a single object is assumed.  The behavior is undefined unless 'p'
+        // was returned by a call to 'allocate' on an allocator that compares
+        // equal to this one, 'n' is the same value that was passed to that
+        // call, and 'p' has not already been deallocated.
+
+    // ACCESSORS
+    pointer address(reference x) const;
+        // Return the address of the object referred to by the specified 'x',
+        // even if the (template parameter) 'TYPE' overloads the unary
+        // 'operator&'.
+
+    const_pointer address(const_reference x) const;
+        // Return the address of the object referred to by the specified 'x',
+        // even if the (template parameter) 'TYPE' overloads the unary
+        // 'operator&'.
+
+    ALLOCATOR *allocator() const;
+        // Return the address of the concrete allocator to which this object
+        // forwards allocation calls directly, or 0 if this object forwards
+        // allocation calls through the 'bslma::Allocator' protocol.
+
+    size_type max_size() const;
+        // Return the maximum number of elements of (template parameter)
+        // 'TYPE' that can be allocated using this allocator.  Note that there
+        // is no guarantee that attempts at allocating fewer elements than the
+        // value returned by 'max_size' will not throw.
+
+    Allocator *mechanism() const;
+        // Return the address of the 'bslma::Allocator' that supplies memory
+        // to this object, and that is to be supplied to elements that use the
+        // bslma allocator model.
+};
+
+// FREE OPERATORS
+template <class T1, class T2, class ALLOCATOR>
+bool operator==(const StaticAllocator<T1, ALLOCATOR>& lhs,
+                const StaticAllocator<T2, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' are proxies for the same
+    // mechanism, and 'false' otherwise.  Note that the two allocators need not
+    // be instantiated on the same element type in order to compare equal.
+
+template <class T1, class T2, class ALLOCATOR>
+bool operator!=(const StaticAllocator<T1, ALLOCATOR>& lhs,
+                const StaticAllocator<T2, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' are not proxies for the
+    // same mechanism, and 'false' otherwise.
+
+template <class TYPE, class ALLOCATOR>
+bool operator==(const StaticAllocator<TYPE, ALLOCATOR>&  lhs,
+                const Allocator                         *rhs);
+    // Return 'true' if the specified 'lhs' is a proxy for the specified
+    // 'rhs', and 'false' otherwise.
+
+template <class TYPE, class ALLOCATOR>
+bool operator!=(const StaticAllocator<TYPE, ALLOCATOR>&  lhs,
+                const Allocator                         *rhs);
+    // Return 'true' if the specified 'lhs' is not a proxy for the specified
+    // 'rhs', and 'false' otherwise.
+
+template <class TYPE, class ALLOCATOR>
+bool operator==(const Allocator                         *lhs,
+                const StaticAllocator<TYPE, ALLOCATOR>&  rhs);
+    // Return 'true' if the specified 'rhs' is a proxy for the specified
+    // 'lhs', and 'false' otherwise.
+
+template <class TYPE, class ALLOCATOR>
+bool operator!=(const Allocator                         *lhs,
+                const StaticAllocator<TYPE, ALLOCATOR>&  rhs);
+    // Return 'true' if the specified 'rhs' is not a proxy for the specified
+    // 'lhs', and 'false' otherwise.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class StaticAllocator
+                           // ---------------------
+
+// CREATORS
+template <class TYPE, class ALLOCATOR>
+inline
+StaticAllocator<TYPE, ALLOCATOR>::StaticAllocator()
+: d_allocator_p(0)
+, d_mechanism_p(Default::defaultAllocator())
+{
+}
+
+template <class TYPE, class ALLOCATOR>
+template <class ANY_ALLOCATOR>
+inline
+StaticAllocator<TYPE, ALLOCATOR>::StaticAllocator(
+                  ANY_ALLOCATOR *allocator,
+                  typename bsl::enable_if<
+                              StaticAllocator_IsFinal<ALLOCATOR>::value
+                           && bsl::is_convertible<ANY_ALLOCATOR *,
+                                                  ALLOCATOR *>::value>::type *)
+: d_allocator_p(allocator)
+, d_mechanism_p(Default::allocator(allocator))
+{
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+StaticAllocator<TYPE, ALLOCATOR>::StaticAllocator(Allocator *mechanism)
+: d_allocator_p(0)
+, d_mechanism_p(Default::allocator(mechanism))
+{
+}
+
+template <class TYPE, class ALLOCATOR>
+template <class ANY_TYPE>
+inline
+StaticAllocator<TYPE, ALLOCATOR>::StaticAllocator(
+                          const StaticAllocator<ANY_TYPE, ALLOCATOR>& original)
+: d_allocator_p(original.d_allocator_p)
+, d_mechanism_p(original.d_mechanism_p)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class ALLOCATOR>
+inline
+typename StaticAllocator<TYPE, ALLOCATOR>::pointer
+StaticAllocator<TYPE, ALLOCATOR>::allocate(size_type n, const void *hint)
+{
+    BSLS_ASSERT_SAFE(n <= this->max_size());
+
+    (void)hint;  // suppress unused parameter warning
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_allocator_p)) {
+        return static_cast<pointer>(
+                         d_allocator_p->ALLOCATOR::allocate(n * sizeof(TYPE)));
+                                                                      // RETURN
+    }
+
+    return static_cast<pointer>(d_mechanism_p->allocate(n * sizeof(TYPE)));
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+void StaticAllocator<TYPE, ALLOCATOR>::deallocate(pointer p, size_type n)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_allocator_p)) {
+        d_allocator_p->ALLOCATOR::deallocate(p);
+        return;                                                       // RETURN
+    }
+
+    (void)n;  // suppress unused parameter warning
+
+    d_mechanism_p->deallocate(p);
+}
+
+// ACCESSORS
+template <class TYPE, class ALLOCATOR>
+inline
+typename StaticAllocator<TYPE, ALLOCATOR>::pointer
+StaticAllocator<TYPE, ALLOCATOR>::address(reference x) const
+{
+    return BSLS_UTIL_ADDRESSOF(x);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+typename StaticAllocator<TYPE, ALLOCATOR>::const_pointer
+StaticAllocator<TYPE, ALLOCATOR>::address(const_reference x) const
+{
+    return BSLS_UTIL_ADDRESSOF(x);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+ALLOCATOR *StaticAllocator<TYPE, ALLOCATOR>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+typename StaticAllocator<TYPE, ALLOCATOR>::size_type
+StaticAllocator<TYPE, ALLOCATOR>::max_size() const
+{
+    return ~std::size_t(0) / sizeof(TYPE);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+Allocator *StaticAllocator<TYPE, ALLOCATOR>::mechanism() const
+{
+    return d_mechanism_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class T1, class T2, class ALLOCATOR>
+inline
+bool bslma::operator==(const StaticAllocator<T1, ALLOCATOR>& lhs,
+                       const StaticAllocator<T2, ALLOCATOR>& rhs)
+{
+    return lhs.mechanism() == rhs.mechanism();
+}
+
+template <class T1, class T2, class ALLOCATOR>
+inline
+bool bslma::operator!=(const StaticAllocator<T1, ALLOCATOR>& lhs,
+                       const StaticAllocator<T2, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+bool bslma::operator==(const StaticAllocator<TYPE, ALLOCATOR>&  lhs,
+                       const Allocator                         *rhs)
+{
+    return lhs.mechanism() == rhs;
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+bool bslma::operator!=(const StaticAllocator<TYPE, ALLOCATOR>&  lhs,
+                       const Allocator                         *rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+bool bslma::operator==(const Allocator                         *lhs,
+                       const StaticAllocator<TYPE, ALLOCATOR>&  rhs)
+{
+    return lhs == rhs.mechanism();
+}
+
+template <class TYPE, class ALLOCATOR>
+inline
+bool bslma::operator!=(const Allocator                         *lhs,
+                       const StaticAllocator<TYPE, ALLOCATOR>&  rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,850 @@
+// bslma_staticallocator.t.cpp                                        -*-C++-*-
+
+#include <bslma_staticallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an STL-compatible allocator template that
+// forwards allocation calls either directly to an object of a concrete
+// allocator type, or through the 'bslma::Allocator' protocol.  The primary
+// concern is that calls made through an allocator initialized with a pointer
+// to a 'final' concrete type are bound statically (i.e., are not virtual),
+// while calls made through an allocator whose concrete type is not 'final',
+// or initialized with a 'bslma::Allocator *', are dispatched virtually.  We
+// verify this using a concrete test allocator type, 'CountingAllocator', a
+// type derived from it, 'OverridingAllocator', that overrides 'allocate' and
+// 'deallocate', and a 'final' type derived from it, 'FinalAllocator': an
+// allocator bound to 'CountingAllocator' but supplied an
+// 'OverridingAllocator' object must still reach the overrides.  We also
+// verify that the type interoperates with the 'bslma' allocator-propagation
+// machinery, i.e., that it is convertible from 'bslma::Allocator *' and
+// exposes the mechanism to be supplied to elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] StaticAllocator();
+// [ 2] StaticAllocator(ANY_ALLOCATOR *allocator);
+// [ 2] StaticAllocator(Allocator *mechanism);
+// [ 2] StaticAllocator(const StaticAllocator<ANY_TYPE, ALLOCATOR>& orig);
+//
+// MANIPULATORS
+// [ 3] pointer allocate(size_type n, const void *hint = 0);
+// [ 3] void deallocate(pointer p, size_type n = 1);
+//
+// ACCESSORS
+// [ 5] pointer address(reference x) const;
+// [ 5] const_pointer address(const_reference x) const;
+// [ 2] ALLOCATOR *allocator() const;
+// [ 5] size_type max_size() const;
+// [ 2] Allocator *mechanism() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const SA<T1, A>& lhs, const SA<T2, A>& rhs);
+// [ 4] bool operator!=(const SA<T1, A>& lhs, const SA<T2, A>& rhs);
+// [ 4] bool operator==(const SA<T, A>& lhs, const Allocator *rhs);
+// [ 4] bool operator!=(const SA<T, A>& lhs, const Allocator *rhs);
+// [ 4] bool operator==(const Allocator *lhs, const SA<T, A>& rhs);
+// [ 4] bool operator!=(const Allocator *lhs, const SA<T, A>& rhs);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: interoperates with 'bslma' allocator propagation
+// [ 7] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr)      BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr)      BSLS_ASSERTTEST_ASSERT_PASS(expr)
+#define ASSERT_SAFE_FAIL(expr) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(expr)
+#define ASSERT_SAFE_PASS(expr) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(expr)
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+class CountingAllocator : public bslma::Allocator {
+    // This concrete allocator obtains memory from the global operators 'new'
+    // and 'delete', and counts the calls made to its 'allocate' and
+    // 'deallocate' methods.
+
+    // DATA
+    int d_numAllocations;    // number of calls to 'allocate'
+    int d_numDeallocations;  // number of calls to 'deallocate'
+
+  public:
+    // CREATORS
+    CountingAllocator() : d_numAllocations(0), d_numDeallocations(0) {}
+        // Create a counting allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+        // Return a newly allocated block of at least the specified 'size'
+        // bytes, and increment the number of allocations.
+    {
+        ++d_numAllocations;
+        return ::operator new(size);
+    }
+
+    virtual void deallocate(void *address)
+        // Return the memory block at the specified 'address' to this
+        // allocator, and increment the number of deallocations.
+    {
+        ++d_numDeallocations;
+        ::operator delete(address);
+    }
+
+    // ACCESSORS
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of calls made to 'allocate'.
+
+    int numDeallocations() const { return d_numDeallocations; }
+        // Return the number of calls made to 'deallocate'.
+};
+
+class OverridingAllocator : public CountingAllocator {
+    // This class overrides the 'allocate' and 'deallocate' methods of
+    // 'CountingAllocator', additionally counting the calls dispatched to the
+    // overrides (i.e., made virtually).
+
+    // DATA
+    int d_numVirtualCalls;  // number of calls to the overrides
+
+  public:
+    // CREATORS
+    OverridingAllocator() : d_numVirtualCalls(0) {}
+        // Create an overriding allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+        // Return 'CountingAllocator::allocate(size)', and increment the
+        // number of virtual calls.
+    {
+        ++d_numVirtualCalls;
+        return CountingAllocator::allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+        // Invoke 'CountingAllocator::deallocate(address)', and increment the
+        // number of virtual calls.
+    {
+        ++d_numVirtualCalls;
+        CountingAllocator::deallocate(address);
+    }
+
+    // ACCESSORS
+    int numVirtualCalls() const { return d_numVirtualCalls; }
+        // Return the number of calls dispatched to the overrides.
+};
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_FINAL)
+#define FINAL final
+#else
+#define FINAL
+#endif
+
+class FinalAllocator FINAL : public CountingAllocator {
+    // This class is a 'CountingAllocator' that is 'final' on platforms
+    // supporting 'final', so that a 'bslma::StaticAllocator' can bind to it
+    // statically.
+};
+
+class AllocatingType {
+    // This class has the 'bslma::UsesBslmaAllocator' trait, and records the
+    // allocator supplied at construction.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator supplied at construction
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocatingType, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocatingType(bslma::Allocator *basicAllocator = 0)
+        // Create an object using the optionally specified 'basicAllocator'.
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const { return d_allocator_p; }
+        // Return the allocator supplied at construction.
+};
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::StaticAllocator<int,    FinalAllocator>    Obj;
+typedef bslma::StaticAllocator<double, FinalAllocator>    DObj;
+typedef bslma::StaticAllocator<int,    CountingAllocator> NObj;
+    // 'NObj' is bound to a concrete allocator type that is not 'final'.
+
+const bool k_IS_STATIC = bslma::StaticAllocator_IsFinal<FinalAllocator>::value;
+    // 'true' if an 'Obj' initialized with a 'FinalAllocator *' calls it
+    // statically, i.e., if the platform supports 'final'
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Binding Allocation to a Concrete Allocator
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a concrete allocator, 'my_CountingAllocator', whose
+// 'allocate' and 'deallocate' methods are defined inline, and that we want
+// node-based containers to call those methods directly rather than through
+// the virtual 'bslma::Allocator' interface.
+//
+// First, we define the allocator, declaring it 'final' so that calls can be
+// bound to its methods statically:
+//..
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_FINAL)
+    class my_CountingAllocator final : public bslma::Allocator {
+        // This class implements the 'bslma::Allocator' protocol using the
+        // global operators 'new' and 'delete', counting the number of blocks
+        // outstanding.
+
+        // DATA
+        int d_numBlocksInUse;  // number of blocks currently allocated
+
+      public:
+        // CREATORS
+        my_CountingAllocator() : d_numBlocksInUse(0) {}
+            // Create a counting allocator having no blocks in use.
+
+        // MANIPULATORS
+        virtual void *allocate(size_type size)
+            // Return a newly allocated block of at least the specified
+            // 'size' bytes.
+        {
+            ++d_numBlocksInUse;
+            return ::operator new(size);
+        }
+
+        virtual void deallocate(void *address)
+            // Return the memory block at the specified 'address' to this
+            // allocator.
+        {
+            --d_numBlocksInUse;
+            ::operator delete(address);
+        }
+
+        // ACCESSORS
+        int numBlocksInUse() const { return d_numBlocksInUse; }
+            // Return the number of blocks currently in use.
+    };
+#endif
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_FINAL)
+
+// Then, we create a 'bslma::StaticAllocator' bound to an object of that
+// type, and allocate some memory.  The call to 'allocate' is resolved at
+// compile time to 'my_CountingAllocator::allocate':
+//..
+    my_CountingAllocator countingAllocator;
+
+    typedef bslma::StaticAllocator<int, my_CountingAllocator> IntAllocator;
+
+    IntAllocator intAllocator(&countingAllocator);
+
+    int *p = intAllocator.allocate(4);
+    ASSERT(1 == countingAllocator.numBlocksInUse());
+//..
+// Next, we rebind the allocator to a different element type, as a node-based
+// container would, and observe that the rebound allocator shares the same
+// concrete allocator:
+//..
+    typedef IntAllocator::rebind<double>::other DoubleAllocator;
+
+    DoubleAllocator doubleAllocator(intAllocator);
+    ASSERT(intAllocator       == doubleAllocator);
+    ASSERT(&countingAllocator == doubleAllocator.allocator());
+
+    double *q = doubleAllocator.allocate(2);
+    ASSERT(2 == countingAllocator.numBlocksInUse());
+//..
+// Then, we observe that the allocator exposes the 'bslma::Allocator' that
+// should be passed to elements that use the bslma allocator model:
+//..
+    ASSERT(&countingAllocator == intAllocator.mechanism());
+//..
+// Finally, we return the memory:
+//..
+    doubleAllocator.deallocate(q, 2);
+    intAllocator.deallocate(p, 4);
+    ASSERT(0 == countingAllocator.numBlocksInUse());
+//..
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // INTEROPERATION WITH 'bslma' ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 'bslma::StaticAllocator' is implicitly convertible from
+        //:   'bslma::Allocator *' (the property used by 'bsl' containers and
+        //:   'bsl::allocator_traits' to detect bslma-style allocators) and
+        //:   from a pointer to its concrete 'ALLOCATOR' type, whether or not
+        //:   'ALLOCATOR' is 'final'.
+        //:
+        //: 2 The mechanism of an allocator, rebound to any element type, can
+        //:   be supplied to an element having the 'bslma::UsesBslmaAllocator'
+        //:   trait, so that the element uses the same allocator.
+        //:
+        //: 3 The type is trivially copyable and bitwise moveable.
+        //
+        // Plan:
+        //: 1 Use 'bsl::is_convertible' to verify the conversions.  (C-1)
+        //:
+        //: 2 Construct an 'AllocatingType' object using the mechanism of a
+        //:   rebound allocator, and verify the allocator it records.  (C-2)
+        //:
+        //: 3 Verify the traits using the corresponding metafunctions.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: interoperates with 'bslma' allocator propagation
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINTEROPERATION WITH 'bslma' ALLOCATOR"
+                            " PROPAGATION"
+                            "\n======================================"
+                            "============\n");
+
+        ASSERT((bsl::is_convertible<bslma::Allocator *,   Obj>::value));
+        ASSERT((bsl::is_convertible<FinalAllocator *,     Obj>::value));
+        ASSERT((bsl::is_convertible<bslma::Allocator *,  DObj>::value));
+        ASSERT((bsl::is_convertible<CountingAllocator *, NObj>::value));
+
+        ASSERT((bsl::is_trivially_copyable<Obj>::value));
+        ASSERT((bslmf::IsBitwiseMoveable<Obj>::value));
+
+        {
+            FinalAllocator ca;
+
+            const Obj X(&ca);
+
+            typedef Obj::rebind<AllocatingType>::other TObj;
+
+            TObj mY(X);  const TObj& Y = mY;
+
+            AllocatingType *p = mY.allocate(1);
+            ASSERT(1 == ca.numAllocations());
+
+            new (p) AllocatingType(Y.mechanism());
+            ASSERT(&ca == p->allocator());
+
+            p->~AllocatingType();
+            mY.deallocate(p);
+            ASSERT(1 == ca.numDeallocations());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'address' AND 'max_size'
+        //
+        // Concerns:
+        //: 1 'address' returns the address of its argument.
+        //:
+        //: 2 'max_size' returns the largest number of elements whose total
+        //:   size is representable by 'size_type'.
+        //
+        // Plan:
+        //: 1 Verify the values returned for several objects and element
+        //:   types.  (C-1..2)
+        //
+        // Testing:
+        //   pointer address(reference x) const;
+        //   const_pointer address(const_reference x) const;
+        //   size_type max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'address' AND 'max_size'"
+                            "\n========================\n");
+
+        const Obj  X;
+        const DObj Y;
+
+        int          i = 0;
+        const int&   I = i;
+        double       d = 0.0;
+
+        ASSERT(&i == X.address(i));
+        ASSERT(&I == X.address(I));
+        ASSERT(&d == Y.address(d));
+
+        ASSERT(~std::size_t(0) / sizeof(int)    == X.max_size());
+        ASSERT(~std::size_t(0) / sizeof(double) == Y.max_size());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two allocators compare equal if and only if they have the same
+        //:   mechanism, regardless of their element types and of whether
+        //:   they were initialized with a concrete allocator or with a
+        //:   'bslma::Allocator *'.
+        //:
+        //: 2 An allocator compares equal to a 'bslma::Allocator *' if and
+        //:   only if that is its mechanism, in either order of operands.
+        //
+        // Plan:
+        //: 1 Create allocators for two concrete allocator objects, both
+        //:   directly and through 'bslma::Allocator *', and for two element
+        //:   types, and compare each pair.  (C-1)
+        //:
+        //: 2 Compare each allocator with each 'bslma::Allocator *'.  (C-2)
+        //
+        // Testing:
+        //   bool operator==(const SA<T1, A>& lhs, const SA<T2, A>& rhs);
+        //   bool operator!=(const SA<T1, A>& lhs, const SA<T2, A>& rhs);
+        //   bool operator==(const SA<T, A>& lhs, const Allocator *rhs);
+        //   bool operator!=(const SA<T, A>& lhs, const Allocator *rhs);
+        //   bool operator==(const Allocator *lhs, const SA<T, A>& rhs);
+        //   bool operator!=(const Allocator *lhs, const SA<T, A>& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEQUALITY OPERATORS"
+                            "\n==================\n");
+
+        FinalAllocator ca1;
+        FinalAllocator ca2;
+
+        bslma::Allocator *const MECHANISMS[] = { &ca1, &ca2 };
+
+        const Obj  A1(&ca1);
+        const Obj  B1(static_cast<bslma::Allocator *>(&ca1));
+        const DObj C1(&ca1);
+        const Obj  A2(&ca2);
+        const DObj C2(&ca2);
+
+        const Obj  *INTS[]    = { &A1, &B1, &A2 };
+        const int   INT_IDX[] = {   0,   0,   1 };
+        const DObj *DBLS[]    = { &C1, &C2 };
+        const int   DBL_IDX[] = {   0,   1 };
+
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                const bool EXP = INT_IDX[i] == INT_IDX[j];
+                ASSERTV(i, j,  EXP == (*INTS[i] == *INTS[j]));
+                ASSERTV(i, j, !EXP == (*INTS[i] != *INTS[j]));
+            }
+            for (int j = 0; j < 2; ++j) {
+                const bool EXP = INT_IDX[i] == DBL_IDX[j];
+                ASSERTV(i, j,  EXP == (*INTS[i] == *DBLS[j]));
+                ASSERTV(i, j, !EXP == (*INTS[i] != *DBLS[j]));
+                ASSERTV(i, j,  EXP == (*DBLS[j] == *INTS[i]));
+                ASSERTV(i, j, !EXP == (*DBLS[j] != *INTS[i]));
+            }
+            for (int j = 0; j < 2; ++j) {
+                const bool EXP = INT_IDX[i] == j;
+                ASSERTV(i, j,  EXP == (*INTS[i] == MECHANISMS[j]));
+                ASSERTV(i, j, !EXP == (*INTS[i] != MECHANISMS[j]));
+                ASSERTV(i, j,  EXP == (MECHANISMS[j] == *INTS[i]));
+                ASSERTV(i, j, !EXP == (MECHANISMS[j] != *INTS[i]));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 An allocator initialized with a pointer to the concrete
+        //:   'ALLOCATOR' type calls 'ALLOCATOR::allocate' and
+        //:   'ALLOCATOR::deallocate' non-virtually if 'ALLOCATOR' is 'final'.
+        //:
+        //: 5 An allocator whose 'ALLOCATOR' is not 'final', initialized with
+        //:   a pointer to an object of a type derived from 'ALLOCATOR', calls
+        //:   the overrides of that type.
+        //:
+        //: 2 An allocator initialized with a 'bslma::Allocator *', or
+        //:   default-constructed, calls the mechanism virtually.
+        //:
+        //: 3 The number of bytes requested is the number of elements times
+        //:   the element size, and the memory is returned to the mechanism
+        //:   on the virtual path.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate through an allocator initialized with
+        //:   the address of a 'FinalAllocator' object, and verify that it is
+        //:   bound statically (if 'final' is supported) and the calls made.
+        //:   (C-1)
+        //:
+        //: 2 Initialize allocators bound to 'CountingAllocator' with the
+        //:   address of an 'OverridingAllocator' object, both as a
+        //:   'CountingAllocator *' and as a 'bslma::Allocator *'.  Allocate
+        //:   and deallocate through each, and verify the number of calls
+        //:   dispatched to the overrides.  (C-2, 5)
+        //:
+        //: 2 Allocate and deallocate through allocators using a
+        //:   'bslma::TestAllocator', both explicitly and as the default
+        //:   allocator, and verify the number of bytes in use.  (C-2..3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an argument exceeding 'max_size()'.  (C-4)
+        //
+        // Testing:
+        //   pointer allocate(size_type n, const void *hint = 0);
+        //   void deallocate(pointer p, size_type n = 1);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'allocate' AND 'deallocate'"
+                            "\n===========================\n");
+
+        if (verbose) printf("\nTesting static dispatch.\n");
+        {
+            FinalAllocator fa;
+
+            Obj mX(&fa);
+            ASSERT((k_IS_STATIC ? &fa : 0) == mX.allocator());
+            ASSERT(&fa                     == mX.mechanism());
+
+            int *p = mX.allocate(3);
+            ASSERT(1 == fa.numAllocations());
+
+            mX.deallocate(p, 3);
+            ASSERT(1 == fa.numDeallocations());
+        }
+
+        if (verbose) printf("\nTesting virtual dispatch.\n");
+        {
+            OverridingAllocator oa;
+
+            NObj mX(static_cast<CountingAllocator *>(&oa));
+            ASSERT(0 == mX.allocator());
+
+            int *p = mX.allocate(3);
+            ASSERT(1 == oa.numAllocations());
+            ASSERT(1 == oa.numVirtualCalls());
+
+            mX.deallocate(p, 3);
+            ASSERT(1 == oa.numDeallocations());
+            ASSERT(2 == oa.numVirtualCalls());
+        }
+        {
+            OverridingAllocator oa;
+
+            NObj mX(static_cast<bslma::Allocator *>(&oa));
+            ASSERT(0 == mX.allocator());
+
+            int *p = mX.allocate(3);
+            ASSERT(1 == oa.numAllocations());
+            ASSERT(1 == oa.numVirtualCalls());
+
+            mX.deallocate(p, 3);
+            ASSERT(1 == oa.numDeallocations());
+            ASSERT(2 == oa.numVirtualCalls());
+        }
+
+        if (verbose) printf("\nTesting sizes.\n");
+        {
+            bslma::TestAllocator ta("object",  veryVeryVerbose);
+            bslma::TestAllocator da("default", veryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj  mX(&ta);
+            DObj mY;
+
+            for (int n = 1; n <= 8; ++n) {
+                int    *p = mX.allocate(n);
+                double *q = mY.allocate(n);
+
+                ASSERTV(n, n * sizeof(int)
+                             == static_cast<std::size_t>(ta.numBytesInUse()));
+                ASSERTV(n, n * sizeof(double)
+                             == static_cast<std::size_t>(da.numBytesInUse()));
+
+                mX.deallocate(p, n);
+                mY.deallocate(q, n);
+
+                ASSERTV(n, 0 == ta.numBytesInUse());
+                ASSERTV(n, 0 == da.numBytesInUse());
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            FinalAllocator ca;
+
+            Obj mX(&ca);
+
+            ASSERT_SAFE_FAIL(mX.allocate(mX.max_size() + 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed allocator uses the currently installed
+        //:   default allocator as its mechanism and has no concrete
+        //:   allocator.
+        //:
+        //: 2 An allocator initialized with a non-null pointer to the concrete
+        //:   type uses it both as its concrete allocator and as its
+        //:   mechanism.
+        //:
+        //: 3 An allocator initialized with a 'bslma::Allocator *' uses it as
+        //:   its mechanism and has no concrete allocator.
+        //:
+        //: 4 A null pointer of either type, or a null pointer literal,
+        //:   selects the default allocator.
+        //:
+        //: 5 Copy construction, construction from an allocator for another
+        //:   element type, and assignment preserve both pointers.
+        //:
+        //: 6 An allocator whose concrete type is not 'final', initialized
+        //:   with a pointer to that type or to a type derived from it, uses
+        //:   it only as its mechanism.
+        //:
+        //: 7 An allocator whose concrete type is 'final' uses a pointer to
+        //:   that type as its concrete allocator only if 'final' is
+        //:   supported.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the default allocator, create
+        //:   allocators using each constructor, and verify the values of
+        //:   'allocator' and 'mechanism'.  (C-1..7)
+        //
+        // Testing:
+        //   StaticAllocator();
+        //   StaticAllocator(ANY_ALLOCATOR *allocator);
+        //   StaticAllocator(Allocator *mechanism);
+        //   StaticAllocator(const StaticAllocator<ANY_TYPE, ALLOCATOR>& orig);
+        //   ALLOCATOR *allocator() const;
+        //   Allocator *mechanism() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND BASIC ACCESSORS"
+                            "\n============================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        FinalAllocator  ca;
+        FinalAllocator *EXP = k_IS_STATIC ? &ca : 0;
+
+        {
+            const Obj X;
+            ASSERT(0   == X.allocator());
+            ASSERT(&da == X.mechanism());
+        }
+        {
+            const Obj X(&ca);
+            ASSERT(EXP == X.allocator());
+            ASSERT(&ca == X.mechanism());
+
+            const Obj Y(X);
+            ASSERT(EXP == Y.allocator());
+            ASSERT(&ca == Y.mechanism());
+
+            const DObj Z(X);
+            ASSERT(EXP == Z.allocator());
+            ASSERT(&ca == Z.mechanism());
+
+            Obj mW;  const Obj& W = mW;
+            mW = X;
+            ASSERT(EXP == W.allocator());
+            ASSERT(&ca == W.mechanism());
+        }
+        {
+            const Obj X(static_cast<bslma::Allocator *>(&ca));
+            ASSERT(0   == X.allocator());
+            ASSERT(&ca == X.mechanism());
+
+            const DObj Z(X);
+            ASSERT(0   == Z.allocator());
+            ASSERT(&ca == Z.mechanism());
+        }
+        {
+            const Obj X(static_cast<FinalAllocator *>(0));
+            ASSERT(0   == X.allocator());
+            ASSERT(&da == X.mechanism());
+
+            const Obj Y(static_cast<bslma::Allocator *>(0));
+            ASSERT(0   == Y.allocator());
+            ASSERT(&da == Y.mechanism());
+
+            const Obj Z(0);
+            ASSERT(0   == Z.allocator());
+            ASSERT(&da == Z.mechanism());
+        }
+        {
+            CountingAllocator   na;
+            OverridingAllocator oa;
+
+            const NObj X(&na);
+            ASSERT(0   == X.allocator());
+            ASSERT(&na == X.mechanism());
+
+            const NObj Y(&oa);
+            ASSERT(0   == Y.allocator());
+            ASSERT(&oa == Y.mechanism());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate memory through an allocator bound to a
+        //:   concrete allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        FinalAllocator ca;
+
+        Obj mX(&ca);  const Obj& X = mX;
+        ASSERT(&ca == X.mechanism());
+
+        int *p = mX.allocate(10);
+        for (int i = 0; i < 10; ++i) {
+            p[i] = i;
+        }
+        mX.deallocate(p, 10);
+
+        ASSERT(1 == ca.numAllocations());
+        ASSERT(1 == ca.numDeallocations());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,238 @@
+// bslma_threaddefaultallocatorguard.h                                -*-C++-*-
+#ifndef INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+#define INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a scoped guard to install a thread default allocator.
+//
+//@CLASSES:
+//  bslma::ThreadDefaultAllocatorGuard: thread-default-allocator scoped guard
+//
+//@SEE_ALSO: bslma_default, bslma_defaultallocatorguard
+//
+//@DESCRIPTION: This component provides an object,
+// 'bslma::ThreadDefaultAllocatorGuard', that serves as a "scoped guard" to
+// install an allocator as the *thread* *default* *allocator* of the calling
+// thread (see {'bslma_default'|Thread Default Allocator}) for the lifetime of
+// the guard.  While the guard is in scope, 'bslma::Default::defaultAllocator'
+// (and 'bslma::Default::allocator' with no argument or an explicit 0) called
+// from the thread that created the guard returns the guarded allocator; other
+// threads are unaffected, and so is the process-wide default allocator.
+//
+// The guard object takes as its constructor argument the address of an object
+// of a class derived from 'bslma::Allocator', or 0.  The thread default
+// allocator of the calling thread at the time of guard construction (which is
+// 0 unless another guard is active) is held by the guard, and the
+// constructor-argument allocator is installed in its place (via a call to
+// 'bslma::Default::setThreadDefaultAllocator').  Upon destruction of the
+// guard object, its held allocator is reinstalled.  Supplying 0 suspends any
+// thread default allocator installed by an enclosing guard, so that the
+// process-wide default allocator is used within the scope of the guard.
+//
+// Unlike 'bslma::DefaultAllocatorGuard', which replaces the process-wide
+// default allocator and is intended for testing only, this guard is intended
+// for use in production code, e.g., by a worker thread that routes all
+// incidental allocations made while processing a request to an
+// unsynchronized allocator owned by that thread.  A guard must be destroyed
+// by the thread that created it, and guards in the same thread must be
+// destroyed in the reverse order of their creation (as is the case for
+// automatic objects).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing the Allocations of a Worker Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each of several worker threads processes a stream of
+// requests, and that processing a request creates many short-lived objects
+// that are not supplied an allocator, and that therefore use the default
+// allocator.  Since the process-wide default allocator is shared by every
+// thread, it must be thread-safe, and it does not benefit from the locality
+// of the allocations made on behalf of a single request.  Instead, each
+// worker can supply an allocator of its own (in practice, an unsynchronized
+// multipool or arena that is released after each request).
+//
+// First, we define a simple allocator that counts the number of blocks
+// outstanding, which will stand in for the allocator of a worker thread:
+//..
+//  class my_CountingAllocator : public bslma::Allocator {
+//      // This allocator uses 'operator new' and 'operator delete', and counts
+//      // the number of blocks currently allocated.
+//
+//      // DATA
+//      int d_blocksOutstanding;
+//
+//    public:
+//      // CREATORS
+//      my_CountingAllocator() : d_blocksOutstanding(0) {}
+//
+//      // MANIPULATORS
+//      virtual void *allocate(size_type size)
+//      {
+//          ++d_blocksOutstanding;
+//          return ::operator new(size);
+//      }
+//
+//      virtual void deallocate(void *address)
+//      {
+//          --d_blocksOutstanding;
+//          ::operator delete(address);
+//      }
+//
+//      // ACCESSORS
+//      int blocksOutstanding() const { return d_blocksOutstanding; }
+//  };
+//..
+// Then, we define a type that, like most allocator-aware types, allocates
+// memory from the default allocator unless an allocator is supplied at
+// construction:
+//..
+//  class my_Buffer {
+//      // This class owns a buffer of a fixed number of bytes.
+//
+//      // DATA
+//      bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+//      void             *d_buffer_p;     // owned buffer
+//
+//    private:
+//      // NOT IMPLEMENTED
+//      my_Buffer(const my_Buffer&);
+//      my_Buffer& operator=(const my_Buffer&);
+//
+//    public:
+//      // CREATORS
+//      explicit my_Buffer(int size, bslma::Allocator *basicAllocator = 0)
+//      : d_allocator_p(bslma::Default::allocator(basicAllocator))
+//      , d_buffer_p(d_allocator_p->allocate(size))
+//      {
+//      }
+//
+//      ~my_Buffer()
+//      {
+//          d_allocator_p->deallocate(d_buffer_p);
+//      }
+//
+//      // ACCESSORS
+//      bslma::Allocator *allocator() const { return d_allocator_p; }
+//  };
+//..
+// Next, we write the function that processes a request; it is unaware of the
+// allocator used by the thread that calls it:
+//..
+//  void processRequest(int requestSize)
+//      // Process a request of the specified 'requestSize'.
+//  {
+//      my_Buffer scratch(requestSize);
+//
+//      // ...
+//  }
+//..
+// Now, the function run by each worker thread installs its own allocator for
+// the duration of the processing:
+//..
+//  void processRequests(const int *requestSizes, int numRequests)
+//      // Process the specified 'numRequests' requests whose sizes are held
+//      // in the specified 'requestSizes' array, using an allocator local to
+//      // the calling thread for all allocations made through the default
+//      // allocator.
+//  {
+//      my_CountingAllocator               localAllocator;
+//      bslma::ThreadDefaultAllocatorGuard guard(&localAllocator);
+//
+//      assert(&localAllocator == bslma::Default::defaultAllocator());
+//
+//      for (int i = 0; i < numRequests; ++i) {
+//          processRequest(requestSizes[i]);
+//      }
+//
+//      assert(0 == localAllocator.blocksOutstanding());
+//  }
+//..
+// Finally, we observe that, outside of the guarded scope, the process-wide
+// default allocator is in effect again:
+//..
+//  bslma::Allocator *processDefault = bslma::Default::defaultAllocator();
+//
+//  const int SIZES[] = { 16, 256, 4096 };
+//  processRequests(SIZES, 3);
+//
+//  assert(processDefault == bslma::Default::defaultAllocator());
+//  assert(0 == bslma::Default::threadDefaultAllocator());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+class Allocator;
+
+                     // =================================
+                     // class ThreadDefaultAllocatorGuard
+                     // =================================
+
+class ThreadDefaultAllocatorGuard {
+    // Upon construction, an object of this class saves the thread default
+    // allocator of the calling thread and installs the user-specified
+    // allocator (or 0) in its place.  On destruction, the original thread
+    // default allocator is restored.
+
+    // DATA
+    Allocator *d_original_p;  // original (to be restored at destruction), or
+                              // 0 if none was installed
+
+    // NOT IMPLEMENTED
+    ThreadDefaultAllocatorGuard(const ThreadDefaultAllocatorGuard&);
+    ThreadDefaultAllocatorGuard& operator=(
+                                           const ThreadDefaultAllocatorGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    ThreadDefaultAllocatorGuard(Allocator *temporary);
+        // Create a scoped guard that installs the specified 'temporary'
+        // allocator as the thread default allocator of the calling thread,
+        // or, if 'temporary' is 0, uninstalls the thread default allocator of
+        // the calling thread.  The behavior is undefined unless 'temporary'
+        // is 0 or outlives every object created in the calling thread using
+        // the default allocator while this guard is in scope.  Note that the
+        // thread default allocator is automatically restored to the original
+        // allocator on destruction.
+
+    ~ThreadDefaultAllocatorGuard();
+        // Restore the thread default allocator that was in place in the
+        // calling thread when this scoped guard was created and destroy this
+        // guard.  The behavior is undefined unless this guard is destroyed by
+        // the thread that created it, after any guard subsequently created by
+        // that thread.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,560 @@
+// bslma_threaddefaultallocatorguard.t.cpp                            -*-C++-*-
+
+#include <bslma_threaddefaultallocatorguard.h>
+
+#include <bslma_allocator.h>               // for testing only
+#include <bslma_default.h>                 // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_testallocator.h>           // for testing only
+
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test "guards" the thread default allocator of the
+// calling thread, which is to say that an instance of this object installs a
+// new thread default allocator (from the constructor argument) on
+// construction, saving the original one, and restores the original thread
+// default allocator on destruction.
+//
+// In addition to the single-threaded concerns (installation, restoration,
+// nesting, and suspension by supplying 0), we must verify that the
+// allocator installed by a guard is visible only in the thread that created
+// the guard, and that neither the process-wide default allocator nor its
+// lock is affected.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] bslma::ThreadDefaultAllocatorGuard(bslma::Allocator *temporary);
+// [ 2] ~bslma::ThreadDefaultAllocatorGuard();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Guards in different threads are independent.
+// [ 4] USAGE EXAMPLE
+//=============================================================================
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+typedef bslma::ThreadDefaultAllocatorGuard Obj;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase3 {
+
+struct ThreadInfo {
+    // This 'struct' holds the input and output of 'threadFunction'.
+
+    bslma::Allocator *d_processDefault_p;  // expected process default
+    int               d_numIterations;     // number of iterations to run
+    int               d_numFailures;       // number of failed checks
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Repeatedly install a test allocator owned by this thread using a guard,
+    // allocate through the default allocator, and verify that the allocator
+    // owned by this thread is used, recording the number of failed checks in
+    // the 'ThreadInfo' object at the specified 'arg'.
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    bslma::TestAllocator localAllocator;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        if (0 != bslma::Default::threadDefaultAllocator()) {
+            ++info->d_numFailures;
+        }
+
+        {
+            Obj guard(&localAllocator);
+
+            bslma::Allocator *a = bslma::Default::allocator();
+            if (&localAllocator != a) {
+                ++info->d_numFailures;
+            }
+
+            void *p = a->allocate(16);
+            if (1 != localAllocator.numBlocksInUse()) {
+                ++info->d_numFailures;
+            }
+            a->deallocate(p);
+        }
+
+        if (info->d_processDefault_p != bslma::Default::defaultAllocator()) {
+            ++info->d_numFailures;
+        }
+    }
+
+    if (0 != localAllocator.numBlocksInUse()
+     || info->d_numIterations != localAllocator.numBlocksTotal()) {
+        ++info->d_numFailures;
+    }
+
+    return 0;
+}
+
+}  // close namespace TestCase3
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Routing the Allocations of a Worker Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each of several worker threads processes a stream of
+// requests, and that processing a request creates many short-lived objects
+// that are not supplied an allocator, and that therefore use the default
+// allocator.  Since the process-wide default allocator is shared by every
+// thread, it must be thread-safe, and it does not benefit from the locality
+// of the allocations made on behalf of a single request.  Instead, each
+// worker can supply an allocator of its own (in practice, an unsynchronized
+// multipool or arena that is released after each request).
+//
+// First, we define a simple allocator that counts the number of blocks
+// outstanding, which will stand in for the allocator of a worker thread:
+//..
+    class my_CountingAllocator : public bslma::Allocator {
+        // This allocator uses 'operator new' and 'operator delete', and counts
+        // the number of blocks currently allocated.
+
+        // DATA
+        int d_blocksOutstanding;
+
+      public:
+        // CREATORS
+        my_CountingAllocator() : d_blocksOutstanding(0) {}
+
+        // MANIPULATORS
+        virtual void *allocate(size_type size)
+        {
+            ++d_blocksOutstanding;
+            return ::operator new(size);
+        }
+
+        virtual void deallocate(void *address)
+        {
+            --d_blocksOutstanding;
+            ::operator delete(address);
+        }
+
+        // ACCESSORS
+        int blocksOutstanding() const { return d_blocksOutstanding; }
+    };
+//..
+// Then, we define a type that, like most allocator-aware types, allocates
+// memory from the default allocator unless an allocator is supplied at
+// construction:
+//..
+    class my_Buffer {
+        // This class owns a buffer of a fixed number of bytes.
+
+        // DATA
+        bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+        void             *d_buffer_p;     // owned buffer
+
+      private:
+        // NOT IMPLEMENTED
+        my_Buffer(const my_Buffer&);
+        my_Buffer& operator=(const my_Buffer&);
+
+      public:
+        // CREATORS
+        explicit my_Buffer(int size, bslma::Allocator *basicAllocator = 0)
+        : d_allocator_p(bslma::Default::allocator(basicAllocator))
+        , d_buffer_p(d_allocator_p->allocate(size))
+        {
+        }
+
+        ~my_Buffer()
+        {
+            d_allocator_p->deallocate(d_buffer_p);
+        }
+
+        // ACCESSORS
+        bslma::Allocator *allocator() const { return d_allocator_p; }
+    };
+//..
+// Next, we write the function that processes a request; it is unaware of the
+// allocator used by the thread that calls it:
+//..
+    void processRequest(int requestSize)
+        // Process a request of the specified 'requestSize'.
+    {
+        my_Buffer scratch(requestSize);
+
+        // ...
+    }
+//..
+// Now, the function run by each worker thread installs its own allocator for
+// the duration of the processing:
+//..
+    void processRequests(const int *requestSizes, int numRequests)
+        // Process the specified 'numRequests' requests whose sizes are held
+        // in the specified 'requestSizes' array, using an allocator local to
+        // the calling thread for all allocations made through the default
+        // allocator.
+    {
+        my_CountingAllocator               localAllocator;
+        bslma::ThreadDefaultAllocatorGuard guard(&localAllocator);
+
+        ASSERT(&localAllocator == bslma::Default::defaultAllocator());
+
+        for (int i = 0; i < numRequests; ++i) {
+            processRequest(requestSizes[i]);
+        }
+
+        ASSERT(0 == localAllocator.blocksOutstanding());
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, we observe that, outside of the guarded scope, the process-wide
+// default allocator is in effect again:
+//..
+    bslma::Allocator *processDefault = bslma::Default::defaultAllocator();
+
+    const int SIZES[] = { 16, 256, 4096 };
+    processRequests(SIZES, 3);
+
+    ASSERT(processDefault == bslma::Default::defaultAllocator());
+    ASSERT(0 == bslma::Default::threadDefaultAllocator());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: GUARDS IN DIFFERENT THREADS ARE INDEPENDENT
+        //
+        // Concerns:
+        //: 1 A thread default allocator installed by a guard is used only by
+        //:   the thread that created the guard.
+        //:
+        //: 2 Threads that have no guard in scope use the process-wide default
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the process-wide default allocator.
+        //:
+        //: 2 Start several threads, each of which repeatedly creates a guard
+        //:   for an allocator of its own, allocates through the default
+        //:   allocator, and verifies that its own allocator was used and is
+        //:   uninstalled when the guard is destroyed.  (C-1..2)
+        //:
+        //: 3 Verify that the process-wide default allocator was not used.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Guards in different threads are independent.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: GUARDS IN DIFFERENT THREADS"
+                            "\n====================================\n");
+
+        using namespace TestCase3;
+
+        enum { NUM_THREADS = 4, NUM_ITERATIONS = 1000 };
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::Default::setDefaultAllocatorRaw(&da);
+
+        ThreadInfo info[NUM_THREADS];
+        ThreadId   ids[NUM_THREADS];
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            info[i].d_processDefault_p = &da;
+            info[i].d_numIterations    = NUM_ITERATIONS;
+            info[i].d_numFailures      = 0;
+
+            ids[i] = createThread(&threadFunction, &info[i]);
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            joinThread(ids[i]);
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            if (veryVerbose) { P_(i) P(info[i].d_numFailures) }
+
+            ASSERTV(i, info[i].d_numFailures, 0 == info[i].d_numFailures);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(&da == bslma::Default::defaultAllocator());
+        ASSERT(0   == bslma::Default::threadDefaultAllocator());
+
+        bslma::Default::setDefaultAllocatorRaw(
+                                      &bslma::NewDeleteAllocator::singleton());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 The constructor installs the specified allocator as the thread
+        //:   default allocator, which is then returned by 'defaultAllocator'
+        //:   and by 'allocator' when called with 0.
+        //:
+        //: 2 The destructor restores the thread default allocator in effect
+        //:   at construction.
+        //:
+        //: 3 Guards nest.
+        //:
+        //: 4 A guard created with 0 suspends the thread default allocator of
+        //:   an enclosing guard, so that the process-wide default allocator is
+        //:   used.
+        //:
+        //: 5 The process-wide default allocator is neither changed nor locked
+        //:   by a guard.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the process-wide default allocator
+        //:   using 'setDefaultAllocator', and verify it is not locked by
+        //:   calls to 'defaultAllocator' made while a guard is in scope.
+        //:   (C-5)
+        //:
+        //: 2 Create nested guards, including one for 0, and verify the
+        //:   allocator returned by 'defaultAllocator', 'allocator', and
+        //:   'threadDefaultAllocator' in each scope.  (C-1..4)
+        //
+        // Testing:
+        //   bslma::ThreadDefaultAllocatorGuard(bslma::Allocator *temporary);
+        //   ~bslma::ThreadDefaultAllocatorGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("thread",  veryVeryVerbose);
+        bslma::TestAllocator ua("inner",   veryVeryVerbose);
+
+        {
+            Obj guard(&ta);
+
+            ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+            ASSERT(&ta == bslma::Default::allocator());
+            ASSERT(&ta == bslma::Default::allocator(0));
+            ASSERT(&ua == bslma::Default::allocator(&ua));
+
+            // The process-wide default allocator is not locked.
+
+            ASSERT(0 == bslma::Default::setDefaultAllocator(&da));
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+
+            {
+                Obj inner(&ua);
+
+                ASSERT(&ua == bslma::Default::threadDefaultAllocator());
+                ASSERT(&ua == bslma::Default::defaultAllocator());
+
+                {
+                    Obj suspend(0);
+
+                    ASSERT(0   == bslma::Default::threadDefaultAllocator());
+                    ASSERT(&da == bslma::Default::defaultAllocator());
+                    ASSERT(&da == bslma::Default::allocator());
+                }
+
+                ASSERT(&ua == bslma::Default::threadDefaultAllocator());
+                ASSERT(&ua == bslma::Default::defaultAllocator());
+            }
+
+            ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+        }
+
+        ASSERT(0   == bslma::Default::threadDefaultAllocator());
+        ASSERT(&da == bslma::Default::defaultAllocator());
+
+        bslma::Default::setDefaultAllocatorRaw(
+                                      &bslma::NewDeleteAllocator::singleton());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a guard for a test allocator, allocate through the default
+        //:   allocator, and verify that the test allocator was used and that
+        //:   the new-delete allocator is the default allocator once the guard
+        //:   is destroyed.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::NewDeleteAllocator *na =
+                                      &bslma::NewDeleteAllocator::singleton();
+
+        ASSERT(0  == bslma::Default::threadDefaultAllocator());
+
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj guard(&ta);
+
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+
+            void *p = bslma::Default::allocator()->allocate(10);
+            ASSERT(1 == ta.numBlocksInUse());
+            bslma::Default::allocator()->deallocate(p);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        ASSERT(0  == bslma::Default::threadDefaultAllocator());
+        ASSERT(na == bslma::Default::defaultAllocator());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
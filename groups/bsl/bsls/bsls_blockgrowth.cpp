@@ -20,6 +20,7 @@ const char *BlockGrowth::toAscii(BlockGrowth::Strategy value)
     switch (value) {
       CASE(GEOMETRIC)
       CASE(CONSTANT)
+      CASE(ADAPTIVE)
       default: return "(* UNKNOWN *)";
     }
 
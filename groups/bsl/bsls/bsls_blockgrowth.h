@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //
 ///Block Growth Strategy
 ///---------------------
-// This component supports two memory block growth strategies:
+// This component supports three memory block growth strategies:
 //
 //: GEOMETRIC GROWTH: A container, pool or allocator that employs this
 //:   strategy, as indicated by the enumerator 'BSLS_GEOMETRIC', grows its
@@ -29,6 +29,15 @@ BSLS_IDENT("$Id: $")
 //: CONSTANT GROWTH: A container, pool or allocator that employs this strategy,
 //:   as indicated by the enumerator 'BSLS_CONSTANT', locks the buffer growth.
 //:   The new buffer is always the same size as the current buffer.
+//:
+//: ADAPTIVE GROWTH: A container, pool or allocator that employs this
+//:   strategy, as indicated by the enumerator 'BSLS_ADAPTIVE', sizes each new
+//:   buffer from the demand it has observed so far (e.g., the number of
+//:   blocks already handed out), subject to a configurable cap, and may serve
+//:   outlying requests separately rather than let them inflate the size of
+//:   all subsequent buffers.  The exact policy is defined by each component
+//:   that supports it; components that do not distinguish adaptive growth
+//:   treat it as geometric growth.
 //
 ///Usage
 ///-----
@@ -132,7 +141,10 @@ struct BlockGrowth {
         BSLS_GEOMETRIC,  // Default.  Indicates that memory block sizes grow
                          // geometrically.
 
-        BSLS_CONSTANT    // Indicates that memory block size is locked.
+        BSLS_CONSTANT,   // Indicates that memory block size is locked.
+
+        BSLS_ADAPTIVE    // Indicates that memory block sizes grow according
+                         // to observed demand, up to a configurable cap.
     };
 
     // CLASS METHODS
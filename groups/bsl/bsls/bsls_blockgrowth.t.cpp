@@ -235,7 +235,7 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting enumerator value and 'toAscii'."
                           << endl;
 
-        int invalidEnumValues[] = { 2, -1, 10 };
+        int invalidEnumValues[] = { 3, -1, 10 };
         static const struct {
             int         d_line;   // line number
             Enum        d_enum;   // enumerator
@@ -246,6 +246,7 @@ int main(int argc, char *argv[])
            // ----    ----------                  -----              -----
             { L_,     Class::BSLS_GEOMETRIC,      "GEOMETRIC",        0  },
             { L_,     Class::BSLS_CONSTANT,       "CONSTANT",         1  },
+            { L_,     Class::BSLS_ADAPTIVE,       "ADAPTIVE",         2  },
             { L_,     (Enum)invalidEnumValues[0], "(* UNKNOWN *)",   -1  },
             { L_,     (Enum)invalidEnumValues[1], "(* UNKNOWN *)",   -1  },
             { L_,     (Enum)invalidEnumValues[2], "(* UNKNOWN *)",   -1  },
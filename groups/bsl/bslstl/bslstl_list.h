@@ -499,6 +499,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iterator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_RANGECOMPARE
 #include <bslalg_rangecompare.h>
 #endif
@@ -515,10 +519,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_enableif.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISENUM
 #include <bslmf_isenum.h>
 #endif
@@ -857,6 +869,68 @@ class list
         }
     };
 
+    enum {
+        NODE_BATCH_SIZE = 32  // maximum number of nodes obtained from, or
+                              // returned to, a 'bslma::Allocator' in a single
+                              // 'allocateBatch' or 'deallocateBatch' call
+    };
+
+    typedef integral_constant<
+                bool,
+                is_convertible<BloombergLP::bslma::Allocator *,
+                               ALLOCATOR>::value> HasBslmaMechanism;
+        // This 'typedef' is an alias for 'true_type' if 'ALLOCATOR' is
+        // convertible from 'bslma::Allocator *' (i.e., if nodes are allocated
+        // from the 'bslma::Allocator' returned by 'mechanism()'), and
+        // 'false_type' otherwise.
+
+    class NodeBatchProctor
+        // This class provides a proctor to return to a 'bslma::Allocator' the
+        // nodes of a batch, obtained by 'allocateBatch', that have not yet
+        // been linked into a list, in the event that an exception is thrown.
+        // Each node in the batch must either contain no 'VALUE' object, or
+        // be released from the proctor (using 'advance').
+    {
+        // DATA
+        BloombergLP::bslma::Allocator  *d_mechanism_p;  // allocator
+        void                          **d_begin_p;      // first node to free
+        void                          **d_end_p;        // end of the batch
+
+      public:
+        // CREATORS
+        NodeBatchProctor(BloombergLP::bslma::Allocator  *mechanism,
+                         void                          **nodes,
+                         typename AllocTraits::size_type numNodes)
+            // Create a proctor that will use the specified 'mechanism' to
+            // return the specified 'numNodes' nodes whose addresses are held
+            // in the specified 'nodes' array.
+        : d_mechanism_p(mechanism)
+        , d_begin_p(nodes)
+        , d_end_p(nodes + numNodes)
+        {
+        }
+
+        ~NodeBatchProctor()
+            // Destroy this proctor, and return the nodes it still manages.
+        {
+            if (d_begin_p != d_end_p) {
+                d_mechanism_p->deallocateBatch(
+                         d_begin_p,
+                         static_cast<typename AllocTraits::size_type>(
+                                                        d_end_p - d_begin_p),
+                         sizeof(Node));
+            }
+        }
+
+        // MANIPULATORS
+        void advance()
+            // Release the first node still managed by this proctor from
+            // management.
+        {
+            ++d_begin_p;
+        }
+    };
+
     struct Comp_Elems {
         // Binary function predicate object type for comparing two 'VALUE'
         // objects using 'operator<'.  This operation is usually, but not
@@ -965,6 +1039,33 @@ class list
         // Insert the specified 'node' prior to the specified 'position' in
         // this list.
 
+    void clear_imp(true_type);
+    void clear_imp(false_type);
+        // Remove all the elements from this list.  If the first (unnamed)
+        // argument is 'true_type', return the nodes of the removed elements
+        // to 'allocator().mechanism()' in batches of up to 'NODE_BATCH_SIZE'
+        // nodes; otherwise, return each node individually.
+
+    template <class INPUT_ITER>
+    iterator insert_range_imp(const_iterator position,
+                              INPUT_ITER     first,
+                              INPUT_ITER     last,
+                              true_type);
+    template <class INPUT_ITER>
+    iterator insert_range_imp(const_iterator position,
+                              INPUT_ITER     first,
+                              INPUT_ITER     last,
+                              false_type);
+        // Insert the specified range '[first, last)' into this list at the
+        // specified 'position' and return an iterator to the first inserted
+        // element or 'position' if the range is empty.  If the fourth
+        // (unnamed) argument is 'true_type' and the length of the range can
+        // be determined in advance (i.e., 'INPUT_ITER' is at least a forward
+        // iterator), obtain the nodes from 'allocator().mechanism()' in
+        // batches of up to 'NODE_BATCH_SIZE' nodes; otherwise, allocate each
+        // node individually.  If an exception is thrown, the elements already
+        // inserted remain in this list.
+
     template <class COMPARE>
     NodePtr merge_imp(NodePtr node1,
                       NodePtr node2,
@@ -1408,18 +1509,7 @@ class list
         // MS Visual Studio 2008 compiler requires that a function using
         // enable_if be inplace inline.
 
-        if (first == last) {
-            return position.unconst();                                // RETURN
-        }
-
-        // Remember the position of the first insertion
-
-        iterator ret = insert(position, *first);
-        for (++first; first != last; ++first) {
-            insert(position, *first);
-        }
-
-        return ret;
+        return insert_range_imp(position, first, last, HasBslmaMechanism());
     }
 
     iterator erase(const_iterator position);
@@ -1904,6 +1994,118 @@ list<VALUE, ALLOCATOR>::insert_node(const_iterator position, NodePtr node)
     return iterator(node);
 }
 
+template <class VALUE, class ALLOCATOR>
+void list<VALUE, ALLOCATOR>::clear_imp(true_type)
+{
+    BloombergLP::bslma::Allocator *mechanism = allocator().mechanism();
+
+    void      *nodes[NODE_BATCH_SIZE];
+    size_type  numNodes = 0;
+
+    NodePtr p = head();
+    while (p != d_sentinel) {
+        NodePtr next = p->d_next;
+
+        AllocTraits::destroy(allocator(),
+                             BloombergLP::bsls::Util::addressOf(p->d_value));
+        p->destroy();
+
+        nodes[numNodes] = p;
+        if (static_cast<size_type>(NODE_BATCH_SIZE) == ++numNodes) {
+            mechanism->deallocateBatch(nodes, numNodes, sizeof(Node));
+            numNodes = 0;
+        }
+
+        p = next;
+    }
+
+    mechanism->deallocateBatch(nodes, numNodes, sizeof(Node));
+
+    link_nodes(d_sentinel, d_sentinel);
+    size_ref() = 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void list<VALUE, ALLOCATOR>::clear_imp(false_type)
+{
+    erase(begin(), end());
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class INPUT_ITER>
+typename list<VALUE, ALLOCATOR>::iterator
+list<VALUE, ALLOCATOR>::insert_range_imp(const_iterator position,
+                                         INPUT_ITER     first,
+                                         INPUT_ITER     last,
+                                         true_type)
+{
+    size_type numElements = static_cast<size_type>(
+              BloombergLP::bslstl::IteratorUtil::insertDistance(first, last));
+
+    if (numElements < 2) {
+        // Either the range is short or its length is unknown (i.e.,
+        // 'INPUT_ITER' is an input iterator).
+
+        return insert_range_imp(position, first, last, false_type());
+                                                                      // RETURN
+    }
+
+    BloombergLP::bslma::Allocator *mechanism = allocator().mechanism();
+
+    NodePtr prev = position.d_nodeptr->d_prev;
+
+    void *nodes[NODE_BATCH_SIZE];
+
+    while (numElements > 0) {
+        const size_type maxNodes = NODE_BATCH_SIZE;
+        const size_type numNodes = numElements < maxNodes
+                                 ? numElements
+                                 : maxNodes;
+
+        mechanism->allocateBatch(nodes, numNodes, sizeof(Node));
+
+        NodeBatchProctor proctor(mechanism, nodes, numNodes);
+
+        for (size_type i = 0; i < numNodes; ++i, ++first) {
+            NodePtr p = static_cast<NodePtr>(nodes[i]);
+            p->init();
+            AllocTraits::construct(
+                                allocator(),
+                                BloombergLP::bsls::Util::addressOf(p->d_value),
+                                *first);
+            proctor.advance();
+            insert_node(position, p);
+        }
+
+        numElements -= numNodes;
+    }
+
+    return iterator(prev->d_next);
+}
+
+template <class VALUE, class ALLOCATOR>
+template <class INPUT_ITER>
+typename list<VALUE, ALLOCATOR>::iterator
+list<VALUE, ALLOCATOR>::insert_range_imp(const_iterator position,
+                                         INPUT_ITER     first,
+                                         INPUT_ITER     last,
+                                         false_type)
+{
+    if (first == last) {
+        return position.unconst();                                    // RETURN
+    }
+
+    // Remember the position of the first insertion
+
+    iterator ret = insert(position, *first);
+    for (++first; first != last; ++first) {
+        insert(position, *first);
+    }
+
+    return ret;
+}
+
 template <class VALUE, class ALLOCATOR>
 template <class COMPARE>
 typename list<VALUE, ALLOCATOR>::NodePtr
@@ -2829,7 +3031,7 @@ template <class VALUE, class ALLOCATOR>
 inline
 void list<VALUE, ALLOCATOR>::clear()
 {
-    erase(begin(), end());
+    clear_imp(HasBslmaMechanism());
 }
 
 // 23.3.5.5 list operations:
@@ -160,7 +160,8 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [29] USAGE EXAMPLE
+// [29] BATCH NODE ALLOCATION
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(list<T,A> *object, const char *spec, int vF = 1);
@@ -1310,6 +1311,59 @@ bool operator!=(IntWrapper a, IntWrapper b)
 
 enum TestEnum { TWO = 2, NINETYNINE = 99 };
 
+                       // ==============================
+                       // class BatchCountingAllocator
+                       // ==============================
+
+class BatchCountingAllocator : public bslma::TestAllocator {
+    // This test allocator additionally counts the number of calls to, and the
+    // total number of blocks handled by, the 'allocateBatch' and
+    // 'deallocateBatch' methods, which it forwards to the default (looping)
+    // implementations of the 'bslma::Allocator' protocol.
+
+    // DATA
+    int d_numAllocateBatch;      // number of calls to 'allocateBatch'
+    int d_numDeallocateBatch;    // number of calls to 'deallocateBatch'
+    int d_numBatchAllocated;     // blocks obtained from 'allocateBatch'
+    int d_numBatchDeallocated;   // blocks returned to 'deallocateBatch'
+
+  public:
+    // CREATORS
+    explicit BatchCountingAllocator(bool verboseFlag = false)
+    : bslma::TestAllocator("BatchCounting", verboseFlag)
+    , d_numAllocateBatch(0)
+    , d_numDeallocateBatch(0)
+    , d_numBatchAllocated(0)
+    , d_numBatchDeallocated(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void allocateBatch(void      **blocks,
+                               size_type   numBlocks,
+                               size_type   size)
+    {
+        ++d_numAllocateBatch;
+        bslma::Allocator::allocateBatch(blocks, numBlocks, size);
+        d_numBatchAllocated += static_cast<int>(numBlocks);
+    }
+
+    virtual void deallocateBatch(void *const *blocks,
+                                 size_type    numBlocks,
+                                 size_type    size)
+    {
+        ++d_numDeallocateBatch;
+        d_numBatchDeallocated += static_cast<int>(numBlocks);
+        bslma::Allocator::deallocateBatch(blocks, numBlocks, size);
+    }
+
+    // ACCESSORS
+    int numAllocateBatch() const { return d_numAllocateBatch; }
+    int numDeallocateBatch() const { return d_numDeallocateBatch; }
+    int numBatchAllocated() const { return d_numBatchAllocated; }
+    int numBatchDeallocated() const { return d_numBatchDeallocated; }
+};
+
 //=============================================================================
 //                       USAGE EXAMPLES
 //-----------------------------------------------------------------------------
@@ -8701,7 +8755,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -8742,6 +8796,139 @@ int main(int argc, char *argv[])
         remove("star_data2.txt");
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH NODE ALLOCATION
+        //
+        // Concerns:
+        //: 1 Inserting a range of two or more elements delimited by forward
+        //:   iterators into a list using a 'bslma::Allocator' mechanism
+        //:   obtains the nodes using 'allocateBatch', in batches of (at most)
+        //:   32 nodes, and inserts the elements in order at the specified
+        //:   position.
+        //:
+        //: 2 Ranges of fewer than two elements, and ranges delimited by input
+        //:   iterators, do not use 'allocateBatch'.
+        //:
+        //: 3 'clear' returns every node using 'deallocateBatch', leaving no
+        //:   memory outstanding other than the sentinel.
+        //:
+        //: 4 If an exception is thrown, every node obtained by a batch that
+        //:   was not yet linked into the list is returned to the allocator.
+        //
+        // Plan:
+        //: 1 Using a test allocator that counts batch calls, insert ranges of
+        //:   varying lengths into a list and verify the number of batch calls,
+        //:   the resulting contents, and that 'clear' deallocates the nodes
+        //:   in batches.  (C-1..3)
+        //:
+        //: 2 Repeat the range insertion inside an exception test loop and
+        //:   verify that no memory is leaked when an exception is thrown.
+        //:   (C-4)
+        //
+        // Testing:
+        //   BATCH NODE ALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BATCH NODE ALLOCATION"
+                            "\n=============================\n");
+
+        enum { BATCH = 32 };
+
+        if (verbose) printf("\nForward-iterator ranges.\n");
+        {
+            static const int LENGTHS[] = { 0, 1, 2, 3, 31, 32, 33, 64, 100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                int values[100];
+                for (int i = 0; i < LENGTH; ++i) {
+                    values[i] = i;
+                }
+
+                BatchCountingAllocator ba(veryVeryVeryVerbose);
+                {
+                    list<int> mX(&ba);  const list<int>& X = mX;
+                    mX.push_back(-1);
+                    mX.push_back(-2);
+
+                    list<int>::iterator it = mX.insert(
+                                                          ++mX.begin(),
+                                                          values,
+                                                          values + LENGTH);
+
+                    const int EXP_CALLS = LENGTH < 2
+                                          ? 0
+                                          : (LENGTH + BATCH - 1) / BATCH;
+
+                    LOOP_ASSERT(LENGTH, EXP_CALLS == ba.numAllocateBatch());
+                    LOOP_ASSERT(LENGTH,
+                                (LENGTH < 2 ? 0 : LENGTH) ==
+                                                     ba.numBatchAllocated());
+                    LOOP_ASSERT(LENGTH,
+                                static_cast<size_t>(LENGTH + 2) == X.size());
+
+                    list<int>::const_iterator cit = X.begin();
+                    LOOP_ASSERT(LENGTH, -1 == *cit);
+                    ++cit;
+                    LOOP_ASSERT(LENGTH, (0 == LENGTH ? -2 : 0) == *it);
+                    for (int i = 0; i < LENGTH; ++i, ++cit) {
+                        LOOP2_ASSERT(LENGTH, i, i == *cit);
+                    }
+                    LOOP_ASSERT(LENGTH, -2 == *cit);
+
+                    mX.clear();
+
+                    const int EXP_DEALLOC = (LENGTH + 2 + BATCH - 1) / BATCH;
+
+                    LOOP_ASSERT(LENGTH,
+                                EXP_DEALLOC == ba.numDeallocateBatch());
+                    LOOP_ASSERT(LENGTH,
+                                LENGTH + 2 == ba.numBatchDeallocated());
+                    LOOP_ASSERT(LENGTH, X.empty());
+                    LOOP_ASSERT(LENGTH, 1 == ba.numBlocksInUse());
+                }
+                LOOP_ASSERT(LENGTH, 0 == ba.numBlocksInUse());
+            }
+        }
+
+        if (verbose) printf("\nInput-iterator ranges.\n");
+        {
+            BatchCountingAllocator ba(veryVeryVeryVerbose);
+
+            const InputSeq<int> SEQ("abcdefghijklmnopqrstuvwxyzABCDEFGHIJ");
+
+            list<int> mX(&ba);  const list<int>& X = mX;
+            mX.insert(mX.end(), SEQ.begin(), SEQ.end());
+
+            ASSERT(0  == ba.numAllocateBatch());
+            ASSERT(36 == X.size());
+        }
+
+        if (verbose) printf("\nException neutrality.\n");
+        {
+            list<TestType> values;
+            for (int i = 0; i < 40; ++i) {
+                values.push_back(TestType(static_cast<char>('A' + i % 26)));
+            }
+
+            BatchCountingAllocator ba(veryVeryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ba) {
+                list<TestType> mX(&ba);  const list<TestType>& X = mX;
+                mX.push_back(TestType('z'));
+
+                mX.insert(X.begin(), values.begin(), values.end());
+
+                ASSERT(41 == X.size());
+                ASSERT(TestType('z') == X.back());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == ba.numBlocksInUse());
+        }
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // TESTING SORT
@@ -56,6 +56,17 @@ BSLS_IDENT("$Id: $")
 //: 3 'bslstl::SimplePool' is less configurable in order to achieve abstraction
 //:   of allocation and improvement in performance.
 //
+///Free-List Locality
+///------------------
+// Blocks are dispensed from the free list in the reverse order of their
+// deallocation, so that, after a container has inserted and erased elements
+// in an unrelated order, consecutive free blocks may be scattered across many
+// chunks.  'allocate' prefetches the block that the next call will dispense,
+// hiding part of the latency of following the free list, and 'sortFreeList'
+// reorders the free list by ascending address, so that subsequent allocations
+// are again dispensed sequentially.  'sortFreeList' is never called
+// implicitly.
+//
 // Clients are encouraged to use 'bdema_Pool' as 'bslstl::SimplePool' is
 // designed for node-based STL containers, and its pooling behavior may change
 // according to the needs of those containers.
@@ -225,6 +236,14 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_ALGORITHM
 #include <algorithm>       // 'std::swap'
 #define INCLUDED_ALGORITHM
@@ -286,16 +305,32 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
+    union Chunk;
+
+    struct ChunkHeader {
+        // This 'struct' holds the bookkeeping information stored at the
+        // beginning of each chunk.
+
+        Chunk                  *d_next_p;           // pointer to next Chunk
+
+        bsls::Types::size_type  d_numMaxAlignedType;
+                                                    // number of
+                                                    // 'MaxAlignedType'
+                                                    // objects allocated for
+                                                    // this chunk
+    };
+
     union Chunk {
         // This 'union' prepends to the beginning of each managed block of
         // allocated memory, implementing a singly-linked list of managed
         // chunks, and thereby enabling constant-time additions to the list of
-        // chunks.
+        // chunks.  The size of the chunk is recorded so that it can be
+        // supplied when the chunk is returned to the allocator.
 
-        Chunk *d_next_p;  // pointer to next Chunk
+        ChunkHeader d_header;  // link to next chunk and size of this chunk
 
         typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
+                               // ensure each block is correctly aligned
     };
 
   public:
@@ -376,6 +411,13 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void release();
         // Relinquish all memory currently allocated via this pool object.
 
+    void sortFreeList();
+        // Reorder the list of free memory blocks of this pool by ascending
+        // address, so that the blocks are subsequently dispensed in that
+        // order.  Note that this method takes time proportional to
+        // 'F * log(F)', where 'F' is the number of free blocks, and allocates
+        // no memory.
+
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
         // the specified 'other' object.  This method provides the no-throw
@@ -422,11 +464,12 @@ SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
     Chunk *chunkPtr = reinterpret_cast<Chunk *>(
                     AllocatorTraits::allocate(allocator(), numMaxAlignedType));
 
-    BSLS_ASSERT_SAFE(0 ==
-             reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
+    BSLS_ASSERT_SAFE(0 == reinterpret_cast<bsls::Types::UintPtr>(chunkPtr)
+                          % bsls::AlignmentFromType<Chunk>::VALUE);
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    chunkPtr->d_header.d_next_p            = d_chunkList_p;
+    chunkPtr->d_header.d_numMaxAlignedType = numMaxAlignedType;
+    d_chunkList_p                          = chunkPtr;
 
     return reinterpret_cast<Block *>(chunkPtr + 1);
 }
@@ -480,6 +523,11 @@ VALUE *SimplePool<VALUE, ALLOCATOR>::allocate()
     }
     VALUE *block = reinterpret_cast<VALUE *>(d_freeList_p);
     d_freeList_p = d_freeList_p->d_next_p;
+
+    // Start loading the block to be dispensed by the next call, whose link
+    // will then be read, while the caller uses this one.
+
+    bsls::PerformanceHint::prefetchForWriting(d_freeList_p);
     return block;
 }
 
@@ -493,6 +541,62 @@ void SimplePool<VALUE, ALLOCATOR>::deallocate(void *address)
     d_freeList_p = reinterpret_cast<Block *>(address);
 }
 
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::sortFreeList()
+{
+    // Perform a bottom-up merge sort of the free list: each pass merges
+    // adjacent runs of 'runLength' blocks, until a single run remains.
+
+    if (!d_freeList_p) {
+        return;                                                       // RETURN
+    }
+
+    for (size_type runLength = 1; ; runLength *= 2) {
+        Block     *remaining = d_freeList_p;
+        Block    **tail      = &d_freeList_p;
+        size_type  numMerges = 0;
+
+        while (remaining) {
+            ++numMerges;
+
+            // Split off two runs of at most 'runLength' blocks each.
+
+            Block     *a    = remaining;
+            Block     *b    = remaining;
+            size_type  lenA = 0;
+            while (b && lenA < runLength) {
+                b = b->d_next_p;
+                ++lenA;
+            }
+            size_type lenB = runLength;
+
+            // Merge the two runs onto 'tail'.
+
+            while (lenA > 0 || (lenB > 0 && b)) {
+                Block *next;
+                if (0 == lenA || (lenB > 0 && b && b < a)) {
+                    next = b;
+                    b    = b->d_next_p;
+                    --lenB;
+                }
+                else {
+                    next = a;
+                    a    = a->d_next_p;
+                    --lenA;
+                }
+                *tail = next;
+                tail  = &next->d_next_p;
+            }
+            remaining = b;
+        }
+        *tail = 0;
+
+        if (numMerges <= 1) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
@@ -555,8 +659,11 @@ void SimplePool<VALUE, ALLOCATOR>::release()
         typename AllocatorTraits::value_type *lastChunk =
                       reinterpret_cast<typename AllocatorTraits::value_type *>(
                                                                 d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+        const size_type numMaxAlignedType =
+                     static_cast<size_type>(
+                              d_chunkList_p->d_header.d_numMaxAlignedType);
+        d_chunkList_p   = d_chunkList_p->d_header.d_next_p;
+        AllocatorTraits::deallocate(allocator(), lastChunk, numMaxAlignedType);
     }
     d_freeList_p = 0;
 }
@@ -48,13 +48,14 @@ using namespace bslstl;
 // [ 5] void deallocate(void *address);
 // [ 6] void reserve(std::size_t numBlocks);
 // [ 7] void release();
+// [10] void sortFreeList();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
 // [ 3] TEST APPARATUS
 
@@ -259,7 +260,7 @@ class TestDriver {
   public:
     // TEST CASES
     static void testCase10();
-        // Test usage example.
+        // Test 'sortFreeList'.
 
     static void testCase9();
         // Test alignment concern.
@@ -343,6 +344,82 @@ void TestDriver<VALUE>::createFreeBlocks(Obj *result, int numBlocks)
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'sortFreeList'
+    //
+    // Concerns:
+    //: 1 After 'sortFreeList', the blocks on the free list are dispensed in
+    //:   ascending address order, irrespective of the order in which they
+    //:   were deallocated.
+    //:
+    //: 2 'sortFreeList' neither allocates nor deallocates memory.
+    //:
+    //: 3 'sortFreeList' has no effect on a pool with an empty free list.
+    //
+    // Plan:
+    //: 1 For each number of blocks 'i' from 0 to 40, allocate 'i' blocks,
+    //:   deallocate them in an order that alternates between both ends of
+    //:   the sequence of allocations, and invoke 'sortFreeList'.  Verify
+    //:   that 'allocate' then dispenses the blocks in ascending address
+    //:   order, and that no memory was allocated or deallocated.  (C-1..3)
+    //
+    // Testing:
+    //   void sortFreeList();
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'sortFreeList'"
+                        "\n==========================\n");
+
+    enum { MAX_BLOCKS = 40 };
+
+    for (int ti = 0; ti <= MAX_BLOCKS; ++ti) {
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);
+
+            void *blocks[MAX_BLOCKS];
+            for (int tj = 0; tj < ti; ++tj) {
+                blocks[tj] = mX.allocate();
+            }
+
+            for (int lo = 0, hi = ti - 1; lo <= hi; ++lo, --hi) {
+                mX.deallocate(blocks[lo]);
+                if (lo < hi) {
+                    mX.deallocate(blocks[hi]);
+                }
+            }
+
+            std::sort(blocks, blocks + ti);
+
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.sortFreeList();
+
+                ASSERTV(ti, oam.isTotalSame());
+                ASSERTV(ti, oam.isInUseSame());
+
+                for (int tj = 0; tj < ti; ++tj) {
+                    void *ptr = mX.allocate();
+                    ASSERTV(ti, tj, blocks[tj] == ptr);
+                }
+
+                ASSERTV(ti, oam.isTotalSame());
+            }
+        }
+
+        ASSERTV(ti, 0 == oa.numBlocksInUse());
+        ASSERTV(ti, 0 == da.numBlocksTotal());
+    }
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase9()
 {
@@ -1266,7 +1343,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1312,6 +1389,9 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+          RUN_EACH_TYPE(TestDriver, testCase10, TEST_TYPES);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // ALIGNMENT TEST
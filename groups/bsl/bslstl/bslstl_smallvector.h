@@ -0,0 +1,1170 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector-like container having inline element storage.
+//
+//@CLASSES:
+//  bslstl::SmallVector: vector holding up to 't_N' elements without allocating
+//
+//@SEE_ALSO: bslstl_vector, bdlma_localsequentialallocator
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bslstl::SmallVector', a dynamically-sized, contiguous sequence of elements
+// of a (template parameter) 'VALUE_TYPE' that embeds, in its own footprint,
+// storage for up to a (template parameter) 't_N' elements.  As long as its
+// size does not exceed 't_N', a small vector allocates no memory at all, so
+// that, e.g., a small vector created on the stack to collect the few fields
+// of a message costs no more than a fixed-size array; when its size exceeds
+// 't_N', it *spills* its elements to a buffer obtained from the
+// 'bslma::Allocator' supplied at construction (or the default allocator),
+// and grows geometrically from there, as 'bsl::vector' does.
+//
+// Unlike creating a 'bsl::vector' on top of a
+// 'bdlma::LocalSequentialAllocator', the inline storage of a small vector is
+// part of the container itself (so that no separate allocator object needs
+// to be created, or passed around with the container), and is reused by every
+// element placed in it (whereas a sequential allocator never reuses the memory
+// of the buffers a vector releases as it grows).  Elements that use
+// 'bslma::Allocator' to supply memory are supplied the allocator of the small
+// vector, whether they are stored inline or not.
+//
+// The interface of 'bslstl::SmallVector' follows that of 'bsl::vector', and
+// provides, in addition, the 'isInline' accessor, which indicates whether the
+// elements are stored in the inline buffer.  Note that, since the inline
+// elements are part of the footprint of the container, 'swap' exchanges
+// elements (rather than buffers) unless both vectors have spilled, and that,
+// as for 'bsl::vector', any operation that changes the capacity of a small
+// vector invalidates its iterators.
+//
+///Small Strings
+///-------------
+// No corresponding small-string type is provided: 'bsl::string' already
+// stores short strings in an inline buffer within its footprint.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Fields of a Message
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we parse messages made of comma-separated integer fields, most
+// messages having fewer than 8 fields.
+//
+// First, we define a function that parses a message into a small vector
+// having inline storage for 8 fields, supplied by the caller:
+//..
+//  void parseFields(bslstl::SmallVector<int, 8> *fields, const char *message)
+//      // Load into the specified 'fields' the comma-separated integers of the
+//      // specified 'message'.
+//  {
+//      fields->clear();
+//
+//      int value = 0;
+//      for (const char *p = message; ; ++p) {
+//          if (',' == *p || 0 == *p) {
+//              fields->push_back(value);
+//              value = 0;
+//              if (0 == *p) {
+//                  break;
+//              }
+//          }
+//          else {
+//              value = value * 10 + (*p - '0');
+//          }
+//      }
+//  }
+//..
+// Then, we parse a typical message, using a test allocator to observe that
+// no memory is allocated:
+//..
+//  bslma::TestAllocator        ta;
+//  bslstl::SmallVector<int, 8> fields(&ta);
+//
+//  parseFields(&fields, "3,14,15,92");
+//
+//  assert(4  == fields.size());
+//  assert(92 == fields[3]);
+//  assert(fields.isInline());
+//  assert(0  == ta.numAllocations());
+//..
+// Finally, we parse an unusually long message, whose fields spill to memory
+// supplied by the allocator:
+//..
+//  parseFields(&fields, "1,2,3,4,5,6,7,8,9,10");
+//
+//  assert(10 == fields.size());
+//  assert(!fields.isInline());
+//  assert(1  == ta.numAllocations());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONSTRUCTORPROXY
+#include <bslalg_constructorproxy.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                             // =================
+                             // class SmallVector
+                             // =================
+
+template <class VALUE_TYPE, int t_N>
+class SmallVector {
+    // This class template provides a dynamically-sized, contiguous sequence
+    // of elements of the (template parameter) 'VALUE_TYPE', having storage
+    // for up to the (template parameter) 't_N' elements within its own
+    // footprint, and obtaining storage for more elements from a
+    // 'bslma::Allocator'.  The behavior is undefined unless '0 < t_N'.
+
+  public:
+    // TYPES
+    typedef VALUE_TYPE         value_type;
+    typedef VALUE_TYPE&        reference;
+    typedef const VALUE_TYPE&  const_reference;
+    typedef VALUE_TYPE        *pointer;
+    typedef const VALUE_TYPE  *const_pointer;
+    typedef VALUE_TYPE        *iterator;
+    typedef const VALUE_TYPE  *const_iterator;
+    typedef std::size_t        size_type;
+    typedef std::ptrdiff_t     difference_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::AlignedBuffer<
+                          t_N * sizeof(VALUE_TYPE),
+                          bsls::AlignmentFromType<VALUE_TYPE>::VALUE> Buffer;
+
+    BSLMF_ASSERT(0 < t_N);
+
+    // DATA
+    VALUE_TYPE       *d_begin_p;     // first element
+    VALUE_TYPE       *d_end_p;       // one past the last element
+    size_type         d_capacity;    // number of elements 'd_begin_p' can
+                                     // hold
+    bslma::Allocator *d_allocator_p; // memory allocator (held, not owned)
+    Buffer            d_buffer;      // inline storage for 't_N' elements
+
+  private:
+    // PRIVATE CLASS METHODS
+    static size_type computeNewCapacity(size_type newLength,
+                                        size_type capacity,
+                                        size_type maxSize);
+        // Return a capacity at least the specified 'newLength' and at least
+        // the minimum of twice the specified 'capacity' and the specified
+        // 'maxSize'.  The behavior is undefined unless
+        // 'capacity < newLength <= maxSize'.
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline storage of this vector.
+
+    void privateInitialize(size_type numElements);
+        // Make this empty vector, whose storage is inline, able to hold the
+        // specified 'numElements' elements, allocating a buffer if
+        // 'numElements' exceeds 't_N'.
+
+    void privateInsert(VALUE_TYPE        *position,
+                       size_type          numElements,
+                       const VALUE_TYPE&  value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // before the specified 'position', growing the storage of this vector
+        // if needed.
+
+    void privateReplaceStorage(VALUE_TYPE *data, size_type capacity);
+        // Release the storage of this vector (if it was allocated), and make
+        // the specified 'data', having the specified 'capacity', the storage
+        // of this vector.  Note that the elements must have been moved to
+        // 'data' already, and 'd_end_p' must be updated by the caller.
+
+    bool privateTryExpand(size_type newCapacity);
+        // Attempt to grow the allocated storage of this vector to the
+        // specified 'newCapacity' without moving it, and return 'true' on
+        // success, and 'false' (with no effect) otherwise, or if the storage
+        // of this vector is inline.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    SmallVector(bslma::Allocator *basicAllocator = 0);
+        // Create an empty vector.  Optionally specify a 'basicAllocator' used
+        // to supply memory (to this vector and its elements).  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit
+    SmallVector(size_type numElements, bslma::Allocator *basicAllocator = 0);
+    SmallVector(size_type          numElements,
+                const VALUE_TYPE&  value,
+                bslma::Allocator  *basicAllocator = 0);
+        // Create a vector of the specified 'numElements' elements, each
+        // having the specified 'value', or having the default value of
+        // 'VALUE_TYPE' if 'value' is not specified.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Throw
+        // 'std::length_error' if 'numElements > max_size()'.
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a vector having the same value as the specified 'original'
+        // vector.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ~SmallVector();
+        // Destroy this vector, its elements, and release its allocated
+        // storage (if any).
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this vector the value of the specified 'rhs' vector, and
+        // return a reference providing modifiable access to this vector.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Replace the elements of this vector with the specified
+        // 'numElements' copies of the specified 'value'.  Throw
+        // 'std::length_error' if 'numElements > max_size()'.
+
+    reference operator[](size_type position);
+        // Return a reference to the element at the specified 'position'.  The
+        // behavior is undefined unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the element at the specified 'position'.
+        // Throw 'std::out_of_range' if 'position >= size()'.
+
+    reference front();
+        // Return a reference to the first element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    reference back();
+        // Return a reference to the last element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    VALUE_TYPE *data();
+        // Return the address of the first element (or of the storage of this
+        // vector if it is empty).
+
+    iterator begin();
+        // Return an iterator to the first element.
+
+    iterator end();
+        // Return the past-the-end iterator of this vector.
+
+    void clear();
+        // Destroy all of the elements of this vector.  Note that the capacity
+        // (and storage) of this vector is not affected.
+
+    iterator erase(const_iterator position);
+        // Destroy the element at the specified 'position', and return an
+        // iterator to the element following it.  The behavior is undefined
+        // unless 'begin() <= position < end()'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Destroy the elements in the specified range '[first, last)', and
+        // return an iterator to the element following them.  The behavior is
+        // undefined unless 'begin() <= first <= last <= end()'.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert a copy of the specified 'value' before the specified
+        // 'position', and return an iterator to the new element.  Throw
+        // 'std::length_error' if 'size() == max_size()'.  The behavior is
+        // undefined unless 'begin() <= position <= end()'.
+
+    void insert(const_iterator    position,
+                size_type         numElements,
+                const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // before the specified 'position'.  Throw 'std::length_error' if
+        // 'size() + numElements > max_size()'.  The behavior is undefined
+        // unless 'begin() <= position <= end()'.
+
+    void pop_back();
+        // Destroy the last element.  The behavior is undefined unless this
+        // vector is not empty.
+
+    void push_back(const VALUE_TYPE& value);
+        // Append a copy of the specified 'value'.  Throw 'std::length_error'
+        // if 'size() == max_size()'.
+
+    void reserve(size_type newCapacity);
+        // Make the capacity of this vector at least the specified
+        // 'newCapacity'.  Throw 'std::length_error' if
+        // 'newCapacity > max_size()'.
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // the elements at and after 'newSize', or appending copies of the
+        // specified 'value' (or default-constructed elements if 'value' is not
+        // specified).  Throw 'std::length_error' if 'newSize > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the storage of this vector to fit its size, moving its
+        // elements back to the inline storage if they fit there.
+
+    void swap(SmallVector& other);
+        // Exchange the value of this vector with that of the specified 'other'
+        // vector.  If both vectors have allocated storage, this method does
+        // not throw, and exchanges their buffers (without moving elements);
+        // otherwise, the elements are copied, and an exception may be thrown.
+        // The behavior is undefined unless both vectors use the same
+        // allocator.
+
+    // ACCESSORS
+    const_reference operator[](size_type position) const;
+        // Return a reference to the non-modifiable element at the specified
+        // 'position'.  The behavior is undefined unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference to the non-modifiable element at the specified
+        // 'position'.  Throw 'std::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference to the non-modifiable first element.  The
+        // behavior is undefined unless this vector is not empty.
+
+    const_reference back() const;
+        // Return a reference to the non-modifiable last element.  The
+        // behavior is undefined unless this vector is not empty.
+
+    const VALUE_TYPE *data() const;
+        // Return the address of the non-modifiable first element (or of the
+        // storage of this vector if it is empty).
+
+    const_iterator begin() const;
+        // Return an iterator to the non-modifiable first element.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this vector.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+
+    size_type capacity() const;
+        // Return the number of elements this vector can hold without
+        // obtaining more storage.  Note that the capacity is at least 't_N'.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    bool isInline() const;
+        // Return 'true' if the elements of this vector are stored in its
+        // inline storage, and 'false' if they are stored in memory obtained
+        // from its allocator.
+
+    size_type max_size() const;
+        // Return the maximum number of elements this vector can hold.
+
+    size_type size() const;
+        // Return the number of elements of this vector.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, int t_N>
+bool operator==(const SmallVector<VALUE_TYPE, t_N>& lhs,
+                const SmallVector<VALUE_TYPE, t_N>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors have the same
+    // value, and 'false' otherwise.  Two vectors have the same value if they
+    // have the same number of elements, and the same element value at each
+    // position.
+
+template <class VALUE_TYPE, int t_N>
+bool operator!=(const SmallVector<VALUE_TYPE, t_N>& lhs,
+                const SmallVector<VALUE_TYPE, t_N>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors do not have the
+    // same value, and 'false' otherwise.  Two vectors do not have the same
+    // value if they have different numbers of elements, or different element
+    // values at some position.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, int t_N>
+void swap(SmallVector<VALUE_TYPE, t_N>& a, SmallVector<VALUE_TYPE, t_N>& b);
+    // Exchange the values of the specified 'a' and 'b' vectors.  The
+    // behavior is undefined unless both vectors use the same allocator.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class SmallVector
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::size_type
+SmallVector<VALUE_TYPE, t_N>::computeNewCapacity(size_type newLength,
+                                                 size_type capacity,
+                                                 size_type maxSize)
+{
+    BSLS_ASSERT_SAFE(capacity  <  newLength);
+    BSLS_ASSERT_SAFE(newLength <= maxSize);
+
+    const size_type newCapacity = capacity <= maxSize / 2
+                                ? capacity * 2
+                                : maxSize;
+
+    return newCapacity < newLength ? newLength : newCapacity;
+}
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, int t_N>
+inline
+VALUE_TYPE *SmallVector<VALUE_TYPE, t_N>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::privateInitialize(size_type numElements)
+{
+    BSLS_ASSERT_SAFE(isInline());
+    BSLS_ASSERT_SAFE(empty());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        StdExceptUtil::throwLengthError(
+                              "SmallVector<...>: too many elements requested");
+    }
+
+    if (numElements > d_capacity) {
+        d_begin_p  = static_cast<VALUE_TYPE *>(
+                  d_allocator_p->allocate(numElements * sizeof(VALUE_TYPE)));
+        d_end_p    = d_begin_p;
+        d_capacity = numElements;
+    }
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::privateInsert(
+                                               VALUE_TYPE        *position,
+                                               size_type          numElements,
+                                               const VALUE_TYPE&  value)
+{
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements
+                                                       > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        StdExceptUtil::throwLengthError(
+                                  "SmallVector<...>::insert: vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+
+    if (newSize > d_capacity) {
+        const size_type newCapacity = computeNewCapacity(newSize,
+                                                         d_capacity,
+                                                         maxSize);
+
+        if (!privateTryExpand(newCapacity)) {
+            VALUE_TYPE *newData = static_cast<VALUE_TYPE *>(
+                  d_allocator_p->allocate(newCapacity * sizeof(VALUE_TYPE)));
+
+            bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                               newData,
+                                                               d_allocator_p);
+
+            bslalg::ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                                              &d_end_p,
+                                                              d_begin_p,
+                                                              position,
+                                                              d_end_p,
+                                                              value,
+                                                              numElements,
+                                                              d_allocator_p);
+            proctor.release();
+
+            privateReplaceStorage(newData, newCapacity);
+            d_end_p = newData + newSize;
+            return;                                                   // RETURN
+        }
+    }
+
+    bslalg::ArrayPrimitives::insert(position,
+                                    d_end_p,
+                                    value,
+                                    numElements,
+                                    d_allocator_p);
+    d_end_p += numElements;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+void SmallVector<VALUE_TYPE, t_N>::privateReplaceStorage(VALUE_TYPE *data,
+                                                         size_type   capacity)
+{
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+    d_begin_p  = data;
+    d_capacity = capacity;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+bool SmallVector<VALUE_TYPE, t_N>::privateTryExpand(size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_capacity < newCapacity);
+
+    if (isInline() || !d_allocator_p->tryExpand(
+                                         d_begin_p,
+                                         d_capacity * sizeof(VALUE_TYPE),
+                                         newCapacity * sizeof(VALUE_TYPE))) {
+        return false;                                                 // RETURN
+    }
+
+    d_capacity = newCapacity;
+    return true;
+}
+
+// CREATORS
+template <class VALUE_TYPE, int t_N>
+inline
+SmallVector<VALUE_TYPE, t_N>::SmallVector(bslma::Allocator *basicAllocator)
+: d_begin_p(inlineData())
+, d_end_p(d_begin_p)
+, d_capacity(t_N)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class VALUE_TYPE, int t_N>
+SmallVector<VALUE_TYPE, t_N>::SmallVector(size_type         numElements,
+                                          bslma::Allocator *basicAllocator)
+: d_begin_p(inlineData())
+, d_end_p(d_begin_p)
+, d_capacity(t_N)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    privateInitialize(numElements);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                isInline() ? 0 : d_begin_p,
+                                                d_allocator_p);
+
+    bslalg::ArrayPrimitives::defaultConstruct(d_begin_p,
+                                              numElements,
+                                              d_allocator_p);
+    proctor.release();
+
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class VALUE_TYPE, int t_N>
+SmallVector<VALUE_TYPE, t_N>::SmallVector(size_type          numElements,
+                                          const VALUE_TYPE&  value,
+                                          bslma::Allocator  *basicAllocator)
+: d_begin_p(inlineData())
+, d_end_p(d_begin_p)
+, d_capacity(t_N)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    privateInitialize(numElements);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                isInline() ? 0 : d_begin_p,
+                                                d_allocator_p);
+
+    bslalg::ArrayPrimitives::uninitializedFillN(d_begin_p,
+                                                numElements,
+                                                value,
+                                                d_allocator_p);
+    proctor.release();
+
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class VALUE_TYPE, int t_N>
+SmallVector<VALUE_TYPE, t_N>::SmallVector(const SmallVector&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_begin_p(inlineData())
+, d_end_p(d_begin_p)
+, d_capacity(t_N)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    privateInitialize(original.size());
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                                isInline() ? 0 : d_begin_p,
+                                                d_allocator_p);
+
+    bslalg::ArrayPrimitives::copyConstruct(d_begin_p,
+                                           original.d_begin_p,
+                                           original.d_end_p,
+                                           d_allocator_p);
+    proctor.release();
+
+    d_end_p = d_begin_p + original.size();
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+SmallVector<VALUE_TYPE, t_N>::~SmallVector()
+{
+    bslalg::ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, int t_N>
+SmallVector<VALUE_TYPE, t_N>&
+SmallVector<VALUE_TYPE, t_N>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        if (rhs.size() > d_capacity) {
+            reserve(rhs.size());
+        }
+        bslalg::ArrayPrimitives::copyConstruct(d_begin_p,
+                                               rhs.d_begin_p,
+                                               rhs.d_end_p,
+                                               d_allocator_p);
+        d_end_p = d_begin_p + rhs.size();
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::assign(size_type         numElements,
+                                          const VALUE_TYPE& value)
+{
+    // 'value' may be an element of this vector, so it is copied before the
+    // elements are destroyed.
+
+    bslalg::ConstructorProxy<VALUE_TYPE> copy(value, d_allocator_p);
+
+    clear();
+    privateInsert(d_begin_p, numElements, copy.object());
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::reference
+SmallVector<VALUE_TYPE, t_N>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::reference
+SmallVector<VALUE_TYPE, t_N>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        StdExceptUtil::throwOutOfRange(
+                                "SmallVector<...>::at(n): invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::reference
+SmallVector<VALUE_TYPE, t_N>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::reference
+SmallVector<VALUE_TYPE, t_N>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+VALUE_TYPE *SmallVector<VALUE_TYPE, t_N>::data()
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::iterator
+SmallVector<VALUE_TYPE, t_N>::begin()
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::iterator
+SmallVector<VALUE_TYPE, t_N>::end()
+{
+    return d_end_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+void SmallVector<VALUE_TYPE, t_N>::clear()
+{
+    bslalg::ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+    d_end_p = d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::iterator
+SmallVector<VALUE_TYPE, t_N>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::iterator
+SmallVector<VALUE_TYPE, t_N>::erase(const_iterator first,
+                                    const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first   <= last);
+    BSLS_ASSERT_SAFE(last    <= end());
+
+    const size_type numElements = last - first;
+    bslalg::ArrayPrimitives::erase(const_cast<VALUE_TYPE *>(first),
+                                   const_cast<VALUE_TYPE *>(last),
+                                   d_end_p,
+                                   d_allocator_p);
+    d_end_p -= numElements;
+    return const_cast<VALUE_TYPE *>(first);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::iterator
+SmallVector<VALUE_TYPE, t_N>::insert(const_iterator    position,
+                                     const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const size_type index = position - d_begin_p;
+    privateInsert(const_cast<VALUE_TYPE *>(position), 1, value);
+    return d_begin_p + index;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+void SmallVector<VALUE_TYPE, t_N>::insert(const_iterator    position,
+                                          size_type         numElements,
+                                          const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    privateInsert(const_cast<VALUE_TYPE *>(position), numElements, value);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+void SmallVector<VALUE_TYPE, t_N>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    bslalg::ScalarDestructionPrimitives::destroy(--d_end_p);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+void SmallVector<VALUE_TYPE, t_N>::push_back(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslalg::ScalarPrimitives::copyConstruct(d_end_p,
+                                                value,
+                                                d_allocator_p);
+        ++d_end_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        privateInsert(d_end_p, 1, value);
+    }
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::reserve(size_type newCapacity)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        StdExceptUtil::throwLengthError(
+                    "SmallVector<...>::reserve(newCapacity): vector too long");
+    }
+
+    if (newCapacity <= d_capacity || privateTryExpand(newCapacity)) {
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData = static_cast<VALUE_TYPE *>(
+                  d_allocator_p->allocate(newCapacity * sizeof(VALUE_TYPE)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    const size_type length = size();
+    bslalg::ArrayPrimitives::destructiveMove(newData,
+                                             d_begin_p,
+                                             d_end_p,
+                                             d_allocator_p);
+    proctor.release();
+
+    privateReplaceStorage(newData, newCapacity);
+    d_end_p = newData + length;
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::resize(size_type newSize)
+{
+    if (newSize <= size()) {
+        bslalg::ArrayDestructionPrimitives::destroy(d_begin_p + newSize,
+                                                    d_end_p);
+        d_end_p = d_begin_p + newSize;
+    }
+    else {
+        bslalg::ConstructorProxy<VALUE_TYPE> defaultValue(d_allocator_p);
+        privateInsert(d_end_p, newSize - size(), defaultValue.object());
+    }
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::resize(size_type         newSize,
+                                          const VALUE_TYPE& value)
+{
+    if (newSize <= size()) {
+        bslalg::ArrayDestructionPrimitives::destroy(d_begin_p + newSize,
+                                                    d_end_p);
+        d_end_p = d_begin_p + newSize;
+    }
+    else {
+        privateInsert(d_end_p, newSize - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::shrink_to_fit()
+{
+    const size_type length = size();
+
+    if (isInline() || length == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData;
+    size_type   newCapacity;
+
+    if (length <= static_cast<size_type>(t_N)) {
+        newData     = inlineData();
+        newCapacity = t_N;
+
+        bslalg::ArrayPrimitives::destructiveMove(newData,
+                                                 d_begin_p,
+                                                 d_end_p,
+                                                 d_allocator_p);
+    }
+    else {
+        newData     = static_cast<VALUE_TYPE *>(
+                       d_allocator_p->allocate(length * sizeof(VALUE_TYPE)));
+        newCapacity = length;
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                            d_allocator_p);
+
+        bslalg::ArrayPrimitives::destructiveMove(newData,
+                                                 d_begin_p,
+                                                 d_end_p,
+                                                 d_allocator_p);
+        proctor.release();
+    }
+
+    privateReplaceStorage(newData, newCapacity);
+    d_end_p = newData + length;
+}
+
+template <class VALUE_TYPE, int t_N>
+void SmallVector<VALUE_TYPE, t_N>::swap(SmallVector& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!isInline()
+                                            && !other.isInline())) {
+        VALUE_TYPE *begin    = d_begin_p;
+        VALUE_TYPE *end      = d_end_p;
+        size_type   capacity = d_capacity;
+
+        d_begin_p  = other.d_begin_p;
+        d_end_p    = other.d_end_p;
+        d_capacity = other.d_capacity;
+
+        other.d_begin_p  = begin;
+        other.d_end_p    = end;
+        other.d_capacity = capacity;
+        return;                                                       // RETURN
+    }
+
+    SmallVector copy(*this, d_allocator_p);
+    *this = other;
+    other = copy;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_reference
+SmallVector<VALUE_TYPE, t_N>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_reference
+SmallVector<VALUE_TYPE, t_N>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        StdExceptUtil::throwOutOfRange(
+                          "SmallVector<...>::at(n) const: invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_reference
+SmallVector<VALUE_TYPE, t_N>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_reference
+SmallVector<VALUE_TYPE, t_N>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+const VALUE_TYPE *SmallVector<VALUE_TYPE, t_N>::data() const
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_iterator
+SmallVector<VALUE_TYPE, t_N>::begin() const
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::const_iterator
+SmallVector<VALUE_TYPE, t_N>::end() const
+{
+    return d_end_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+bslma::Allocator *SmallVector<VALUE_TYPE, t_N>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::size_type
+SmallVector<VALUE_TYPE, t_N>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+bool SmallVector<VALUE_TYPE, t_N>::empty() const
+{
+    return d_begin_p == d_end_p;
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+bool SmallVector<VALUE_TYPE, t_N>::isInline() const
+{
+    return d_begin_p == reinterpret_cast<const VALUE_TYPE *>(
+                                                            d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::size_type
+SmallVector<VALUE_TYPE, t_N>::max_size() const
+{
+    return ~size_type(0) / sizeof(VALUE_TYPE);
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+typename SmallVector<VALUE_TYPE, t_N>::size_type
+SmallVector<VALUE_TYPE, t_N>::size() const
+{
+    return d_end_p - d_begin_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE_TYPE, int t_N>
+inline
+bool bslstl::operator==(const SmallVector<VALUE_TYPE, t_N>& lhs,
+                        const SmallVector<VALUE_TYPE, t_N>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class VALUE_TYPE, int t_N>
+inline
+bool bslstl::operator!=(const SmallVector<VALUE_TYPE, t_N>& lhs,
+                        const SmallVector<VALUE_TYPE, t_N>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, int t_N>
+inline
+void bslstl::swap(SmallVector<VALUE_TYPE, t_N>& a,
+                  SmallVector<VALUE_TYPE, t_N>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1174 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a sequence container whose first 't_N' elements
+// are stored within its own footprint.  The primary concerns are that no
+// memory is allocated while the size of a vector does not exceed 't_N'; that
+// the elements spill, exactly once per growth, to memory obtained from the
+// allocator of the vector when they no longer fit; that every manipulator
+// preserves the values of the elements across the transition between inline
+// and allocated storage (in both directions); that elements using
+// 'bslma::Allocator' are supplied the allocator of the vector; that allocated
+// storage is grown in place when the allocator supports it; and that
+// exceptions leave the vector valid without leaking memory.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit SmallVector(size_type n, bslma::Allocator *ba = 0);
+// [ 2] SmallVector(size_type n, const VALUE_TYPE& v, Allocator *ba = 0);
+// [ 2] SmallVector(const SmallVector& original, Allocator *ba = 0);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 5] SmallVector& operator=(const SmallVector& rhs);
+// [ 3] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 2] reference operator[](size_type position);
+// [ 2] reference at(size_type position);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 3] void clear();
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 3] void insert(const_iterator pos, size_type n, const VALUE_TYPE& v);
+// [ 3] void pop_back();
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 4] void reserve(size_type newCapacity);
+// [ 3] void resize(size_type newSize);
+// [ 3] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 4] void shrink_to_fit();
+// [ 5] void swap(SmallVector& other);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool isInline() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const SmallVector& lhs, const SmallVector& rhs);
+// [ 5] bool operator!=(const SmallVector& lhs, const SmallVector& rhs);
+// [ 5] void swap(SmallVector& a, SmallVector& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: Allocated storage grows in place when possible.
+// [ 6] CONCERN: Exceptions leave the vector valid and do not leak.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsltf::AllocTestType AllocType;
+
+typedef bslstl::SmallVector<int, 4>       IntObj;
+typedef bslstl::SmallVector<AllocType, 4> AllocObj;
+
+enum { k_N = 4 };
+
+//=============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class OBJ>
+bool hasValues(const OBJ& object, int numElements, int base = 0)
+    // Return 'true' if the specified 'object' has the specified 'numElements'
+    // elements, having the values 'base', 'base + 1', ... (where 'base' is 0
+    // unless specified), and 'false' otherwise.
+{
+    if (object.size() != static_cast<typename OBJ::size_type>(numElements)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < numElements; ++i) {
+        if (base + i != static_cast<int>(object[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool hasValues(const AllocObj& object, int numElements, int base = 0)
+    // Return 'true' if the specified 'object' has the specified 'numElements'
+    // elements, having the values 'base', 'base + 1', ... (where 'base' is 0
+    // unless specified), each using the allocator of 'object', and 'false'
+    // otherwise.
+{
+    if (object.size() != static_cast<AllocObj::size_type>(numElements)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < numElements; ++i) {
+        if (base + i != object[i].data()
+         || object.allocator() != object[i].allocator()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                        // ==========================
+                        // class InPlaceTestAllocator
+                        // ==========================
+
+class InPlaceTestAllocator : public bslma::Allocator {
+    // This test allocator dispenses maximally-aligned blocks sequentially
+    // from a fixed arena, and implements 'tryExpand' by extending the most
+    // recently allocated block into the unused remainder of the arena.
+    // Deallocation has no effect other than being counted.
+
+    // PRIVATE TYPES
+    typedef bsls::AlignmentUtil::MaxAlignedType AlignedType;
+
+    enum { k_ARENA_SIZE = 16 * 1024 };
+
+    // DATA
+    AlignedType  d_arena[k_ARENA_SIZE / sizeof(AlignedType)];
+    size_type    d_cursor;             // offset of the next free byte
+    char        *d_last_p;             // most recently allocated block
+    int          d_numAllocations;     // number of 'allocate' calls
+    int          d_numDeallocations;   // number of 'deallocate' calls
+    int          d_numExpansions;      // number of successful 'tryExpand'
+
+    // PRIVATE CLASS METHODS
+    static size_type roundUp(size_type size)
+        // Return the specified 'size' rounded up to the maximal alignment.
+    {
+        return (size + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                          & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+    }
+
+    char *arena() { return reinterpret_cast<char *>(d_arena); }
+        // Return the address of the arena.
+
+  public:
+    // CREATORS
+    InPlaceTestAllocator()
+    : d_cursor(0)
+    , d_last_p(0)
+    , d_numAllocations(0)
+    , d_numDeallocations(0)
+    , d_numExpansions(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+    {
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+
+        ++d_numAllocations;
+
+        if (roundUp(size) > k_ARENA_SIZE - d_cursor) {
+            bsls::BslExceptionUtil::throwBadAlloc();
+        }
+
+        d_last_p  = arena() + d_cursor;
+        d_cursor += roundUp(size);
+        return d_last_p;
+    }
+
+    void deallocate(void *address)
+    {
+        if (address) {
+            ++d_numDeallocations;
+        }
+    }
+
+    bool tryExpand(void *address, size_type originalSize, size_type newSize)
+    {
+        ASSERT(originalSize <= newSize);
+
+        const size_type offset = d_last_p - arena();
+
+        if (address != d_last_p
+         || offset + roundUp(originalSize) != d_cursor
+         || roundUp(newSize) > k_ARENA_SIZE - offset) {
+            return false;                                             // RETURN
+        }
+
+        ++d_numExpansions;
+        d_cursor = offset + roundUp(newSize);
+        return true;
+    }
+
+    // ACCESSORS
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of calls to 'allocate' with a non-zero size.
+
+    int numDeallocations() const { return d_numDeallocations; }
+        // Return the number of calls to 'deallocate' with a non-null address.
+
+    int numExpansions() const { return d_numExpansions; }
+        // Return the number of successful calls to 'tryExpand'.
+};
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Fields of a Message
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we parse messages made of comma-separated integer fields, most
+// messages having fewer than 8 fields.
+//
+// First, we define a function that parses a message into a small vector
+// having inline storage for 8 fields, supplied by the caller:
+//..
+    void parseFields(bslstl::SmallVector<int, 8> *fields, const char *message)
+        // Load into the specified 'fields' the comma-separated integers of the
+        // specified 'message'.
+    {
+        fields->clear();
+
+        int value = 0;
+        for (const char *p = message; ; ++p) {
+            if (',' == *p || 0 == *p) {
+                fields->push_back(value);
+                value = 0;
+                if (0 == *p) {
+                    break;
+                }
+            }
+            else {
+                value = value * 10 + (*p - '0');
+            }
+        }
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we parse a typical message, using a test allocator to observe that
+// no memory is allocated:
+//..
+    bslma::TestAllocator        ta("test", veryVeryVeryVerbose);
+    bslstl::SmallVector<int, 8> fields(&ta);
+
+    parseFields(&fields, "3,14,15,92");
+
+    ASSERT(4  == fields.size());
+    ASSERT(92 == fields[3]);
+    ASSERT(fields.isInline());
+    ASSERT(0  == ta.numAllocations());
+//..
+// Finally, we parse an unusually long message, whose fields spill to memory
+// supplied by the allocator:
+//..
+    parseFields(&fields, "1,2,3,4,5,6,7,8,9,10");
+
+    ASSERT(10 == fields.size());
+    ASSERT(!fields.isInline());
+    ASSERT(1  == ta.numAllocations());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If allocating storage, or copying an element, throws while
+        //:   constructing a vector, the exception propagates and no memory is
+        //:   leaked.
+        //:
+        //: 2 If an exception is thrown while a vector grows (in particular,
+        //:   while its elements spill from the inline storage), the vector
+        //:   remains valid, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using the 'bslma::TestAllocator' exception-test macros, copy
+        //:   vectors of elements that allocate, of sizes on both sides of
+        //:   't_N', and verify that no memory is leaked.  (C-1)
+        //:
+        //: 2 Likewise, append elements to vectors of various sizes, and verify
+        //:   that, on exception, the size of the vector is unchanged, and
+        //:   that, on success, the elements have the expected values.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Exceptions leave the vector valid and do not leak.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: EXCEPTION SAFETY"
+                            "\n=========================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int n = 0; n <= 2 * k_N + 1; ++n) {
+            AllocObj mS(&sa);
+            for (int i = 0; i < n; ++i) {
+                mS.push_back(AllocType(i));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                AllocObj mX(mS, &oa);
+                ASSERTV(n, hasValues(mX, n));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+
+            {
+                AllocObj mX(&oa);
+                for (int i = 0; i < n; ++i) {
+                    mX.push_back(AllocType(i));
+                }
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const AllocType value(n);
+
+                    const bool wasInline = mX.isInline();
+                    const int  size      = static_cast<int>(mX.size());
+
+                    try {
+                        mX.push_back(value);
+                    }
+                    catch (...) {
+                        ASSERTV(n, size == static_cast<int>(mX.size()));
+                        ASSERTV(n, !wasInline || mX.isInline());
+                        ASSERTV(n, hasValues(mX, size));
+                        throw;
+                    }
+                    ASSERTV(n, hasValues(mX, n + 1));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+#else
+        if (verbose) printf("\nSkipped: exceptions are disabled.\n");
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Assignment gives the target the value of the source, for all
+        //:   combinations of inline and allocated storage, and keeps the
+        //:   allocator of the target.
+        //:
+        //: 2 Self-assignment has no effect.
+        //:
+        //: 3 'swap' exchanges the values of two vectors, for all combinations
+        //:   of inline and allocated storage, and, if both vectors have
+        //:   allocated storage, exchanges their buffers without allocating.
+        //:
+        //: 4 Vectors compare equal exactly when they have the same elements.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For all pairs of sizes on both sides of 't_N', assign, swap, and
+        //:   compare vectors, verifying their values and allocators.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that swapping vectors having different allocators is
+        //:   detected.  (C-5)
+        //
+        // Testing:
+        //   SmallVector& operator=(const SmallVector& rhs);
+        //   void swap(SmallVector& other);
+        //   bool operator==(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator!=(const SmallVector& lhs, const SmallVector& rhs);
+        //   void swap(SmallVector& a, SmallVector& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n===================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other", veryVeryVeryVerbose);
+
+        const int MAX_SIZE = 2 * k_N + 1;
+
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            for (int j = 0; j <= MAX_SIZE; ++j) {
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                AllocObj mY(&za);  const AllocObj& Y = mY;
+
+                for (int k = 0; k < i; ++k) {
+                    mX.push_back(AllocType(k));
+                }
+                for (int k = 0; k < j; ++k) {
+                    mY.push_back(AllocType(k + 100));
+                }
+
+                ASSERTV(i, j, (0 == i && 0 == j) == (X == Y));
+                ASSERTV(i, j, (0 == i && 0 == j) != (X != Y));
+
+                mX = Y;
+
+                ASSERTV(i, j, X == Y);
+                ASSERTV(i, j, &oa == X.allocator());
+                ASSERTV(i, j, hasValues(X, j, 100));
+
+                mX = X;
+
+                ASSERTV(i, j, hasValues(X, j, 100));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            for (int j = 0; j <= MAX_SIZE; ++j) {
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                AllocObj mY(&oa);  const AllocObj& Y = mY;
+
+                for (int k = 0; k < i; ++k) {
+                    mX.push_back(AllocType(k));
+                }
+                for (int k = 0; k < j; ++k) {
+                    mY.push_back(AllocType(k + 100));
+                }
+
+                const bool bothAllocated = !X.isInline() && !Y.isInline();
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                swap(mX, mY);
+
+                ASSERTV(i, j, hasValues(X, j, 100));
+                ASSERTV(i, j, hasValues(Y, i));
+                ASSERTV(i, j, !bothAllocated
+                                   || numAllocations == oa.numAllocations());
+
+                mX.swap(mY);
+
+                ASSERTV(i, j, hasValues(X, i));
+                ASSERTV(i, j, hasValues(Y, j, 100));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            IntObj mX(&oa);
+            IntObj mY(&oa);
+            IntObj mZ(&za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'reserve', 'shrink_to_fit', AND IN-PLACE GROWTH
+        //
+        // Concerns:
+        //: 1 'reserve' does nothing if the capacity suffices, and otherwise
+        //:   moves the elements to allocated storage of the requested
+        //:   capacity.
+        //:
+        //: 2 'shrink_to_fit' moves the elements back to the inline storage if
+        //:   they fit there, and otherwise reduces the allocated storage to
+        //:   the size of the vector.
+        //:
+        //: 3 Allocated storage (but never the inline storage) is grown in
+        //:   place when the allocator supports it.
+        //:
+        //: 4 Requests exceeding 'max_size()' throw 'std::length_error'.
+        //
+        // Plan:
+        //: 1 Reserve capacities below and above 't_N', and shrink vectors of
+        //:   various sizes, verifying the capacity, storage, values, and the
+        //:   allocations of the vector.  (C-1..2)
+        //:
+        //: 2 Grow a vector using an allocator that expands its most recent
+        //:   block in place, and verify that only the spill from the inline
+        //:   storage allocates.  (C-3)
+        //:
+        //: 3 Reserve more than 'max_size()' elements, and verify that
+        //:   'std::length_error' is thrown.  (C-4)
+        //
+        // Testing:
+        //   void reserve(size_type newCapacity);
+        //   void shrink_to_fit();
+        //   CONCERN: Allocated storage grows in place when possible.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'reserve', 'shrink_to_fit', AND IN-PLACE GROWTH"
+                            "\n==============================================="
+                            "\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'reserve'.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+
+            mX.push_back(AllocType(0));
+            mX.push_back(AllocType(1));
+
+            mX.reserve(0);
+            mX.reserve(k_N);
+            ASSERT(X.isInline());
+            ASSERT(k_N == X.capacity());
+            ASSERT(2   == oa.numBlocksInUse());  // one per element
+
+            mX.reserve(100);
+            ASSERT(!X.isInline());
+            ASSERT(100 == X.capacity());
+            ASSERT(hasValues(X, 2));
+
+            for (int i = 2; i < 100; ++i) {
+                mX.push_back(AllocType(i));
+            }
+            ASSERT(100 == X.capacity());
+            ASSERT(hasValues(X, 100));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'shrink_to_fit'.\n");
+
+        for (int n = 0; n <= 3 * k_N; ++n) {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+
+            mX.reserve(4 * k_N);
+            for (int i = 0; i < n; ++i) {
+                mX.push_back(AllocType(i));
+            }
+
+            mX.shrink_to_fit();
+
+            ASSERTV(n, (n <= k_N) == X.isInline());
+            ASSERTV(n, X.capacity() == static_cast<AllocObj::size_type>(
+                                                        n <= k_N ? k_N : n));
+            ASSERTV(n, hasValues(X, n));
+
+            mX.shrink_to_fit();
+            ASSERTV(n, hasValues(X, n));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting in-place growth.\n");
+        {
+            InPlaceTestAllocator ia;
+
+            IntObj mX(&ia);  const IntObj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(hasValues(X, 1000));
+            ASSERT(1 == ia.numAllocations());
+            ASSERT(0 <  ia.numExpansions());
+            ASSERT(0 == ia.numDeallocations());
+
+            mX.reserve(2000);
+            ASSERT(1    == ia.numAllocations());
+            ASSERT(2000 == X.capacity());
+        }
+
+        if (verbose) printf("\nTesting 'max_size'.\n");
+        {
+#ifdef BDE_BUILD_TARGET_EXC
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            bool caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(X.isInline());
+#endif
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, ERASE, RESIZE, AND ASSIGN
+        //
+        // Concerns:
+        //: 1 'insert' and 'erase' produce the expected values at every
+        //:   position, for sizes on both sides of 't_N', and 'insert' returns
+        //:   an iterator to the inserted element.
+        //:
+        //: 2 Inserting (or assigning) an element of the vector itself works,
+        //:   including when the insertion spills the elements.
+        //:
+        //: 3 'resize' and 'pop_back' remove elements, and 'resize' appends
+        //:   default-constructed (or copied) elements.
+        //:
+        //: 4 'clear' keeps the storage of the vector.
+        //
+        // Plan:
+        //: 1 For each size and position, insert one and several elements, and
+        //:   erase one and several elements, verifying the resulting values
+        //:   against expected values computed by brute force.  (C-1)
+        //:
+        //: 2 Insert the front element of full vectors, and assign the value of
+        //:   an element to its vector.  (C-2)
+        //:
+        //: 3 Resize, pop, and clear vectors, verifying their values and
+        //:   storage.  (C-3..4)
+        //
+        // Testing:
+        //   void assign(size_type numElements, const VALUE_TYPE& value);
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+        //   void insert(const_iterator pos, size_type n, const VALUE_TYPE& v);
+        //   void pop_back();
+        //   void resize(size_type newSize);
+        //   void resize(size_type newSize, const VALUE_TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, ERASE, RESIZE, AND ASSIGN"
+                            "\n=================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int MAX_SIZE = 2 * k_N + 1;
+
+        if (verbose) printf("\nTesting 'insert'.\n");
+
+        for (int n = 0; n <= MAX_SIZE; ++n) {
+            for (int pos = 0; pos <= n; ++pos) {
+                for (int count = 1; count <= k_N + 1; ++count) {
+                    AllocObj mX(&oa);  const AllocObj& X = mX;
+
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(AllocType(i));
+                    }
+
+                    if (1 == count) {
+                        AllocObj::iterator it = mX.insert(X.begin() + pos,
+                                                          AllocType(-1));
+                        ASSERTV(n, pos, X.begin() + pos == it);
+                    }
+                    else {
+                        mX.insert(X.begin() + pos, count, AllocType(-1));
+                    }
+
+                    ASSERTV(n, pos, count, n + count == (int)X.size());
+                    for (int i = 0; i < n + count; ++i) {
+                        const int expected = i < pos ? i
+                                           : i < pos + count ? -1
+                                           : i - count;
+                        ASSERTV(n, pos, count, i,
+                                expected == X[i].data());
+                        ASSERTV(n, pos, count, i,
+                                &oa == X[i].allocator());
+                    }
+                    ASSERTV(n, pos, count,
+                            (n + count <= k_N) == X.isInline());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'erase'.\n");
+
+        for (int n = 1; n <= MAX_SIZE; ++n) {
+            for (int pos = 0; pos < n; ++pos) {
+                for (int count = 0; pos + count <= n; ++count) {
+                    AllocObj mX(&oa);  const AllocObj& X = mX;
+
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(AllocType(i));
+                    }
+
+                    AllocObj::iterator it;
+                    if (1 == count) {
+                        it = mX.erase(X.begin() + pos);
+                    }
+                    else {
+                        it = mX.erase(X.begin() + pos,
+                                      X.begin() + pos + count);
+                    }
+                    ASSERTV(n, pos, count, X.begin() + pos == it);
+
+                    ASSERTV(n, pos, count, n - count == (int)X.size());
+                    for (int i = 0; i < n - count; ++i) {
+                        const int expected = i < pos ? i : i + count;
+                        ASSERTV(n, pos, count, i,
+                                expected == X[i].data());
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting aliasing.\n");
+
+        for (int n = 1; n <= MAX_SIZE; ++n) {
+            {
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+
+                for (int i = 0; i < n; ++i) {
+                    mX.push_back(AllocType(i));
+                }
+                mX.reserve(n);  // no spare capacity if allocated
+
+                mX.push_back(X.front());
+                mX.insert(X.begin(), X.back());
+                mX.insert(X.end(), 3, X[n]);
+
+                ASSERTV(n, n + 5 == (int)X.size());
+                ASSERTV(n, 0     == X[0].data());
+                ASSERTV(n, 0     == X[n + 1].data());
+                ASSERTV(n, n - 1 == X[n + 4].data());
+
+                mX.assign(n, X[1]);
+
+                ASSERTV(n, n == (int)X.size());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 0 == X[i].data());
+                }
+            }
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting 'resize', 'pop_back', and 'clear'.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+
+            mX.resize(2);
+            ASSERT(2 == X.size());
+            ASSERT(0 == X[1].data());
+            ASSERT(&oa == X[1].allocator());
+            ASSERT(X.isInline());
+
+            mX.resize(3 * k_N, AllocType(7));
+            ASSERT(3 * k_N == X.size());
+            ASSERT(7 == X.back().data());
+            ASSERT(&oa == X.back().allocator());
+            ASSERT(!X.isInline());
+
+            mX.resize(3 * k_N + 1);
+            ASSERT(0 == X.back().data());
+
+            mX.pop_back();
+            ASSERT(3 * k_N == X.size());
+
+            mX.resize(1);
+            ASSERT(1 == X.size());
+            ASSERT(0 == X.front().data());
+
+            const AllocObj::size_type capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());  // the allocated storage
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'push_back', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A vector uses the specified allocator, or the default allocator
+        //:   if none is specified, and its elements use the same allocator.
+        //:
+        //: 2 A vector having at most 't_N' elements allocates no memory (other
+        //:   than that of its elements), and its capacity is 't_N'.
+        //:
+        //: 3 Appending an element to a full vector spills the elements to
+        //:   allocated storage, with a single allocation, and the capacity
+        //:   then grows geometrically.
+        //:
+        //: 4 The constructors create vectors having the specified values, for
+        //:   sizes on both sides of 't_N'.
+        //:
+        //: 5 The element accessors give access to the elements.
+        //:
+        //: 6 The destructor destroys the elements and releases all memory.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create vectors with and without an allocator, and verify their
+        //:   allocators and states.  (C-1)
+        //:
+        //: 2 Append elements one at a time, verifying the storage, capacity,
+        //:   and values of the vector, and the allocations.  (C-2..3)
+        //:
+        //: 3 Create vectors of sizes on both sides of 't_N' with each
+        //:   constructor, and verify their values.  (C-4..6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+        //   explicit SmallVector(size_type n, bslma::Allocator *ba = 0);
+        //   SmallVector(size_type n, const VALUE_TYPE& v, Allocator *ba = 0);
+        //   SmallVector(const SmallVector& original, Allocator *ba = 0);
+        //   ~SmallVector();
+        //   reference operator[](size_type position);
+        //   reference at(size_type position);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   iterator begin();
+        //   iterator end();
+        //   void push_back(const VALUE_TYPE& value);
+        //   bslma::Allocator *allocator() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   bool isInline() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, 'push_back', AND BASIC ACCESSORS"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting default construction.\n");
+        {
+            IntObj mX;  const IntObj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+            ASSERT(k_N == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(0 <  X.max_size());
+
+            IntObj mY(&oa);  const IntObj& Y = mY;
+            ASSERT(&oa == Y.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numAllocations());
+
+        if (verbose) printf("\nTesting 'push_back'.\n");
+        {
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            for (int i = 0; i < 10 * k_N; ++i) {
+                const IntObj::size_type  capacity       = X.capacity();
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                mX.push_back(i);
+
+                ASSERTV(i, hasValues(X, i + 1));
+                ASSERTV(i, (i < k_N) == X.isInline());
+
+                // The storage is allocated exactly when the capacity changes,
+                // and the capacity then doubles.
+
+                ASSERTV(i, (capacity == X.capacity() ? 0 : 1)
+                                   == oa.numAllocations() - numAllocations);
+                ASSERTV(i, capacity == X.capacity()
+                                            || 2 * capacity == X.capacity());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+
+            for (int i = 0; i < 10 * k_N; ++i) {
+                mX.push_back(AllocType(i));
+                ASSERTV(i, hasValues(X, i + 1));
+            }
+
+            ASSERT(0 == X.front().data());
+            ASSERT(10 * k_N - 1 == X.back().data());
+            ASSERT(X.data() == X.begin());
+            ASSERT(X.end()  == X.begin() + X.size());
+
+            mX.front().setData(-1);
+            mX.back().setData(-2);
+            mX[1].setData(-3);
+            mX.at(2).setData(-4);
+            mX.data()[3].setData(-5);
+            ASSERT(-1 == X[0].data());
+            ASSERT(-2 == X[10 * k_N - 1].data());
+            ASSERT(-3 == X.at(1).data());
+            ASSERT(-4 == X[2].data());
+            ASSERT(-5 == mX.begin()[3].data());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting value constructors.\n");
+
+        for (int n = 0; n <= 2 * k_N + 1; ++n) {
+            {
+                AllocObj mX(n, &oa);  const AllocObj& X = mX;
+                ASSERTV(n, n == (int)X.size());
+                ASSERTV(n, (n <= k_N) == X.isInline());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 0   == X[i].data());
+                    ASSERTV(n, i, &oa == X[i].allocator());
+                }
+
+                AllocObj mY(n, AllocType(5), &oa);  const AllocObj& Y = mY;
+                ASSERTV(n, n == (int)Y.size());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 5   == Y[i].data());
+                    ASSERTV(n, i, &oa == Y[i].allocator());
+                }
+
+                AllocObj mZ(&oa);  const AllocObj& Z = mZ;
+                for (int i = 0; i < n; ++i) {
+                    mZ.push_back(AllocType(i));
+                }
+
+                AllocObj mW(Z);  const AllocObj& W = mW;
+                ASSERTV(n, &defaultAllocator == W.allocator());
+                ASSERTV(n, hasValues(W, n));
+                ASSERTV(n, (n <= k_N) == W.isInline());
+
+                AllocObj mV(Z, &oa);  const AllocObj& V = mV;
+                ASSERTV(n, hasValues(V, n));
+            }
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+            ASSERTV(n, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\nTesting 'at' out of range.\n");
+        {
+            IntObj mX(&oa);  const IntObj& X = mX;
+            mX.push_back(1);
+
+            bool caught = false;
+            try {
+                X.at(1);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            ASSERT_SAFE_FAIL(X[0]);
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(mX.pop_back());
+
+            mX.push_back(1);
+
+            ASSERT_SAFE_PASS(X[0]);
+            ASSERT_SAFE_FAIL(X[1]);
+            ASSERT_SAFE_PASS(X.front());
+            ASSERT_SAFE_PASS(X.back());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append elements to a vector, and verify that memory is allocated
+        //:   only when the inline storage is exhausted.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            for (int i = 0; i < k_N; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(hasValues(X, k_N));
+            ASSERT(X.isInline());
+            ASSERT(0 == oa.numAllocations());
+
+            mX.push_back(k_N);
+            ASSERT(hasValues(X, k_N + 1));
+            ASSERT(!X.isInline());
+            ASSERT(1 == oa.numAllocations());
+
+            IntObj mY(X, &oa);  const IntObj& Y = mY;
+            ASSERT(X == Y);
+
+            mY.pop_back();
+            ASSERT(X != Y);
+
+            mY.shrink_to_fit();
+            ASSERT(Y.isInline());
+            ASSERT(hasValues(Y, k_N));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1222,14 +1222,26 @@ class basic_string
         // 'newCapacity'.  Upon reallocation, copy the first specified
         // 'numChars' from the previous buffer to the new buffer, and load
         // 'storage' with the new capacity.  If '*storage >= newCapacity', this
-        // method has no effect.  Return the new buffer if reallocation, and 0
-        // otherwise.  The behavior is undefined unless 'numChars <= length()'
-        // and 'newCapacity <= max_size()'.  Note that a null-terminating
-        // character is not counted in '*storage' nor 'newCapacity'.  Also note
-        // that the previous buffer is *not* deallocated, nor is the string
-        // representation changed (in case the previous buffer may contain data
-        // that must be copied): it is the responsibility of the caller to do
-        // so upon reallocation.
+        // method has no effect.  If '*storage' is the capacity of this object
+        // and the current buffer can be extended in place (see
+        // 'privateTryExpand'), update the capacity of this object and load it
+        // into 'storage' without reallocating.  Return the new buffer if
+        // reallocation, and 0 otherwise.  The behavior is undefined unless
+        // 'numChars <= length()' and 'newCapacity <= max_size()'.  Note that
+        // a null-terminating character is not counted in '*storage' nor
+        // 'newCapacity'.  Also note that the previous buffer is *not*
+        // deallocated, nor is the string representation changed (in case the
+        // previous buffer may contain data that must be copied): it is the
+        // responsibility of the caller to do so upon reallocation.
+
+    bool privateTryExpand(size_type newCapacity);
+        // Attempt to update the capacity of this object to the specified
+        // 'newCapacity' by extending the current buffer in place (see
+        // 'bslma::Allocator::tryExpand').  Return 'true' on success, and
+        // 'false' with no effect otherwise (in particular, if this object
+        // holds a short string).  The behavior is undefined unless
+        // 'capacity() < newCapacity <= max_size()'.  Note that a
+        // null-terminating character is not counted in 'newCapacity'.
 
     basic_string& privateResizeRaw(size_type newLength, CHAR_TYPE character);
         // Change the length of this string to the specified 'newLength'.  If
@@ -3194,6 +3206,10 @@ void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReserveRaw(
         size_type newStorage = this->computeNewCapacity(newCapacity,
                                                         this->d_capacity,
                                                         max_size());
+        if (privateTryExpand(newStorage)) {
+            return;                                                   // RETURN
+        }
+
         CHAR_TYPE *newBuffer = privateAllocate(newStorage);
 
         CHAR_TRAITS::copy(newBuffer, this->dataPtr(), this->d_length + 1);
@@ -3220,9 +3236,19 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReserveRaw(
         return 0;                                                     // RETURN
     }
 
-    *storage = this->computeNewCapacity(newCapacity,
-                                        *storage,
-                                        max_size());
+    const size_type newStorage = this->computeNewCapacity(newCapacity,
+                                                          *storage,
+                                                          max_size());
+
+    // If the current buffer can be extended in place, the caller proceeds
+    // exactly as if the capacity had sufficed.
+
+    if (*storage == this->d_capacity && privateTryExpand(newStorage)) {
+        *storage = newStorage;
+        return 0;                                                     // RETURN
+    }
+
+    *storage = newStorage;
 
     CHAR_TYPE *newBuffer = privateAllocate(*storage);
 
@@ -3230,6 +3256,28 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReserveRaw(
     return newBuffer;
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+bool basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateTryExpand(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(this->d_capacity < newCapacity);
+    BSLS_ASSERT_SAFE(newCapacity <= max_size());
+
+    if (this->isShortString()) {
+        return false;                                                 // RETURN
+    }
+
+    if (this->tryExpandN(this->d_start_p,
+                         this->d_capacity + 1,
+                         newCapacity + 1)) {
+        this->d_capacity = newCapacity;
+        return true;                                                  // RETURN
+    }
+
+    return false;
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
 basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateResizeRaw(
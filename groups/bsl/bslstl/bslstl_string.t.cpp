@@ -20,6 +20,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_bslexceptionutil.h>
 
 #include <algorithm>
 #include <cctype>
@@ -254,6 +255,8 @@ using namespace std;
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
 // [25] CONCERN: 'std::length_error' is used properly
+// [30] CONCERN: growth expands storage in place when possible
+// [31] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(string *object, const char *spec, int vF = 1);
@@ -541,6 +544,104 @@ static bslma::TestAllocator *globalAllocator_p,
 static int numCopyCtorCalls    = 0;
 static int numDestructorCalls  = 0;
 
+                        // ==========================
+                        // class InPlaceTestAllocator
+                        // ==========================
+
+class InPlaceTestAllocator : public bslma::Allocator {
+    // This test allocator dispenses maximally-aligned blocks sequentially
+    // from a fixed arena, and implements 'tryExpand' by extending the most
+    // recently allocated block into the unused remainder of the arena.
+    // Deallocation has no effect other than being counted.
+
+    // PRIVATE TYPES
+    typedef bsls::AlignmentUtil::MaxAlignedType AlignedType;
+
+    enum { k_ARENA_SIZE = 16 * 1024 };
+
+    // DATA
+    AlignedType  d_arena[k_ARENA_SIZE / sizeof(AlignedType)];
+    size_type    d_cursor;             // offset of the next free byte
+    char        *d_last_p;             // most recently allocated block
+    int          d_numAllocations;     // number of 'allocate' calls
+    int          d_numDeallocations;   // number of 'deallocate' calls
+    int          d_numExpansions;      // number of successful 'tryExpand'
+
+    // PRIVATE CLASS METHODS
+    static size_type roundUp(size_type size)
+        // Return the specified 'size' rounded up to the maximal alignment.
+    {
+        return (size + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                          & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+    }
+
+    char *arena() { return reinterpret_cast<char *>(d_arena); }
+        // Return the address of the arena.
+
+  public:
+    // CREATORS
+    InPlaceTestAllocator()
+    : d_cursor(0)
+    , d_last_p(0)
+    , d_numAllocations(0)
+    , d_numDeallocations(0)
+    , d_numExpansions(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+    {
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+
+        ++d_numAllocations;
+
+        if (roundUp(size) > k_ARENA_SIZE - d_cursor) {
+            bsls::BslExceptionUtil::throwBadAlloc();
+        }
+
+        d_last_p  = arena() + d_cursor;
+        d_cursor += roundUp(size);
+        return d_last_p;
+    }
+
+    void deallocate(void *address)
+    {
+        if (address) {
+            ++d_numDeallocations;
+        }
+    }
+
+    bool tryExpand(void *address, size_type originalSize, size_type newSize)
+    {
+        ASSERT(originalSize <= newSize);
+
+        const size_type offset = d_last_p - arena();
+
+        if (address != d_last_p
+         || offset + roundUp(originalSize) != d_cursor
+         || roundUp(newSize) > k_ARENA_SIZE - offset) {
+            return false;                                             // RETURN
+        }
+
+        ++d_numExpansions;
+        d_cursor = offset + roundUp(newSize);
+        return true;
+    }
+
+    // ACCESSORS
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of calls to 'allocate' with a non-zero size.
+
+    int numDeallocations() const { return d_numDeallocations; }
+        // Return the number of calls to 'deallocate' with a non-null address.
+
+    int numExpansions() const { return d_numExpansions; }
+        // Return the number of successful calls to 'tryExpand'.
+};
+
                             // ====================
                             // class ExceptionGuard
                             // ====================
@@ -14091,7 +14192,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -14303,6 +14404,84 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING IN-PLACE GROWTH
+        //
+        // Concerns:
+        //: 1 When the allocator can expand the block holding the characters
+        //:   of a long string in place, growth by 'append' and 'reserve'
+        //:   adopts the expanded block and does not relocate the characters.
+        //:
+        //: 2 The value of the string is unaffected by the manner of growth.
+        //
+        // Plan:
+        //: 1 Using an 'InPlaceTestAllocator', append characters to a string
+        //:   until it is long, and verify that its storage is allocated once
+        //:   thereafter, and that the address of its first character does not
+        //:   change as it grows further.  (C-1..2)
+        //:
+        //: 2 Verify that 'reserve' expands the storage of a long string in
+        //:   place.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: growth expands storage in place when possible
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING IN-PLACE GROWTH"
+                            "\n=======================\n");
+
+        const Obj::size_type SHORT_CAPACITY = Obj().capacity();
+
+        if (verbose) printf("\tGrowing by 'append'.\n");
+        {
+            InPlaceTestAllocator ipa;
+
+            Obj mX(&ipa);  const Obj& X = mX;
+
+            while (X.size() <= SHORT_CAPACITY) {
+                mX.push_back('a');
+            }
+
+            ASSERT(1 == ipa.numAllocations());
+
+            const char *const DATA = X.data();
+
+            for (int i = 0; i < 2000; ++i) {
+                mX.append(1, static_cast<char>('a' + i % 26));
+            }
+
+            LOOP_ASSERT(ipa.numAllocations(), 1 == ipa.numAllocations());
+            LOOP_ASSERT(ipa.numExpansions(),  0 <  ipa.numExpansions());
+            ASSERT(DATA == X.data());
+            ASSERT(0    == X[X.size()]);
+
+            const Obj::size_type OFFSET = X.size() - 2000;
+            for (int i = 0; i < 2000; ++i) {
+                LOOP_ASSERT(i, static_cast<char>('a' + i % 26)
+                                                            == X[OFFSET + i]);
+            }
+        }
+
+        if (verbose) printf("\tGrowing by 'reserve'.\n");
+        {
+            InPlaceTestAllocator ipa;
+
+            Obj mX(SHORT_CAPACITY + 1, 'b', &ipa);  const Obj& X = mX;
+
+            ASSERT(1 == ipa.numAllocations());
+
+            const char *const DATA = X.data();
+
+            mX.reserve(1000);
+
+            LOOP_ASSERT(X.capacity(), 1000 <= X.capacity());
+            ASSERT(DATA == X.data());
+            ASSERT(1    == ipa.numAllocations());
+            ASSERT(1    == ipa.numExpansions());
+            ASSERT(Obj(SHORT_CAPACITY + 1, 'b') == X);
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING 'hashAppend'
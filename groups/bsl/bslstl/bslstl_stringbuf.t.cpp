@@ -7,6 +7,9 @@
 #include <bslma_testallocator.h>
 #include <bslma_defaultallocatorguard.h>
 
+#include <bsls_alignmentutil.h>
+#include <bsls_bslexceptionutil.h>
+
 #include <iostream>
 #include <istream>
 #include <ostream>
@@ -47,7 +50,8 @@
 // [11] OUTPUT TO STRINGBUF VIA PUBLIC INTERFACE
 // [12] INPUT FROM STRINGBUF VIA PUBLIC INTERFACE
 // [13] INPUT/OUTPUT FROM/TO STRINGBUF VIA PUBLIC INTERFACE
-// [14] USAGE EXAMPLE
+// [14] CONCERN: output expands the string in place when possible
+// [15] USAGE EXAMPLE
 // [ 1] BREATHING TEST
 
 //==========================================================================
@@ -183,6 +187,106 @@ inline void dbg_print(void* p) { printf("%p", p); fflush(stdout); }
 
 namespace {
 
+                        // ==========================
+                        // class InPlaceTestAllocator
+                        // ==========================
+
+class InPlaceTestAllocator : public BloombergLP::bslma::Allocator {
+    // This test allocator dispenses maximally-aligned blocks sequentially
+    // from a fixed arena, and implements 'tryExpand' by extending the most
+    // recently allocated block into the unused remainder of the arena.
+    // Deallocation has no effect other than being counted.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bsls::AlignmentUtil::MaxAlignedType AlignedType;
+
+    enum { k_ARENA_SIZE = 16 * 1024 };
+
+    // DATA
+    AlignedType  d_arena[k_ARENA_SIZE / sizeof(AlignedType)];
+    size_type    d_cursor;             // offset of the next free byte
+    char        *d_last_p;             // most recently allocated block
+    int          d_numAllocations;     // number of 'allocate' calls
+    int          d_numDeallocations;   // number of 'deallocate' calls
+    int          d_numExpansions;      // number of successful 'tryExpand'
+
+    // PRIVATE CLASS METHODS
+    static size_type roundUp(size_type size)
+        // Return the specified 'size' rounded up to the maximal alignment.
+    {
+        const size_type ALIGNMENT =
+                     BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+        return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    char *arena() { return reinterpret_cast<char *>(d_arena); }
+        // Return the address of the arena.
+
+  public:
+    // CREATORS
+    InPlaceTestAllocator()
+    : d_cursor(0)
+    , d_last_p(0)
+    , d_numAllocations(0)
+    , d_numDeallocations(0)
+    , d_numExpansions(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+    {
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+
+        ++d_numAllocations;
+
+        if (roundUp(size) > k_ARENA_SIZE - d_cursor) {
+            BloombergLP::bsls::BslExceptionUtil::throwBadAlloc();
+        }
+
+        d_last_p  = arena() + d_cursor;
+        d_cursor += roundUp(size);
+        return d_last_p;
+    }
+
+    void deallocate(void *address)
+    {
+        if (address) {
+            ++d_numDeallocations;
+        }
+    }
+
+    bool tryExpand(void *address, size_type originalSize, size_type newSize)
+    {
+        ASSERT(originalSize <= newSize);
+
+        const size_type offset = d_last_p - arena();
+
+        if (address != d_last_p
+         || offset + roundUp(originalSize) != d_cursor
+         || roundUp(newSize) > k_ARENA_SIZE - offset) {
+            return false;                                             // RETURN
+        }
+
+        ++d_numExpansions;
+        d_cursor = offset + roundUp(newSize);
+        return true;
+    }
+
+    // ACCESSORS
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of calls to 'allocate' with a non-zero size.
+
+    int numDeallocations() const { return d_numDeallocations; }
+        // Return the number of calls to 'deallocate' with a non-null address.
+
+    int numExpansions() const { return d_numExpansions; }
+        // Return the number of successful calls to 'tryExpand'.
+};
+
 class StringBufTest : public bsl::stringbuf
 {
 public:
@@ -736,7 +840,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -761,6 +865,58 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING IN-PLACE GROWTH
+        //
+        // Concerns:
+        //: 1 When the allocator can expand the string holding the output
+        //:   sequence in place, the stream buffer grows without reallocating
+        //:   the string.
+        //:
+        //: 2 The characters written are unaffected by the manner of growth.
+        //
+        // Plan:
+        //: 1 Using an 'InPlaceTestAllocator', write characters one at a time
+        //:   and in blocks to a 'stringbuf', and verify that the string is
+        //:   allocated once, and that the characters read back are those
+        //:   written.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: output expands the string in place when possible
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING IN-PLACE GROWTH"
+                            "\n=======================\n");
+
+        {
+            InPlaceTestAllocator ipa;
+
+            bsl::stringbuf buf(&ipa);
+
+            const char BLOCK[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+            const int  LENGTH  = static_cast<int>(sizeof BLOCK - 1);
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(LENGTH == buf.sputn(BLOCK, LENGTH));
+                ASSERT(BLOCK[i % LENGTH] == buf.sputc(BLOCK[i % LENGTH]));
+            }
+
+            LOOP_ASSERT(ipa.numAllocations(), 1 == ipa.numAllocations());
+            LOOP_ASSERT(ipa.numExpansions(),  0 <  ipa.numExpansions());
+
+            const bsl::string RESULT = buf.str();
+
+            ASSERT(100 * (LENGTH + 1) == static_cast<int>(RESULT.size()));
+
+            for (int i = 0; i < 100; ++i) {
+                const int OFFSET = i * (LENGTH + 1);
+
+                LOOP_ASSERT(i, RESULT.substr(OFFSET, LENGTH) == BLOCK);
+                LOOP_ASSERT(i, BLOCK[i % LENGTH] == RESULT[OFFSET + LENGTH]);
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING INPUT/OUTPUT FROM/TO STRINGBUF VIA PUBLIC INTERFACE
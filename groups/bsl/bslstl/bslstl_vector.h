@@ -912,6 +912,14 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // Reserve exactly the specified 'numElements'.  The behavior is
         // undefined unless this vector is empty and has no capacity.
 
+    bool privateTryExpand(size_type newSize);
+        // Attempt to grow the capacity of this vector, as if for reallocation
+        // to hold the specified 'newSize' elements, by extending its current
+        // storage in place (see 'bslma::Allocator::tryExpand').  Return
+        // 'true' if the capacity is now at least 'newSize', and 'false' with
+        // no effect otherwise.  The behavior is undefined unless
+        // 'capacity() < newSize <= max_size()'.
+
   public:
     // CREATORS
 
@@ -2339,7 +2347,7 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateInsert(
     }
 
     const size_type newSize = this->size() + n;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -2387,7 +2395,7 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateMoveInsert(
     }
 
     const size_type newSize = this->size() + n;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         const size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -2435,6 +2443,29 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateReserveEmpty(
     this->d_capacity = numElements;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateTryExpand(size_type newSize)
+{
+    BSLS_ASSERT_SAFE(this->d_capacity < newSize);
+
+    if (0 == this->d_capacity) {
+        return false;                                                 // RETURN
+    }
+
+    const size_type newCapacity = Vector_Util::computeNewCapacity(
+                                                              newSize,
+                                                              this->d_capacity,
+                                                              max_size());
+
+    if (this->tryExpandN(this->d_dataBegin, this->d_capacity, newCapacity)) {
+        this->d_capacity = newCapacity;
+        return true;                                                  // RETURN
+    }
+
+    return false;
+}
+
 // CREATORS
 
                   // *** 23.2.4.1 construct/copy/destroy: ***
@@ -2683,6 +2714,12 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::reserve(size_type newCapacity)
     if (0 == this->d_capacity && 0 != newCapacity) {
         privateReserveEmpty(newCapacity);
     }
+    else if (this->d_capacity < newCapacity
+          && this->tryExpandN(this->d_dataBegin,
+                              this->d_capacity,
+                              newCapacity)) {
+        this->d_capacity = newCapacity;
+    }
     else if (this->d_capacity < newCapacity) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
@@ -2980,7 +3017,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3059,7 +3096,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position)
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3131,7 +3168,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3209,7 +3246,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3293,7 +3330,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3383,7 +3420,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3479,7 +3516,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3572,7 +3609,7 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
@@ -3663,7 +3700,7 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::insert(const_iterator    position,
     }
 
     const size_type newSize = this->size() + numElements;
-    if (newSize > this->d_capacity) {
+    if (newSize > this->d_capacity && !privateTryExpand(newSize)) {
         size_type newCapacity = Vector_Util::computeNewCapacity(
                                                               newSize,
                                                               this->d_capacity,
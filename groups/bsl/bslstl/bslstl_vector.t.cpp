@@ -18,6 +18,7 @@
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_bslexceptionutil.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
@@ -153,10 +154,11 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [25] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 // [21] CONCERN: 'std::length_error' is used properly
 // [23] DRQS 31711031
 // [24] DRQS 34693876
+// [27] CONCERN: growth expands storage in place when possible
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(vector<T,A> *object, const char *spec, int vF = 1);
@@ -364,6 +366,104 @@ static int numCopyCtorCalls    = 0;
 static int numAssignmentCalls  = 0;
 static int numDestructorCalls  = 0;
 
+                        // ==========================
+                        // class InPlaceTestAllocator
+                        // ==========================
+
+class InPlaceTestAllocator : public bslma::Allocator {
+    // This test allocator dispenses maximally-aligned blocks sequentially
+    // from a fixed arena, and implements 'tryExpand' by extending the most
+    // recently allocated block into the unused remainder of the arena.
+    // Deallocation has no effect other than being counted.
+
+    // PRIVATE TYPES
+    typedef bsls::AlignmentUtil::MaxAlignedType AlignedType;
+
+    enum { k_ARENA_SIZE = 16 * 1024 };
+
+    // DATA
+    AlignedType  d_arena[k_ARENA_SIZE / sizeof(AlignedType)];
+    size_type    d_cursor;             // offset of the next free byte
+    char        *d_last_p;             // most recently allocated block
+    int          d_numAllocations;     // number of 'allocate' calls
+    int          d_numDeallocations;   // number of 'deallocate' calls
+    int          d_numExpansions;      // number of successful 'tryExpand'
+
+    // PRIVATE CLASS METHODS
+    static size_type roundUp(size_type size)
+        // Return the specified 'size' rounded up to the maximal alignment.
+    {
+        return (size + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                          & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+    }
+
+    char *arena() { return reinterpret_cast<char *>(d_arena); }
+        // Return the address of the arena.
+
+  public:
+    // CREATORS
+    InPlaceTestAllocator()
+    : d_cursor(0)
+    , d_last_p(0)
+    , d_numAllocations(0)
+    , d_numDeallocations(0)
+    , d_numExpansions(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+    {
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+
+        ++d_numAllocations;
+
+        if (roundUp(size) > k_ARENA_SIZE - d_cursor) {
+            bsls::BslExceptionUtil::throwBadAlloc();
+        }
+
+        d_last_p  = arena() + d_cursor;
+        d_cursor += roundUp(size);
+        return d_last_p;
+    }
+
+    void deallocate(void *address)
+    {
+        if (address) {
+            ++d_numDeallocations;
+        }
+    }
+
+    bool tryExpand(void *address, size_type originalSize, size_type newSize)
+    {
+        ASSERT(originalSize <= newSize);
+
+        const size_type offset = d_last_p - arena();
+
+        if (address != d_last_p
+         || offset + roundUp(originalSize) != d_cursor
+         || roundUp(newSize) > k_ARENA_SIZE - offset) {
+            return false;                                             // RETURN
+        }
+
+        ++d_numExpansions;
+        d_cursor = offset + roundUp(newSize);
+        return true;
+    }
+
+    // ACCESSORS
+    int numAllocations() const { return d_numAllocations; }
+        // Return the number of calls to 'allocate' with a non-zero size.
+
+    int numDeallocations() const { return d_numDeallocations; }
+        // Return the number of calls to 'deallocate' with a non-null address.
+
+    int numExpansions() const { return d_numExpansions; }
+        // Return the number of successful calls to 'tryExpand'.
+};
+
                             // ====================
                             // class ExceptionGuard
                             // ====================
@@ -9537,7 +9637,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9581,6 +9681,116 @@ int main(int argc, char *argv[])
             ASSERT(4 == m1.theValue(1, 1));
         }
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING IN-PLACE GROWTH
+        //
+        // Concerns:
+        //: 1 When the allocator can expand the block holding the elements in
+        //:   place, growth by 'push_back', 'insert', and 'reserve' adopts the
+        //:   expanded block and does not relocate the elements.
+        //:
+        //: 2 When the allocator declines to expand the block, growth
+        //:   allocates a new block and relocates the elements as before.
+        //:
+        //: 3 The value of the vector is unaffected by the manner of growth.
+        //
+        // Plan:
+        //: 1 Using an 'InPlaceTestAllocator', grow a vector by 'push_back'
+        //:   and 'insert' and verify that its storage is allocated once,
+        //:   and that the address of its first element does not change.
+        //:   (C-1, 3)
+        //:
+        //: 2 Verify that 'reserve' expands the storage of a non-empty vector
+        //:   in place.  (C-1)
+        //:
+        //: 3 Grow two vectors using the same allocator alternately, so that
+        //:   the block of only one of them can be expanded at a time, and
+        //:   verify their values.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: growth expands storage in place when possible
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING IN-PLACE GROWTH"
+                            "\n=======================\n");
+
+        if (verbose) printf("\tGrowing by 'push_back' and 'insert'.\n");
+        {
+            InPlaceTestAllocator ipa;
+
+            vector<int> mX(&ipa);  const vector<int>& X = mX;
+
+            mX.push_back(0);
+
+            const int *const DATA = X.data();
+
+            for (int i = 1; i < 1000; ++i) {
+                if (i % 2) {
+                    mX.push_back(i);
+                }
+                else {
+                    mX.insert(mX.begin(), i);
+                }
+            }
+
+            ASSERTV(X.size(), 1000 == X.size());
+            ASSERTV(DATA == X.data());
+            ASSERTV(ipa.numAllocations(),   1 == ipa.numAllocations());
+            ASSERTV(ipa.numDeallocations(), 0 == ipa.numDeallocations());
+            ASSERTV(ipa.numExpansions(),    0 <  ipa.numExpansions());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int EXP = i < 500 ? 998 - 2 * i : 2 * i - 999;
+                ASSERTV(i, X[i], EXP == X[i]);
+            }
+        }
+
+        if (verbose) printf("\tGrowing by 'reserve'.\n");
+        {
+            InPlaceTestAllocator ipa;
+
+            vector<int> mX(&ipa);  const vector<int>& X = mX;
+
+            mX.push_back(1);
+            mX.push_back(2);
+
+            const int *const DATA           = X.data();
+            const int        NUM_EXPANSIONS = ipa.numExpansions();
+
+            mX.reserve(500);
+
+            ASSERTV(X.capacity(), 500 <= X.capacity());
+            ASSERTV(DATA == X.data());
+            ASSERTV(ipa.numAllocations(), 1 == ipa.numAllocations());
+            ASSERTV(NUM_EXPANSIONS, ipa.numExpansions(),
+                    NUM_EXPANSIONS + 1 == ipa.numExpansions());
+            ASSERTV(2 == X.size());
+            ASSERTV(1 == X[0]);
+            ASSERTV(2 == X[1]);
+        }
+
+        if (verbose) printf("\tGrowing two vectors alternately.\n");
+        {
+            InPlaceTestAllocator ipa;
+
+            vector<int> mX(&ipa);  const vector<int>& X = mX;
+            vector<int> mY(&ipa);  const vector<int>& Y = mY;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.push_back(i);
+                mY.push_back(-i);
+            }
+
+            ASSERTV(1 < ipa.numAllocations());
+            ASSERTV(0 < ipa.numDeallocations());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, X[i],  i == X[i]);
+                ASSERTV(i, Y[i], -i == Y[i]);
+            }
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING HYMAN'S TEST CASE 2